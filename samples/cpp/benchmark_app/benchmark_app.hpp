@@ -208,6 +208,12 @@ static const char layout_message[] =
     "Optional. Prompts how model layouts should be treated by application. "
     "For example, \"input1[NCHW],input2[NC]\" or \"[NCHW]\" in case of one input size.";
 
+static const char replay_trace_message[] =
+    "Optional. Path to a request trace recorded from a real application run (set the OV_INFER_TRACE_RECORD"
+    " environment variable to a file path while the application is running to capture one)."
+    " The benchmark replays the recorded arrival pattern and, for dynamic models, the recorded input shapes"
+    " instead of submitting requests back-to-back; -niter and -t are ignored in this mode.";
+
 // @brief message for enabling caching
 static const char cache_dir_message[] = "Optional. Enables caching of loaded models to specified directory. "
                                         "List of devices which support caching is shown at the end of this message.";
@@ -357,6 +363,9 @@ DEFINE_string(data_shape, "", data_shape_message);
 /// @brief Define flag for layout shape <br>
 DEFINE_string(layout, "", layout_message);
 
+/// @brief Define flag for replaying a recorded request trace <br>
+DEFINE_string(replay_trace, "", replay_trace_message);
+
 /// @brief Define flag for inference precision
 DEFINE_string(infer_precision, "", inference_precision_message);
 
@@ -411,6 +420,7 @@ static void show_usage() {
     std::cout << "    -shape                        " << shape_message << std::endl;
     std::cout << "    -data_shape                   " << data_shape_message << std::endl;
     std::cout << "    -layout                       " << layout_message << std::endl;
+    std::cout << "    -replay_trace  <path>         " << replay_trace_message << std::endl;
     std::cout << "    -cache_dir  <path>            " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file               " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile           " << infer_latency_percentile_message << std::endl;
@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -252,6 +253,24 @@ int main(int argc, char* argv[]) {
             slog::info << "Model is compiled" << slog::endl;
         }
 
+        // Parse the recorded request trace before input configuration so the recorded
+        // shapes can feed the regular -data_shape machinery
+        benchmark_app::ReplayTrace replayTrace;
+        const bool isTraceReplay = !FLAGS_replay_trace.empty();
+        if (isTraceReplay) {
+            replayTrace = parse_trace_file(FLAGS_replay_trace);
+            slog::info << "Replaying trace " << FLAGS_replay_trace << " with " << replayTrace.entries.size()
+                       << " submissions" << slog::endl;
+            if (!replayTrace.data_shape_string.empty()) {
+                if (FLAGS_data_shape.empty()) {
+                    FLAGS_data_shape = replayTrace.data_shape_string;
+                } else {
+                    slog::warn << "Shapes from the trace are ignored because -data_shape is set explicitly"
+                               << slog::endl;
+                }
+            }
+        }
+
         std::vector<gflags::CommandLineFlagInfo> flags;
         StatisticsReport::Parameters command_line_arguments;
         gflags::GetAllFlags(&flags);
@@ -968,6 +987,16 @@ int main(int argc, char* argv[]) {
         }
         uint64_t duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
 
+        if (isTraceReplay) {
+            // A replay runs each recorded submission exactly once at its recorded arrival time
+            niter = replayTrace.entries.size();
+            duration_seconds = 0;
+            duration_nanoseconds = 0;
+            if (FLAGS_niter != 0 || FLAGS_t != 0) {
+                slog::warn << "-niter and -t are ignored in trace replay mode" << slog::endl;
+            }
+        }
+
         if (statistics) {
             statistics->add_parameters(
                 StatisticsReport::Category::RUNTIME_CONFIG,
@@ -1171,6 +1200,16 @@ int main(int argc, char* argv[]) {
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
                (FLAGS_api == "async" && iteration % nireq != 0)) {
+            if (isTraceReplay && iteration < replayTrace.entries.size()) {
+                // Hold the submission back until its recorded arrival moment; when the
+                // candidate build is slower than the recorded one the submissions are
+                // simply issued as soon as possible, just like a backlogged application
+                const auto arrival =
+                    startTime + std::chrono::microseconds(replayTrace.entries[iteration].arrival_us);
+                if (Time::now() < arrival) {
+                    std::this_thread::sleep_until(arrival);
+                }
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 throw ov::Exception("No idle Infer Requests!");
@@ -5,8 +5,10 @@
 #include <format_reader_ptr.h>
 
 #include <algorithm>
+#include <fstream>
 #include <map>
 #include <regex>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -885,3 +887,79 @@ std::string parameter_name_to_tensor_name(const std::string& name,
     throw std::runtime_error("Provided I/O name \"" + name +
                              "\" is not found neither in tensor names nor in nodes names.");
 }
+
+benchmark_app::ReplayTrace parse_trace_file(const std::string& path) {
+    benchmark_app::ReplayTrace trace;
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Can't open trace file: " + path);
+    }
+
+    std::string line;
+    int64_t arrival_us = 0;
+    bool has_shapes = true;
+    while (std::getline(file, line)) {
+        if (line.empty())
+            continue;
+        std::istringstream ss(line);
+        std::string kind;
+        std::string shapes;
+        int64_t gap_us = 0;
+        int64_t duration_us = 0;
+        if (!(ss >> kind >> gap_us >> duration_us >> shapes) || (kind != "sync" && kind != "async")) {
+            throw std::runtime_error("Malformed trace line: " + line);
+        }
+        benchmark_app::ReplayTraceEntry entry;
+        entry.sync = (kind == "sync");
+        arrival_us += gap_us;
+        entry.arrival_us = arrival_us;
+        entry.duration_us = duration_us;
+        if (shapes == "-") {
+            has_shapes = false;
+        } else {
+            for (const auto& input : split(shapes, ';')) {
+                auto pos = input.find('=');
+                if (pos == std::string::npos) {
+                    throw std::runtime_error("Malformed shape entry \"" + input + "\" in trace line: " + line);
+                }
+                entry.shapes[input.substr(0, pos)] = input.substr(pos + 1);
+            }
+        }
+        trace.entries.push_back(std::move(entry));
+    }
+    if (trace.entries.empty()) {
+        throw std::runtime_error("Trace file contains no submissions: " + path);
+    }
+
+    // Convert the recorded shapes into -data_shape syntax (one shape group per submission,
+    // picked up in order by the existing input configuration machinery). When every
+    // submission used the same shapes the model may well be static, so the string is left
+    // empty and only the arrival pattern is replayed.
+    const auto& first = trace.entries.front().shapes;
+    bool uniform = true;
+    for (const auto& entry : trace.entries) {
+        if (entry.shapes != first) {
+            uniform = false;
+            break;
+        }
+    }
+    if (has_shapes && !uniform) {
+        std::ostringstream data_shapes;
+        bool first_input = true;
+        for (const auto& kv : first) {
+            if (!first_input)
+                data_shapes << ",";
+            first_input = false;
+            data_shapes << kv.first;
+            for (const auto& entry : trace.entries) {
+                auto it = entry.shapes.find(kv.first);
+                if (it == entry.shapes.end()) {
+                    throw std::runtime_error("Input \"" + kv.first + "\" is missing in some trace submissions");
+                }
+                data_shapes << "[" << it->second << "]";
+            }
+        }
+        trace.data_shape_string = data_shapes.str();
+    }
+    return trace;
+}
@@ -46,8 +46,25 @@ struct InputInfo {
 };
 using InputsInfo = std::map<std::string, InputInfo>;
 using PartialShapes = std::map<std::string, ngraph::PartialShape>;
+
+/// One submission of a recorded request trace (see the OV_INFER_TRACE_RECORD runtime option)
+struct ReplayTraceEntry {
+    bool sync = false;
+    int64_t arrival_us = 0;  // offset from the first recorded submission
+    int64_t duration_us = 0;
+    std::map<std::string, std::string> shapes;  // input name -> "1,3,224,224"
+};
+
+struct ReplayTrace {
+    std::vector<ReplayTraceEntry> entries;
+    // Trace shapes converted to -data_shape syntax; empty when the trace carries no shapes
+    // or all submissions share one shape set (then replay only reproduces the arrival pattern)
+    std::string data_shape_string;
+};
 }  // namespace benchmark_app
 
+benchmark_app::ReplayTrace parse_trace_file(const std::string& path);
+
 std::vector<std::string> parse_devices(const std::string& device_string);
 uint32_t device_default_device_duration_in_seconds(const std::string& device);
 std::map<std::string, std::string> parse_value_per_device(const std::vector<std::string>& devices,
@@ -295,6 +295,44 @@ ov_infer_request_wait_for(ov_infer_request_t* infer_request, const int64_t timeo
 OPENVINO_C_API(ov_status_e)
 ov_infer_request_set_callback(ov_infer_request_t* infer_request, const ov_callback_t* callback);
 
+/**
+ * @struct ov_batch_callback_t
+ * @ingroup ov_infer_request_c_api
+ * @brief Completion callback for a batch of requests, delivering the indices of the finished requests
+ */
+typedef struct {
+    //! The callback func. Called once after the last request of the batch finished; @p finished_ids
+    //! holds the indices of the submitted requests in completion order and is valid only inside the call.
+    void(OPENVINO_C_API_CALLBACK* callback_func)(const size_t* finished_ids, size_t num_finished, void* args);
+    void* args;  //!< The args of callback func
+} ov_batch_callback_t;
+
+/**
+ * @brief Start inference of a batch of requests in asynchronous mode with a single call.
+ * @note Each submission replaces the completion callbacks of the passed requests. When @p callback
+ * is not NULL, its function is invoked once after the whole batch finished, so a foreign-function
+ * caller pays one crossing per batch instead of one per request.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_requests An array of pointers to ov_infer_request_t.
+ * @param num_requests Number of the requests in the array.
+ * @param callback A function to be called once after all requests finished, may be NULL.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_infer_request_start_async_batch(ov_infer_request_t** infer_requests,
+                                   const size_t num_requests,
+                                   const ov_batch_callback_t* callback);
+
+/**
+ * @brief Wait for the results of a batch of requests to become available with a single call.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_requests An array of pointers to ov_infer_request_t.
+ * @param num_requests Number of the requests in the array.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_infer_request_wait_batch(ov_infer_request_t** infer_requests, const size_t num_requests);
+
 /**
  * @brief Release the memory allocated by ov_infer_request_t.
  * @ingroup ov_infer_request_c_api
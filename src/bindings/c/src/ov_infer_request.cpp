@@ -3,6 +3,10 @@
 //
 #include "openvino/c/ov_infer_request.h"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "common.h"
 
 void ov_infer_request_free(ov_infer_request_t* infer_request) {
@@ -298,6 +302,80 @@ ov_status_e ov_infer_request_wait_for(ov_infer_request_t* infer_request, const i
     return ov_status_e::OK;
 }
 
+namespace {
+// Tracks the completion of a batch submitted via ov_infer_request_start_async_batch: every request
+// reports its index here and the one finishing last runs the user callback with all of them.
+struct BatchCompletionTracker {
+    std::mutex mutex;
+    std::vector<size_t> finished_ids;
+    size_t expected = 0;
+    ov_batch_callback_t callback = {};
+};
+}  // namespace
+
+ov_status_e ov_infer_request_start_async_batch(ov_infer_request_t** infer_requests,
+                                               const size_t num_requests,
+                                               const ov_batch_callback_t* callback) {
+    if (!infer_requests || num_requests == 0) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    for (size_t i = 0; i < num_requests; i++) {
+        if (!infer_requests[i]) {
+            return ov_status_e::INVALID_C_PARAM;
+        }
+    }
+
+    try {
+        if (callback && callback->callback_func) {
+            auto tracker = std::make_shared<BatchCompletionTracker>();
+            tracker->finished_ids.reserve(num_requests);
+            tracker->expected = num_requests;
+            tracker->callback = *callback;
+            for (size_t i = 0; i < num_requests; i++) {
+                infer_requests[i]->object->set_callback([tracker, i](std::exception_ptr ex) {
+                    std::unique_lock<std::mutex> lock(tracker->mutex);
+                    tracker->finished_ids.push_back(i);
+                    if (tracker->finished_ids.size() == tracker->expected) {
+                        const auto& ids = tracker->finished_ids;
+                        lock.unlock();
+                        tracker->callback.callback_func(ids.data(), ids.size(), tracker->callback.args);
+                    }
+                });
+            }
+        } else {
+            // drop the callbacks of a possible previous batched submission, so a stale
+            // tracker is not notified when the requests are reused
+            for (size_t i = 0; i < num_requests; i++) {
+                infer_requests[i]->object->set_callback([](std::exception_ptr ex) {});
+            }
+        }
+        for (size_t i = 0; i < num_requests; i++) {
+            infer_requests[i]->object->start_async();
+        }
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_infer_request_wait_batch(ov_infer_request_t** infer_requests, const size_t num_requests) {
+    if (!infer_requests || num_requests == 0) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        for (size_t i = 0; i < num_requests; i++) {
+            if (!infer_requests[i]) {
+                return ov_status_e::INVALID_C_PARAM;
+            }
+            infer_requests[i]->object->wait();
+        }
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
 ov_status_e ov_infer_request_set_callback(ov_infer_request_t* infer_request, const ov_callback_t* callback) {
     if (!infer_request || !callback) {
         return ov_status_e::INVALID_C_PARAM;
@@ -380,6 +380,47 @@ TEST_P(ov_infer_request, infer_request_set_callback) {
     }
 }
 
+TEST_P(ov_infer_request, infer_async_batch) {
+    OV_EXPECT_OK(ov_infer_request_set_input_tensor_by_index(infer_request, 0, input_tensor));
+
+    ov_infer_request_t* requests[1] = {infer_request};
+    OV_ASSERT_OK(ov_infer_request_start_async_batch(requests, 1, nullptr));
+
+    if (!HasFatalFailure()) {
+        OV_EXPECT_OK(ov_infer_request_wait_batch(requests, 1));
+
+        OV_EXPECT_OK(ov_infer_request_get_output_tensor_by_index(infer_request, 0, &output_tensor));
+        EXPECT_NE(nullptr, output_tensor);
+    }
+}
+
+inline void infer_request_batch_callback(const size_t* finished_ids, size_t num_finished, void* args) {
+    EXPECT_EQ(1, num_finished);
+    EXPECT_EQ(0, finished_ids[0]);
+
+    std::lock_guard<std::mutex> lock(ov_infer_request::m);
+    ov_infer_request::ready = true;
+    ov_infer_request::condVar.notify_one();
+}
+
+TEST_P(ov_infer_request, infer_request_batch_callback) {
+    OV_EXPECT_OK(ov_infer_request_set_input_tensor_by_index(infer_request, 0, input_tensor));
+
+    ov_batch_callback_t callback;
+    callback.callback_func = infer_request_batch_callback;
+    callback.args = nullptr;
+
+    ov_infer_request_t* requests[1] = {infer_request};
+    OV_ASSERT_OK(ov_infer_request_start_async_batch(requests, 1, &callback));
+
+    if (!HasFatalFailure()) {
+        std::unique_lock<std::mutex> lock(ov_infer_request::m);
+        ov_infer_request::condVar.wait(lock, [] {
+            return ov_infer_request::ready;
+        });
+    }
+}
+
 TEST_P(ov_infer_request, get_profiling_info) {
     auto device_name = GetParam();
     OV_EXPECT_OK(ov_infer_request_set_tensor(infer_request, in_tensor_name, input_tensor));
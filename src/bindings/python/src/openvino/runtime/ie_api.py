@@ -22,7 +22,7 @@ def tensor_from_file(path: str) -> Tensor:
     return Tensor(np.fromfile(path, dtype=np.uint8))  # type: ignore
 
 
-def set_scalar_tensor(request: InferRequestBase, tensor: Tensor, key: Union[str, int, ConstOutput] = None) -> None:
+def set_request_tensor(request: InferRequestBase, tensor: Tensor, key: Union[str, int, ConstOutput] = None) -> None:
     if key is None:
         request.set_input_tensor(tensor)
     elif isinstance(key, int):
@@ -38,6 +38,7 @@ def update_tensor(
     inputs: Union[np.ndarray, np.number, int, float],
     request: InferRequestBase,
     key: Union[str, int, ConstOutput] = None,
+    is_shared: bool = False,
 ) -> None:
     raise TypeError(f"Incompatible input data of type {type(inputs)} under {key} key!")
 
@@ -47,10 +48,11 @@ def _(
     inputs: np.ndarray,
     request: InferRequestBase,
     key: Union[str, int, ConstOutput] = None,
+    is_shared: bool = False,
 ) -> None:
     # If shape is "empty", assume this is a scalar value
     if not inputs.shape:
-        set_scalar_tensor(request, Tensor(inputs), key)
+        set_request_tensor(request, Tensor(inputs), key)
     else:
         if key is None:
             tensor = request.get_input_tensor()
@@ -60,6 +62,18 @@ def _(
             tensor = request.get_tensor(key)
         else:
             raise TypeError(f"Unsupported key type: {type(key)} for Tensor under key: {key}")
+        # A C-contiguous array that already matches the input descriptor is wrapped
+        # into a shared-memory Tensor instead of being copied element-wise. The request
+        # keeps a reference to the array (see InferRequest.infer), so the memory stays
+        # alive at least until the next inputs are set.
+        if (
+            is_shared
+            and inputs.flags["C_CONTIGUOUS"]
+            and tuple(tensor.shape) == inputs.shape
+            and tensor.data.dtype == inputs.dtype
+        ):
+            set_request_tensor(request, Tensor(inputs, shared_memory=True), key)
+            return
         # Update shape if there is a mismatch
         if tensor.shape != inputs.shape:
             tensor.shape = inputs.shape
@@ -74,19 +88,22 @@ def _(
     inputs: Union[np.number, float, int],
     request: InferRequestBase,
     key: Union[str, int, ConstOutput] = None,
+    is_shared: bool = False,
 ) -> None:
-    set_scalar_tensor(
+    set_request_tensor(
         request,
         Tensor(np.ndarray([], type(inputs), np.array(inputs))),
         key,
     )
 
 
-def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
+def normalize_inputs(request: InferRequestBase, inputs: dict, is_shared: bool = False) -> dict:
     """Helper function to prepare inputs for inference.
 
     It creates copy of Tensors or copy data to already allocated Tensors on device
     if the item is of type `np.ndarray`, `np.number`, `int`, `float` or has numpy __array__ attribute.
+    When `is_shared` is set, C-contiguous arrays matching the input descriptor are
+    wrapped into shared-memory Tensors instead of being copied.
     """
     # Create new temporary dictionary.
     # new_inputs will be used to transfer data to inference calls,
@@ -97,7 +114,7 @@ def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
             raise TypeError(f"Incompatible key type for input: {key}")
         # Copy numpy arrays to already allocated Tensors.
         if isinstance(value, (np.ndarray, np.number, int, float)):
-            update_tensor(value, request, key)
+            update_tensor(value, request, key, is_shared=is_shared)
         # If value is of Tensor type, put it into temporary dictionary.
         elif isinstance(value, Tensor):
             new_inputs[key] = value
@@ -113,7 +130,7 @@ def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
 class InferRequest(InferRequestBase):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
-    def infer(self, inputs: Any = None) -> dict:
+    def infer(self, inputs: Any = None, shared_memory: bool = True) -> dict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of InferRequest while request is running.
@@ -137,19 +154,29 @@ class InferRequest(InferRequestBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Any, optional
+        :param shared_memory: If `True`, C-contiguous numpy arrays that already match
+                              the input descriptor are wrapped into shared-memory
+                              Tensors and consumed without a copy. The request keeps
+                              a reference to the passed data, so the arrays must not
+                              be resized or deallocated while they are set as inputs.
+                              If `False`, data is always copied. Default: True
+        :type shared_memory: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
+        # Keep the inputs alive while their memory may be wrapped into shared tensors.
+        self._inputs_data = inputs if shared_memory else None
         # If inputs are empty, pass empty dictionary.
         if inputs is None:
             return super().infer({})
         # If inputs are dict, normalize dictionary and call infer method.
         elif isinstance(inputs, dict):
-            return super().infer(normalize_inputs(self, inputs))
+            return super().infer(normalize_inputs(self, inputs, is_shared=shared_memory))
         # If inputs are list or tuple, enumarate inputs and save them as dictionary.
         # It is an extension of above branch with dict inputs.
         elif isinstance(inputs, (list, tuple)):
-            return super().infer(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}))
+            return super().infer(normalize_inputs(self, {index: input for index, input in enumerate(inputs)},
+                                                  is_shared=shared_memory))
         # If inputs are Tensor, call infer method directly.
         elif isinstance(inputs, Tensor):
             return super().infer(inputs)
@@ -157,7 +184,7 @@ class InferRequest(InferRequestBase):
         # directly to Tensor or create temporary Tensor to pass into the InferRequest.
         # Pass empty dictionary to infer method, inputs are already set by helper function.
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
-            update_tensor(inputs, self)
+            update_tensor(inputs, self, is_shared=shared_memory)
             return super().infer({})
         elif hasattr(inputs, "__array__"):
             update_tensor(np.array(inputs, copy=True), self)
@@ -12,6 +12,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -193,11 +194,11 @@ void regclass_AsyncInferQueue(py::module m) {
             }
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
-            // Update inputs if there are any
-            self.m_requests[handle].m_request.set_input_tensor(inputs);
             // Now GIL can be released - we are NOT working with Python objects in this block
             {
                 py::gil_scoped_release release;
+                // Update inputs if there are any
+                self.m_requests[handle].m_request.set_input_tensor(inputs);
                 *self.m_requests[handle].m_start_time = Time::now();
                 // Start InferRequest in asynchronus mode
                 self.m_requests[handle].m_request.start_async();
@@ -239,14 +240,41 @@ void regclass_AsyncInferQueue(py::module m) {
             }
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
-            // Update inputs if there are any
-            Common::set_request_tensors(self.m_requests[handle].m_request, inputs);
+            // Gather the input tensors while still holding the GIL, so the whole
+            // submit below can run without it
+            std::vector<std::pair<ov::Output<const ov::Node>, ov::Tensor>> port_inputs;
+            std::vector<std::pair<std::string, ov::Tensor>> name_inputs;
+            std::vector<std::pair<size_t, ov::Tensor>> index_inputs;
+            for (auto&& input : inputs) {
+                auto tensor = Common::cast_to_tensor(input.second);
+                // Check if key is compatible, should be port/string/integer
+                if (py::isinstance<ov::Output<const ov::Node>>(input.first)) {
+                    port_inputs.emplace_back(input.first.cast<ov::Output<const ov::Node>>(), tensor);
+                } else if (py::isinstance<py::str>(input.first)) {
+                    name_inputs.emplace_back(input.first.cast<std::string>(), tensor);
+                } else if (py::isinstance<py::int_>(input.first)) {
+                    index_inputs.emplace_back(input.first.cast<size_t>(), tensor);
+                } else {
+                    throw py::type_error("Incompatible key type for tensor named: " + input.first.cast<std::string>());
+                }
+            }
             // Now GIL can be released - we are NOT working with Python objects in this block
             {
                 py::gil_scoped_release release;
+                auto& request = self.m_requests[handle].m_request;
+                // Update inputs if there are any
+                for (auto&& input : port_inputs) {
+                    request.set_tensor(input.first, input.second);
+                }
+                for (auto&& input : name_inputs) {
+                    request.set_tensor(input.first, input.second);
+                }
+                for (auto&& input : index_inputs) {
+                    request.set_input_tensor(input.first, input.second);
+                }
                 *self.m_requests[handle].m_start_time = Time::now();
                 // Start InferRequest in asynchronus mode
-                self.m_requests[handle].m_request.start_async();
+                request.start_async();
             }
         },
         py::arg("inputs"),
@@ -364,6 +364,23 @@ def test_infer_mixed_keys(device):
     assert np.argmax(res[model.output()]) == 9
 
 
+def test_infer_shared_memory_inputs(device):
+    core = Core()
+    model = core.read_model(test_net_xml, test_net_bin)
+    compiled_model = core.compile_model(model, device)
+    request = compiled_model.create_infer_request()
+
+    # A C-contiguous array matching the input descriptor is wrapped without a copy.
+    img = generate_image()
+    request.infer({"data": img})
+    assert np.shares_memory(request.get_input_tensor().data, img)
+
+    # With shared_memory=False the data is copied into the request's tensor.
+    img2 = generate_image()
+    request.infer({"data": img2}, shared_memory=False)
+    assert not np.shares_memory(request.get_input_tensor().data, img2)
+
+
 @pytest.mark.parametrize(("ov_type", "numpy_dtype"), [
     (Type.f32, np.float32),
     (Type.f64, np.float64),
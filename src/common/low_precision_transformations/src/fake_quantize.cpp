@@ -186,6 +186,34 @@ std::shared_ptr<opset1::FakeQuantize> FakeQuantizeTransformation::fuseElementwis
             return nullptr;
         }
 
+        inputLowConst_f32 = fq::updateShape(inputLowConst_f32, fakeQuantize->get_output_partial_shape(0));
+        inputHighConst_f32 =  fq::updateShape(inputHighConst_f32, fakeQuantize->get_output_partial_shape(0));
+    } else if (ov::is_type<opset1::Divide>(eltwise) && checkElementwise(eltwise)) {
+        // a Divide by a constant is what the pre-processing API inserts for the input scale;
+        // it is moved into the intervals the same way as a Multiply by the reciprocal value,
+        // which lets integer inputs feed the quantized graph without a float round trip
+        if (ov::is_type<opset1::Constant>(eltwise->get_input_node_shared_ptr(0))) {
+            // only the (data / constant) form can be moved into the intervals
+            return nullptr;
+        }
+
+        const auto value = foldConvert(constant, element::f32);
+
+        const auto valueVec = ov::as_type_ptr<opset1::Constant>(value)->cast_vector<float>();
+
+        if (std::any_of(valueVec.cbegin(), valueVec.cend(), [](const float value) { return value <= 0.f; })) {
+            return nullptr;
+        }
+
+        inputLowConst_f32 = fold<opset1::Multiply>(inputLowConst_f32, value);
+        inputHighConst_f32 = fold<opset1::Multiply>(inputHighConst_f32, value);
+        const auto resultLow = ov::as_type_ptr<opset1::Constant>(inputLowConst_f32)->cast_vector<float>();
+        const auto resultHigh = ov::as_type_ptr<opset1::Constant>(inputHighConst_f32)->cast_vector<float>();
+        if (std::any_of(resultLow.begin(), resultLow.end(), [](const float value){ return std::isinf(value); }) ||
+            std::any_of(resultHigh.begin(), resultHigh.end(), [](const float value){ return std::isinf(value); })) {
+            return nullptr;
+        }
+
         inputLowConst_f32 = fq::updateShape(inputLowConst_f32, fakeQuantize->get_output_partial_shape(0));
         inputHighConst_f32 =  fq::updateShape(inputHighConst_f32, fakeQuantize->get_output_partial_shape(0));
     } else if (ov::is_type<opset1::Subtract>(eltwise) && checkElementwise(eltwise)) {
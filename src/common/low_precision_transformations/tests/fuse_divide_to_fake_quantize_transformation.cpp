@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <low_precision/fake_quantize.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "layer_transformation.hpp"
+#include "simple_low_precision_transformer.hpp"
+
+namespace {
+
+using namespace testing;
+using namespace ngraph;
+using namespace ngraph::pass;
+
+class FuseDivideToFakeQuantizeTransformationTestValues {
+public:
+    class FakeQuantizeValues {
+    public:
+        ngraph::Shape constantShape;
+        std::vector<float> inputLow;
+        std::vector<float> inputHigh;
+    };
+
+    ngraph::PartialShape inputShape;
+    TestTransformationParams params;
+    ngraph::Shape divideConstantShape;
+    std::vector<float> divideValues;
+    FakeQuantizeValues actual;
+    // fused intervals; when empty the Divide is expected to stay in place
+    FakeQuantizeValues expected;
+};
+
+std::shared_ptr<ngraph::Function> getFunction(
+    const ngraph::PartialShape& inputShape,
+    const ngraph::Shape& divideConstantShape,
+    const std::vector<float>& divideValues,
+    const FuseDivideToFakeQuantizeTransformationTestValues::FakeQuantizeValues& fakeQuantizeValues) {
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, inputShape);
+
+    std::shared_ptr<Node> parent = input;
+    if (!divideValues.empty()) {
+        parent = std::make_shared<opset1::Divide>(
+            parent,
+            opset1::Constant::create(element::f32, divideConstantShape, divideValues));
+    }
+
+    const auto fakeQuantize = std::make_shared<opset1::FakeQuantize>(
+        parent,
+        opset1::Constant::create(element::f32, fakeQuantizeValues.constantShape, fakeQuantizeValues.inputLow),
+        opset1::Constant::create(element::f32, fakeQuantizeValues.constantShape, fakeQuantizeValues.inputHigh),
+        opset1::Constant::create(element::f32, ngraph::Shape{}, { 0.f }),
+        opset1::Constant::create(element::f32, ngraph::Shape{}, { 255.f }),
+        256ul);
+    fakeQuantize->set_friendly_name("fakeQuantize");
+
+    return std::make_shared<ngraph::Function>(
+        ngraph::ResultVector{ std::make_shared<opset1::Result>(fakeQuantize) },
+        ngraph::ParameterVector{ input },
+        "FuseDivideToFakeQuantizeFunction");
+}
+
+class FuseDivideToFakeQuantizeTransformation :
+    public LayerTransformation,
+    public testing::WithParamInterface<FuseDivideToFakeQuantizeTransformationTestValues> {
+public:
+    void SetUp() override {
+        const FuseDivideToFakeQuantizeTransformationTestValues testValues = GetParam();
+
+        actualFunction = getFunction(
+            testValues.inputShape,
+            testValues.divideConstantShape,
+            testValues.divideValues,
+            testValues.actual);
+
+        SimpleLowPrecisionTransformer transformer;
+        transformer.add<ngraph::pass::low_precision::FakeQuantizeTransformation, ngraph::opset1::FakeQuantize>(
+            testValues.params);
+        transformer.transform(actualFunction);
+
+        const bool fused = !testValues.expected.inputLow.empty();
+        referenceFunction = getFunction(
+            testValues.inputShape,
+            testValues.divideConstantShape,
+            fused ? std::vector<float>{} : testValues.divideValues,
+            fused ? testValues.expected : testValues.actual);
+    }
+
+    static std::string getTestCaseName(testing::TestParamInfo<FuseDivideToFakeQuantizeTransformationTestValues> obj) {
+        const FuseDivideToFakeQuantizeTransformationTestValues testValues = obj.param;
+
+        std::ostringstream result;
+        result << testValues.inputShape << "_" << testValues.divideConstantShape << "_";
+        for (const auto value : testValues.divideValues) {
+            result << value << "_";
+        }
+        result << (testValues.expected.inputLow.empty() ? "notFused" : "fused");
+        return result.str();
+    }
+};
+
+TEST_P(FuseDivideToFakeQuantizeTransformation, CompareFunctions) {
+    actualFunction->validate_nodes_and_infer_types();
+    auto res = compare_functions(actualFunction, referenceFunction, true, false, false, true, false, false);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+const std::vector<FuseDivideToFakeQuantizeTransformationTestValues> testValues = {
+    // per-tensor scale: the intervals are multiplied by the divisor
+    {
+        { 1, 3, 16, 16 },
+        LayerTransformation::createParamsU8I8(),
+        {},
+        { 2.55f },
+        { {}, { 0.f }, { 2.55f } },
+        { {}, { 0.f }, { 6.5025f } }
+    },
+    // per-channel scale: the intervals become per-channel as well
+    {
+        { 1, 3, 16, 16 },
+        LayerTransformation::createParamsU8I8(),
+        { 1, 3, 1, 1 },
+        { 0.5f, 2.f, 4.f },
+        { {}, { 0.f }, { 255.f } },
+        { { 1, 3, 1, 1 }, { 0.f, 0.f, 0.f }, { 127.5f, 510.f, 1020.f } }
+    },
+    // non-positive scale would mirror the intervals: not fused
+    {
+        { 1, 3, 16, 16 },
+        LayerTransformation::createParamsU8I8(),
+        {},
+        { -2.55f },
+        { {}, { 0.f }, { 2.55f } },
+        {}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_LPT,
+    FuseDivideToFakeQuantizeTransformation,
+    ::testing::ValuesIn(testValues),
+    FuseDivideToFakeQuantizeTransformation::getTestCaseName);
+
+}  // namespace
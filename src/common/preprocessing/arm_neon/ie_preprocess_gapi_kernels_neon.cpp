@@ -646,6 +646,13 @@ template void calcRowAreaImpl<neon_tag, float, float, int, float>(neon_tag, floa
                                                                   const Size& outSz, float yalpha, const MapperUnit32F& ymap,
                                                                   int xmaxdf, const int xindex[], const float xalpha[],
                                                                   float vbuf[]);
+
+template void convertDepthRowImpl(neon_tag, const uint8_t in[], float out[], const int length);
+template void convertDepthRowImpl(neon_tag, const uint16_t in[], float out[], const int length);
+template void convertDepthRowImpl(neon_tag, const float in[], uint8_t out[], const int length);
+
+template void subCRowImpl(neon_tag, const float in[], const float c, float out[], const int length);
+template void divCRowImpl(neon_tag, const float in[], const float c, float out[], const int length);
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -81,6 +81,21 @@ template<typename isa_tag_t, typename T, typename A, typename I, typename W>
 void calcRowAreaImpl(isa_tag_t, T dst[], const T* src[], const Size& inSz,
                      const Size& outSz, A yalpha, const MapperUnit<A, I>& ymap,
                      int xmaxdf, const I xindex[], const A xalpha[], W vbuf[]);
+
+template<typename isa_tag_t>
+void convertDepthRowImpl(isa_tag_t, const uint8_t in[], float out[], const int length);
+
+template<typename isa_tag_t>
+void convertDepthRowImpl(isa_tag_t, const uint16_t in[], float out[], const int length);
+
+template<typename isa_tag_t>
+void convertDepthRowImpl(isa_tag_t, const float in[], uint8_t out[], const int length);
+
+template<typename isa_tag_t>
+void subCRowImpl(isa_tag_t, const float in[], const float c, float out[], const int length);
+
+template<typename isa_tag_t>
+void divCRowImpl(isa_tag_t, const float in[], const float c, float out[], const int length);
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
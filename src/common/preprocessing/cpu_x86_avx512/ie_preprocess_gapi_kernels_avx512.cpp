@@ -551,6 +551,13 @@ template void calcRowAreaImpl<avx512_tag, float, float, int, float>(avx512_tag,
                                                                     const Size& outSz, float yalpha, const MapperUnit32F& ymap,
                                                                     int xmaxdf, const int xindex[], const float xalpha[],
                                                                     float vbuf[]);
+
+template void convertDepthRowImpl(avx512_tag, const uint8_t in[], float out[], const int length);
+template void convertDepthRowImpl(avx512_tag, const uint16_t in[], float out[], const int length);
+template void convertDepthRowImpl(avx512_tag, const float in[], uint8_t out[], const int length);
+
+template void subCRowImpl(avx512_tag, const float in[], const float c, float out[], const int length);
+template void divCRowImpl(avx512_tag, const float in[], const float c, float out[], const int length);
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
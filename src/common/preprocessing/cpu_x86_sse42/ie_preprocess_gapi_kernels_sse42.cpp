@@ -1292,6 +1292,13 @@ template void calcRowAreaImpl<sse42_tag, float, float, int, float>(sse42_tag, fl
                               const Size& outSz, float yalpha, const MapperUnit32F& ymap,
                               int xmaxdf, const int xindex[], const float xalpha[],
                               float vbuf[]);
+
+template void convertDepthRowImpl(sse42_tag, const uint8_t in[], float out[], const int length);
+template void convertDepthRowImpl(sse42_tag, const uint16_t in[], float out[], const int length);
+template void convertDepthRowImpl(sse42_tag, const float in[], uint8_t out[], const int length);
+
+template void subCRowImpl(sse42_tag, const float in[], const float c, float out[], const int length);
+template void divCRowImpl(sse42_tag, const float in[], const float c, float out[], const int length);
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
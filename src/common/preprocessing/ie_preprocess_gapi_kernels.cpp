@@ -1271,6 +1271,50 @@ inline p_f operator()(type_to_type<type>) {
 };
 }  // namespace
 
+namespace {
+
+template <typename src_t, typename dst_t>
+void convert_precision(const uint8_t* src, uint8_t* dst, const int width) {
+    const auto *in  = reinterpret_cast<const src_t *>(src);
+          auto *out = reinterpret_cast<dst_t *>(dst);
+
+    for (int i = 0; i < width; i++) {
+        out[i] = saturate_cast<dst_t>(in[i]);
+    }
+}
+
+// scalar counterparts of the SIMD row kernels instantiated in the ISA translation units
+inline void convertDepthRowImpl(scalar_tag, const uint8_t in[], float out[], const int length) {
+    for (int x = 0; x < length; ++x) {
+        out[x] = static_cast<float>(in[x]);
+    }
+}
+
+inline void convertDepthRowImpl(scalar_tag, const uint16_t in[], float out[], const int length) {
+    for (int x = 0; x < length; ++x) {
+        out[x] = static_cast<float>(in[x]);
+    }
+}
+
+inline void convertDepthRowImpl(scalar_tag, const float in[], uint8_t out[], const int length) {
+    for (int x = 0; x < length; ++x) {
+        out[x] = saturate_cast<uint8_t>(in[x]);
+    }
+}
+
+inline void subCRowImpl(scalar_tag, const float in[], const float c, float out[], const int length) {
+    for (int x = 0; x < length; ++x) {
+        out[x] = in[x] - c;
+    }
+}
+
+inline void divCRowImpl(scalar_tag, const float in[], const float c, float out[], const int length) {
+    for (int x = 0; x < length; ++x) {
+        out[x] = in[x] / c;
+    }
+}
+}  // namespace
+
 template <typename isa_tag_t>
 struct choose_impl {
 GAPI_FLUID_KERNEL(FChanToPlane, ChanToPlane, false) {
@@ -1854,6 +1898,94 @@ GAPI_FLUID_KERNEL(FScalePlaneArea8u, ScalePlaneArea8u, true) {
         calcAreaRow<uint8_t, areaDownscale8u::Mapper>(in, out, scratch);
     }
 };
+
+GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, int depth, cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F || src.meta().depth == CV_16U);
+        GAPI_Assert(dst.meta().depth == CV_8U || dst.meta().depth == CV_32F || dst.meta().depth == CV_16U);
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        const auto *in  = src.InLineB(0);
+              auto *out = dst.OutLineB();
+
+        auto const width = dst.length();
+        auto const src_depth = src.meta().depth;
+        auto const dst_depth = dst.meta().depth;
+
+        // the conversions that show up in preprocessing pipelines have SIMD row kernels,
+        // the remaining pairs stay scalar
+        if (src_depth == CV_8U && dst_depth == CV_32F) {
+            convertDepthRowImpl(isa_tag_t{}, in, reinterpret_cast<float*>(out), width);
+            return;
+        } else if (src_depth == CV_16U && dst_depth == CV_32F) {
+            convertDepthRowImpl(isa_tag_t{}, reinterpret_cast<const uint16_t*>(in),
+                                reinterpret_cast<float*>(out), width);
+            return;
+        } else if (src_depth == CV_32F && dst_depth == CV_8U) {
+            convertDepthRowImpl(isa_tag_t{}, reinterpret_cast<const float*>(in), out, width);
+            return;
+        }
+
+        constexpr unsigned supported_types_n = 3;
+        using p_f = void (*)( const uint8_t* src,  uint8_t* dst, const int width);
+        using table_string_t = std::array<p_f, supported_types_n>;
+
+        constexpr std::array<table_string_t, supported_types_n> func_table = {
+                table_string_t{convert_precision<uint16_t, uint16_t>, convert_precision<uint16_t, float>, convert_precision<uint16_t, uint8_t>},
+                table_string_t{convert_precision<float,    uint16_t>, convert_precision<float,    float>, convert_precision<float,    uint8_t>},
+                table_string_t{convert_precision<uint8_t,  uint16_t>, convert_precision<uint8_t,  float>, convert_precision<uint8_t,  uint8_t>}
+        };
+
+        auto depth_to_index = [](int depth){
+            switch (depth) {
+                case  CV_16U: return 0;
+                case  CV_32F: return 1;
+                case  CV_8U:  return 2;
+                default: GAPI_Assert(!"not supported depth"); return -1;
+            }
+        };
+
+        auto const src_index = depth_to_index(src_depth);
+        auto const dst_index = depth_to_index(dst_depth);
+
+        (func_table[src_index][dst_index])(in, out, width);
+    }
+};
+
+GAPI_FLUID_KERNEL(FSubC, GSubC, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, const cv::Scalar &scalar, int depth, cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_32F && src.meta().chan == 1);
+
+        const auto *in  = reinterpret_cast<const float*>(src.InLineB(0));
+              auto *out = reinterpret_cast<float*>(dst.OutLineB());
+
+        auto const width = dst.length();
+
+        subCRowImpl(isa_tag_t{}, in, static_cast<float>(scalar[0]), out, width);
+    }
+};
+
+GAPI_FLUID_KERNEL(FDivC, GDivC, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View &src, const cv::Scalar &scalar, double _scale, int /*dtype*/,
+            cv::gapi::fluid::Buffer &dst) {
+        GAPI_Assert(src.meta().depth == CV_32F && src.meta().chan == 1);
+
+        const auto *in  = reinterpret_cast<const float*>(src.InLineB(0));
+              auto *out = reinterpret_cast<float*>(dst.OutLineB());
+
+        auto const width = dst.length();
+
+        divCRowImpl(isa_tag_t{}, in, static_cast<float>(scalar[0]), out, width);
+    }
+};
 };
 
 namespace {
@@ -1893,6 +2025,9 @@ struct Split_ResizeISA {
         pckg.include<typename choose_impl<isa_tag_t>::FScalePlaneArea32f>();
         pckg.include<typename choose_impl<isa_tag_t>::FUpscalePlaneArea8u>();
         pckg.include<typename choose_impl<isa_tag_t>::FUpscalePlaneArea32f>();
+        pckg.include<typename choose_impl<isa_tag_t>::FConvertDepth>();
+        pckg.include<typename choose_impl<isa_tag_t>::FSubC>();
+        pckg.include<typename choose_impl<isa_tag_t>::FDivC>();
         //at the moment type_dispatch requires something to be returned by the lambda
         return true;
     }
@@ -1951,113 +2086,6 @@ GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
     }
 };
 
-//------------------------------------------------------------------------------
-
-namespace {
-
-template <typename src_t, typename dst_t>
-void convert_precision(const uint8_t* src, uint8_t* dst, const int width) {
-    const auto *in  = reinterpret_cast<const src_t *>(src);
-          auto *out = reinterpret_cast<dst_t *>(dst);
-
-    for (int i = 0; i < width; i++) {
-        out[i] = saturate_cast<dst_t>(in[i]);
-    }
-}
-
-}  // namespace
-
-GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
-    static const int Window = 1;
-
-    static void run(const cv::gapi::fluid::View& src, int depth, cv::gapi::fluid::Buffer& dst) {
-        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F || src.meta().depth == CV_16U);
-        GAPI_Assert(dst.meta().depth == CV_8U || dst.meta().depth == CV_32F || dst.meta().depth == CV_16U);
-        GAPI_Assert(src.meta().chan == 1);
-        GAPI_Assert(dst.meta().chan == 1);
-        GAPI_Assert(src.length() == dst.length());
-
-        constexpr unsigned supported_types_n = 3;
-        using p_f = void (*)( const uint8_t* src,  uint8_t* dst, const int width);
-        using table_string_t = std::array<p_f, supported_types_n>;
-
-        constexpr std::array<table_string_t, supported_types_n> func_table = {
-                table_string_t{convert_precision<uint16_t, uint16_t>, convert_precision<uint16_t, float>, convert_precision<uint16_t, uint8_t>},
-                table_string_t{convert_precision<float,    uint16_t>, convert_precision<float,    float>, convert_precision<float,    uint8_t>},
-                table_string_t{convert_precision<uint8_t,  uint16_t>, convert_precision<uint8_t,  float>, convert_precision<uint8_t,  uint8_t>}
-        };
-
-        auto depth_to_index = [](int depth){
-            switch (depth) {
-                case  CV_16U: return 0;
-                case  CV_32F: return 1;
-                case  CV_8U:  return 2;
-                default: GAPI_Assert(!"not supported depth"); return -1;
-            }
-        };
-        const auto *in  = src.InLineB(0);
-              auto *out = dst.OutLineB();
-
-        auto const width = dst.length();
-        auto const src_index = depth_to_index(src.meta().depth);
-        auto const dst_index = depth_to_index(dst.meta().depth);
-
-        (func_table[src_index][dst_index])(in, out, width);
-    }
-};
-
-namespace {
-    template <typename src_t, typename dst_t>
-    void sub(const uint8_t* src, uint8_t* dst, const int width, double c) {
-        const auto *in  = reinterpret_cast<const src_t *>(src);
-              auto *out = reinterpret_cast<dst_t *>(dst);
-
-        for (int i = 0; i < width; i++) {
-            out[i] = saturate_cast<dst_t>(in[i] - c);
-        }
-    }
-
-    template <typename src_t, typename dst_t>
-    void div(const uint8_t* src, uint8_t* dst, const int width, double c) {
-        const auto *in  = reinterpret_cast<const src_t *>(src);
-              auto *out = reinterpret_cast<dst_t *>(dst);
-
-        for (int i = 0; i < width; i++) {
-            out[i] = saturate_cast<dst_t>(in[i] / c);
-        }
-    }
-}  // namespace
-
-GAPI_FLUID_KERNEL(FSubC, GSubC, false) {
-    static const int Window = 1;
-
-    static void run(const cv::gapi::fluid::View& src, const cv::Scalar &scalar, int depth, cv::gapi::fluid::Buffer& dst) {
-        GAPI_Assert(src.meta().depth == CV_32F && src.meta().chan == 1);
-
-        const auto *in  = src.InLineB(0);
-              auto *out = dst.OutLineB();
-
-        auto const width = dst.length();
-
-        sub<float, float>(in, out, width, scalar[0]);
-    }
-};
-
-GAPI_FLUID_KERNEL(FDivC, GDivC, false) {
-    static const int Window = 1;
-
-    static void run(const cv::gapi::fluid::View &src, const cv::Scalar &scalar, double _scale, int /*dtype*/,
-            cv::gapi::fluid::Buffer &dst) {
-        GAPI_Assert(src.meta().depth == CV_32F && src.meta().chan == 1);
-
-        const auto *in  = src.InLineB(0);
-              auto *out = dst.OutLineB();
-
-        auto const width = dst.length();
-
-        div<float, float>(in, out, width, scalar[0]);
-    }
-};
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2069,9 +2097,6 @@ cv::gapi::GKernelPackage preprocKernels() {
         FKernelsChooseISA(),
         cv::gapi::kernels
         < FScalePlane
-        , FConvertDepth
-        , FSubC
-        , FDivC
         >());
 }
 
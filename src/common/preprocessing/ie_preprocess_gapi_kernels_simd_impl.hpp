@@ -758,6 +758,140 @@ CV_ALWAYS_INLINE void mergeRowImpl(isa_tag_t, const std::array<const T*, chs>& i
         return;
     }
 }
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void convertDepthRowImpl(isa_tag_t, const uint8_t in[], float out[], const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_float32::nlanes;
+
+    for (; length >= nlanes;) {
+        for (; x <= length - nlanes; x += nlanes) {
+            v_float32 r = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(&in[x])));
+            v_store(&out[x], r);
+        }
+
+        if (x < length) {
+            x = length - nlanes;
+            continue;
+        }
+        break;
+    }
+#endif
+
+    for (; x < length; ++x) {
+        out[x] = static_cast<float>(in[x]);
+    }
+}
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void convertDepthRowImpl(isa_tag_t, const uint16_t in[], float out[], const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_float32::nlanes;
+
+    for (; length >= nlanes;) {
+        for (; x <= length - nlanes; x += nlanes) {
+            v_float32 r = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand(&in[x])));
+            v_store(&out[x], r);
+        }
+
+        if (x < length) {
+            x = length - nlanes;
+            continue;
+        }
+        break;
+    }
+#endif
+
+    for (; x < length; ++x) {
+        out[x] = static_cast<float>(in[x]);
+    }
+}
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void convertDepthRowImpl(isa_tag_t, const float in[], uint8_t out[], const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_uint8::nlanes;
+    constexpr int flanes = v_float32::nlanes;
+
+    for (; length >= nlanes;) {
+        for (; x <= length - nlanes; x += nlanes) {
+            v_int32 i0 = v_round(vx_load(&in[x]));
+            v_int32 i1 = v_round(vx_load(&in[x + flanes]));
+            v_int32 i2 = v_round(vx_load(&in[x + 2 * flanes]));
+            v_int32 i3 = v_round(vx_load(&in[x + 3 * flanes]));
+            v_store(&out[x], v_pack_u(v_pack(i0, i1), v_pack(i2, i3)));
+        }
+
+        if (x < length) {
+            x = length - nlanes;
+            continue;
+        }
+        break;
+    }
+#endif
+
+    for (; x < length; ++x) {
+        out[x] = saturate_cast<uint8_t>(in[x]);
+    }
+}
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void subCRowImpl(isa_tag_t, const float in[], const float c, float out[], const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_float32::nlanes;
+    const v_float32 vc = vx_setall_f32(c);
+
+    for (; length >= nlanes;) {
+        for (; x <= length - nlanes; x += nlanes) {
+            v_store(&out[x], vx_load(&in[x]) - vc);
+        }
+
+        if (x < length) {
+            x = length - nlanes;
+            continue;
+        }
+        break;
+    }
+#endif
+
+    for (; x < length; ++x) {
+        out[x] = in[x] - c;
+    }
+}
+
+template<typename isa_tag_t>
+CV_ALWAYS_INLINE void divCRowImpl(isa_tag_t, const float in[], const float c, float out[], const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_float32::nlanes;
+    const v_float32 vc = vx_setall_f32(c);
+
+    for (; length >= nlanes;) {
+        for (; x <= length - nlanes; x += nlanes) {
+            v_store(&out[x], vx_load(&in[x]) / vc);
+        }
+
+        if (x < length) {
+            x = length - nlanes;
+            continue;
+        }
+        break;
+    }
+#endif
+
+    for (; x < length; ++x) {
+        out[x] = in[x] / c;
+    }
+}
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <openvino/pass/make_convolutions_streaming.hpp>
+#include <string>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+using namespace opset8;
+using namespace std;
+
+namespace {
+
+shared_ptr<Convolution> make_conv(const Output<Node>& input,
+                                  size_t kernel,
+                                  size_t pad_begin,
+                                  size_t pad_end) {
+    auto weights = make_shared<Constant>(element::f32, Shape{1, 1, kernel}, 0.1f);
+    return make_shared<Convolution>(input,
+                                    weights,
+                                    Strides{1},
+                                    CoordinateDiff{static_cast<ptrdiff_t>(pad_begin)},
+                                    CoordinateDiff{static_cast<ptrdiff_t>(pad_end)},
+                                    Strides{1});
+}
+
+}  // namespace
+
+TEST(TransformationTests, make_convolutions_streaming_causal_conv) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto X = make_shared<Parameter>(element::f32, Shape{1, 1, 8});
+        auto conv = make_conv(X, 3, 2, 0);
+        conv->set_friendly_name("conv");
+        f = make_shared<Function>(ResultVector{make_shared<Result>(conv)}, ParameterVector{X});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ov::pass::MakeConvolutionsStreaming>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto X = make_shared<Parameter>(element::f32, Shape{1, 1, 8});
+        auto variable = make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{Shape{1, 1, 2}, element::f32, "conv/streaming_context"});
+        auto const_zero = make_shared<Constant>(element::f32, Shape{1, 1, 2}, 0);
+        auto read_val = make_shared<ReadValue>(const_zero, variable);
+        auto concat = make_shared<Concat>(OutputVector{read_val, X}, 2);
+        auto conv = make_conv(concat, 3, 0, 0);
+        auto slice = make_shared<Slice>(concat,
+                                        make_shared<Constant>(element::i64, Shape{1}, -2),
+                                        make_shared<Constant>(element::i64, Shape{1}, numeric_limits<int64_t>::max()),
+                                        make_shared<Constant>(element::i64, Shape{1}, 1),
+                                        make_shared<Constant>(element::i64, Shape{1}, 2));
+        auto assign = make_shared<Assign>(slice, variable);
+        assign->add_control_dependency(read_val);
+        f_ref = make_shared<Function>(ResultVector{make_shared<Result>(conv)},
+                                      SinkVector{assign},
+                                      ParameterVector{X});
+        f_ref->validate_nodes_and_infer_types();
+    }
+    // the padded window [1, 1, 10] is now assembled from the state and the new samples
+    EXPECT_EQ(f->get_results()[0]->get_input_shape(0), (Shape{1, 1, 8}));
+    EXPECT_EQ(f->get_variables().size(), 1);
+    auto res = compare_functions(f, f_ref);
+    EXPECT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, make_convolutions_streaming_skips_symmetric_padding) {
+    std::shared_ptr<ngraph::Function> f(nullptr);
+    {
+        // a convolution padded at both ends is not causal, streaming it would add latency
+        auto X = make_shared<Parameter>(element::f32, Shape{1, 1, 8});
+        auto conv = make_conv(X, 3, 1, 1);
+        f = make_shared<Function>(ResultVector{make_shared<Result>(conv)}, ParameterVector{X});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ov::pass::MakeConvolutionsStreaming>();
+        manager.run_passes(f);
+    }
+    EXPECT_TRUE(f->get_variables().empty());
+    EXPECT_TRUE(f->get_sinks().empty());
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory mapped files
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Holds a region of a file mapped into the address space of the process.
+ * The mapping is released when the last owner of the object is destroyed.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /// \brief Returns a pointer to the beginning of the mapped region
+    virtual char* data() noexcept = 0;
+
+    /// \brief Returns the size of the mapped region in bytes
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into memory for reading
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory
+ * @throws std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file with the wide char name into memory for reading
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory
+ * @throws std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
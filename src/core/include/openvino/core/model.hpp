@@ -10,6 +10,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "openvino/core/any.hpp"
@@ -172,6 +173,12 @@ public:
     std::vector<std::shared_ptr<ov::Node>> get_ordered_ops() const;
     void map_unordered_ops(std::function<void(ov::Node*)> f) const;
 
+    /// \brief Fills `types` with the type info of every operation in the model. The set is
+    /// maintained together with the topological sort cache, so while the model is unchanged
+    /// repeated calls are cheap; returns false (leaving `types` untouched) when the cache is
+    /// stale and the set would have to be recomputed via get_ordered_ops().
+    bool get_cached_op_types(std::unordered_set<ov::DiscreteTypeInfo>& types) const;
+
     // updates graph and m_results list
     void replace_node(std::shared_ptr<ov::Node> old, std::shared_ptr<ov::Node> repl);
 
@@ -537,6 +544,11 @@ private:
     /// model and registers them, otherwise checks all the Parameters are registered.
     void prerequirements(bool detect_variables, bool detect_parameters);
 
+    /// \brief Folds the pending splices recorded by sanctioned local graph edits
+    /// (see ov::replace_node) into m_cached_ordered_ops instead of a full re-sort.
+    /// Resets the topological cache when a splice cannot be applied.
+    void apply_pending_splices() const;
+
     static std::atomic<size_t> m_next_instance_id;
     std::string m_name;
     const std::string m_unique_name;
@@ -559,6 +571,10 @@ private:
     mutable std::unordered_map<std::string, Output<Node>> m_cached_output_names;
     mutable std::unordered_map<std::string, std::weak_ptr<Node>> m_cached_op_names;
 
+    // Type info of every operation in the graph; rebuilt together with m_cached_ordered_ops
+    // and valid under the same condition (see SharedRTInfo::get_use_topological_cache).
+    mutable std::unordered_set<ov::DiscreteTypeInfo> m_cached_op_types;
+
     // Private runtime info which is shared across nodes and used only
     // for internal purposes.
     std::shared_ptr<SharedRTInfo> m_shared_rt_info;
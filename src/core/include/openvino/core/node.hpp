@@ -6,7 +6,6 @@
 
 #include <atomic>
 #include <cstring>
-#include <deque>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -32,6 +31,7 @@
 #include "openvino/core/node_vector.hpp"
 #include "openvino/core/rtti.hpp"
 #include "openvino/core/runtime_attribute.hpp"
+#include "openvino/core/small_stable_vector.hpp"
 #include "openvino/core/strides.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/op/util/attr_types.hpp"
@@ -110,6 +110,30 @@ std::string node_validation_failure_loc_string(const Node* node);
 
 class NodeAccessor;
 
+/**
+ * @brief Scoped deferred-validation mode for model construction.
+ *
+ * While at least one scope is alive on the current thread, every node validated by its
+ * constructor is marked as up to date and revalidate_and_infer_types() becomes a no-op for such
+ * nodes, so a full-model validation running at the end of the construction (e.g. from the Model
+ * constructor) only touches the nodes that were actually edited after creation. Replacing a node
+ * input or changing a producer output type/shape clears the mark. The mode is meant for
+ * frontends, where the graph is built topologically and nodes are not mutated behind the
+ * validation's back; outside an active scope validation behaves as usual.
+ * @ingroup ov_model_cpp_api
+ */
+class OPENVINO_API DeferredValidationScope {
+public:
+    DeferredValidationScope();
+    ~DeferredValidationScope();
+
+    DeferredValidationScope(const DeferredValidationScope&) = delete;
+    DeferredValidationScope& operator=(const DeferredValidationScope&) = delete;
+
+    /// \brief Returns true if at least one scope is alive on the current thread.
+    static bool active();
+};
+
 /**
  * @brief Nodes are the backbone of the graph of Value dataflow. Every node has
  * zero or more nodes as arguments and one value, which is either a tensor
@@ -131,6 +155,11 @@ class OPENVINO_API Node : public std::enable_shared_from_this<Node> {
     friend class Model;
     // To fix collisions in generated friendly name
     friend class pass::ResolveNameCollisions;
+    // For access to m_shared_rt_info, to repair the model topological order caches in place
+    // instead of invalidating them on a local replacement.
+    friend OPENVINO_API void replace_node(const std::shared_ptr<Node>& target,
+                                          const std::shared_ptr<Node>& replacement,
+                                          const std::vector<int64_t>& output_order);
 
 protected:
     descriptor::Input& get_input_descriptor(size_t position);
@@ -179,6 +208,13 @@ protected:
     /// function to mark value-irrelevant inputs.
     void set_input_is_relevant_to_value(size_t i, bool relevant = true);
 
+    /// \brief Drops the up-to-date mark recorded under a DeferredValidationScope. Setters of
+    /// attributes that affect output types or shapes must call this, so a later
+    /// revalidate_and_infer_types() is not skipped for the edited node.
+    void mark_validation_dirty() {
+        m_validation_clean = false;
+    }
+
 public:
     /// \brief Verifies that attributes and inputs are consistent and computes output shapes
     /// and element types. Must be implemented by concrete child classes so that it
@@ -276,6 +312,10 @@ public:
 
     void invalidate_values();
     virtual void revalidate_and_infer_types() {
+        // under a deferred-validation scope the construction-time result is still valid unless
+        // the node was edited afterwards (see DeferredValidationScope)
+        if (m_validation_clean && DeferredValidationScope::active())
+            return;
         invalidate_values();
         validate_and_infer_types();
     }
@@ -499,8 +539,15 @@ private:
     mutable std::string m_unique_name;
     mutable std::atomic_bool m_name_changing{false};
     static std::atomic<size_t> m_next_instance_id;
-    std::deque<descriptor::Input> m_inputs;
-    std::deque<descriptor::Output> m_outputs;
+    // Most ops have a handful of inputs and a single output, so the descriptors are stored
+    // inline in the node and a heap allocation happens only for wider ops. The container keeps
+    // element addresses stable: descriptor::Input holds a raw pointer into the producer's
+    // m_outputs.
+    detail::SmallStableVector<descriptor::Input, 4> m_inputs;
+    detail::SmallStableVector<descriptor::Output, 2> m_outputs;
+    // True when the construction-time validation ran under a DeferredValidationScope and the
+    // node was not edited since; only honored while such a scope is active
+    bool m_validation_clean = false;
     OPENVINO_SUPPRESS_DEPRECATED_START
     std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
     OPENVINO_SUPPRESS_DEPRECATED_END
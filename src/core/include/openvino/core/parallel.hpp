@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 #define OV_THREAD_TBB      0
 #define OV_THREAD_OMP      1
@@ -46,6 +47,7 @@
 #    include "tbb/parallel_reduce.h"
 #    include "tbb/parallel_sort.h"
 #    include "tbb/task_arena.h"
+#    include "tbb/task_group.h"
 #    include "tbb/task_scheduler_observer.h"
 
 inline int parallel_get_max_threads() {
@@ -82,7 +84,10 @@ inline int parallel_get_env_threads() {
 
 #    include <algorithm>
 #    include <cstdlib>
+#    include <functional>
+#    include <mutex>
 #    include <string>
+#    include <vector>
 
 /* MSVC still supports omp 2.0 only */
 #    if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
@@ -202,6 +207,92 @@ void parallel_sort(I begin, I end, const F& comparator) {
 #endif
 }
 
+/**
+ * @brief A lightweight task group for kernels with irregular parallelism which cannot be expressed
+ * as a flat parallel_for (dependency chains, ragged work lists, recursive decomposition).
+ *
+ * Tasks spawned via run() may execute concurrently with each other and with the caller, and a task
+ * may spawn further tasks on the same group. wait() returns once every task spawned so far has
+ * completed and may be called repeatedly to build fork-join phases. On the TBB backends the tasks
+ * go through tbb::task_group, so idle worker threads steal them; on the OpenMP backend the spawned
+ * tasks are executed by a task region at the synchronization point; the sequential build runs each
+ * task immediately inside run().
+ *
+ * Concurrent run() calls from inside tasks are safe; concurrent run()/wait() from unrelated threads
+ * are not, mirroring the semantics of tbb::task_group. On the OpenMP backend a task must not leak
+ * exceptions.
+ */
+class task_group {
+public:
+    task_group() = default;
+    task_group(const task_group&) = delete;
+    task_group& operator=(const task_group&) = delete;
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    template <typename F>
+    void run(F&& task) {
+        _group.run(std::forward<F>(task));
+    }
+
+    void wait() {
+        _group.wait();
+    }
+
+private:
+    tbb::task_group _group;
+#elif OV_THREAD == OV_THREAD_OMP
+    template <typename F>
+    void run(F&& task) {
+#    if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
+        // MSVC implements OpenMP 2.0 which has no tasking support
+        task();
+#    else
+        if (omp_in_parallel()) {
+            // spawned from inside the task region opened by wait(): submit as a nested task
+            std::function<void()> fn(std::forward<F>(task));
+#        pragma omp task firstprivate(fn)
+            fn();
+        } else {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks.emplace_back(std::forward<F>(task));
+        }
+#    endif
+    }
+
+    void wait() {
+#    if !defined(_MSC_VER) || defined(__INTEL_COMPILER)
+        std::vector<std::function<void()>> tasks;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            tasks.swap(_tasks);
+        }
+        if (tasks.empty())
+            return;
+
+#        pragma omp parallel
+#        pragma omp single nowait
+        {
+            for (size_t i = 0; i < tasks.size(); ++i) {
+#        pragma omp task shared(tasks) firstprivate(i)
+                tasks[i]();
+            }
+        }
+#    endif
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::function<void()>> _tasks;
+#elif OV_THREAD == OV_THREAD_SEQ
+    template <typename F>
+    void run(F&& task) {
+        task();
+    }
+
+    void wait() {}
+#endif
+};
+
 template <typename T0, typename R, typename F>
 R parallel_sum(const T0& D0, const R& input, const F& func) {
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
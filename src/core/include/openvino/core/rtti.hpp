@@ -16,6 +16,7 @@
     _OPENVINO_HIDDEN_METHOD static const ::ov::DiscreteTypeInfo& get_type_info_static() { \
         static ::ov::DiscreteTypeInfo type_info_static{TYPE_NAME, 0, VERSION_NAME};       \
         type_info_static.hash();                                                          \
+        type_info_static.type_id();                                                       \
         return type_info_static;                                                          \
     }                                                                                     \
     const ::ov::DiscreteTypeInfo& get_type_info() const override {                        \
@@ -32,6 +33,7 @@
                                                        VERSION_NAME,                                 \
                                                        &PARENT_CLASS::get_type_info_static()};       \
         type_info_static.hash();                                                                     \
+        type_info_static.type_id();                                                                  \
         return type_info_static;                                                                     \
     }                                                                                                \
     const ::ov::DiscreteTypeInfo& get_type_info() const override {                                   \
@@ -0,0 +1,182 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ov {
+namespace detail {
+
+/// \brief A sequence container with inline storage for the first N elements and stable
+///        element addresses.
+///
+/// The first N elements are constructed in a buffer embedded into the container itself, so no
+/// heap allocation happens for sequences that fit the inline capacity; longer sequences spill
+/// into a lazily created deque. Unlike std::vector, growing the container never relocates
+/// already constructed elements, which makes it a drop-in replacement for the std::deque
+/// members of ov::Node where raw pointers into the sequence are held across appends
+/// (see ov::descriptor::Input::m_output), without the per-container heap allocations a deque
+/// performs even when empty.
+///
+/// Only the operations needed by ov::Node are provided: append, indexed access, clear, copy
+/// and forward iteration. Elements are never erased individually.
+template <typename T, size_t N>
+class SmallStableVector {
+    template <typename Container, typename Value>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator(Container* container, size_t index) : m_container{container}, m_index{index} {}
+
+        reference operator*() const {
+            return (*m_container)[m_index];
+        }
+        pointer operator->() const {
+            return &(*m_container)[m_index];
+        }
+        Iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator tmp{*this};
+            ++m_index;
+            return tmp;
+        }
+        bool operator==(const Iterator& other) const {
+            return m_container == other.m_container && m_index == other.m_index;
+        }
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        Container* m_container;
+        size_t m_index;
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iterator<SmallStableVector, T>;
+    using const_iterator = Iterator<const SmallStableVector, const T>;
+
+    SmallStableVector() = default;
+
+    SmallStableVector(const SmallStableVector& other) {
+        *this = other;
+    }
+
+    SmallStableVector& operator=(const SmallStableVector& other) {
+        if (this != &other) {
+            clear();
+            for (const auto& value : other) {
+                emplace_back(value);
+            }
+        }
+        return *this;
+    }
+
+    ~SmallStableVector() {
+        clear();
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    T& operator[](size_t index) {
+        return index < N ? inline_element(index) : (*m_overflow)[index - N];
+    }
+
+    const T& operator[](size_t index) const {
+        return index < N ? inline_element(index) : (*m_overflow)[index - N];
+    }
+
+    T& at(size_t index) {
+        range_check(index);
+        return (*this)[index];
+    }
+
+    const T& at(size_t index) const {
+        range_check(index);
+        return (*this)[index];
+    }
+
+    /// \brief Constructs an element at the end. Addresses of existing elements are preserved.
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        T* element;
+        if (m_size < N) {
+            element = new (&m_inline_storage[m_size]) T(std::forward<Args>(args)...);
+        } else {
+            if (!m_overflow) {
+                m_overflow.reset(new std::deque<T>());
+            }
+            m_overflow->emplace_back(std::forward<Args>(args)...);
+            element = &m_overflow->back();
+        }
+        ++m_size;
+        return *element;
+    }
+
+    void clear() {
+        const size_t inline_size = m_size < N ? m_size : N;
+        for (size_t i = inline_size; i > 0; --i) {
+            inline_element(i - 1).~T();
+        }
+        m_overflow.reset();
+        m_size = 0;
+    }
+
+    iterator begin() {
+        return iterator{this, 0};
+    }
+    iterator end() {
+        return iterator{this, m_size};
+    }
+    const_iterator begin() const {
+        return const_iterator{this, 0};
+    }
+    const_iterator end() const {
+        return const_iterator{this, m_size};
+    }
+
+private:
+    T& inline_element(size_t index) {
+        return *reinterpret_cast<T*>(&m_inline_storage[index]);
+    }
+
+    const T& inline_element(size_t index) const {
+        return *reinterpret_cast<const T*>(&m_inline_storage[index]);
+    }
+
+    void range_check(size_t index) const {
+        if (index >= m_size) {
+            throw std::out_of_range("SmallStableVector: index out of range");
+        }
+    }
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type m_inline_storage[N];
+    // Elements past the inline capacity live here; a deque keeps their addresses stable too.
+    std::unique_ptr<std::deque<T>> m_overflow;
+    size_t m_size = 0;
+};
+
+}  // namespace detail
+}  // namespace ov
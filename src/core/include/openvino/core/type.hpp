@@ -50,14 +50,16 @@ struct OPENVINO_API DiscreteTypeInfo {
           version(0),
           version_id(_version_id),
           parent(_parent),
-          hash_value(0) {}
+          hash_value(0),
+          type_id_value(0) {}
 
     constexpr DiscreteTypeInfo(const char* _name, uint64_t _version, const DiscreteTypeInfo* _parent = nullptr)
         : name(_name),
           version(_version),
           version_id(nullptr),
           parent(_parent),
-          hash_value(0) {}
+          hash_value(0),
+          type_id_value(0) {}
 
     constexpr DiscreteTypeInfo(const char* _name,
                                uint64_t _version,
@@ -67,7 +69,8 @@ struct OPENVINO_API DiscreteTypeInfo {
           version(_version),
           version_id(_version_id),
           parent(_parent),
-          hash_value(0) {}
+          hash_value(0),
+          type_id_value(0) {}
     OPENVINO_SUPPRESS_DEPRECATED_END
 
     bool is_castable(const DiscreteTypeInfo& target_type) const;
@@ -87,8 +90,17 @@ struct OPENVINO_API DiscreteTypeInfo {
     size_t hash() const;
     size_t hash();
 
+    // Process-wide unique integer identifier of this type, interned on first request (the
+    // OPENVINO_RTTI machinery requests it once per type, so opset registration assigns it for
+    // all registered ops). Two infos that compare equal get the same identifier, which turns
+    // operator== between interned infos into a single integer comparison instead of strcmp or
+    // hashing. The non-const overload additionally caches the identifier in the object.
+    size_t type_id() const;
+    size_t type_id();
+
 private:
     size_t hash_value;
+    size_t type_id_value;
 };
 
 OPENVINO_API
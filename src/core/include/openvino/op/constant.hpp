@@ -230,6 +230,13 @@ public:
     OPENVINO_DEPRECATED("Use Constant c-tor with shape argument instead")
     void set_data_shape(const Shape& shape);
 
+    /// \brief Return a hash of the raw constant data
+    ///
+    /// The hash is computed lazily on the first call and cached; any non-const access
+    /// to the data invalidates the cached value. Model hashing relies on it so that
+    /// hashing the same constants repeatedly does not re-read the whole payload.
+    uint64_t get_data_hash() const;
+
     /// \brief Return data size in bytes
     size_t get_byte_size() const {
         return m_data->size();
@@ -560,6 +567,7 @@ private:
     void allocate_buffer(bool memset_allocation);
 
     void* get_data_ptr_nc() {
+        m_data_hash_calculated = false;
         return (m_data ? m_data->get_ptr() : nullptr);
     }
 
@@ -745,6 +753,8 @@ private:
     std::shared_ptr<ngraph::runtime::AlignedBuffer> m_data;
     mutable std::atomic_bool m_all_elements_bitwise_identical{false};
     mutable std::atomic_bool m_all_elements_bitwise_identical_checked{false};
+    mutable std::atomic<uint64_t> m_data_hash{0};
+    mutable std::atomic_bool m_data_hash_calculated{false};
     bool m_alloc_buffer_on_visit_attributes = true;
 };
 }  // namespace v0
@@ -40,6 +40,8 @@ public:
         return m_partial_shape;
     }
     PartialShape& get_partial_shape() {
+        // the caller may edit the shape through the reference
+        mark_validation_dirty();
         return m_partial_shape;
     }
 
@@ -49,6 +51,7 @@ public:
         return m_element_type;
     }
     void set_element_type(const element::Type& element_type) {
+        mark_validation_dirty();
         m_element_type = element_type;
     }
 
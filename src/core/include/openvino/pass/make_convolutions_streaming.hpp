@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/pass/pass.hpp"
+
+namespace ov {
+namespace pass {
+/**
+ * @brief The transformation converts causally padded convolutions into streaming form backed by
+ * ReadValue/Assign state.
+ *
+ * For every Convolution or GroupConvolution whose last spatial dimension is padded only at the
+ * beginning (pads_begin > 0, pads_end == 0), the padding is replaced with a variable that keeps
+ * the trailing pads_begin samples of the previous call's input; the state is concatenated in
+ * front of the new input and the convolution runs unpadded. After the model input is reshaped to
+ * the hop size, each inference processes only the new samples while the convolution stack sees a
+ * continuous signal, so a sliding-window audio front-end stops recomputing the whole window on
+ * every hop.
+ * \ingroup ov_pass_cpp_api
+ */
+class OPENVINO_API MakeConvolutionsStreaming : public ModelPass {
+public:
+    OPENVINO_RTTI("MakeConvolutionsStreaming");
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+};
+}  // namespace pass
+}  // namespace ov
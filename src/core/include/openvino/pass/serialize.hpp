@@ -30,7 +30,12 @@ public:
     enum class Version : uint8_t {
         UNSPECIFIED = 0,  // Use the latest or function version
         IR_V10 = 10,      // v10 IR
-        IR_V11 = 11       // v11 IR
+        IR_V11 = 11,      // v11 IR
+        // v11 IR content stored in the compact binary encoding instead of XML text. The encoding
+        // is a length-prefixed dump of the same layer/attribute structure, constants are aligned
+        // in the bin file for mapping, and the IR frontend reads it back without text parsing,
+        // which makes it preferable for caching scenarios.
+        IR_V11_BINARY = 111
     };
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
 
@@ -31,6 +31,18 @@ void jit_convert_vec<uint8_t, float16>(jit::Generator& gen, const Xbyak::RegExp&
     gen.movdqu(gen.xword[dst], f16vec);
 }
 
+template <>
+void jit_convert_vec<uint8_t, float>(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
+    auto u8vec = gen.xmm1;
+    auto i32vec = gen.ymm2;
+    auto fvec = gen.ymm3;
+
+    gen.movq(u8vec, gen.qword[src]);
+    gen.vpmovzxbd(i32vec, u8vec);
+    gen.vcvtdq2ps(fvec, i32vec);
+    gen.vmovups(gen.yword[dst], fvec);
+}
+
 template <>
 void jit_convert_vec<float16, float>(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
     auto f16vec = gen.xmm3;
@@ -41,6 +53,17 @@ void jit_convert_vec<float16, float>(jit::Generator& gen, const Xbyak::RegExp& s
     gen.vmovups(gen.yword[dst], f32vec);
 }
 
+template <>
+void jit_convert_vec<float, float16>(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
+    auto f32vec = gen.ymm2;
+    auto f16vec = gen.xmm3;
+
+    gen.vmovups(f32vec, gen.yword[src]);
+    gen.vcvtps2ph(f16vec, f32vec, 0);
+    gen.vzeroupper();
+    gen.movdqu(gen.xword[dst], f16vec);
+}
+
 template <>
 void jit_convert_vec_prepare<float, int8_t>(jit::Generator& gen) {
     auto order = gen.ymm1;
@@ -199,11 +222,21 @@ void convert<uint8_t, float16>(const uint8_t* arg, float16* out, size_t count) {
     convert_impl(arg, out, count);
 }
 
+template <>
+void convert<uint8_t, float>(const uint8_t* arg, float* out, size_t count) {
+    convert_impl(arg, out, count);
+}
+
 template <>
 void convert<float16, float>(const float16* arg, float* out, size_t count) {
     convert_impl(arg, out, count);
 }
 
+template <>
+void convert<float, float16>(const float* arg, float16* out, size_t count) {
+    convert_impl(arg, out, count);
+}
+
 template <>
 void convert<float, int8_t>(const float* arg, int8_t* out, size_t count) {
     convert_impl(arg, out, count);
@@ -39,6 +39,10 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
     m_output = &new_output;
     m_src_node = std::shared_ptr<ngraph::Node>(new_output.get_node());
 
+    // the consumer reads from another producer now, so its construction-time validation is no
+    // longer up to date (see DeferredValidationScope)
+    m_node->m_validation_clean = false;
+
     // Output replacement may change the topological order of nodes,
     // so we have to reset cache by setting a flag into shared node info.
     for_each(m_node->m_shared_rt_info.cbegin(),
@@ -61,6 +61,23 @@ bool check_all_digits(const std::string& value) {
 Dimension::value_type dimension_length(Interval::value_type vt) {
     return vt == Interval::s_max ? -1 : vt;
 }
+
+// Single-value counterparts of the clipping helpers in interval.cpp: when both operands of an
+// arithmetic operator are static, the result is combined with one int64 operation instead of
+// the double-bound interval math. Static values are always within [0, s_max).
+Dimension::value_type clip_add_static(Dimension::value_type a, Dimension::value_type b) {
+    return b > Interval::s_max - a ? Interval::s_max : a + b;
+}
+
+Dimension::value_type clip_minus_static(Dimension::value_type a, Dimension::value_type b) {
+    return a <= b ? 0 : a - b;
+}
+
+Dimension::value_type clip_times_static(Dimension::value_type a, Dimension::value_type b) {
+    if (a == 0 || b == 0)
+        return 0;
+    return a > Interval::s_max / b ? Interval::s_max : a * b;
+}
 }  // namespace
 
 std::ostream& ov::operator<<(std::ostream& str, const Dimension& dimension) {
@@ -132,12 +149,16 @@ Dimension Dimension::operator+(const Dimension& dim) const {
         return *this;
     else if (m_dimension == 0)
         return dim;
+    else if (is_static() && dim.is_static())
+        return Dimension(clip_add_static(m_dimension.get_min_val(), dim.m_dimension.get_min_val()));
     return Dimension(m_dimension + dim.m_dimension);
 }
 
 Dimension Dimension::operator-(const Dimension& dim) const {
     if (dim.m_dimension == 0)
         return *this;
+    else if (is_static() && dim.is_static())
+        return Dimension(clip_minus_static(m_dimension.get_min_val(), dim.m_dimension.get_min_val()));
     return Dimension(m_dimension - dim.m_dimension);
 }
 
@@ -157,6 +178,8 @@ Dimension Dimension::operator*(const Dimension& dim) const {
         return *this;
     else if (m_dimension == 1)
         return dim;
+    else if (is_static() && dim.is_static())
+        return Dimension(clip_times_static(m_dimension.get_min_val(), dim.m_dimension.get_min_val()));
     return Dimension(m_dimension * dim.m_dimension);
 }
 
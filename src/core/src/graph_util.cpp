@@ -4,6 +4,7 @@
 
 #include "ngraph/graph_util.hpp"
 
+#include <functional>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
@@ -28,6 +29,7 @@
 #include "ngraph/rt_info.hpp"
 #include "ngraph/util.hpp"
 #include "openvino/core/descriptor/tensor.hpp"
+#include "shared_node_info.hpp"
 
 using namespace std;
 
@@ -126,6 +128,74 @@ void ov::replace_node(const std::shared_ptr<Node>& target,
     // Fix input/output descriptors
     NGRAPH_CHECK(target->get_output_size() == replacement->get_output_size());
 
+    // A match-sized local replacement keeps the cached topological order of the models
+    // repairable: when the nodes standing behind `replacement` are new to the model and read
+    // only from the target or its ancestors, they belong right after the target in the cached
+    // order. Detect this case and record the edit as a pending splice (applied lazily by
+    // Model::get_ordered_ops) instead of discarding the whole cache.
+    std::set<std::shared_ptr<SharedRTInfo>> cached_infos;
+    for (const auto& info : target->m_shared_rt_info) {
+        if (info->get_use_topological_cache())
+            cached_infos.insert(info);
+    }
+    std::vector<std::shared_ptr<Node>> spliced_nodes;
+    bool repairable = !cached_infos.empty() && target->m_control_dependents.empty() &&
+                      target->get_control_dependencies().empty();
+    if (repairable) {
+        // Nodes which may legally produce values for the spliced subgraph: the target and a
+        // bounded set of its ancestors. Hitting the bound makes the check conservatively fail.
+        constexpr size_t search_limit = 64;
+        std::unordered_set<Node*> ancestors{target.get()};
+        std::vector<Node*> stack{target.get()};
+        while (!stack.empty() && ancestors.size() < search_limit) {
+            auto* ancestor = stack.back();
+            stack.pop_back();
+            for (const auto& input_value : ancestor->input_values()) {
+                if (ancestors.insert(input_value.get_node()).second)
+                    stack.push_back(input_value.get_node());
+            }
+        }
+        // Post-order DFS over the new nodes, so `spliced_nodes` comes out topologically sorted.
+        std::unordered_set<Node*> visited;
+        std::function<bool(const std::shared_ptr<Node>&)> visit = [&](const std::shared_ptr<Node>& node) -> bool {
+            size_t tracked = 0;
+            for (const auto& info : cached_infos)
+                tracked += node->m_shared_rt_info.count(info);
+            if (tracked == cached_infos.size()) {
+                // An existing producer must already precede the target in the cached order
+                return ancestors.count(node.get()) != 0;
+            }
+            if (tracked != 0)
+                return false;  // tracked by some of the caches only, play safe
+            for (const auto& info : cached_infos) {
+                // A node waiting in an earlier splice has no known position relative
+                // to this target yet, play safe
+                if (info->has_pending_node(node.get()))
+                    return false;
+            }
+            if (!visited.insert(node.get()).second)
+                return true;
+            if (visited.size() > search_limit)
+                return false;
+            for (const auto& input_value : node->input_values()) {
+                if (!visit(input_value.get_node_shared_ptr()))
+                    return false;
+            }
+            for (const auto& dep : node->get_control_dependencies()) {
+                if (!visit(dep))
+                    return false;
+            }
+            spliced_nodes.push_back(node);
+            return true;
+        };
+        repairable = visit(replacement);
+    }
+
+    if (repairable) {
+        for (const auto& info : cached_infos)
+            info->begin_sanctioned_edit();
+    }
+
     // For each of target's output O with replacement output O_rep:
     //     For each O's connected downstream input I:
     //         Change I's connected upstream output to O_rep
@@ -136,6 +206,13 @@ void ov::replace_node(const std::shared_ptr<Node>& target,
     replacement->add_node_control_dependents(target);
     replacement->add_node_control_dependencies(target);
     target->clear_control_dependents();
+
+    if (repairable) {
+        for (const auto& info : cached_infos) {
+            info->end_sanctioned_edit();
+            info->add_pending_splice({target, spliced_nodes});
+        }
+    }
 }
 
 void ov::replace_node(const std::shared_ptr<Node>& target, const OutputVector& replacement_values) {
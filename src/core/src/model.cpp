@@ -260,10 +260,76 @@ void ov::Model::validate_nodes_and_infer_types() const {
     }
 }
 
+void ov::Model::apply_pending_splices() const {
+    auto splices = m_shared_rt_info->take_pending_splices();
+
+    std::unordered_map<Node*, size_t> positions;
+    positions.reserve(m_cached_ordered_ops.size());
+    for (size_t i = 0; i < m_cached_ordered_ops.size(); ++i) {
+        if (auto node = m_cached_ordered_ops[i].lock())
+            positions[node.get()] = i;
+    }
+
+    std::vector<NodeVector> insertions(m_cached_ordered_ops.size());
+    std::unordered_set<Node*> anchors;
+    for (auto& splice : splices) {
+        const auto anchor = positions.find(splice.anchor.get());
+        if (anchor == positions.end()) {
+            // The anchor left the cached order in a way we cannot track,
+            // fall back to the full sort
+            m_shared_rt_info->set_use_topological_cache(false);
+            return;
+        }
+        anchors.insert(splice.anchor.get());
+        auto& at_anchor = insertions[anchor->second];
+        at_anchor.insert(at_anchor.end(), splice.new_nodes.begin(), splice.new_nodes.end());
+    }
+
+    // Roots stay in the order even while they temporarily have no consumers
+    std::unordered_set<Node*> roots;
+    for (const auto& result : get_results())
+        roots.insert(result.get());
+    for (const auto& sink : get_sinks())
+        roots.insert(sink.get());
+    for (const auto& param : get_parameters())
+        roots.insert(param.get());
+
+    auto has_consumers = [](const shared_ptr<Node>& node) {
+        for (const auto& output : node->outputs()) {
+            if (!output.get_target_inputs().empty())
+                return true;
+        }
+        return false;
+    };
+
+    std::vector<std::weak_ptr<Node>> updated;
+    updated.reserve(m_cached_ordered_ops.size());
+    for (size_t i = 0; i < m_cached_ordered_ops.size(); ++i) {
+        if (auto node = m_cached_ordered_ops[i].lock()) {
+            // A replaced node which lost all its consumers is no longer a part of the model
+            if (!anchors.count(node.get()) || roots.count(node.get()) || has_consumers(node))
+                updated.emplace_back(node);
+        }
+        for (const auto& spliced : insertions[i]) {
+            updated.emplace_back(spliced);
+            m_cached_op_types.insert(spliced->get_type_info());
+            spliced->insert_info(m_shared_rt_info);
+        }
+    }
+    m_cached_ordered_ops = std::move(updated);
+    m_cached_output_names.clear();
+    m_cached_op_names.clear();
+}
+
 std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::get_ordered_ops");
     lock_guard<mutex> lock(m_model_mutex);
 
+    if (m_shared_rt_info->get_use_topological_cache() && m_shared_rt_info->has_pending_splices()) {
+        // Local edits whose placement in the order is known are folded in without a re-sort
+        apply_pending_splices();
+    }
+
     NodeVector nodes;
     if (m_shared_rt_info->get_use_topological_cache()) {
         for (const auto& node : m_cached_ordered_ops) {
@@ -289,8 +355,10 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     // Update nodes cache and update all nodes to have shared rt info
     // which belongs to the current Model.
     m_cached_ordered_ops.clear();
+    m_cached_op_types.clear();
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
         m_cached_ordered_ops.push_back(node);
+        m_cached_op_types.insert(node->get_type_info());
         node->insert_info(m_shared_rt_info);
     });
     m_cached_output_names.clear();
@@ -300,6 +368,18 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     return order;
 }
 
+bool ov::Model::get_cached_op_types(std::unordered_set<ov::DiscreteTypeInfo>& types) const {
+    lock_guard<mutex> lock(m_model_mutex);
+    if (m_shared_rt_info->get_use_topological_cache() && m_shared_rt_info->has_pending_splices()) {
+        // Pending splices may bring types which are not in the cache yet
+        apply_pending_splices();
+    }
+    if (!m_shared_rt_info->get_use_topological_cache())
+        return false;
+    types = m_cached_op_types;
+    return true;
+}
+
 void ov::Model::map_unordered_ops(std::function<void(Node*)> f) const {
     std::unordered_set<Node*> unordered_ops;
     std::stack<Node*, std::vector<Node*>> remaining_ops;
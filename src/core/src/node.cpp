@@ -79,11 +79,10 @@ ov::Node::Node(const OutputVector& arguments, size_t output_size) : Node() {
 
 ov::Node::~Node() {
     try {
-        // raise a flag to reset nodes cache
-        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
-            info->set_use_topological_cache(false);
-        });
-
+        // Note: node destruction doesn't reset the nodes cache. Removing a node never breaks
+        // the relative order of the remaining nodes, and the cache keeps weak pointers, so an
+        // expiring node silently drops out of the cached order. Edits which keep nodes alive
+        // while detaching them from the model invalidate the cache at the editing point.
         for (descriptor::Input& input : m_inputs) {
             if (input.has_output()) {
                 // This test adds 1 to the actual count, so a count of 2 means this input is the only
@@ -203,7 +202,24 @@ ov::descriptor::Output& ov::Node::get_output_descriptor(size_t position) {
     return m_outputs[position];
 }
 
+namespace {
+thread_local int deferred_validation_depth = 0;
+}  // namespace
+
+ov::DeferredValidationScope::DeferredValidationScope() {
+    ++deferred_validation_depth;
+}
+
+ov::DeferredValidationScope::~DeferredValidationScope() {
+    --deferred_validation_depth;
+}
+
+bool ov::DeferredValidationScope::active() {
+    return deferred_validation_depth > 0;
+}
+
 void ov::Node::set_argument(size_t position, const Output<Node>& argument) {
+    m_validation_clean = false;
     auto output_node = argument.get_node();
     auto& output_descriptor = output_node->m_outputs.size() > argument.get_index()
                                   ? output_node->m_outputs.at(argument.get_index())
@@ -220,6 +236,9 @@ void ov::Node::set_argument(size_t position, const Output<Node>& argument) {
 
 void ov::Node::constructor_validate_and_infer_types() {
     validate_and_infer_types();
+    // under a deferred-validation scope the result is recorded as up to date, so the
+    // end-of-construction model validation does not repeat it (see DeferredValidationScope)
+    m_validation_clean = DeferredValidationScope::active();
 }
 
 void ov::Node::set_output_size(size_t n) {
@@ -254,8 +273,17 @@ void ov::Node::set_input_is_relevant_to_value(size_t i, bool relevant) {
 }
 
 void ov::Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape) {
+    auto& output_descriptor = get_output_descriptor(i);
+    const auto& tensor = output_descriptor.get_tensor_ptr();
+    // a changed output invalidates the recorded construction-time validation of every consumer
+    // (see DeferredValidationScope)
+    if (tensor->get_element_type() != element_type || tensor->get_partial_shape() != pshape) {
+        for (auto* input : output_descriptor.get_inputs()) {
+            input->get_raw_pointer_node()->m_validation_clean = false;
+        }
+    }
     OPENVINO_SUPPRESS_DEPRECATED_START
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    tensor->set_tensor_type(element_type, pshape);
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
 
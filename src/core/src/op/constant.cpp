@@ -211,6 +211,11 @@ ov::op::v0::Constant::Constant(const Constant& other) {
     m_shape = other.m_shape;
     m_data = other.m_data;
     update_identical_flags(other.m_all_elements_bitwise_identical_checked, other.m_all_elements_bitwise_identical);
+    if (other.m_data_hash_calculated) {
+        // the buffer is shared, so the memoized data hash stays valid for the copy
+        m_data_hash = other.m_data_hash.load();
+        m_data_hash_calculated = true;
+    }
     constructor_validate_and_infer_types();
 }
 
@@ -222,6 +227,11 @@ ov::op::v0::Constant::Constant(const Constant& other, const ov::Shape& new_shape
     m_shape = new_shape;
     m_data = other.m_data;
     update_identical_flags(other.m_all_elements_bitwise_identical_checked, other.m_all_elements_bitwise_identical);
+    if (other.m_data_hash_calculated) {
+        // the buffer is shared, so the memoized data hash stays valid for the copy
+        m_data_hash = other.m_data_hash.load();
+        m_data_hash_calculated = true;
+    }
     constructor_validate_and_infer_types();
 }
 
@@ -532,6 +542,29 @@ void ov::op::v0::Constant::update_identical_flags(bool is_checked, bool identica
     m_all_elements_bitwise_identical = identical_value;
 }
 
+uint64_t ov::op::v0::Constant::get_data_hash() const {
+    if (m_data_hash_calculated) {
+        return m_data_hash;
+    }
+    const auto size = m_data ? m_data->size() : 0;
+    // Same streaming combine the serializer uses for constant deduplication; the buffer
+    // is at least word aligned, so reading it as 64-bit cells is safe
+    constexpr auto cel_size = sizeof(uint64_t);
+    uint64_t seed = static_cast<uint64_t>(size);
+    const auto* data = static_cast<const uint64_t*>(get_data_ptr());
+    const auto* d_end = std::next(data, size / cel_size);
+    for (const auto* d = data; d != d_end; ++d) {
+        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    uint64_t last_bytes{0};
+    std::memcpy(&last_bytes, d_end, size % cel_size);
+    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+
+    m_data_hash = seed;
+    m_data_hash_calculated = true;
+    return seed;
+}
+
 bool ov::op::v0::Constant::visit_attributes(AttributeVisitor& visitor) {
     OV_OP_SCOPE(v0_Constant_visit_attributes);
     ov::Shape prev_shape = m_shape;
@@ -546,6 +579,7 @@ bool ov::op::v0::Constant::visit_attributes(AttributeVisitor& visitor) {
     }
     visitor.on_attribute("value", m_data);
     update_identical_flags(false, false);
+    m_data_hash_calculated = false;
     return true;
 }
 
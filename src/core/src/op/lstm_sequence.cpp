@@ -9,6 +9,7 @@
 #include "ngraph/builder/autobroadcast.hpp"
 #include "ngraph/builder/reshape.hpp"
 #include "ngraph/builder/split.hpp"
+#include "lstm_sequence_shape_inference.hpp"
 #include "ngraph/op/util/recurrent_sequence.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "ngraph/opsets/opset4.hpp"
@@ -347,47 +348,9 @@ shared_ptr<Node> op::v5::LSTMSequence::clone_with_new_inputs(const OutputVector&
 
 void op::v5::LSTMSequence::validate_and_infer_types() {
     OV_OP_SCOPE(v5_LSTMSequence_validate_and_infer_types);
-    for (const auto& input : inputs()) {
-        if (input.get_partial_shape().rank().is_dynamic()) {
-            set_output_type(0, get_input_element_type(0), ov::PartialShape::dynamic());
-            set_output_type(1, get_input_element_type(0), ov::PartialShape::dynamic());
-            set_output_type(2, get_input_element_type(0), ov::PartialShape::dynamic());
-            return;
-        }
-    }
-    std::vector<ov::PartialShape> input_param{};
-
-    auto lstm_seq_gates_count = 4;
-    auto merged_batch_size = Dimension::dynamic();
-    auto merged_hidden_size = Dimension::dynamic();
-    auto merged_num_directions = Dimension::dynamic();
-    auto result_et = element::dynamic;
-
-    // Copy all inputs without initial_cell_state information for further validation
-    for (size_t i = 0; i < get_input_size(); i++) {
-        // exclude initial_cell_state from the loop
-        if (i != 2) {
-            input_param.push_back(get_input_partial_shape(i));
-        }
-    }
-
-    // Get input partial shape for all inputs
-    const auto& x_pshape = get_input_partial_shape(0);
-    const auto& ht_pshape = get_input_partial_shape(1);
-    const auto& ct_pshape = get_input_partial_shape(2);
-    const auto& sl_pshape = get_input_partial_shape(3);
-    const auto& w_pshape = get_input_partial_shape(4);
-    const auto& r_pshape = get_input_partial_shape(5);
-    const auto& b_pshape = get_input_partial_shape(6);
-
-    ngraph::op::util::validate_seq_input_rank_dimension(input_param);
-
-    // Validate rank and dimension for initial_cell_state input
-    NODE_VALIDATION_CHECK(this,
-                          (ct_pshape.rank().get_length() == 3),
-                          "LSTMSequence input tensor initial_cell_state shall have dimension 3D.");
 
     // Validate input types and save result for output type
+    auto result_et = element::dynamic;
     NODE_VALIDATION_CHECK(this,
                           element::Type::merge(result_et, result_et, get_input_element_type(0)) &&
                               element::Type::merge(result_et, result_et, get_input_element_type(1)) &&
@@ -399,90 +362,15 @@ void op::v5::LSTMSequence::validate_and_infer_types() {
                           "not "
                           "match.");
 
-    // Merge batch_size dimension across all inputs to evaluate output[0] dimension
-    NODE_VALIDATION_CHECK(this,
-                          Dimension::merge(merged_batch_size, merged_batch_size, ht_pshape[0]) &&
-                              Dimension::merge(merged_batch_size, merged_batch_size, ct_pshape[0]) &&
-                              Dimension::merge(merged_batch_size, merged_batch_size, x_pshape[0]) &&
-                              Dimension::merge(merged_batch_size, merged_batch_size, sl_pshape[0]),
-                          "Parameter batch_size not matched in LSTMSequence.");
-
-    // Merge hidden_size dimension across all inputs to evaluate output dimension
-    NODE_VALIDATION_CHECK(this,
-                          Dimension::merge(merged_hidden_size, merged_hidden_size, ht_pshape[2]) &&
-                              Dimension::merge(merged_hidden_size, merged_hidden_size, ct_pshape[2]) &&
-                              Dimension::merge(merged_hidden_size, merged_hidden_size, r_pshape[2]),
-                          "Parameter hidden_size not matched LSTMSequence.");
-
-    // Merge num_directions dimension across all inputs to evaluate output dimension
-    NODE_VALIDATION_CHECK(this,
-                          Dimension::merge(merged_num_directions, merged_num_directions, ht_pshape[1]) &&
-                              Dimension::merge(merged_num_directions, merged_num_directions, ct_pshape[1]) &&
-                              Dimension::merge(merged_num_directions, merged_num_directions, w_pshape[0]) &&
-                              Dimension::merge(merged_num_directions, merged_num_directions, r_pshape[0]) &&
-                              Dimension::merge(merged_num_directions, merged_num_directions, b_pshape[0]),
-                          "Parameter num_directions not matched in LSTMSequence.");
-
-    auto valid_num_directions = 0;
-    if (m_direction == op::RecurrentSequenceDirection::FORWARD ||
-        m_direction == op::RecurrentSequenceDirection::REVERSE) {
-        valid_num_directions = 1;
-    } else if (m_direction == op::RecurrentSequenceDirection::BIDIRECTIONAL) {
-        valid_num_directions = 2;
-    } else {
-        // Guard for potential future extension of RecurrentSequenceDirection enum
-        NODE_VALIDATION_CHECK(this, false, "Parameter direction must be FORWARD or REVERSE or BIDIRECTIONAL.");
-    }
-
-    NODE_VALIDATION_CHECK(this,
-                          Dimension::merge(merged_num_directions, merged_num_directions, valid_num_directions),
-                          "Parameter 'num_directions' doesn't match with direction '",
-                          m_direction,
-                          "' in LSTMSequence. Expected ",
-                          valid_num_directions,
-                          ", actual ",
-                          merged_num_directions);
-
-    // Validate hidden_size value for W, R, B inputs
-    if (merged_hidden_size.is_static()) {
-        if (w_pshape[1].is_static()) {
-            NODE_VALIDATION_CHECK(this,
-                                  w_pshape[1].compatible(merged_hidden_size * lstm_seq_gates_count),
-                                  "Parameter hidden_size mistmatched in W input. Current value is: ",
-                                  w_pshape[1].get_length(),
-                                  ", expected: ",
-                                  merged_hidden_size.get_length() * lstm_seq_gates_count,
-                                  ".");
-        }
-
-        if (r_pshape[1].is_static()) {
-            NODE_VALIDATION_CHECK(this,
-                                  r_pshape[1].compatible(merged_hidden_size * lstm_seq_gates_count),
-                                  "Parameter hidden_size mistmatched in R input. Current value is: ",
-                                  r_pshape[1].get_length(),
-                                  ", expected: ",
-                                  merged_hidden_size.get_length() * lstm_seq_gates_count,
-                                  ".");
-        }
-
-        if (b_pshape[1].is_static()) {
-            NODE_VALIDATION_CHECK(this,
-                                  b_pshape[1].compatible(merged_hidden_size * lstm_seq_gates_count),
-                                  "Parameter hidden_size mistmatched in B input. Current value is: ",
-                                  b_pshape[1].get_length(),
-                                  ", expected: ",
-                                  merged_hidden_size.get_length() * lstm_seq_gates_count,
-                                  ".");
-        }
-    }
-
-    // Mark inputs which are relevant to output parameters
-    for (size_t i = 0; i <= 6; ++i)
-        set_input_is_relevant_to_shape(i);
+    const auto input_shapes = get_node_input_partial_shapes(*this);
+    std::vector<ov::PartialShape> output_shapes = {ov::PartialShape::dynamic(4),
+                                                   ov::PartialShape::dynamic(3),
+                                                   ov::PartialShape::dynamic(3)};
+    shape_infer(this, input_shapes, output_shapes);
 
     // Set output size, type and shape
     set_output_size(3);
-    set_output_type(0, result_et, {merged_batch_size, merged_num_directions, x_pshape[1], merged_hidden_size});
-    set_output_type(1, result_et, {merged_batch_size, merged_num_directions, merged_hidden_size});
-    set_output_type(2, result_et, {merged_batch_size, merged_num_directions, merged_hidden_size});
+    set_output_type(0, result_et, output_shapes[0]);
+    set_output_type(1, result_et, output_shapes[1]);
+    set_output_type(2, result_et, output_shapes[2]);
 }
@@ -64,6 +64,7 @@ void op::Parameter::set_partial_shape(const PartialShape& partial_shape) {
                     " with layout ",
                     get_layout().to_string(),
                     ". Layout is not compatible with shape");
+    mark_validation_dirty();
     m_partial_shape = partial_shape;
 }
 
@@ -11,6 +11,7 @@
 #include "itt.hpp"
 #include "ngraph/op/util/recurrent_sequence.hpp"
 #include "ngraph/opsets/opset4.hpp"
+#include "rnn_sequence_shape_inference.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -41,30 +42,9 @@ op::v5::RNNSequence::RNNSequence(const Output<Node>& X,
 
 void op::v5::RNNSequence::validate_and_infer_types() {
     OV_OP_SCOPE(v5_RNNSequence_validate_and_infer_types);
-    for (const auto& input : inputs()) {
-        if (input.get_partial_shape().rank().is_dynamic()) {
-            set_output_type(0, get_input_element_type(0), ov::PartialShape::dynamic());
-            set_output_type(1, get_input_element_type(0), ov::PartialShape::dynamic());
-            return;
-        }
-    }
-
-    auto rnn_seq_gates_count = 1;
-    auto merged_batch_size = Dimension::dynamic();
-    auto merged_hidden_size = Dimension::dynamic();
-    auto merged_num_directions = Dimension::dynamic();
-    auto result_et = element::dynamic;
-
-    auto x_pshape = get_input_partial_shape(0);
-    auto ht_pshape = get_input_partial_shape(1);
-    auto sl_pshape = get_input_partial_shape(2);
-    auto w_pshape = get_input_partial_shape(3);
-    auto r_pshape = get_input_partial_shape(4);
-    auto b_pshape = get_input_partial_shape(5);
-
-    ngraph::op::util::validate_seq_input_rank_dimension({x_pshape, ht_pshape, sl_pshape, w_pshape, r_pshape, b_pshape});
 
     // Validate input types and save result for output type
+    auto result_et = element::dynamic;
     NODE_VALIDATION_CHECK(this,
                           element::Type::merge(result_et, result_et, get_input_element_type(0)) &&
                               element::Type::merge(result_et, result_et, get_input_element_type(1)) &&
@@ -74,88 +54,14 @@ void op::v5::RNNSequence::validate_and_infer_types() {
                           "Element types for X, initial_hidden_state, W, R and B inputs do not "
                           "match.");
 
-    // Merge batch_size dimension across all inputs to evaluate output[0] dimension
-    NODE_VALIDATION_CHECK(this,
-                          Dimension::merge(merged_batch_size, merged_batch_size, ht_pshape[0]) &&
-                              Dimension::merge(merged_batch_size, merged_batch_size, x_pshape[0]) &&
-                              Dimension::merge(merged_batch_size, merged_batch_size, sl_pshape[0]),
-                          "Parameter batch_size not matched in RNNSequence.");
-
-    // Merge hidden_size dimension across all inputs to evaluate output dimension
-    NODE_VALIDATION_CHECK(this,
-                          Dimension::merge(merged_hidden_size, merged_hidden_size, ht_pshape[2]) &&
-                              Dimension::merge(merged_hidden_size, merged_hidden_size, r_pshape[2]),
-                          "Parameter hidden_size not matched RNNSequence.");
-
-    // Merge num_directions dimension across all inputs to evaluate output dimension
-    NODE_VALIDATION_CHECK(this,
-                          Dimension::merge(merged_num_directions, merged_num_directions, ht_pshape[1]) &&
-                              Dimension::merge(merged_num_directions, merged_num_directions, w_pshape[0]) &&
-                              Dimension::merge(merged_num_directions, merged_num_directions, r_pshape[0]) &&
-                              Dimension::merge(merged_num_directions, merged_num_directions, b_pshape[0]),
-                          "Parameter num_directions not matched in RNNSequence.");
-
-    auto valid_num_directions = 0;
-    if (m_direction == op::RecurrentSequenceDirection::FORWARD ||
-        m_direction == op::RecurrentSequenceDirection::REVERSE) {
-        valid_num_directions = 1;
-    } else if (m_direction == op::RecurrentSequenceDirection::BIDIRECTIONAL) {
-        valid_num_directions = 2;
-    } else {
-        // Guard for potential future extension of RecurrentSequenceDirection enum
-        NODE_VALIDATION_CHECK(this, false, "Parameter direction must be FORWARD or REVERSE or BIDIRECTIONAL.");
-    }
-
-    NODE_VALIDATION_CHECK(this,
-                          Dimension::merge(merged_num_directions, merged_num_directions, valid_num_directions),
-                          "Parameter 'num_directions' doesn't match with direction '",
-                          m_direction,
-                          "' in RNNSequence. Expected ",
-                          valid_num_directions,
-                          ", actual ",
-                          merged_num_directions);
-
-    // Validate hidden_size value for W, R, B inputs
-    if (merged_hidden_size.is_static()) {
-        if (w_pshape[1].is_static()) {
-            NODE_VALIDATION_CHECK(this,
-                                  w_pshape[1].compatible(merged_hidden_size * rnn_seq_gates_count),
-                                  "Parameter hidden_size mistmatched in W input. Current value is: ",
-                                  w_pshape[1].get_length(),
-                                  ", expected: ",
-                                  merged_hidden_size.get_length() * rnn_seq_gates_count,
-                                  ".");
-        }
-
-        if (r_pshape[1].is_static()) {
-            NODE_VALIDATION_CHECK(this,
-                                  r_pshape[1].compatible(merged_hidden_size * rnn_seq_gates_count),
-                                  "Parameter hidden_size mistmatched in R input. Current value is: ",
-                                  r_pshape[1].get_length(),
-                                  ", expected: ",
-                                  merged_hidden_size.get_length() * rnn_seq_gates_count,
-                                  ".");
-        }
-
-        if (b_pshape[1].is_static()) {
-            NODE_VALIDATION_CHECK(this,
-                                  b_pshape[1].compatible(merged_hidden_size * rnn_seq_gates_count),
-                                  "Parameter hidden_size mistmatched in B input. Current value is: ",
-                                  b_pshape[1].get_length(),
-                                  ", expected: ",
-                                  merged_hidden_size.get_length() * rnn_seq_gates_count,
-                                  ".");
-        }
-    }
-
-    // Mark inputs which are relevant to output parameters
-    for (size_t i = 0; i <= 5; ++i)
-        set_input_is_relevant_to_shape(i);
+    const auto input_shapes = get_node_input_partial_shapes(*this);
+    std::vector<ov::PartialShape> output_shapes = {ov::PartialShape::dynamic(4), ov::PartialShape::dynamic(3)};
+    shape_infer(this, input_shapes, output_shapes);
 
     // Set output size, type and shape
     set_output_size(2);
-    set_output_type(0, result_et, {merged_batch_size, merged_num_directions, x_pshape[1], merged_hidden_size});
-    set_output_type(1, result_et, {merged_batch_size, merged_num_directions, merged_hidden_size});
+    set_output_type(0, result_et, output_shapes[0]);
+    set_output_type(1, result_et, output_shapes[1]);
 }
 
 bool op::v5::RNNSequence::visit_attributes(AttributeVisitor& visitor) {
@@ -51,6 +51,34 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+/**
+ * \brief Release constants consumed only by an already folded node.
+ *
+ * A folded node is detached from the model but stays alive until the pass finishes iterating over
+ * the ops list, and keeps its input constants alive with it. Re-pointing inputs of the dead node to
+ * a scalar placeholder drops the original buffers right away, which keeps peak memory close to the
+ * final model size when long weight-transform chains (e.g. transpose/convert over each FC weight)
+ * are folded.
+ *
+ * \param node  Folded node to detach from its input constants.
+ */
+const auto release_inputs_of_folded_node = [](const std::shared_ptr<ov::Node>& node) {
+    for (const auto& output : node->outputs()) {
+        // Some outputs were not replaced, so the node is still a part of the model
+        if (!output.get_target_inputs().empty())
+            return;
+    }
+
+    for (auto&& input : node->inputs()) {
+        const auto source = input.get_source_output();
+        if (!ov::is_type<ov::op::v0::Constant>(source.get_node()) || source.get_target_inputs().size() != 1)
+            continue;
+
+        const auto placeholder = std::make_shared<ov::op::v0::Constant>(source.get_element_type(), ov::Shape{}, 0);
+        input.replace_source_output(placeholder);
+    }
+};
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
@@ -87,6 +115,8 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                     rewritten = true;
                 }
             }
+
+            release_inputs_of_folded_node(node);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
@@ -17,6 +17,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/op/util/op_types.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -89,9 +90,38 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Index MatcherPasses by the type of their pattern root, so for each node only the matchers
+    // that can possibly match are tried. Matchers with an untyped root (or without a matcher at
+    // all) cannot be indexed and are tried on every node, but they no longer disable the index
+    // for the rest of the matchers.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> untyped_matchers;
+
+    // Level-one discrimination data of a typed matcher: when the pattern root has arguments,
+    // the argument count and the types wrapped by its WrapType arguments are known up front,
+    // so most non-matching candidates are rejected with a few type id comparisons instead of
+    // a full pattern interpretation with its predicate calls and pattern map bookkeeping.
+    struct MatcherInputFilter {
+        bool has_constraints = false;
+        size_t input_count = 0;
+        std::vector<std::vector<NodeTypeInfo>> arg_types;  // empty inner vector - argument unconstrained
+    };
+    std::vector<MatcherInputFilter> input_filters(m_matchers.size());
+    auto fill_input_filter = [](MatcherInputFilter& filter, const std::shared_ptr<Node>& root) {
+        if (root->get_input_size() == 0)
+            return;
+        filter.has_constraints = true;
+        filter.input_count = root->get_input_size();
+        filter.arg_types.reserve(filter.input_count);
+        for (const auto& arg : root->input_values()) {
+            if (auto arg_wrap = std::dynamic_pointer_cast<pattern::op::WrapType>(arg.get_node_shared_ptr())) {
+                filter.arg_types.push_back(arg_wrap->get_wrapped_types());
+            } else {
+                filter.arg_types.emplace_back();
+            }
+        }
+    };
+
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
@@ -99,8 +129,8 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
-            break;
+            untyped_matchers.push_back(matcher_index);
+            continue;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -113,24 +143,48 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
         // it's type
         // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
+        // and the matcher has to be tried on every node.
         if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
             if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
                 for (const auto& root_type_info : any_type->get_wrapped_types()) {
                     type_to_matcher[root_type_info].push_back(matcher_index);
                 }
+                fill_input_filter(input_filters[matcher_index], root);
             } else {
-                all_roots_has_type = false;
-                break;
+                untyped_matchers.push_back(matcher_index);
             }
         } else {
             type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            fill_input_filter(input_filters[matcher_index], root);
         }
 
         // TODO: traverse parents for root_type_info in order to register complete list of matchers
         // including ones triggered by parent type info.
     }
 
+    // When the set of operation types present in the model is cached (it lives on the Model next
+    // to the topological sort cache and was refreshed by the get_ordered_ops() call that filled
+    // nodes_to_run), a pass group whose root types are all absent can be skipped without visiting
+    // a single node. Skipping is only legal when every matcher is typed, per-node shape inference
+    // was not requested and the model has no sub-graph operations to recurse into.
+    std::unordered_set<NodeTypeInfo> model_op_types;
+    if (untyped_matchers.empty() && !m_enable_shape_inference && f->get_cached_op_types(model_op_types)) {
+        bool may_match = false;
+        for (const auto& model_type : model_op_types) {
+            for (const DiscreteTypeInfo* type_info = &model_type; type_info; type_info = type_info->parent) {
+                if (type_to_matcher.count(*type_info) ||
+                    *type_info == ngraph::op::util::MultiSubGraphOp::get_type_info_static()) {
+                    may_match = true;
+                    break;
+                }
+            }
+            if (may_match)
+                break;
+        }
+        if (!may_match)
+            return false;
+    }
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -163,8 +217,9 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
+    // Matchers applicable to each operation type met in this traversal; the parent type chain
+    // walk and the sort by registration order are resolved once per distinct type.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> matchers_by_type;
 
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
@@ -188,11 +243,12 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
+        // Collect the matchers indexed by this node type (and its parent types) together with the
+        // untyped ones and try them in the order of registration
+        auto matchers_it = matchers_by_type.find(node->get_type_info());
+        if (matchers_it == matchers_by_type.end()) {
+            std::vector<size_t> matcher_passes_to_run(untyped_matchers);
             const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
             while (node_type_info) {
                 auto matchers = type_to_matcher.find(*node_type_info);
                 if (matchers != type_to_matcher.end()) {
@@ -205,31 +261,38 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
                 }
                 node_type_info = node_type_info->parent;
             }
-
             std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
+            matchers_it = matchers_by_type.emplace(node->get_type_info(), std::move(matcher_passes_to_run)).first;
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
 
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
+        for (size_t matcher_index : matchers_it->second) {
+            const auto& filter = input_filters[matcher_index];
+            if (filter.has_constraints) {
+                if (node->get_input_size() != filter.input_count)
+                    continue;
+                // The per-position type check is invalid for commutative nodes since the
+                // matcher tries the argument permutations there
+                if (!ov::op::util::is_commutative(node.get())) {
+                    bool args_can_match = true;
+                    for (size_t i = 0; i < filter.input_count && args_can_match; ++i) {
+                        const auto& allowed_types = filter.arg_types[i];
+                        if (allowed_types.empty())
+                            continue;
+                        const auto& arg_type = node->input_value(i).get_node()->get_type_info();
+                        args_can_match = std::any_of(allowed_types.begin(),
+                                                     allowed_types.end(),
+                                                     [&](const NodeTypeInfo& type_info) {
+                                                         return arg_type.is_castable(type_info);
+                                                     });
+                    }
+                    if (!args_can_match)
+                        continue;
                 }
             }
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
+            }
         }
     }
     return rewritten;
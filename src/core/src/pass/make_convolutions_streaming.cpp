@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/make_convolutions_streaming.hpp"
+
+#include <limits>
+#include <memory>
+#include <ngraph/rt_info.hpp>
+#include <openvino/cc/pass/itt.hpp>
+#include <openvino/op/util/variable.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+using namespace std;
+using namespace ngraph;
+using namespace opset8;
+using namespace ov::op::util;
+
+namespace {
+
+// Converts one causally padded convolution into streaming form; returns false when the node
+// is not a convolution padded only at the beginning of its last spatial dimension
+template <typename ConvType>
+bool make_conv_streaming(const shared_ptr<ov::Node>& node, VariableVector& variables, SinkVector& sinks) {
+    auto conv = dynamic_pointer_cast<ConvType>(node);
+    if (!conv)
+        return false;
+    if (conv->get_auto_pad() != ov::op::PadType::EXPLICIT)
+        return false;
+    const auto& conv_pads_begin = conv->get_pads_begin();
+    const auto& conv_pads_end = conv->get_pads_end();
+    if (conv_pads_begin.empty() || conv_pads_begin.back() <= 0 || conv_pads_end.back() != 0)
+        return false;
+    if (conv->get_input_partial_shape(0).is_dynamic())
+        return false;
+
+    const auto context = static_cast<size_t>(conv_pads_begin.back());
+    const auto& input = conv->input_value(0);
+    const auto input_shape = input.get_shape();
+    const auto axis = static_cast<int64_t>(input_shape.size()) - 1;
+
+    auto state_shape = input_shape;
+    state_shape.back() = context;
+
+    // The variable keeps the trailing `context` input samples of the previous call, which is
+    // exactly the signal the causal padding stood in for
+    const auto var_name = conv->get_friendly_name() + "/streaming_context";
+    auto variable = make_shared<Variable>(VariableInfo{state_shape, input.get_element_type(), var_name});
+    variables.push_back(variable);
+
+    auto const_zero = make_shared<Constant>(input.get_element_type(), state_shape, 0);
+    auto read_val = make_shared<ReadValue>(const_zero, variable);
+    auto concat = make_shared<Concat>(OutputVector{read_val, input}, axis);
+
+    auto slice_start = make_shared<Constant>(element::i64, Shape{1}, -static_cast<int64_t>(context));
+    auto slice_stop = make_shared<Constant>(element::i64, Shape{1}, numeric_limits<int64_t>::max());
+    auto slice_step = make_shared<Constant>(element::i64, Shape{1}, 1);
+    auto slice_axis = make_shared<Constant>(element::i64, Shape{1}, axis);
+    auto next_context = make_shared<Slice>(concat, slice_start, slice_stop, slice_step, slice_axis);
+    auto assign = make_shared<Assign>(next_context, variable);
+    assign->add_control_dependency(read_val);
+    sinks.push_back(assign);
+
+    conv->input(0).replace_source_output(concat);
+    auto pads_begin = conv_pads_begin;
+    pads_begin.back() = 0;
+    conv->set_pads_begin(pads_begin);
+    copy_runtime_info(conv, {const_zero, read_val, concat, next_context, assign});
+    return true;
+}
+
+}  // namespace
+
+bool ov::pass::MakeConvolutionsStreaming::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_MODEL_SCOPE(MakeConvolutionsStreaming);
+
+    VariableVector variables;
+    SinkVector sinks;
+
+    for (const auto& node : f->get_ordered_ops()) {
+        if (!make_conv_streaming<Convolution>(node, variables, sinks))
+            make_conv_streaming<GroupConvolution>(node, variables, sinks);
+    }
+
+    if (sinks.empty())
+        return false;
+
+    f->add_variables(variables);
+    f->add_sinks(sinks);
+    f->validate_nodes_and_infer_types();
+    return true;
+}
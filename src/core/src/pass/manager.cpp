@@ -81,7 +81,7 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             }
             // GraphRewrite is a temporary container for MatcherPass to make execution
             // on on entire ngraph::Function
-            function_changed = GraphRewrite(matcher_pass).run_on_model(func);
+            function_changed |= GraphRewrite(matcher_pass).run_on_model(func);
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -97,7 +97,7 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                     function_changed = false;
                 }
             } else {
-                function_changed = function_pass->run_on_model(func);
+                function_changed |= function_pass->run_on_model(func);
             }
         } else if (auto node_pass = dynamic_pointer_cast<ngraph::pass::NodePass>(pass)) {
             if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
@@ -85,12 +85,24 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool align_blobs = false)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_align_blobs(align_blobs),
           m_blob_offset(bin_data.tellp()) {}
 
     FilePosition write(const char* ptr, size_t size) {
+        if (m_align_blobs) {
+            // pad the blob up to the alignment expected from mapped constants, so a reader can
+            // reference the mapped region in place instead of copying it into an aligned buffer
+            constexpr FilePosition blob_alignment = 64;
+            static const std::array<char, blob_alignment> padding{};
+            const FilePosition current_pos = m_binary_output.tellp();
+            const auto misalignment = (current_pos - m_blob_offset) % blob_alignment;
+            if (misalignment != 0) {
+                m_binary_output.write(padding.data(), blob_alignment - misalignment);
+            }
+        }
         const FilePosition write_pos = m_binary_output.tellp();
         const auto offset = write_pos - m_blob_offset;
         if (!m_enable_compression) {
@@ -118,9 +130,66 @@ private:
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    bool m_align_blobs;
     FilePosition m_blob_offset;  // blob offset inside output stream
 };
 
+// Compact binary encoding of the IR document: a length-prefixed dump of the same layer/attribute
+// tree the XML writer produces, so the IR frontend can rebuild the document and reuse the regular
+// deserializer on top of it without text parsing. The layout is the "OVBF" magic, u16 encoding
+// version and u64 IR version followed by the root element record. An element record is the name
+// string, u32 attribute count with (name, value) string pairs, u32 child count with child records,
+// each prefixed by the u8 kind (0 - element, 1 - text). A string is its u32 size and bytes.
+constexpr char binary_ir_magic[4] = {'O', 'V', 'B', 'F'};
+constexpr uint16_t binary_ir_encoding_version = 1;
+
+template <typename T>
+void write_binary_scalar(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write_binary_string(std::ostream& stream, const char* value) {
+    const auto size = static_cast<uint32_t>(std::strlen(value));
+    write_binary_scalar(stream, size);
+    stream.write(value, size);
+}
+
+void save_element_binary(std::ostream& stream, const pugi::xml_node& element) {
+    write_binary_string(stream, element.name());
+    uint32_t attribute_count = 0;
+    for (auto attribute = element.first_attribute(); attribute; attribute = attribute.next_attribute()) {
+        ++attribute_count;
+    }
+    write_binary_scalar(stream, attribute_count);
+    for (auto attribute = element.first_attribute(); attribute; attribute = attribute.next_attribute()) {
+        write_binary_string(stream, attribute.name());
+        write_binary_string(stream, attribute.value());
+    }
+    uint32_t child_count = 0;
+    for (const auto& child : element.children()) {
+        if (child.type() == pugi::node_element || child.type() == pugi::node_pcdata) {
+            ++child_count;
+        }
+    }
+    write_binary_scalar(stream, child_count);
+    for (const auto& child : element.children()) {
+        if (child.type() == pugi::node_element) {
+            write_binary_scalar(stream, static_cast<uint8_t>(0));
+            save_element_binary(stream, child);
+        } else if (child.type() == pugi::node_pcdata) {
+            write_binary_scalar(stream, static_cast<uint8_t>(1));
+            write_binary_string(stream, child.value());
+        }
+    }
+}
+
+void save_dom_binary(std::ostream& stream, const pugi::xml_document& doc, int64_t ir_version) {
+    stream.write(binary_ir_magic, sizeof(binary_ir_magic));
+    write_binary_scalar(stream, binary_ir_encoding_version);
+    write_binary_scalar(stream, static_cast<uint64_t>(ir_version));
+    save_element_binary(stream, doc.document_element());
+}
+
 void ngfunction_2_ir(pugi::xml_node& node,
                      const ngraph::Function& f,
                      const std::map<std::string, ngraph::OpSet>& custom_opsets,
@@ -238,6 +307,8 @@ class XmlSerializer : public ngraph::AttributeVisitor {
     ConstantWriter& m_constant_write_handler;
     int64_t m_version;
     bool m_deterministic;
+    // the node whose attributes are being visited, if the serializer was created for one
+    ngraph::Node* m_node;
 
     template <typename T>
     std::string create_atribute_list(ngraph::ValueAccessor<std::vector<T>>& adapter) {
@@ -360,13 +431,15 @@ public:
                   const std::map<std::string, ngraph::OpSet>& custom_opsets,
                   ConstantWriter& constant_write_handler,
                   int64_t version,
-                  bool deterministic = false)
+                  bool deterministic = false,
+                  ngraph::Node* node = nullptr)
         : m_xml_node(data),
           m_node_type_name(node_type_name),
           m_custom_opsets(custom_opsets),
           m_constant_write_handler(constant_write_handler),
           m_version(version),
-          m_deterministic(deterministic) {}
+          m_deterministic(deterministic),
+          m_node(node) {}
 
     void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
         using BodyTargetNames = std::tuple<std::string, std::string, std::vector<std::string>>;
@@ -453,7 +526,18 @@ public:
                            &adapter)) {
             if (name == "value" && translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
-                int64_t offset = m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()), size);
+                int64_t offset;
+                const auto* constant = m_deterministic ? ngraph::as_type<ov::op::v0::Constant>(m_node) : nullptr;
+                if (constant) {
+                    // Hash calculation pass: feed the constant's memoized content hash into the
+                    // stream instead of the payload, so hashing a model again reads only metadata
+                    const uint64_t data_hash = constant->get_data_hash();
+                    offset = m_constant_write_handler.write(reinterpret_cast<const char*>(&data_hash),
+                                                            sizeof(data_hash));
+                } else {
+                    offset =
+                        m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()), size);
+                }
 
                 m_xml_node.append_attribute("offset").set_value(static_cast<unsigned long long>(offset));
                 m_xml_node.append_attribute("size").set_value(static_cast<unsigned long long>(size));
@@ -971,7 +1055,13 @@ void ngfunction_2_ir(pugi::xml_node& netXml,
 
         // fill <data> general attributes
         auto_pad_resolving(node);  // Backward compatibility: clear padding values for nodes with auto_pad
-        XmlSerializer visitor(data, node_type_name, custom_opsets, constant_node_write_handler, version, deterministic);
+        XmlSerializer visitor(data,
+                              node_type_name,
+                              custom_opsets,
+                              constant_node_write_handler,
+                              version,
+                              deterministic,
+                              node);
         NGRAPH_CHECK(node->visit_attributes(visitor), "Visitor API is not supported in ", node);
         rt_info::XmlSerializer{data}.serialize(node->get_rt_info());
 
@@ -1042,6 +1132,11 @@ void serializeFunc(std::ostream& xml_file,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
                    bool deterministic = false) {
+    const bool binary_format = ver == ov::pass::Serialize::Version::IR_V11_BINARY;
+    if (binary_format) {
+        // the compact encoding only changes the container, the content version resolves as usual
+        ver = ov::pass::Serialize::Version::UNSPECIFIED;
+    }
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1062,11 +1157,17 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    // In the deterministic (hash) mode only fixed-size content hashes reach the writer, so
+    // deduplication would just compare pointers to expired temporaries - keep it off there
+    ConstantWriter constant_write_handler(bin_file, !deterministic, binary_format);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
-    xml_doc.save(xml_file);
+    if (binary_format) {
+        save_dom_binary(xml_file, xml_doc, version);
+    } else {
+        xml_doc.save(xml_file);
+    }
     xml_file.flush();
     bin_file.flush();
 };
@@ -1077,6 +1178,22 @@ namespace ov {
 bool pass::Serialize::run_on_model(const std::shared_ptr<ngraph::Function>& f_orig) {
     RUN_ON_FUNCTION_SCOPE(Serialize);
     auto f = ov::clone_model(*f_orig);
+    // Stamp the saved model with its content hash and the op count the loader validates the
+    // record against (the v10 format has no rt_info section to carry it). The record documents
+    // the saved content, e.g. for tooling that pairs artifacts with models; the compiled-blob
+    // cache always hashes the live function instead, since a model may be mutated after load
+    // with no trace in the rt_info
+    auto version = m_version;
+    if (f->get_rt_info().count("version"))
+        version = static_cast<Version>(f->get_rt_info().at("version").as<int64_t>());
+    if (version != Version::IR_V10) {
+        // drop a record inherited from a previous save so the hash covers only the content
+        f->get_rt_info().erase("precomputed_metadata");
+        uint64_t model_hash = 0;
+        Hash(model_hash).run_on_model(f);
+        f->get_rt_info()["precomputed_metadata"] =
+            ov::AnyMap{{"model_hash", std::to_string(model_hash)}, {"ops", std::to_string(f->get_ops().size())}};
+    }
     if (m_xmlFile && m_binFile) {
         serializeFunc(*m_xmlFile, *m_binFile, f, m_version, m_custom_opsets);
     } else {
@@ -1149,7 +1266,7 @@ pass::StreamSerialize::StreamSerialize(std::ostream& stream,
       m_custom_data_serializer(custom_data_serializer),
       m_version(version) {
     if (version != Serialize::Version::UNSPECIFIED && version != Serialize::Version::IR_V10 &&
-        version != Serialize::Version::IR_V11) {
+        version != Serialize::Version::IR_V11 && version != Serialize::Version::IR_V11_BINARY) {
         throw ngraph_error("Unsupported version");
     }
 }
@@ -1174,13 +1291,15 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
     auto writeHeader = [this](const DataHeader& hdr) {
         m_stream.write((const char*)&hdr, sizeof hdr);
     };
-    auto version = static_cast<int64_t>(m_version);
+    const bool binary_format = m_version == Serialize::Version::IR_V11_BINARY;
+    const auto requested_version = binary_format ? Serialize::Version::UNSPECIFIED : m_version;
+    auto version = static_cast<int64_t>(requested_version);
     auto& rt_info = f->get_rt_info();
     if (rt_info.count("version")) {
         version = rt_info.at("version").as<int64_t>();
     }
 
-    if (version != static_cast<int64_t>(m_version) && m_version != Serialize::Version::UNSPECIFIED)
+    if (version != static_cast<int64_t>(requested_version) && requested_version != Serialize::Version::UNSPECIFIED)
         throw ngraph_error("Cannot serialize model to incompatible IR version");
 
     if (version == static_cast<int64_t>(Serialize::Version::UNSPECIFIED)) {
@@ -1202,14 +1321,18 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(m_stream);
+    ConstantWriter constant_write_handler(m_stream, true, binary_format);
     XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = f;
     visitor.on_attribute(name, fun);
 
     // IR
     hdr.model_offset = m_stream.tellp();
-    xml_doc.save(m_stream);
+    if (binary_format) {
+        save_dom_binary(m_stream, xml_doc, version);
+    } else {
+        xml_doc.save(m_stream);
+    }
     m_stream.flush();
 
     const size_t file_size = m_stream.tellp();
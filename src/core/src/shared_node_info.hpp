@@ -7,6 +7,8 @@
 #include <memory>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <unordered_set>
+#include <vector>
 
 namespace ov {
 class SharedRTInfo {
@@ -14,14 +16,66 @@ public:
     SharedRTInfo() : m_use_topological_cache(false) {}
 
     void set_use_topological_cache(bool status) {
+        // Edits made under a sanctioned scope are repaired in place through pending
+        // splices (see below), so they must not discard the cached order.
+        if (!status && m_sanctioned_edit)
+            return;
         m_use_topological_cache = status;
+        if (!status) {
+            m_pending_splices.clear();
+            m_pending_nodes.clear();
+        }
     }
 
     bool get_use_topological_cache() const {
         return m_use_topological_cache;
     }
 
+    /// \brief Describes a local graph edit whose effect on the cached topological order
+    ///        is known in advance: `new_nodes` (already topologically sorted between
+    ///        themselves) belong right after `anchor` in the cached order. Both are kept
+    ///        alive by shared pointers so the model can locate the insertion point even
+    ///        after the editing pass released its references.
+    struct TopologicalSplice {
+        std::shared_ptr<Node> anchor;
+        std::vector<std::shared_ptr<Node>> new_nodes;
+    };
+
+    void begin_sanctioned_edit() {
+        m_sanctioned_edit = true;
+    }
+
+    void end_sanctioned_edit() {
+        m_sanctioned_edit = false;
+    }
+
+    void add_pending_splice(TopologicalSplice splice) {
+        for (const auto& node : splice.new_nodes)
+            m_pending_nodes.insert(node.get());
+        m_pending_splices.emplace_back(std::move(splice));
+    }
+
+    bool has_pending_splices() const {
+        return !m_pending_splices.empty();
+    }
+
+    /// \brief Returns true if the node waits in a pending splice and therefore has no
+    ///        position in the cached order yet.
+    bool has_pending_node(const Node* node) const {
+        return m_pending_nodes.count(node) != 0;
+    }
+
+    std::vector<TopologicalSplice> take_pending_splices() {
+        std::vector<TopologicalSplice> splices;
+        splices.swap(m_pending_splices);
+        m_pending_nodes.clear();
+        return splices;
+    }
+
 private:
     bool m_use_topological_cache;
+    bool m_sanctioned_edit = false;
+    std::vector<TopologicalSplice> m_pending_splices;
+    std::unordered_set<const Node*> m_pending_nodes;
 };
 }  // namespace ov
@@ -4,8 +4,29 @@
 
 #include "ngraph/type.hpp"
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
 #include "openvino/util/common_util.hpp"
 
+namespace {
+// Interned type identifiers: one per distinct (version, name) pair, which is exactly the
+// identity DiscreteTypeInfo::operator== is defined over (version_id does not participate).
+// Identifier 0 is reserved for "not interned yet".
+size_t intern_type_id(const ov::DiscreteTypeInfo& info) {
+    static std::mutex type_id_mutex;
+    static std::map<std::pair<uint64_t, std::string>, size_t> type_ids;
+    std::lock_guard<std::mutex> lock(type_id_mutex);
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    const auto result =
+        type_ids.emplace(std::make_pair(info.version, std::string(info.name ? info.name : "")), type_ids.size() + 1);
+    OPENVINO_SUPPRESS_DEPRECATED_END
+    return result.first->second;
+}
+}  // namespace
+
 namespace std {
 size_t std::hash<ngraph::DiscreteTypeInfo>::operator()(const ngraph::DiscreteTypeInfo& k) const {
     return k.hash();
@@ -32,6 +53,18 @@ size_t DiscreteTypeInfo::hash() {
     return hash_value;
 }
 
+size_t DiscreteTypeInfo::type_id() const {
+    if (type_id_value != 0)
+        return type_id_value;
+    return intern_type_id(*this);
+}
+
+size_t DiscreteTypeInfo::type_id() {
+    if (type_id_value == 0)
+        type_id_value = intern_type_id(*this);
+    return type_id_value;
+}
+
 bool DiscreteTypeInfo::is_castable(const DiscreteTypeInfo& target_type) const {
     return *this == target_type || (parent && parent->is_castable(target_type));
 }
@@ -85,6 +118,10 @@ bool DiscreteTypeInfo::operator<(const DiscreteTypeInfo& b) const {
     return false;
 }
 bool DiscreteTypeInfo::operator==(const DiscreteTypeInfo& b) const {
+    if (this == &b)
+        return true;
+    if (type_id_value != 0 && b.type_id_value != 0)
+        return type_id_value == b.type_id_value;
     if (hash_value != 0 && b.hash_value != 0)
         return hash() == b.hash();
     OPENVINO_SUPPRESS_DEPRECATED_START
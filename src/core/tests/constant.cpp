@@ -1777,6 +1777,22 @@ TEST(constant, lazy_bitwise_identical) {
     EXPECT_GT(bitwise_check_count_only, bitwise_check_count * 10);
 }
 
+TEST(constant, memoized_data_hash) {
+    Shape shape{4};
+    op::Constant c(element::f32, shape, vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    op::Constant c_same(element::f32, shape, vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    op::Constant c_other(element::f32, shape, vector<float>{1.0f, 2.0f, 3.0f, 5.0f});
+
+    const auto hash = c.get_data_hash();
+    EXPECT_EQ(hash, c.get_data_hash());  // cached value is stable
+    EXPECT_EQ(hash, c_same.get_data_hash());
+    EXPECT_NE(hash, c_other.get_data_hash());
+
+    // copies share the buffer, so the memoized hash is inherited
+    op::Constant c_copy(c);
+    EXPECT_EQ(hash, c_copy.get_data_hash());
+}
+
 // Disabled just because of long execution time. Enable for nightly builds in future
 TEST(constant, DISABLED_nightly_huge_size_4GB) {
     size_t start = 1llu << 32;
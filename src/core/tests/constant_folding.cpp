@@ -3584,3 +3584,19 @@ TEST(constant_folding, evaluate_on_tensor_vector) {
     ASSERT_EQ(data_shape, result_node->get_output_shape(0));
     ASSERT_EQ(add_expected, result_node->cast_vector<int>());
 }
+
+TEST(constant_folding, release_unused_inputs_of_folded_node) {
+    auto data = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto convert = make_shared<op::Convert>(data, element::f16);
+    auto consumer = make_shared<op::Relu>(convert);
+
+    auto model = std::make_shared<ov::Model>(NodeVector{consumer}, ParameterVector{});
+
+    run_constant_folding(model);
+
+    ASSERT_EQ(count_ops_of_type<op::Convert>(model), 0);
+    // The folded convert must not keep the original constant alive until the end of the pass,
+    // so its only input should be re-pointed to a placeholder
+    ASSERT_NE(convert->input_value(0).get_node(), data.get());
+    ASSERT_EQ(data->output(0).get_target_inputs().size(), 0);
+}
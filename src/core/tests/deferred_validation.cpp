@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/opsets/opset8.hpp"
+
+TEST(deferred_validation, scope_nesting) {
+    EXPECT_FALSE(ov::DeferredValidationScope::active());
+    {
+        ov::DeferredValidationScope outer;
+        EXPECT_TRUE(ov::DeferredValidationScope::active());
+        {
+            ov::DeferredValidationScope inner;
+            EXPECT_TRUE(ov::DeferredValidationScope::active());
+        }
+        EXPECT_TRUE(ov::DeferredValidationScope::active());
+    }
+    EXPECT_FALSE(ov::DeferredValidationScope::active());
+}
+
+TEST(deferred_validation, model_built_under_scope_is_valid) {
+    ov::DeferredValidationScope scope;
+
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 16, 16});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto f = std::make_shared<ov::Model>(relu, ov::ParameterVector{arg0});
+
+    f->validate_nodes_and_infer_types();
+    EXPECT_EQ(relu->get_output_partial_shape(0), (ov::PartialShape{1, 3, 16, 16}));
+}
+
+TEST(deferred_validation, replaced_input_is_revalidated) {
+    ov::DeferredValidationScope scope;
+
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 16, 16});
+    auto arg1 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 32, 32});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto f = std::make_shared<ov::Model>(relu, ov::ParameterVector{arg0, arg1});
+
+    relu->input(0).replace_source_output(arg1->output(0));
+    f->validate_nodes_and_infer_types();
+    EXPECT_EQ(relu->get_output_partial_shape(0), (ov::PartialShape{1, 3, 32, 32}));
+}
+
+TEST(deferred_validation, changed_producer_shape_propagates) {
+    ov::DeferredValidationScope scope;
+
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 16, 16});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto abs = std::make_shared<ov::opset8::Abs>(relu);
+    auto f = std::make_shared<ov::Model>(abs, ov::ParameterVector{arg0});
+
+    // the parameter's set_output_type change must mark the consumers dirty, so the model
+    // validation re-infers the whole chain instead of skipping it
+    arg0->set_partial_shape(ov::PartialShape{2, 3, 16, 16});
+    f->validate_nodes_and_infer_types();
+    EXPECT_EQ(relu->get_output_partial_shape(0), (ov::PartialShape{2, 3, 16, 16}));
+    EXPECT_EQ(abs->get_output_partial_shape(0), (ov::PartialShape{2, 3, 16, 16}));
+}
@@ -107,6 +107,51 @@ TEST(dimension, dimension_mul_operator_5) {
     EXPECT_EQ(ref_value, large_interval * three);
 }
 
+TEST(dimension, dimension_add_operator_static) {
+    Dimension three(3);
+    Dimension four(4);
+    Dimension ref_value(7);
+    EXPECT_EQ(ref_value, three + four);
+}
+
+TEST(dimension, dimension_add_operator_static_overflow) {
+    // overflow happens and the result is clipped into int64_max
+    Dimension large_value(Interval::s_max - 1);
+    Dimension two(2);
+    Dimension ref_value(Interval::s_max, Interval::s_max);
+    EXPECT_EQ(ref_value, large_value + two);
+}
+
+TEST(dimension, dimension_sub_operator_static) {
+    Dimension seven(7);
+    Dimension three(3);
+    Dimension ref_value(4);
+    EXPECT_EQ(ref_value, seven - three);
+}
+
+TEST(dimension, dimension_sub_operator_static_clipped_to_zero) {
+    Dimension three(3);
+    Dimension seven(7);
+    Dimension ref_value(0);
+    EXPECT_EQ(ref_value, three - seven);
+}
+
+TEST(dimension, dimension_mul_operator_static) {
+    Dimension six(6);
+    Dimension seven(7);
+    Dimension ref_value(42);
+    EXPECT_EQ(ref_value, six * seven);
+}
+
+TEST(dimension, dimension_mul_operator_static_overflow) {
+    // (int64_max / 2 + 1) * 2 = 9223372036854775808 = int64_max + 1
+    // overflow happens and the result is clipped into int64_max
+    Dimension large_value(ov::Interval::s_max / 2 + 1);
+    Dimension two(2);
+    Dimension ref_value(Interval::s_max, Interval::s_max);
+    EXPECT_EQ(ref_value, large_value * two);
+}
+
 TEST(dimension, division_of_static_dims_twenty_three_div_three_eq_seven) {
     Dimension twenty_three(23);
     Dimension::value_type three(3);
@@ -1375,8 +1375,8 @@ TEST(model, topological_sort_caching_replace_node) {
     auto new_relu = std::make_shared<ov::opset8::Relu>(relu1);
     ov::replace_node(relu2, new_relu);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    // replacement by a local subgraph is repaired in place, so the cache survives
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
 
     // Before get_ordered_ops, new_node shouldn't have shared_info, but after
     // it will be set to the model shared_info and cache will be used.
@@ -1387,6 +1387,50 @@ TEST(model, topological_sort_caching_replace_node) {
     ASSERT_TRUE(all_ops_have_same_info(f));
 }
 
+TEST(model, topological_sort_caching_replace_node_non_local) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto result1 = std::make_shared<ov::opset8::Result>(relu1);
+    auto result2 = std::make_shared<ov::opset8::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result1, result2}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    auto new_relu = std::make_shared<ov::opset8::Relu>(relu2);
+    ov::replace_node(relu1, new_relu);
+
+    // The replacement reads from a node which is not an ancestor of the target,
+    // so the edit is not a local splice and cache must be updated
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 5);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_destructed_node) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(relu1);
+    auto result = std::make_shared<ov::opset8::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    auto new_relu = std::make_shared<ov::opset8::Relu>(relu1);
+    ov::replace_node(relu2, new_relu);
+    relu2.reset();
+
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+    // The replaced node is destructed at this point; removing a node keeps the
+    // relative order of the remaining nodes, so the cache is not discarded
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
 TEST(model, topological_sort_caching_replace_source_output) {
     auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
     auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
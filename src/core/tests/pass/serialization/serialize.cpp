@@ -70,6 +70,13 @@ TEST_P(SerializationTest, SerializeHelper) {
     });
 }
 
+TEST_P(SerializationTest, CompareFunctionsBinaryFormat) {
+    CompareSerialized([this](const std::shared_ptr<ov::Model>& m) {
+        ov::pass::Serialize(m_out_xml_path, m_out_bin_path, ov::pass::Serialize::Version::IR_V11_BINARY)
+            .run_on_model(m);
+    });
+}
+
 INSTANTIATE_TEST_SUITE_P(
     IRSerialization,
     SerializationTest,
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/small_stable_vector.hpp"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace ov;
+
+TEST(small_stable_vector, emplace_and_access) {
+    detail::SmallStableVector<string, 2> v;
+    EXPECT_TRUE(v.empty());
+    v.emplace_back("a");
+    v.emplace_back("b");
+    v.emplace_back("c");
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(v[0], "a");
+    EXPECT_EQ(v.at(1), "b");
+    EXPECT_EQ(v.at(2), "c");
+    EXPECT_THROW(v.at(3), std::out_of_range);
+}
+
+TEST(small_stable_vector, stable_addresses_past_inline_capacity) {
+    detail::SmallStableVector<int, 2> v;
+    vector<int*> addresses;
+    for (int i = 0; i < 100; ++i) {
+        addresses.push_back(&v.emplace_back(i));
+    }
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(addresses[i], &v[i]);
+        EXPECT_EQ(*addresses[i], i);
+    }
+}
+
+TEST(small_stable_vector, iteration) {
+    detail::SmallStableVector<int, 2> v;
+    for (int i = 0; i < 5; ++i) {
+        v.emplace_back(i);
+    }
+    int expected = 0;
+    for (auto& value : v) {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 5);
+}
+
+TEST(small_stable_vector, copy) {
+    detail::SmallStableVector<string, 2> v;
+    v.emplace_back("a");
+    v.emplace_back("b");
+    v.emplace_back("c");
+
+    detail::SmallStableVector<string, 2> copy_constructed(v);
+    EXPECT_EQ(copy_constructed.size(), 3);
+    EXPECT_EQ(copy_constructed[2], "c");
+    EXPECT_NE(&copy_constructed[0], &v[0]);
+
+    detail::SmallStableVector<string, 2> copy_assigned;
+    copy_assigned.emplace_back("old");
+    copy_assigned = v;
+    EXPECT_EQ(copy_assigned.size(), 3);
+    EXPECT_EQ(copy_assigned[0], "a");
+}
+
+TEST(small_stable_vector, clear) {
+    detail::SmallStableVector<string, 2> v;
+    v.emplace_back("a");
+    v.emplace_back("b");
+    v.emplace_back("c");
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    v.emplace_back("d");
+    EXPECT_EQ(v.size(), 1);
+    EXPECT_EQ(v[0], "d");
+}
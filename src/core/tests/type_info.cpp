@@ -73,6 +73,26 @@ TEST(type_info, check_hash_value) {
     EXPECT_EQ(hash_val(type_empty_ver.name, type_empty_ver.version_id, type_empty_ver.version), type_empty_ver.hash());
 }
 
+TEST(type_info, check_type_id) {
+    ov::DiscreteTypeInfo type("type_id_a", static_cast<uint64_t>(0), "version1");
+    ov::DiscreteTypeInfo type_same("type_id_a", static_cast<uint64_t>(0), "version2");
+    ov::DiscreteTypeInfo type_other("type_id_b", static_cast<uint64_t>(0), "version1");
+    ov::DiscreteTypeInfo type_other_version("type_id_a", 1ul, "version1");
+    // identifiers are interned per (version, name) pair: version_id does not participate,
+    // in line with operator==
+    EXPECT_NE(type.type_id(), 0);
+    EXPECT_EQ(type.type_id(), type_same.type_id());
+    EXPECT_NE(type.type_id(), type_other.type_id());
+    EXPECT_NE(type.type_id(), type_other_version.type_id());
+    // the const overload returns the same identifier without caching it
+    const ov::DiscreteTypeInfo type_const("type_id_a", static_cast<uint64_t>(0), "version1");
+    EXPECT_EQ(type_const.type_id(), type.type_id());
+    // interned infos still compare as before
+    EXPECT_TRUE(type == type_same);
+    EXPECT_FALSE(type == type_other);
+    EXPECT_FALSE(type == type_other_version);
+}
+
 TEST(type_info, find_in_map) {
     std::vector<std::string> vector_names;
     ov::DiscreteTypeInfo a("Mod", 1ul, "opset1");
@@ -5,6 +5,7 @@
 #include <openvino/util/env_util.hpp>
 #include <openvino/util/file_util.hpp>
 
+#include "openvino/core/node.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/extension/op.hpp"
 #include "openvino/frontend/manager.hpp"
@@ -50,23 +51,30 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 
 std::shared_ptr<ov::Model> FrontEnd::convert(const InputModel::Ptr& model) const {
     FRONT_END_CHECK_IMPLEMENTED(m_actual, convert);
+    // conversion builds the graph topologically, so each node validated at construction stays
+    // valid unless edited afterwards; with the scope active the final full-model validation
+    // revisits only the edited ones instead of re-inferring every node
+    DeferredValidationScope deferred_validation;
     FRONTEND_RETURN_STATEMENT("Converting input model",
                               FrontEnd::create_copy(m_actual->convert(model->m_actual), m_shared_object))
 }
 
 void FrontEnd::convert(const std::shared_ptr<Model>& model) const {
     FRONT_END_CHECK_IMPLEMENTED(m_actual, convert);
+    DeferredValidationScope deferred_validation;
     FRONTEND_CALL_STATEMENT("Converting partially converted model", m_actual->convert(model))
 }
 
 std::shared_ptr<Model> FrontEnd::convert_partially(const InputModel::Ptr& model) const {
     FRONT_END_CHECK_IMPLEMENTED(m_actual, convert_partially);
+    DeferredValidationScope deferred_validation;
     FRONTEND_RETURN_STATEMENT("Partially convert model",
                               FrontEnd::create_copy(m_actual->convert_partially(model->m_actual), m_shared_object))
 }
 
 std::shared_ptr<Model> FrontEnd::decode(const InputModel::Ptr& model) const {
     FRONT_END_CHECK_IMPLEMENTED(m_actual, decode);
+    DeferredValidationScope deferred_validation;
     FRONTEND_RETURN_STATEMENT("Decoding model",
                               FrontEnd::create_copy(m_actual->decode(model->m_actual), m_shared_object))
 }
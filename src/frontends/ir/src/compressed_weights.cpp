@@ -0,0 +1,154 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compressed_weights.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "ie_common.h"
+#include "ie_parallel.hpp"
+
+namespace ov {
+namespace {
+
+constexpr char weights_magic[4] = {'O', 'V', 'W', 'C'};
+constexpr uint16_t weights_container_version = 1;
+
+enum WeightsCodec : uint16_t {
+    CODEC_RAW = 0,  // frames are stored as is
+    CODEC_LZ4 = 1,  // frames are LZ4 block compressed
+};
+
+struct WeightsHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t codec;
+    uint64_t frame_count;
+    uint64_t raw_size;
+};
+
+struct WeightsFrame {
+    uint64_t raw_offset;
+    uint64_t raw_size;
+    uint64_t packed_offset;
+    uint64_t packed_size;
+};
+
+// Decodes one LZ4 block (the stand-alone block format, not the framed one) with full
+// bounds checking. Implemented locally to keep the runtime free of extra dependencies;
+// the format is trivial: a token with literal/match length nibbles, raw literals, then
+// a 2-byte match offset into the already decoded output.
+size_t decode_lz4_block(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_capacity) {
+    const uint8_t* src_end = src + src_size;
+    uint8_t* const dst_begin = dst;
+    uint8_t* const dst_end = dst + dst_capacity;
+
+    auto read_extended_length = [&](size_t length) {
+        uint8_t byte;
+        do {
+            if (src >= src_end)
+                IE_THROW() << "Compressed weights file is malformed: truncated LZ4 length";
+            byte = *src++;
+            length += byte;
+        } while (byte == 255);
+        return length;
+    };
+
+    while (src < src_end) {
+        const uint8_t token = *src++;
+
+        size_t literal_length = token >> 4;
+        if (literal_length == 15)
+            literal_length = read_extended_length(literal_length);
+        if (literal_length > static_cast<size_t>(src_end - src) || literal_length > static_cast<size_t>(dst_end - dst))
+            IE_THROW() << "Compressed weights file is malformed: LZ4 literals out of bounds";
+        std::memcpy(dst, src, literal_length);
+        src += literal_length;
+        dst += literal_length;
+
+        if (src >= src_end)  // the last sequence has no match part
+            break;
+
+        if (src_end - src < 2)
+            IE_THROW() << "Compressed weights file is malformed: truncated LZ4 match offset";
+        const size_t match_offset = static_cast<size_t>(src[0]) | (static_cast<size_t>(src[1]) << 8);
+        src += 2;
+
+        size_t match_length = (token & 0x0F) + 4;
+        if ((token & 0x0F) == 15)
+            match_length = read_extended_length(match_length);
+        if (match_offset == 0 || match_offset > static_cast<size_t>(dst - dst_begin) ||
+            match_length > static_cast<size_t>(dst_end - dst))
+            IE_THROW() << "Compressed weights file is malformed: LZ4 match out of bounds";
+
+        // matches may overlap the bytes just written, so they are copied byte by byte
+        const uint8_t* match = dst - match_offset;
+        for (size_t i = 0; i < match_length; i++)
+            dst[i] = match[i];
+        dst += match_length;
+    }
+
+    return dst - dst_begin;
+}
+
+}  // namespace
+
+bool is_compressed_weights(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+    return buffer && buffer->size() >= sizeof(WeightsHeader) &&
+           std::memcmp(buffer->get_ptr(), weights_magic, sizeof(weights_magic)) == 0;
+}
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> decompress_weights(
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+    if (!is_compressed_weights(buffer))
+        IE_THROW() << "Provided weights buffer is not a compressed weights file";
+
+    WeightsHeader header;
+    std::memcpy(&header, buffer->get_ptr(), sizeof(header));
+    if (header.version != weights_container_version)
+        IE_THROW() << "Unsupported compressed weights file version: " << header.version;
+    if (header.codec != CODEC_RAW && header.codec != CODEC_LZ4)
+        IE_THROW() << "Unsupported compressed weights codec: " << header.codec;
+
+    // the bound is checked before the multiplication so a huge frame_count cannot overflow
+    // the table size into a small value (is_compressed_weights guarantees the header fits)
+    if (header.frame_count > (buffer->size() - sizeof(WeightsHeader)) / sizeof(WeightsFrame))
+        IE_THROW() << "Compressed weights file is malformed: truncated frame table";
+
+    const uint8_t* file_data = buffer->get_ptr<uint8_t>();
+    const WeightsFrame* frames = reinterpret_cast<const WeightsFrame*>(file_data + sizeof(WeightsHeader));
+
+    auto raw = std::make_shared<ngraph::runtime::AlignedBuffer>(header.raw_size);
+    uint8_t* raw_data = raw->get_ptr<uint8_t>();
+
+    for (size_t i = 0; i < header.frame_count; i++) {
+        const WeightsFrame& frame = frames[i];
+        // offset + size may wrap around uint64, so the ranges are checked subtractively
+        if (frame.raw_size > header.raw_size || frame.raw_offset > header.raw_size - frame.raw_size ||
+            frame.packed_size > buffer->size() || frame.packed_offset > buffer->size() - frame.packed_size)
+            IE_THROW() << "Compressed weights file is malformed: frame " << i << " is out of bounds";
+    }
+
+    // One frame per constant makes the frames independent, decompress them in parallel.
+    // The file is typically memory mapped, so this pass is also what actually faults the
+    // compressed pages in, overlapping the I/O with the decompression.
+    ov::parallel_for(header.frame_count, [&](size_t i) {
+        const WeightsFrame& frame = frames[i];
+        const uint8_t* packed = file_data + frame.packed_offset;
+        uint8_t* dst = raw_data + frame.raw_offset;
+        if (header.codec == CODEC_RAW) {
+            if (frame.packed_size != frame.raw_size)
+                IE_THROW() << "Compressed weights file is malformed: raw frame " << i << " size mismatch";
+            std::memcpy(dst, packed, frame.raw_size);
+        } else {
+            if (decode_lz4_block(packed, frame.packed_size, dst, frame.raw_size) != frame.raw_size)
+                IE_THROW() << "Compressed weights file is malformed: frame " << i << " decodes to a wrong size";
+        }
+    });
+
+    return raw;
+}
+
+}  // namespace ov
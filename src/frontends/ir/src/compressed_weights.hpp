@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Support for weight files compressed at rest.
+ * @file compressed_weights.hpp
+ *
+ * A compressed weights file packs the original .bin content into independent frames,
+ * one frame per constant, so the frames can be decompressed in parallel directly into
+ * an aligned buffer with the original layout. The offsets the IR references stay valid,
+ * the deserializer is unaware of the compression.
+ *
+ * File layout (all fields little endian):
+ *   char     magic[4]     "OVWC"
+ *   uint16_t version      1
+ *   uint16_t codec        see WeightsCodec
+ *   uint64_t frame_count
+ *   uint64_t raw_size     total size of the decompressed content
+ *   frame_count x { uint64_t raw_offset, raw_size, packed_offset, packed_size }
+ *   packed frame payloads
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ov {
+
+/// \brief Checks whether the buffer holds a compressed weights file (by magic).
+bool is_compressed_weights(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer);
+
+/// \brief Decompresses a compressed weights file into an aligned buffer with the
+///        original .bin layout. Frames are decompressed in parallel.
+/// \throws if the container or a frame is malformed.
+std::shared_ptr<ngraph::runtime::AlignedBuffer> decompress_weights(
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer);
+
+}  // namespace ov
@@ -5,8 +5,10 @@
 #include "openvino/frontend/ir/frontend.hpp"
 
 #include <array>
+#include <cstring>
 #include <vector>
 
+#include "compressed_weights.hpp"
 #include "input_model.hpp"
 #include "mmap_object.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
@@ -40,6 +42,15 @@ size_t GetIRVersion(std::istream& model) {
     model.clear();
     model.seekg(0, model.beg);
 
+    // the compact binary IR encoding keeps the IR version right after the magic and the u16
+    // encoding version (see ov::pass::Serialize::Version::IR_V11_BINARY)
+    constexpr char binary_ir_magic[4] = {'O', 'V', 'B', 'F'};
+    if (std::memcmp(header.data(), binary_ir_magic, sizeof(binary_ir_magic)) == 0) {
+        uint64_t version = 0;
+        std::memcpy(&version, header.data() + sizeof(binary_ir_magic) + sizeof(uint16_t), sizeof(version));
+        return static_cast<size_t>(version);
+    }
+
     pugi::xml_document doc;
     auto res =
         doc.load_buffer(header.data(), header.size(), pugi::parse_default | pugi::parse_fragment, pugi::encoding_utf8);
@@ -198,27 +209,15 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         }
     }
     if (!weights_path.empty()) {
-        std::ifstream bin_stream;
-        bin_stream.open(weights_path, std::ios::binary);
-        if (!bin_stream.is_open())
-#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-            IE_THROW() << "Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!";
-#else
-            IE_THROW() << "Weights file " + weights_path + " cannot be opened!";
-#endif
-
-        bin_stream.seekg(0, std::ios::end);
-        size_t file_size = bin_stream.tellg();
-        bin_stream.seekg(0, std::ios::beg);
-
-        auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
-        bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-        bin_stream.close();
-
-        weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
-            aligned_weights_buffer->get_ptr<char>(),
-            aligned_weights_buffer->size(),
-            aligned_weights_buffer);
+        // Map the weights file instead of reading it into a heap buffer. Constants created by the
+        // deserializer keep a reference into the mapped region, so model weights are not duplicated
+        // in memory and cold pages are faulted in on demand.
+        weights = ov::load_mmap_object(weights_path);
+    }
+    // Weights shipped compressed at rest are unpacked here into a buffer with the original .bin
+    // layout, so the offsets in the IR stay valid and the deserializer is unaware of the container.
+    if (ov::is_compressed_weights(weights)) {
+        weights = ov::decompress_weights(weights);
     }
 
     return create_input_model();
@@ -6,6 +6,7 @@
 
 #include <xml_parse_utils.h>
 
+#include <cstring>
 #include <ir_deserializer.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <openvino/op/util/framework_node.hpp>
@@ -18,6 +19,64 @@ using namespace ngraph;
 using namespace InferenceEngine;
 
 namespace {
+// Reader counterpart of the compact binary IR encoding produced by ov::pass::Serialize with the
+// IR_V11_BINARY version: the "OVBF" magic, u16 encoding version and u64 IR version followed by the
+// root element record (name string, u32 attribute count with (name, value) string pairs, u32 child
+// count with child records prefixed by the u8 kind: 0 - element, 1 - text; strings are u32 size
+// plus bytes). The document is rebuilt node by node, so the regular deserializer works on top of
+// it without any text parsing.
+constexpr char binary_ir_magic[4] = {'O', 'V', 'B', 'F'};
+constexpr uint16_t binary_ir_encoding_version = 1;
+
+template <typename T>
+T read_binary_scalar(std::istream& stream) {
+    T value{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+std::string read_binary_string(std::istream& stream) {
+    const auto size = read_binary_scalar<uint32_t>(stream);
+    std::string value(size, '\0');
+    if (size > 0) {
+        stream.read(&value[0], size);
+    }
+    return value;
+}
+
+void load_element_binary(std::istream& stream, pugi::xml_node element) {
+    const auto attribute_count = read_binary_scalar<uint32_t>(stream);
+    for (uint32_t i = 0; i < attribute_count && stream.good(); ++i) {
+        const auto name = read_binary_string(stream);
+        const auto value = read_binary_string(stream);
+        element.append_attribute(name.c_str()).set_value(value.c_str());
+    }
+    const auto child_count = read_binary_scalar<uint32_t>(stream);
+    for (uint32_t i = 0; i < child_count && stream.good(); ++i) {
+        const auto kind = read_binary_scalar<uint8_t>(stream);
+        if (kind == 1) {
+            element.append_child(pugi::node_pcdata).set_value(read_binary_string(stream).c_str());
+        } else {
+            const auto name = read_binary_string(stream);
+            load_element_binary(stream, element.append_child(name.c_str()));
+        }
+    }
+}
+
+void load_dom_binary(std::istream& stream, pugi::xml_document& doc) {
+    // the magic has been consumed by the format check already
+    const auto encoding_version = read_binary_scalar<uint16_t>(stream);
+    if (encoding_version != binary_ir_encoding_version) {
+        IE_THROW() << "Unsupported binary IR encoding version: " << encoding_version;
+    }
+    read_binary_scalar<uint64_t>(stream);  // IR version, duplicated in the root element attributes
+    const auto root_name = read_binary_string(stream);
+    load_element_binary(stream, doc.append_child(root_name.c_str()));
+    if (!stream.good() && !stream.eof()) {
+        IE_THROW() << "Truncated or malformed binary IR";
+    }
+}
+
 void ParsePreProcess(pugi::xml_node& root,
                      std::shared_ptr<ngraph::runtime::AlignedBuffer> weights,
                      std::shared_ptr<Function> f) {
@@ -202,9 +261,18 @@ public:
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
         : m_weights(weights),
           m_extensions(extensions) {
-        pugi::xml_parse_result res = m_xml_doc.load(stream);
-        if (res.status != pugi::status_ok) {
-            IE_THROW() << res.description() << " at offset " << res.offset;
+        const auto start_pos = stream.tellg();
+        char magic[sizeof(binary_ir_magic)] = {};
+        stream.read(magic, sizeof(magic));
+        if (stream.good() && std::memcmp(magic, binary_ir_magic, sizeof(magic)) == 0) {
+            load_dom_binary(stream, m_xml_doc);
+        } else {
+            stream.clear();
+            stream.seekg(start_pos);
+            pugi::xml_parse_result res = m_xml_doc.load(stream);
+            if (res.status != pugi::status_ok) {
+                IE_THROW() << res.description() << " at offset " << res.offset;
+            }
         }
         m_root = m_xml_doc.document_element();
         for (const auto& it : ov::get_available_opsets()) {
@@ -12,6 +12,7 @@
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
@@ -430,9 +431,20 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
-    // Read all layers and store their parameters in params map
+    // Read all layers and store their parameters in params map.
+    // Layer subtrees are independent, so parse them in parallel (read-only pugixml traversal is
+    // thread safe) and resolve the cross-layer information serially afterwards.
+    std::vector<pugi::xml_node> layer_nodes;
     FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+        layer_nodes.emplace_back(node);
+    }
+    std::vector<GenericLayerParams> layer_params(layer_nodes.size());
+    ov::parallel_for(layer_nodes.size(), [&](size_t i) {
+        layer_params[i] = parseGenericParams(layer_nodes[i]);
+    });
+    for (size_t i = 0; i < layer_nodes.size(); ++i) {
+        const auto& node = layer_nodes[i];
+        auto& node_param = layer_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
@@ -553,6 +565,23 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         read_legacy_meta_data(function, meta_names, root);
     } else {
         read_meta_data(function, root.child("rt_info"));
+
+        // the serializer stamps precomputed facts with the op count of the saved model; a
+        // hand-edited IR fails this cheap check and loses the record here instead of
+        // carrying a hash which no longer describes the content
+        auto& rt_info = function->get_rt_info();
+        const auto it = rt_info.find("precomputed_metadata");
+        if (it != rt_info.end()) {
+            bool valid = false;
+            if (it->second.is<std::shared_ptr<ov::Meta>>()) {
+                const ov::AnyMap& meta = *it->second.as<std::shared_ptr<ov::Meta>>();
+                const auto ops = meta.find("ops");
+                valid = ops != meta.end() &&
+                        ops->second.as<std::string>() == std::to_string(function->get_ops().size());
+            }
+            if (!valid)
+                rt_info.erase("precomputed_metadata");
+        }
     }
 
     return function;
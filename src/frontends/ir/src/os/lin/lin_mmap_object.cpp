@@ -77,6 +77,11 @@ public:
         if (m_size > 0) {
             m_data = mmap(nullptr, m_size, prot, MAP_PRIVATE, m_handle.get(), 0);
             OPENVINO_ASSERT(m_data != MAP_FAILED, "Can not create file mapping for ", path, ", err=", strerror(errno));
+            // Ask the kernel to start reading the whole file ahead right away: the weights are
+            // mapped before the xml is parsed, so the asynchronous readahead overlaps with the
+            // topology construction instead of being paid as page faults when the constants are
+            // first touched. A failed advise only loses the prefetch, hence the result is ignored.
+            (void)posix_madvise(m_data, m_size, POSIX_MADV_WILLNEED);
         } else {
             m_data = MAP_FAILED;
         }
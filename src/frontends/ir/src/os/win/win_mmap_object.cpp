@@ -106,6 +106,25 @@ private:
                                      0,  // offset_align & 0xffffffff,
                                      m_size);
             OPENVINO_ASSERT(m_data, "Can not create map view for ", path);
+
+            // Hint the memory manager to start paging the whole view in right away: the weights
+            // are mapped before the xml is parsed, so the prefetch overlaps with the topology
+            // construction instead of being paid as page faults when the constants are first
+            // touched. PrefetchVirtualMemory exists since Windows 8, so it is looked up
+            // dynamically and the hint is simply skipped on older systems.
+            struct MemoryRangeEntry {
+                PVOID VirtualAddress;
+                SIZE_T NumberOfBytes;
+            };
+            using PrefetchVirtualMemoryF = BOOL(WINAPI*)(HANDLE, ULONG_PTR, MemoryRangeEntry*, ULONG);
+            auto prefetch = reinterpret_cast<PrefetchVirtualMemoryF>(
+                reinterpret_cast<void*>(::GetProcAddress(::GetModuleHandleA("kernel32.dll"), "PrefetchVirtualMemory")));
+            if (prefetch) {
+                MemoryRangeEntry range;
+                range.VirtualAddress = m_data;
+                range.NumberOfBytes = m_size;
+                prefetch(::GetCurrentProcess(), 1, &range, 0);
+            }
         } else {
             m_data = NULL;
         }
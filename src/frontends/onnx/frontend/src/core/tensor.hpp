@@ -237,9 +237,11 @@ private:
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         int data_size = get_data_size();
         if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-            if (constant->get_byte_size() != external_data.size()) {
+            // the constant references the mapped region of the data file directly, so the raw
+            // tensor payload is neither copied through protobuf nor duplicated on the heap
+            auto external_data = load_external_mmap_data();
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data);
+            if (constant->get_byte_size() != external_data->size()) {
                 throw error::invalid_external_data(
                     "The size of the external data file does not match the byte size of an initializer '" + get_name() +
                     "' in the model");
@@ -265,6 +267,21 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (has_external_data()) {
+            // externally stored data is always in the raw layout of the element type, so it can
+            // reference the mapped file directly instead of being converted element by element
+            auto external_data = load_external_mmap_data();
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data);
+            if (constant->get_byte_size() != external_data->size()) {
+                throw error::invalid_external_data(
+                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                    "' in the model");
+            }
+            if (m_tensor_proto->has_name()) {
+                constant->set_friendly_name(get_name());
+            }
+            return constant;
+        }
         auto data = get_data<T>();
         auto data_size = data.size();
         if (data_size == shape_size(m_shape)) {
@@ -291,6 +308,11 @@ private:
         return tensor_external_data.load_external_data(m_model_dir);
     }
 
+    detail::Buffer load_external_mmap_data() const {
+        const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        return tensor_external_data.load_external_mmap_data(m_model_dir);
+    }
+
     template <typename T>
     std::vector<T> get_external_data() const {
         return detail::__get_raw_data<T>(load_external_data(), m_tensor_proto->data_type());
@@ -5,6 +5,8 @@
 #include "utils/tensor_external_data.hpp"
 
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -15,6 +17,31 @@
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+namespace {
+// Every initializer stored in one external file gets its own TensorExternalData instance, so the
+// mapping of the file is shared here instead of being re-created per tensor. The cache holds weak
+// references only: a file stays mapped for as long as at least one constant created from it is
+// alive and is unmapped together with the last model that uses it.
+std::shared_ptr<ov::util::MappedMemory> map_external_file(const std::string& full_path) {
+    static std::map<std::string, std::weak_ptr<ov::util::MappedMemory>> mapped_files;
+    static std::mutex mapped_files_mutex;
+
+    std::lock_guard<std::mutex> lock{mapped_files_mutex};
+    auto it = mapped_files.find(full_path);
+    if (it != mapped_files.end()) {
+        if (auto mapped_memory = it->second.lock()) {
+            return mapped_memory;
+        }
+    }
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    auto mapped_memory = ov::util::load_mmap_object(ov::util::string_to_wstring(full_path));
+#else
+    auto mapped_memory = ov::util::load_mmap_object(full_path);
+#endif
+    mapped_files[full_path] = mapped_memory;
+    return mapped_memory;
+}
+}  // namespace
 TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor) {
     for (const auto& entry : tensor.external_data()) {
         if (entry.key() == "location") {
@@ -72,6 +99,38 @@ std::string TensorExternalData::load_external_data(const std::string& model_dir)
     return read_data;
 }
 
+Buffer TensorExternalData::load_external_mmap_data(const std::string& model_dir) const {
+    NGRAPH_SUPPRESS_DEPRECATED_START
+    auto full_path = file_util::path_join(model_dir, m_data_location);
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    file_util::convert_path_win_style(full_path);
+#endif
+    NGRAPH_SUPPRESS_DEPRECATED_END
+
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    try {
+        mapped_memory = map_external_file(full_path);
+    } catch (const std::runtime_error&) {
+        throw error::invalid_external_data{*this};
+    }
+
+    const auto file_size = mapped_memory->size();
+    if (m_offset + m_data_length > file_size) {
+        throw error::invalid_external_data{*this};
+    }
+
+    if (m_sha1_digest.size() > 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    // default value of m_offset is 0
+    const uint64_t map_data_length = m_data_length > 0 ? m_data_length : file_size - m_offset;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        mapped_memory->data() + m_offset,
+        map_data_length,
+        mapped_memory);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
@@ -6,9 +6,14 @@
 
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+using Buffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +28,16 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map (mmap for lin, MapViewOfFile for win) external data from tensor passed to constructor
+    ///
+    /// \note       The data file stays mapped as long as at least one returned buffer is alive,
+    ///             all tensors stored in one file share a single mapping.
+    ///             If mapping of the external file fails,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \return     External binary data viewed through a buffer backed by the file mapping
+    Buffer load_external_mmap_data(const std::string& model_dir) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
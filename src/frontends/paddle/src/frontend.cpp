@@ -9,6 +9,8 @@
 #include <fstream>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "decoder_proto.hpp"
@@ -141,6 +143,64 @@ std::istream* variant_to_stream_ptr(const ov::Any& variant, std::ifstream& ext_s
     FRONT_END_INITIALIZATION_CHECK(ext_stream && ext_stream.is_open(), "Cannot open model file.");
     return &ext_stream;
 }
+
+// Collects flags of the operations needed to compute the requested output tensors: walks back from
+// the fetch targets over tensor names and keeps every producer of a needed name (every producer,
+// since in-place operations may write the same name several times and the conversion loop relies
+// on the program order of those writes). Operations feeding only the pruned parts of the program,
+// e.g. heads that are not requested, are skipped by the conversion loop, which cuts the conversion
+// time and the number of created nodes proportionally to the cut.
+std::vector<bool> get_ops_needed_for_outputs(const std::vector<std::shared_ptr<OpPlace>>& op_places,
+                                             const std::vector<std::shared_ptr<TensorPlace>>& output_tensors) {
+    if (output_tensors.empty()) {
+        // no explicit fetch targets, keep the whole program
+        return std::vector<bool>(op_places.size(), true);
+    }
+    std::unordered_map<std::string, std::vector<size_t>> producers;
+    for (size_t op_ind = 0; op_ind < op_places.size(); ++op_ind) {
+        const auto& op_desc = op_places[op_ind]->get_desc();
+        if (op_desc.type() == "feed" || op_desc.type() == "fetch") {
+            continue;
+        }
+        for (const auto& port : op_desc.outputs()) {
+            for (const auto& var_name : port.arguments()) {
+                producers[var_name].push_back(op_ind);
+            }
+        }
+    }
+
+    std::vector<bool> needed(op_places.size(), false);
+    std::unordered_set<std::string> visited_names;
+    std::vector<std::string> names_to_visit;
+    for (const auto& output_tensor : output_tensors) {
+        names_to_visit.push_back(output_tensor->get_desc().name());
+    }
+    while (!names_to_visit.empty()) {
+        const auto var_name = names_to_visit.back();
+        names_to_visit.pop_back();
+        if (!visited_names.insert(var_name).second) {
+            continue;
+        }
+        const auto producers_it = producers.find(var_name);
+        if (producers_it == producers.end()) {
+            // the name is fed, frozen or belongs to the outer block
+            continue;
+        }
+        for (const auto op_ind : producers_it->second) {
+            if (needed[op_ind]) {
+                continue;
+            }
+            needed[op_ind] = true;
+            const auto& op_desc = op_places[op_ind]->get_desc();
+            for (const auto& port : op_desc.inputs()) {
+                for (const auto& in_var_name : port.arguments()) {
+                    names_to_visit.push_back(in_var_name);
+                }
+            }
+        }
+    }
+    return needed;
+}
 }  // namespace
 
 FrontEnd::FrontEnd() : m_op_translators(paddle::get_supported_ops()) {}
@@ -253,11 +313,16 @@ std::map<int32_t, std::shared_ptr<ov::Model>> FrontEnd::convert_each_node_recurs
     }
 
     const auto& op_places = model->get_op_places(block_idx);
-    for (const auto& op_place : op_places) {
+    const auto needed_ops = get_ops_needed_for_outputs(op_places, output_tensors);
+    for (size_t op_ind = 0; op_ind < op_places.size(); ++op_ind) {
+        const auto& op_place = op_places[op_ind];
         const auto& op_desc = op_place->get_desc();
         if (op_desc.type() == "feed" || op_desc.type() == "fetch") {
             // inputs and outputs are stored in the model already
             continue;
+        } else if (!needed_ops[op_ind]) {
+            // the operation does not contribute to any requested output
+            continue;
         } else {
             try_update_sublock_info(op_place, subblock_inputs_outputs);
 
@@ -5,6 +5,7 @@
 #include "translate_session.hpp"
 
 #include "input_model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "tf_framework_node.hpp"
 #include "utils.hpp"
@@ -126,8 +127,31 @@ void TranslateSession::translate_graph(const ov::frontend::InputModel::Ptr& inpu
         ng_op_map[input_name] = {param};
     }
 
+    // translate Constant nodes ahead of the main pass: they have no inputs, so each of them can be
+    // converted independently, and in big models they dominate both the operation count and the
+    // copied bytes. The main pass picks up the prepared outputs and keeps the serial order for
+    // everything that has to be connected to its producers.
+    std::vector<ov::OutputVector> prepared_consts(operation_places.size());
+    if (m_translator_map->count("Const")) {
+        const auto& const_translator = m_translator_map->at("Const");
+        ov::parallel_for(operation_places.size(), [&](size_t op_ind) {
+            const auto& operation_place = operation_places[op_ind];
+            const auto& operation_decoder = operation_place->get_decoder();
+            if (operation_decoder->get_op_type() != "Const" || ng_op_map.count(operation_place->get_names()[0])) {
+                return;
+            }
+            try {
+                NodeContext node_context(operation_decoder, {}, this);
+                prepared_consts[op_ind] = const_translator(node_context);
+            } catch (...) {
+                // leave the slot empty, the main pass re-translates the node with full error handling
+            }
+        });
+    }
+
     // create the OV ops from TensorFlow ops
-    for (const auto& operation_place : operation_places) {
+    for (size_t op_ind = 0; op_ind < operation_places.size(); ++op_ind) {
+        const auto& operation_place = operation_places[op_ind];
         auto operation_decoder = operation_place->get_decoder();
         auto operation_name = operation_place->get_names()[0];
         // output for parameter nodes has been already generated
@@ -200,7 +224,10 @@ void TranslateSession::translate_graph(const ov::frontend::InputModel::Ptr& inpu
         bool is_converted = false;
         auto operation_type = operation_decoder->get_op_type();
         try {
-            if (m_translator_map->count(operation_type)) {
+            if (!prepared_consts[op_ind].empty()) {
+                ov_outputs = prepared_consts[op_ind];
+                is_converted = true;
+            } else if (m_translator_map->count(operation_type)) {
                 auto translator = m_translator_map->at(operation_decoder->get_op_type());
                 NodeContext node_context(operation_decoder, ov_inputs, this);
                 ov_outputs = translator(node_context);
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -155,6 +156,49 @@ public:
      */
     virtual std::shared_ptr<RemoteContext> GetContext() const;
 
+    /**
+     * @brief Lightweight always-on inference counters of the executable network.
+     *
+     * The counters are relaxed atomics bumped by the ov::InferRequest wrapper on request
+     * submission and completion and aggregated only when read, so they add no measurable
+     * cost to the hot path. Snapshots are exposed through the ov::infer_counters property.
+     */
+    struct InferCounters {
+        /// power-of-two millisecond latency buckets: [0..1), [1..2), [2..4), ... , open-ended
+        static constexpr size_t histogramBuckets = 16;
+
+        std::atomic<uint64_t> requestCount{0};
+        std::atomic<uint64_t> latencyTotalUs{0};
+        std::atomic<uint64_t> latencyHistogram[histogramBuckets] = {};
+        std::atomic<int64_t> inFlight{0};
+        std::atomic<int64_t> peakInFlight{0};
+
+        void onSubmit() {
+            requestCount.fetch_add(1, std::memory_order_relaxed);
+            const auto current = inFlight.fetch_add(1, std::memory_order_relaxed) + 1;
+            auto peak = peakInFlight.load(std::memory_order_relaxed);
+            while (current > peak && !peakInFlight.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+            }
+        }
+
+        void onComplete(uint64_t latencyUs) {
+            inFlight.fetch_sub(1, std::memory_order_relaxed);
+            latencyTotalUs.fetch_add(latencyUs, std::memory_order_relaxed);
+            size_t bucket = 0;
+            for (uint64_t ms = latencyUs / 1000; ms > 0 && bucket < histogramBuckets - 1; ms >>= 1) {
+                ++bucket;
+            }
+            latencyHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief Returns the inference counters of the executable network
+     */
+    InferCounters& inferCounters() {
+        return _inferCounters;
+    }
+
     /**
      * @brief Raises the flag that model was loaded from cache
      */
@@ -213,6 +257,11 @@ protected:
      * @brief If true, it means that model was loaded from cache
      */
     bool _loadedFromCache = false;
+
+    /**
+     * @brief Inference counters exposed through the ov::infer_counters property
+     */
+    InferCounters _inferCounters;
 };
 
 /**
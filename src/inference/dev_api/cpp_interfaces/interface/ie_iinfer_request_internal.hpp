@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "cpp/ie_infer_request.hpp"
 #include "ie_common.h"
@@ -129,6 +131,25 @@ public:
      */
     virtual BatchedBlob::Ptr GetBlobs(const std::string& name);
 
+    /**
+     * @brief Set input/output data to infer using a model port
+     * @note Default implementation resolves the legacy blob name once per port and forwards to
+     * SetBlob(name, data). Plugins may override it to consume the data directly and skip the legacy
+     * name resolution and blob maps entirely.
+     * @param port - an input or output port of the model.
+     * @param data - a reference to input or output blob. The type of Blob must correspond to the port
+     * precision and size.
+     */
+    virtual void SetBlobByPort(const ov::Output<const ov::Node>& port, const Blob::Ptr& data);
+
+    /**
+     * @brief Get input/output data to infer using a model port
+     * @note Default implementation forwards to GetBlob(name) with the cached legacy name of the port
+     * @param port - an input or output port of the model.
+     * @return data - a reference to input or output blob.
+     */
+    virtual Blob::Ptr GetBlobByPort(const ov::Output<const ov::Node>& port);
+
     /**
      * @brief Sets pre-process for input data
      * @param name Name of input blob.
@@ -253,6 +274,13 @@ public:
     const std::vector<std::shared_ptr<const ov::Node>>& GetInputs() const;
     const std::vector<std::shared_ptr<const ov::Node>>& GetOutputs() const;
 
+    /**
+     * @brief Submission timestamp in microseconds of the in-flight asynchronous request,
+     * or -1 when the request is not in flight. Maintained by the ov::InferRequest wrapper
+     * to feed the per-network inference counters (see IExecutableNetworkInternal::InferCounters).
+     */
+    std::atomic<int64_t> _telemetryStartUs{-1};
+
     /**
      * @brief Sets inputs/outputs from ov::Model
      */
@@ -296,6 +324,13 @@ protected:
      */
     std::shared_ptr<const ov::Node> findOutputByNodeName(const std::string& name) const;
 
+    /**
+     * @brief Returns the legacy blob name of a model port, caching the result for further calls
+     * @param port An input or output port of the model
+     * @return A reference to the cached legacy name
+     */
+    const std::string& legacyNameFromPort(const ov::Output<const ov::Node>& port);
+
     /**
      * @brief Concatenates _batched_inputs into single blob before inference
      * It is expected that _batched_inputs map contains only valid BatchedBlob blobs with 2 or more blobs inside
@@ -343,6 +378,7 @@ protected:
     std::vector<std::shared_ptr<const ov::Node>> _results;     //!< A vector of function outputs
     std::map<std::string, PreProcessDataPtr> _preProcData;     //!< A map of pre-process data per input
     std::map<std::string, BatchedBlob::Ptr> _batched_inputs;   //!< A map of user passed blobs for network inputs
+    std::map<std::pair<const ov::Node*, size_t>, std::string> _legacyPortNames;  //!< Cached legacy blob names per model port
     int m_curBatch = -1;                                       //!< Current batch value used in dynamic batching
 
     /**
@@ -108,6 +108,14 @@ DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
  * @brief enable hyper thread
  */
 DECLARE_CONFIG_KEY(ENABLE_HYPER_THREAD);
+
+/**
+ * @brief Explicit logical processor ids per stream used instead of the formula based CORES binding.
+ *        The value is a ';' separated list of per stream core sets, where each set is a ',' separated
+ *        list of logical processor ids or inclusive 'first-last' ranges, e.g. "0-7;8-15"
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(STREAM_CORE_IDS);
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
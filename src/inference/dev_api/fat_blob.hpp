@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides the container format for ahead-of-time compiled "fat" blobs
+ *        holding one exported model per target configuration
+ * @file
+ */
+#pragma once
+
+#include <ie_api.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ov {
+
+/**
+ * @brief Describes one section of a fat blob.
+ *
+ * A section holds the regular blob exported for one target configuration. Sections are
+ * distinguished by the device name they were compiled for and, optionally, by the value
+ * of the DEVICE_ARCHITECTURE metric of that device, so several variants for the same
+ * device family (e.g. per-generation GPU blobs) can live in one artifact.
+ */
+struct FatBlobEntry {
+    std::string deviceName;    //!< Device name the section was compiled for
+    std::string architecture;  //!< DEVICE_ARCHITECTURE selector; empty matches any architecture
+    uint64_t offset = 0;       //!< Absolute offset of the section payload in the stream
+    uint64_t size = 0;         //!< Payload size in bytes
+};
+
+/**
+ * @brief Checks whether the stream starts with the fat blob magic.
+ *
+ * The stream position is restored, so a plain (single-target) blob can be handed to the
+ * plugin unchanged when this returns false.
+ */
+INFERENCE_ENGINE_API_CPP(bool) isFatBlob(std::istream& stream);
+
+/**
+ * @brief Reads the fat blob header and returns the section index.
+ *
+ * The stream is left positioned right after the header; use FatBlobEntry::offset to reach
+ * a particular section.
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<FatBlobEntry>) readFatBlobIndex(std::istream& stream);
+
+/**
+ * @brief Selects the section matching the device and positions the stream at its payload.
+ *
+ * Among the sections compiled for @p deviceName a section with the matching
+ * @p architecture wins; a section with an empty selector is the fallback. Throws when no
+ * section fits, listing the targets the blob was compiled for.
+ */
+INFERENCE_ENGINE_API_CPP(void)
+seekFatBlobSection(std::istream& stream, const std::string& deviceName, const std::string& architecture);
+
+/**
+ * @brief Writes a fat blob assembled from already exported per-target blobs.
+ *
+ * @param stream        Destination stream
+ * @param deviceNames   Device name of each section, one per blob
+ * @param architectures DEVICE_ARCHITECTURE selector of each section; empty entries match any
+ * @param blobs         Exported blob payloads
+ */
+INFERENCE_ENGINE_API_CPP(void)
+writeFatBlob(std::ostream& stream,
+             const std::vector<std::string>& deviceNames,
+             const std::vector<std::string>& architectures,
+             const std::vector<std::string>& blobs);
+
+}  // namespace ov
@@ -33,6 +33,15 @@ INFERENCE_ENGINE_API_CPP(bool) checkOpenMpEnvVars(bool includeOMPNumThreads = tr
  */
 INFERENCE_ENGINE_API_CPP(std::vector<int>) getAvailableNUMANodes();
 
+/**
+ * @brief      Returns the logical processors of the given NUMA node (Linux only; an empty vector
+ *             is returned on the other OSes and for an unknown node)
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  numaNodeId  A node id as reported by getAvailableNUMANodes()
+ * @return     Logical processor ids of the node
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) getNumaNodeProcessors(int numaNodeId);
+
 /**
  * @brief      Returns available CPU cores types (on Linux, and Windows) and ONLY with TBB, single core type is assumed
  * otherwise
@@ -42,6 +42,49 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Schedules the task to a stream selected by the affinity key.
+     *        Tasks sharing a key are executed by the same stream thread, so consecutive requests
+     *        of one logical session (e.g. one camera) preferentially reuse the warm caches and
+     *        the NUMA-local data of that stream. A key is bound to a stream on first use in a
+     *        round-robin fashion and the binding stays sticky for the executor lifetime.
+     * @param task A task to start
+     * @param affinityKey A user-supplied session key
+     */
+    void run(Task task, std::size_t affinityKey);
+
+    /**
+     * @brief Priority classes honored when the tasks are dequeued by the stream threads
+     */
+    enum class TaskPriority { High = 0, Normal = 1, Low = 2 };
+
+    /**
+     * @brief Schedules the task with an explicit priority class. Pending high priority tasks
+     *        are always dequeued before normal ones and normal ones before low, so interactive
+     *        traffic does not queue behind batch backfill jobs sharing the executor.
+     * @param task A task to start
+     * @param priority A priority class of the task
+     * @param owner An opaque tag of the entity the task belongs to; a cooperative preemption
+     *        point never picks up a task carrying the tag of its caller (see RunHighPriorityTask)
+     */
+    void run(Task task, TaskPriority priority, const void* owner);
+
+    /**
+     * @brief Cheap check for pending high priority tasks, suitable for per-node polling
+     * @return `True` if at least one high priority task is waiting in the queue
+     */
+    bool HasHighPriorityTasksPending() const;
+
+    /**
+     * @brief Executes one pending high priority task on the calling thread. This is the
+     *        cooperative preemption primitive: a low priority workload calls it at its
+     *        preemption points and thereby lends its stream to the waiting task. Tasks tagged
+     *        with @p currentOwner are skipped, as the caller's own state is busy mid-execution.
+     * @param currentOwner The tag the caller used when scheduling its own tasks
+     * @return `True` if a task was executed
+     */
+    bool RunHighPriorityTask(const void* currentOwner);
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
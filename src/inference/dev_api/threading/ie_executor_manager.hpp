@@ -46,6 +46,25 @@ public:
     /// @private
     virtual IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) = 0;
 
+    /**
+     * @brief Returns a view of the process-wide shared CPU streams executor
+     *
+     * In contrast to getIdleCPUStreamsExecutor, which hands the whole pool of stream threads to a single
+     * owner, the pool behind this call is shared by all callers, so several executable networks loaded
+     * into one process do not oversubscribe CPU cores with a pool each. Every view admits at most
+     * @p streamsQuota of its tasks into the pool at a time and queues the rest locally, which keeps the
+     * pool occupancy of each network proportional to its quota while still letting the streams of an
+     * idle network execute tasks of a busy one.
+     * @param config A streams executor configuration; the pool is created on first use from this
+     * configuration with the number of streams raised to cover the whole machine, subsequent callers
+     * share the already created pool
+     * @param streamsQuota The maximum number of pool streams the view may occupy at a time; value 0
+     * means the number of streams from @p config
+     * @return A shared pointer to the view over the shared executor
+     */
+    virtual IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                              int streamsQuota = 0) = 0;
+
     /**
      * @cond
      */
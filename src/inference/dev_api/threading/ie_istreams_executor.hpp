@@ -104,6 +104,9 @@ public:
         int _threads_per_stream_small = 0;  //!< Threads per stream in small cores
         int _small_core_offset = 0;         //!< Calculate small core start offset when binding cpu cores
         bool _enable_hyper_thread = true;   //!< enable hyper thread
+        std::vector<std::vector<int>> _stream_core_ids = {};  //!< Explicit logical processor ids per stream.
+                                                              //!< When non-empty, overrides the formula based
+                                                              //!< CORES binding and the per stream concurrency
         enum StreamMode { DEFAULT, AGGRESSIVE, LESSAGGRESSIVE };
         enum PreferredCoreType {
             ANY,
@@ -42,5 +42,299 @@ DECLARE_CPU_CONFIG_KEY(DENORMALS_OPTIMIZATION);
 
 DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_DECOMPRESSION_RATE);
 
+/**
+ * @brief The name for defining if constant weights are replicated on each NUMA node
+ *
+ * By default all streams share one copy of the model weights, which resides on the NUMA node
+ * where the model was compiled, so streams running on another socket access them remotely.
+ * When this option is enabled each NUMA node gets its own local replica of the weights at the
+ * cost of extra memory proportional to the number of nodes.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(WEIGHTS_NUMA_REPLICATION);
+
+/**
+ * @brief The name for defining the maximum number of nodes executed concurrently within a stream
+ *
+ * By default all nodes of a graph are executed one by one in topological order, so independent
+ * branches (e.g. parallel projections of an attention block) serialize. Setting this option to a
+ * positive number lets the plugin execute data-independent nodes concurrently, using at most the
+ * given number of threads per stream. Zero (the default) keeps the sequential execution.
+ * Note: to make concurrent execution safe, intermediate memory reuse between nodes is disabled
+ * for the model, which increases its memory consumption.
+ */
+DECLARE_CPU_CONFIG_KEY(INTRA_GRAPH_PARALLELISM);
+
+/**
+ * @brief The name for defining if the source model is released once the graphs are compiled
+ *
+ * After compilation every constant is either copied into the execution graphs (repacked weights)
+ * or used in place, so the model kept by the executable network only backs ExportNetwork().
+ * Enabling this option drops that copy right after compilation, reducing memory consumption at
+ * the cost of ExportNetwork() (and therefore model caching) no longer being available for the
+ * compiled model.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(RELEASE_SOURCE_WEIGHTS);
+
+/**
+ * @brief The name for defining if hardware counters are sampled around every node execution
+ *
+ * Extends the regular performance counters (PluginConfigParams::KEY_PERF_COUNT must be enabled as
+ * well) with per-node PMU statistics collected through the Linux perf_event interface: IPC,
+ * last-level-cache miss rate and an estimate of the DRAM bandwidth. The derived metrics are
+ * reported as a suffix of the exec_type field of the profiling info. The option has no effect on
+ * platforms where perf events are unavailable.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(PMU_PERF_COUNT);
+
+/**
+ * @brief The name for defining the file the per-node execution timeline is dumped to
+ *
+ * The regular performance counters report flat per-node averages, which is not enough to see how
+ * the infer requests of concurrent streams interleave in time. When this option is set to a file
+ * path, every node execution is recorded with its begin/end timestamps and the merged timeline of
+ * all streams is dumped to the file in the Chrome trace event format (loadable into
+ * chrome://tracing or Perfetto), appending the events of each request as it finishes. An empty
+ * value (the default) disables tracing, in which case the execution path stays unaffected.
+ * It is passed to Core::SetConfig() with a file path as the value
+ */
+DECLARE_CPU_CONFIG_KEY(EXECUTION_TRACE);
+
+/**
+ * @brief The name for defining if the network executes on the process-wide shared pool of CPU streams
+ *
+ * By default every executable network creates its own pool of stream threads, so a process that
+ * loads several networks runs more streams than the machine has cores and the networks evict each
+ * other's caches. When this option is enabled the network submits its infer requests to a single
+ * pool shared by all networks that enabled it, occupying at most its own number of streams at a
+ * time; pool streams left idle by one network pick up the queued requests of the busy ones. The
+ * share of the pool a network may occupy is additionally weighted by ov::hint::model_priority.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(STREAMS_POOL_SHARING);
+
+/**
+ * @brief The name for defining if large plugin allocations are backed with huge pages
+ *
+ * Weights and scratch buffers of big models cover gigabytes of address space, so walking them
+ * with regular 4K pages wastes a noticeable share of cycles in dTLB misses. When this option is
+ * enabled the plugin advises the kernel to back every sufficiently large allocation with
+ * transparent huge pages (Linux madvise(MADV_HUGEPAGE)); when huge pages cannot be provided the
+ * kernel silently keeps regular ones. The setting applies to the whole process once enabled and
+ * has no effect on platforms without such advice.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(HUGE_PAGES);
+
+/**
+ * @brief The name for defining if node implementations are re-selected by measurement at runtime
+ *
+ * Implementations are normally picked once at compile time by static heuristics, which choose a
+ * suboptimal convolution algorithm for a small share of layers. When this option is enabled a node
+ * that has a viable alternative implementation alternates between the chosen one and the
+ * alternative during a short warm-up window of the first infer requests, measures both and locks
+ * in the faster one. The first inferences get proportionally slower, so the option only pays off
+ * for long-running workloads.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(ADAPTIVE_IMPL_SELECTION);
+
+/**
+ * @brief The name for defining if the transformation pipeline stores resumable checkpoints
+ *
+ * Compiling a very large model spends most of its time in the transformation pipeline, and a
+ * crash or an eviction in the middle of it restarts the compilation from zero. When this option
+ * is enabled the plugin serializes the intermediate model into the cache directory
+ * (CONFIG_KEY(CACHE_DIR) must be set as well) after each expensive pipeline stage, so a retried
+ * compilation of the same model resumes from the last completed stage. The checkpoints are
+ * removed once the compilation succeeds; a checkpoint left by a different machine or model is
+ * ignored.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(COMPILATION_CHECKPOINTING);
+
+/**
+ * @brief The name for defining the memory budget of a compiled model in bytes
+ *
+ * Every stream of a compiled model materializes its own copy of the graph (the workspace of the
+ * intermediate tensors plus the run-time scratch pad), so the memory consumption grows with the
+ * number of busy streams and a model co-located with a strict container limit gets killed instead
+ * of slowing down. When a positive budget is set, a stream materializes its own graph copy only
+ * while the accounted consumption stays below the budget; past it the infer requests queue on the
+ * already materialized graphs, trading throughput for staying below the limit. Zero (the default)
+ * keeps the consumption unlimited. The accounted bytes are reported by the
+ * CPU_CONFIG_KEY(MEMORY_USAGE) metric of the compiled model.
+ * It is passed to Core::SetConfig() with the number of bytes as the value
+ */
+DECLARE_CPU_CONFIG_KEY(MEMORY_BUDGET);
+
+/**
+ * @brief The name of the read-only compiled model metric reporting the accounted memory consumption
+ *
+ * Returns a map from a stream name ("stream_N") to the bytes owned by the graph copy of that
+ * stream, plus a "total" entry. Constant weights are not accounted since they are shared between
+ * the streams (and, through the weights cache, between the models compiled from identical sources).
+ */
+DECLARE_CPU_CONFIG_KEY(MEMORY_USAGE);
+
+/**
+ * @brief The name for defining a common record budget of the runtime caches
+ *
+ * A long-running process that keeps receiving new tensor shapes accumulates records in the
+ * per-shape runtime caches (the plugin parameter cache and the process-wide oneDNN primitive
+ * cache), which shows up as slow RSS creep. The budget caps the number of records each of these
+ * caches may hold: past it the least recently used records are evicted, so the footprint of the
+ * caches stops growing while the hot shapes stay cached. Zero disables the runtime caching
+ * entirely. The record sizes vary with the cached object, so the budget is expressed in records,
+ * the same unit the oneDNN primitive cache uses. Current occupancy is reported by the
+ * CPU_CONFIG_KEY(RUNTIME_CACHE_STATISTICS) metric of the compiled model.
+ * It is passed to Core::SetConfig() with the number of records as the value
+ */
+DECLARE_CPU_CONFIG_KEY(RUNTIME_CACHE_BUDGET);
+
+/**
+ * @brief The name of the read-only compiled model metric reporting the runtime cache growth
+ *
+ * Returns a map with the record count, the LRU eviction count and the hit/miss counters of the
+ * parameter cache of the calling stream's graph copy (every stream owns an identical cache), plus
+ * the configured oneDNN primitive cache capacity. Intended for allocation watchdogs of
+ * long-running deployments to decide when to tighten CPU_CONFIG_KEY(RUNTIME_CACHE_BUDGET).
+ */
+DECLARE_CPU_CONFIG_KEY(RUNTIME_CACHE_STATISTICS);
+
+/**
+ * @brief The name for defining explicit per-stream core sets for a compiled model
+ *
+ * When several models share one process, the formula-based stream placement of each model is
+ * computed in isolation, so their streams land on overlapping cores and evict each other's
+ * caches. This option assigns every stream of the compiled model an explicit set of logical
+ * processors: the number of sets defines the number of placements (streams wrap around it), and
+ * the size of a set defines the intra-op concurrency of the streams it hosts. For example, a
+ * latency-critical model can be compiled with "0-7;8-15" (2 streams by 8 threads) while a batch
+ * model runs beside it on "16-19;20-23;24-27;28-31" and further cores. The sets are given as a
+ * ';' separated list, each set being a ',' separated list of logical processor ids or inclusive
+ * 'first-last' ranges. Ids outside the process affinity mask are left unused.
+ * It is passed to Core::SetConfig() or LoadNetwork() per compiled model
+ */
+DECLARE_CPU_CONFIG_KEY(STREAM_CORE_IDS);
+
+/**
+ * @brief The name for defining if inference of an unchanged frame is replaced by the cached outputs
+ *
+ * Consecutive frames of a stationary video feed are often byte-identical, yet every one of them
+ * pays for a full inference. When this option is enabled each infer request keeps a copy of its
+ * previous inputs and outputs; a frame whose inputs compare equal to the previous ones skips the
+ * execution entirely and the cached outputs are replayed. The comparison works on the raw input
+ * bytes, so any change, however small, triggers a full inference. Stateful models and models with
+ * dynamic input shapes always run in full since their outputs depend on more than the inputs. The
+ * copies cost one extra input and output sized buffer per infer request.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(DELTA_INFERENCE);
+
+/**
+ * @brief The name for defining if packed weights are shared between the processes of one host
+ *
+ * Fleet-style deployments run several identical worker processes per host, each mapping its own
+ * copy of the packed constant buffers. When this option is enabled the first process publishes
+ * each packed buffer into a named shared memory segment under /dev/shm, keyed by the content
+ * hash of the weights, and the other processes map it read-only, so one physical copy backs all
+ * the workers. The segments persist until removed, therefore a restarted worker reuses the warm
+ * segments immediately; a segment which does not match the expected size falls back to a private
+ * copy. The option applies to the whole process once enabled and is silently ignored on
+ * platforms without /dev/shm.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(WEIGHTS_SHM_SHARING);
+
+/**
+ * @brief The name for defining if a batch-N infer request is split across the streams
+ *
+ * The inverse of automatic batching: the network stays compiled with its original (small)
+ * batch, and an infer request fed with blobs whose batch is a multiple of it slices them along
+ * the batch dimension into zero-copy views and runs one per-stream sub-request per slice, so
+ * the slices execute concurrently on the configured streams and the outputs are written
+ * straight into the full-batch blobs. Engaged only for stateless networks with static shapes
+ * whose input and output batch dimension can be tracked; requests over other networks and
+ * requests which do not set full-batch blobs behave as usual.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(BATCH_SPLITTING);
+
+/**
+ * @brief The name for defining the resident working-set budget of streamed weights in bytes
+ *
+ * A model whose weights are larger than the physical memory of the machine cannot keep them all
+ * resident: the weights stay mmap-backed by the model file and the kernel pages them in and out
+ * under pressure, so by default every inference stalls in page faults at unpredictable points.
+ * When a positive budget is set, a background thread per stream walks the execution order ahead
+ * of the computation, advising the weights of the upcoming nodes into memory up to the given
+ * number of bytes and advising the already consumed ones out, so the faults overlap with the
+ * compute of the preceding nodes and the resident set stays near the budget. Throughput is
+ * traded for the ability to run at all; weights repacked into private buffers at compilation
+ * time are not streamed and stay permanently resident. Zero (the default) disables streaming.
+ * The option has no effect on platforms without memory advice support.
+ * It is passed to Core::SetConfig() with the number of bytes as the value
+ */
+DECLARE_CPU_CONFIG_KEY(WEIGHTS_STREAMING_BUDGET);
+
+/**
+ * @brief The name for defining the file the annotated execution graph is dumped to
+ *
+ * Serializes the execution graph of the compiled model into an IR file ('cout' prints a short
+ * per-node summary to the standard output instead): every node carries the chosen implementation
+ * (including the instruction set), the runtime precisions, the memory formats and, once the model
+ * is released, the average execution time accumulated over its lifetime (per-node times require
+ * PluginConfigParams::KEY_PERF_COUNT to be enabled as well). The file is written right after the
+ * compilation and refreshed with the runtime annotations when the model is released. Unlike the
+ * debug-caps facilities this dump is available in release builds, so production behavior can be
+ * diagnosed without redeploying a debug build. An empty value (the default) disables the dump.
+ * It is passed to Core::SetConfig() with a '*.xml' file path or 'cout' as the value
+ */
+DECLARE_CPU_CONFIG_KEY(EXEC_GRAPH_DUMP);
+
+/**
+ * @brief The name for defining if the model compilation is tiered for a fast cold start
+ *
+ * When enabled the plugin first compiles a single bring-up graph with the graph-level fusions
+ * skipped, which takes a fraction of the full compile, and starts serving infer requests from it
+ * right away. The fully optimized per-stream graphs compile in the background on the stream
+ * threads and every stream migrates to its optimized graph as soon as it is ready, so the
+ * throughput temporarily degrades instead of the model being unavailable for the whole compile
+ * time (a freshly autoscaled instance can take traffic within seconds). The bring-up graph is
+ * shared by all the streams and is kept allocated for the model lifetime. Stateful models are
+ * compiled the regular synchronous way, since their variable state lives inside the executing
+ * graph and would not survive the migration. Disabled by default.
+ * It is passed to Core::SetConfig() with PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(TIERED_COMPILATION);
+
+/**
+ * @brief The name for defining if compiled models are shared between identical compilations
+ *
+ * When enabled the plugin hashes the model together with the compile options on every
+ * LoadNetwork call and, when an executable network compiled from an identical model with
+ * identical options is still alive, hands it out instead of compiling a new one. The duplicates
+ * then share one set of stream graphs, packed weights and kernels: an ensemble that instantiates
+ * the same model several times pays its compile time and memory once. The sharing is
+ * transparent - infer requests stay independent - but stateful models are excluded, since their
+ * variable state lives in the executable network and must not leak between the nominally
+ * independent instances. Disabled by default.
+ * It is passed to Core::SetConfig() with PluginConfigParams::YES or PluginConfigParams::NO
+ */
+DECLARE_CPU_CONFIG_KEY(CROSS_MODEL_SHARING);
+
 }  // namespace CPUConfigParams
 }  // namespace InferenceEngine
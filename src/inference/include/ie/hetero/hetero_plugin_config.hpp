@@ -34,5 +34,18 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for a directory with measured per-operation device cost tables used for
+ * automatic affinity assignment.
+ * The directory is expected to contain one <device_name>.costs text file per fallback device
+ * with "<op_type> <cost_in_microseconds>" lines (plus an optional "__transfer_per_byte__"
+ * entry with the cost of moving one byte across the device boundary). When tables are
+ * available for at least two fallback devices, the plugin splits the network to minimize the
+ * estimated end-to-end latency including transfer costs instead of the plain priority-order
+ * fallback. The tables can be produced with the benchmark tooling and kept in the model cache
+ * directory.
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_TABLE_PATH);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
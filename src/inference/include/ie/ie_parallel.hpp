@@ -44,5 +44,6 @@ using ov::parallel_sum;
 using ov::parallel_sum2d;
 using ov::parallel_sum3d;
 using ov::splitter;
+using ov::task_group;
 
 }  // namespace InferenceEngine
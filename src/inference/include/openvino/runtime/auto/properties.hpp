@@ -18,5 +18,12 @@ namespace intel_auto {
  */
 static constexpr Property<bool> device_bind_buffer{"DEVICE_BIND_BUFFER"};
 
+/**
+ * @brief auto device setting that keeps the CPU helper network alive after the selected device is
+ * ready and migrates the overflow traffic to it at runtime, based on the devices load and the
+ * observed request latency
+ */
+static constexpr Property<bool> runtime_load_balancing{"RUNTIME_LOAD_BALANCING"};
+
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
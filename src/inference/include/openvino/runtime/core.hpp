@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -197,6 +198,40 @@ public:
      */
     CompiledModel compile_model(const std::string& model_path, const AnyMap& properties = {});
 
+    /**
+     * @brief Asynchronously creates a compiled model from a source model object.
+     *
+     * The whole compilation pipeline (transformations and plugin compilation) runs on a
+     * background thread taken from the internal executor pool, so compilation of several
+     * models can be overlapped by issuing multiple asynchronous requests before waiting
+     * on the returned futures.
+     *
+     * @param model Model object acquired from Core::read_model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future that provides the compiled model (or rethrows the compilation error) on get().
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Asynchronously reads and compiles a model from the IR/ONNX/PDPD file.
+     *
+     * Model reading, transformations and plugin compilation all happen on a background
+     * thread, so several models can be read and compiled concurrently.
+     *
+     * @param model_path Path to a model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future that provides the compiled model (or rethrows the compilation error) on get().
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
     /**
      * @brief Reads and loads a compiled model from IR / ONNX / PDPD file to the default OpenVINI device selected by
      * AUTO plugin.
@@ -49,5 +49,153 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
 
 static constexpr Property<float> sparse_weights_decompression_rate{"SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines whether model weights are replicated on each NUMA node.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * By default all inference streams share a single copy of the weights, which is allocated on the
+ * NUMA node that compiled the model, so streams pinned to another socket access the weights over
+ * the inter-socket link. Enabling this property keeps one replica of the constant weights per NUMA
+ * node and each stream uses the local one, trading additional memory (one model copy per node) for
+ * multi-socket throughput.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::weights_numa_replication(true)); // enable weights replication
+ * @endcode
+ */
+static constexpr Property<bool> weights_numa_replication{"CPU_WEIGHTS_NUMA_REPLICATION"};
+
+/**
+ * @brief This property caps the number of graph nodes executed concurrently within one stream.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When set to a positive value, data-independent nodes of the execution graph are scheduled
+ * concurrently (a dependency-counting scheduler over the graph edges), which speeds up models
+ * with wide parallel branches. The value limits how many threads one stream may occupy.
+ * The default value 0 keeps the sequential per-stream execution. Enabling the feature disables
+ * intermediate-tensor memory reuse for the model, so its memory consumption grows.
+ */
+static constexpr Property<int32_t> intra_graph_parallelism{"CPU_INTRA_GRAPH_PARALLELISM"};
+
+/**
+ * @brief This property defines whether the source model is released after compilation.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Once the execution graphs are built, every constant has either been repacked into the graphs
+ * or is used in place, so the model retained by the compiled model only serves the export
+ * (model caching) path. Enabling this property drops the retained model right after compilation,
+ * releasing the buffers of all repacked constants. Exporting such a compiled model is not
+ * possible, so the property must not be combined with model caching.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::release_source_weights(true)); // release weights after compile
+ * @endcode
+ */
+static constexpr Property<bool> release_source_weights{"CPU_RELEASE_SOURCE_WEIGHTS"};
+
+/**
+ * @brief This property defines whether hardware counters are sampled around every node execution.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When enabled together with ov::enable_profiling, each node execution additionally samples the
+ * CPU performance monitoring unit (through the Linux perf_event interface) and the profiling info
+ * reports the per-node IPC, last-level-cache miss rate and an estimate of the DRAM bandwidth as a
+ * suffix of the exec_type field. This helps to tell memory-bound nodes from compute-bound ones
+ * without external tooling. On platforms where perf events are unavailable (non-Linux systems,
+ * restricted perf_event_paranoid, some containers) the option is silently ignored.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::pmu_perf_count(true)); // sample PMU counters per node
+ * @endcode
+ */
+static constexpr Property<bool> pmu_perf_count{"CPU_PMU_PERF_COUNT"};
+
+/**
+ * @brief This property defines the file the per-node execution timeline is dumped to.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * While ov::enable_profiling reports flat per-node averages, diagnosing how the infer requests of
+ * concurrent streams interfere needs timelines. When this property is set to a file path, every
+ * node execution is recorded with its begin/end timestamps and the merged timeline of all streams
+ * is dumped to the file in the Chrome trace event format (loadable into chrome://tracing or
+ * Perfetto), appending the events of each request as it finishes. An empty value (the default)
+ * disables tracing, in which case the execution path stays unaffected.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::execution_trace("cpu_trace.json")); // dump the execution timeline
+ * @endcode
+ */
+static constexpr Property<std::string> execution_trace{"CPU_EXECUTION_TRACE"};
+
+/**
+ * @brief This property defines the resident working-set budget of streamed weights in bytes.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Lets a model whose mmap-backed weights exceed the physical memory run at all: a background
+ * thread per stream walks the execution order ahead of the computation, advising the weights of
+ * the upcoming nodes into memory up to the given number of bytes and the already consumed ones
+ * out, so the page faults overlap with compute and the resident set stays near the budget.
+ * Weights repacked at compilation time are not streamed. Zero (the default) disables streaming.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::weights_streaming_budget(8ull << 30)); // keep ~8 GB resident
+ * @endcode
+ */
+static constexpr Property<uint64_t> weights_streaming_budget{"CPU_WEIGHTS_STREAMING_BUDGET"};
+
+/**
+ * @brief This property defines the file the annotated execution graph is dumped to.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Serializes the execution graph into an IR file ('cout' prints a short summary to the standard
+ * output): every node carries the chosen implementation (including the instruction set), the
+ * runtime precisions and memory formats, and - once the model is released - the average execution
+ * time accumulated over its lifetime (per-node times require ov::enable_profiling). Available in
+ * release builds, so production behavior can be diagnosed without a debug redeployment. An empty
+ * value (the default) disables the dump.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::exec_graph_dump("exec_graph.xml")); // dump the annotated graph
+ * @endcode
+ */
+static constexpr Property<std::string> exec_graph_dump{"CPU_EXEC_GRAPH_DUMP"};
+
+/**
+ * @brief Compile the model in tiers for a fast cold start.
+ *
+ * When enabled the plugin serves the first infer requests from a quickly built bring-up graph
+ * (graph-level fusions are skipped) while the fully optimized per-stream graphs compile in the
+ * background; every stream migrates to its optimized graph as soon as it is ready. Useful for
+ * autoscaled deployments where a new instance must take traffic before the full compile
+ * finishes. Stateful models fall back to the regular synchronous compilation.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The following code puts the freshly compiled model behind traffic right away:
+ * @code
+ * ov::Core core;
+ * auto model = core.compile_model("model.xml", "CPU", ov::intel_cpu::tiered_compilation(true));
+ * @endcode
+ */
+static constexpr Property<bool> tiered_compilation{"CPU_TIERED_COMPILATION"};
+
+/**
+ * @brief Share compiled models between identical compilations.
+ *
+ * When enabled, compiling a model that is identical (by structural hash, constants included) to
+ * an already compiled and still alive one with the same options returns the existing compiled
+ * model, so duplicated instances share graphs, packed weights and kernels instead of each paying
+ * the full compile time and memory. Infer requests created from the instances stay independent;
+ * stateful models are excluded from the sharing.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * @code
+ * ov::Core core;
+ * core.set_property("CPU", ov::intel_cpu::cross_model_sharing(true));
+ * auto a = core.compile_model(model, "CPU");
+ * auto b = core.compile_model(model, "CPU");  // shares the compilation of `a`
+ * @endcode
+ */
+static constexpr Property<bool> cross_model_sharing{"CPU_CROSS_MODEL_SHARING"};
+
 }  // namespace intel_cpu
 }  // namespace ov
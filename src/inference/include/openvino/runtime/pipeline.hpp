@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides Pipeline.
+ *
+ * @file openvino/runtime/pipeline.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+
+/**
+ * @brief This class chains several compiled models into one inference pipeline.
+ *
+ * An infer request is created per stage and every stage output is wired to the matching input of
+ * the next stage at construction time: the ports are matched by shared tensor names when possible
+ * and by position otherwise, and the producer request's output tensor is set as the consumer
+ * request's input tensor. Adjacent stages therefore share one buffer - no copy and no per-frame
+ * descriptor validation happens between them. Element type or shape mismatches between chained
+ * stages are reported once, from the constructor.
+ * @ingroup ov_runtime_cpp_api
+ */
+class OPENVINO_RUNTIME_API Pipeline {
+    std::vector<CompiledModel> _models;
+    std::vector<InferRequest> _requests;
+
+public:
+    /**
+     * @brief Default constructor.
+     */
+    Pipeline() = default;
+
+    /**
+     * @brief Constructs a pipeline from compiled models in execution order.
+     * @param stages Compiled models, each consuming the outputs of the previous one.
+     */
+    explicit Pipeline(const std::vector<CompiledModel>& stages);
+
+    /**
+     * @brief Runs all the stages in order, synchronously.
+     */
+    void infer();
+
+    /**
+     * @brief Sets an input tensor of the first stage.
+     * @param idx Index of the first stage input.
+     * @param tensor Reference to the tensor.
+     */
+    void set_input_tensor(size_t idx, const Tensor& tensor);
+
+    /**
+     * @brief Sets the input tensor of the first stage when it has a single input.
+     * @param tensor Reference to the tensor.
+     */
+    void set_input_tensor(const Tensor& tensor);
+
+    /**
+     * @brief Gets an input tensor of the first stage.
+     * @param idx Index of the first stage input.
+     * @return Tensor of the first stage input.
+     */
+    Tensor get_input_tensor(size_t idx);
+
+    /**
+     * @brief Gets the input tensor of the first stage when it has a single input.
+     * @return Tensor of the first stage input.
+     */
+    Tensor get_input_tensor();
+
+    /**
+     * @brief Gets an output tensor of the last stage.
+     * @param idx Index of the last stage output.
+     * @return Tensor of the last stage output.
+     */
+    Tensor get_output_tensor(size_t idx);
+
+    /**
+     * @brief Gets the output tensor of the last stage when it has a single output.
+     * @return Tensor of the last stage output.
+     */
+    Tensor get_output_tensor();
+
+    /**
+     * @brief Returns the number of chained stages.
+     * @return Number of stages.
+     */
+    size_t get_stage_count() const;
+
+    /**
+     * @brief Gives access to an individual stage request, e.g. to query profiling info or to set
+     * an extra input the previous stage does not produce.
+     * @param idx Index of the stage in execution order.
+     * @return Reference to the stage infer request.
+     */
+    InferRequest& get_stage_request(size_t idx);
+};
+
+}  // namespace ov
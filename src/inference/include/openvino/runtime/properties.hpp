@@ -287,6 +287,54 @@ inline std::istream& operator>>(std::istream& is, Priority& priority) {
  */
 static constexpr Property<Priority> model_priority{"MODEL_PRIORITY"};
 
+/**
+ * @brief Enum to define possible core types to run inference threads on (for hybrid CPUs)
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+enum class SchedulingCoreType {
+    ANY_CORE = 0,    //!<  Any core can be used, selection is left to the device
+    PCORE_ONLY = 1,  //!<  Schedule inference threads on the performance cores only
+    ECORE_ONLY = 2,  //!<  Schedule inference threads on the efficiency cores only
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const SchedulingCoreType& core_type) {
+    switch (core_type) {
+    case SchedulingCoreType::ANY_CORE:
+        return os << "ANY_CORE";
+    case SchedulingCoreType::PCORE_ONLY:
+        return os << "PCORE_ONLY";
+    case SchedulingCoreType::ECORE_ONLY:
+        return os << "ECORE_ONLY";
+    default:
+        throw ov::Exception{"Unsupported scheduling core type hint"};
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, SchedulingCoreType& core_type) {
+    std::string str;
+    is >> str;
+    if (str == "ANY_CORE") {
+        core_type = SchedulingCoreType::ANY_CORE;
+    } else if (str == "PCORE_ONLY") {
+        core_type = SchedulingCoreType::PCORE_ONLY;
+    } else if (str == "ECORE_ONLY") {
+        core_type = SchedulingCoreType::ECORE_ONLY;
+    } else {
+        throw ov::Exception{"Unsupported scheduling core type: " + str};
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Hint restricting the core types inference threads may run on (for hybrid CPUs)
+ * On hybrid processors the device by default decides on the core types per performance hint
+ * (e.g. the latency case prefers the performance cores); this hint overrides that decision.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<SchedulingCoreType> scheduling_core_type{"SCHEDULING_CORE_TYPE"};
+
 /**
  * @brief Enum to define possible performance mode hints
  * @ingroup ov_runtime_cpp_prop_api
@@ -472,6 +520,24 @@ static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
  */
 static constexpr Property<bool, PropertyMutability::RO> loaded_from_cache{"LOADED_FROM_CACHE"};
 
+/**
+ * @brief Read-only property of ov::CompiledModel with lightweight always-on inference counters
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * Property returns an ov::AnyMap with the following entries, accumulated since the model was
+ * compiled:
+ *  - "request_count" (uint64_t) - number of submitted inference requests
+ *  - "latency_total_us" (uint64_t) - summed request latency in microseconds
+ *  - "latency_histogram_ms" (std::vector<uint64_t>) - request count per power-of-two
+ *    millisecond bucket: [0..1), [1..2), [2..4), ... with the last bucket open-ended
+ *  - "in_flight" (int64_t) - requests submitted but not yet completed
+ *  - "peak_in_flight" (int64_t) - maximum of "in_flight" observed so far
+ *
+ * The counters are plain relaxed atomics updated on request submission and completion, so
+ * querying them does not perturb the measured pipeline.
+ */
+static constexpr Property<AnyMap, PropertyMutability::RO> infer_counters{"INFER_COUNTERS"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  * @ingroup ov_runtime_cpp_prop_api
@@ -533,6 +599,21 @@ static constexpr Property<std::tuple<unsigned int, unsigned int, unsigned int>,
  */
 static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FORCE_TBB_TERMINATE"};
 
+/**
+ * @brief Read-only property to get per-stage peak memory statistics of the last model compilation.
+ *
+ * Property returns a map from a compilation stage name (e.g. "read_model", "compile") to the peak
+ * resident set size in kilobytes observed while the stage was running. The counters are collected
+ * on Linux only, and only when the OV_COMPILATION_MEMORY_PROFILE environment variable is set
+ * (the collection resets the peak-RSS counter of the whole process, so it must be asked for
+ * explicitly); otherwise the map is empty. The numbers are meaningful for serialized
+ * compilations only - concurrently compiling threads reset each other's baselines. Query it on
+ * the core itself: ov::Core::get_property("", ov::compilation_memory_profile).
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> compilation_memory_profile{
+    "COMPILATION_MEMORY_PROFILE"};
+
 /**
  * @brief Namespace with device properties
  */
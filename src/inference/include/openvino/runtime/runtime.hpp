@@ -11,3 +11,4 @@
 #pragma once
 
 #include "openvino/runtime/core.hpp"
+#include "openvino/runtime/pipeline.hpp"
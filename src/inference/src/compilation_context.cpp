@@ -12,12 +12,18 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <cstring>
+#include <functional>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
+#include "meta_data.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
@@ -41,6 +47,62 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+static uint64_t hash_bytes(const uint8_t* data, size_t size) {
+    uint64_t seed = static_cast<uint64_t>(size);
+    constexpr auto cel_size = sizeof(uint64_t);
+    const auto* cells = reinterpret_cast<const uint64_t*>(data);
+    const auto* cells_end = cells + size / cel_size;
+    for (const auto* c = cells; c != cells_end; ++c) {
+        seed ^= *c + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    uint64_t last_bytes{0};
+    std::memcpy(&last_bytes, cells_end, size % cel_size);
+    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+// Hashes a memory region in fixed-size chunks in parallel and combines the per-chunk hashes
+// in order, so the result is deterministic while the data scan uses all cores
+static uint64_t parallel_data_hash(const uint8_t* data, size_t size) {
+    constexpr size_t chunk_size = 8 * 1024 * 1024;
+    const size_t chunks = size / chunk_size + (size % chunk_size ? 1 : 0);
+    if (chunks <= 1)
+        return hash_bytes(data, size);
+
+    std::vector<uint64_t> chunk_hashes(chunks);
+    InferenceEngine::parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * chunk_size;
+        chunk_hashes[i] = hash_bytes(data + offset, std::min(chunk_size, size - offset));
+    });
+
+    uint64_t seed = static_cast<uint64_t>(size);
+    for (const auto& chunk_hash : chunk_hashes) {
+        seed = hash_combine(seed, chunk_hash);
+    }
+    return seed;
+}
+
+// Computes the memoized data hashes of all constants (including sub-graph bodies) in parallel,
+// so the serializing hash pass, which walks the nodes sequentially, reads only metadata
+static void warmConstantHashes(const std::shared_ptr<ov::Model>& model) {
+    std::vector<ov::op::v0::Constant*> constants;
+    std::function<void(const std::shared_ptr<ov::Model>&)> collect = [&](const std::shared_ptr<ov::Model>& f) {
+        for (const auto& op : f->get_ops()) {
+            if (auto constant = ov::as_type<ov::op::v0::Constant>(op.get())) {
+                constants.push_back(constant);
+            } else if (auto subgraph = ov::as_type<ov::op::util::MultiSubGraphOp>(op.get())) {
+                for (size_t i = 0; i < subgraph->get_internal_subgraphs_size(); ++i)
+                    collect(subgraph->get_function(static_cast<int>(i)));
+            }
+        }
+    };
+    collect(model);
+
+    InferenceEngine::parallel_for(constants.size(), [&](size_t i) {
+        constants[i]->get_data_hash();
+    });
+}
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -70,12 +132,19 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     IE_ASSERT(network.getFunction());
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate hash on function. The hash the converter stores in the IR runtime info
+    // (see ov::pass::Serialize) is deliberately not consulted here: a model may be mutated
+    // between load and compile - reshape, set_batch, transformations - with no observable
+    // trace in the rt_info, and a stale hash would key the compiled-blob cache to the blob
+    // built for the original model. Only the live function contents can be trusted.
     CNNNetwork net(network);
-    ov::pass::Manager m;
-    m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
-    m.run_passes(net.getFunction());
+    warmConstantHashes(net.getFunction());
+    {
+        ov::pass::Manager m;
+        m.register_pass<ngraph::pass::FixRtInfo>();
+        m.register_pass<ov::pass::Hash>(seed);
+        m.run_passes(net.getFunction());
+    }
 
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
@@ -150,16 +219,7 @@ std::string NetworkCompilationContext::computeHash(const std::string& modelStr,
 
     // tensor data
     seed = hash_combine(seed, tensor.get_size());
-
-    auto ptr = static_cast<size_t*>(tensor.data());
-    size_t size = tensor.get_size() / sizeof(size_t);
-    for (size_t i = 0; i < size; i++)
-        seed = hash_combine(seed, ptr[i]);
-    auto size_done = size * sizeof(size_t);
-    auto ptr_left = static_cast<uint8_t*>(tensor.data()) + size_done;
-    size_t size_left = tensor.get_size() - size_done;
-    for (size_t i = 0; i < size_left; i++)
-        seed = hash_combine(seed, ptr_left[i]);
+    seed = hash_combine(seed, parallel_data_hash(static_cast<const uint8_t*>(tensor.data()), tensor.get_size()));
 
     // compile options
     for (const auto& kvp : compileOptions) {
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_memory_profiler.hpp"
+
+#include <utility>
+
+#if defined(__linux__)
+#    include <cstdlib>
+#    include <fstream>
+#endif
+
+namespace ov {
+
+namespace {
+
+#if defined(__linux__)
+// Peak RSS of the process in kilobytes as reported by the kernel
+uint64_t read_peak_rss_kb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::stoull(line.substr(6));
+        }
+    }
+    return 0;
+}
+
+// Resets the peak RSS counter so the next VmHWM read reflects only the work done afterwards
+void reset_peak_rss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+
+// The reset above clears the VmHWM of the whole process, including peak-RSS measurements the
+// embedding application or external monitoring may be making, so the scopes stay inert unless
+// profiling is explicitly requested (same opt-in style as OV_INFER_TRACE_RECORD)
+bool profiling_enabled() {
+    static const bool enabled = std::getenv("OV_COMPILATION_MEMORY_PROFILE") != nullptr;
+    return enabled;
+}
+#endif
+
+}  // namespace
+
+CompilationMemoryProfiler& CompilationMemoryProfiler::get() {
+    static CompilationMemoryProfiler instance;
+    return instance;
+}
+
+CompilationMemoryProfiler::Scope::Scope(std::string name) : m_name(std::move(name)) {
+#if defined(__linux__)
+    m_active = profiling_enabled();
+    if (m_active)
+        reset_peak_rss();
+#endif
+}
+
+CompilationMemoryProfiler::Scope::~Scope() {
+#if defined(__linux__)
+    if (m_active)
+        CompilationMemoryProfiler::get().record(m_name, read_peak_rss_kb());
+#endif
+}
+
+void CompilationMemoryProfiler::record(const std::string& name, uint64_t peak_rss_kb) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_peak_rss_kb[name] = peak_rss_kb;
+}
+
+std::map<std::string, uint64_t> CompilationMemoryProfiler::get_stats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_peak_rss_kb;
+}
+
+}  // namespace ov
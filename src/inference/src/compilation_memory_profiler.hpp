@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Per-stage peak memory statistics collected while a model is compiled
+ * @file compilation_memory_profiler.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace ov {
+
+/**
+ * @brief Collects per-stage peak RSS while a model is being read and compiled.
+ *
+ * Stage scopes are placed next to the corresponding ITT tasks in the core
+ * (Core::ReadNetwork, Core::LoadNetwork, ...), so the stage names line up with
+ * the traces. On Linux the peak is taken from VmHWM which is reset when a stage
+ * starts, so every entry shows the transient high-water mark of that stage
+ * alone; on other platforms nothing is collected.
+ *
+ * Collection is off by default and opted into by setting the
+ * OV_COMPILATION_MEMORY_PROFILE environment variable: the VmHWM reset clears
+ * the peak-RSS counter of the whole process, which would corrupt measurements
+ * the embedding application makes for itself. The numbers are only meaningful
+ * for serialized compilations - concurrent or nested stages (two threads
+ * compiling, a read inside a compile) reset each other's baselines.
+ *
+ * The stats of the last compilation are queryable through
+ * ov::Core::get_property("", ov::compilation_memory_profile).
+ */
+class CompilationMemoryProfiler {
+public:
+    static CompilationMemoryProfiler& get();
+
+    /// RAII scope measuring the peak RSS of one named stage
+    class Scope {
+    public:
+        explicit Scope(std::string name);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::string m_name;
+        bool m_active = false;
+    };
+
+    std::map<std::string, uint64_t> get_stats() const;
+
+private:
+    CompilationMemoryProfiler() = default;
+    void record(const std::string& name, uint64_t peak_rss_kb);
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, uint64_t> m_peak_rss_kb;
+};
+
+}  // namespace ov
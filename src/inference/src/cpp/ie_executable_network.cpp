@@ -217,6 +217,18 @@ Any CompiledModel::get_property(const std::string& name) const {
         if (ov::loaded_from_cache == name) {
             return _impl->isLoadedFromCache();
         }
+        if (ov::infer_counters == name) {
+            const auto& counters = _impl->inferCounters();
+            std::vector<uint64_t> histogram(ie::IExecutableNetworkInternal::InferCounters::histogramBuckets);
+            for (size_t i = 0; i < histogram.size(); ++i) {
+                histogram[i] = counters.latencyHistogram[i].load(std::memory_order_relaxed);
+            }
+            return AnyMap{{"request_count", counters.requestCount.load(std::memory_order_relaxed)},
+                          {"latency_total_us", counters.latencyTotalUs.load(std::memory_order_relaxed)},
+                          {"latency_histogram_ms", std::move(histogram)},
+                          {"in_flight", counters.inFlight.load(std::memory_order_relaxed)},
+                          {"peak_in_flight", counters.peakInFlight.load(std::memory_order_relaxed)}};
+        }
         if (ov::supported_properties == name) {
             try {
                 auto supported_properties = _impl->GetMetric(name).as<std::vector<PropertyName>>();
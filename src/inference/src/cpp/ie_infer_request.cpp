@@ -12,6 +12,7 @@
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "ie_infer_async_request_base.hpp"
 #include "ie_ngraph_utils.hpp"
+#include "infer_trace.hpp"
 #include "ie_remote_context.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/exception.hpp"
@@ -255,7 +256,9 @@ InferRequest::InferRequest(const ie::IInferRequestInternal::Ptr& impl, const std
 }
 
 void InferRequest::set_tensor(const ov::Output<const ov::Node>& port, const Tensor& tensor) {
-    OV_INFER_REQ_CALL_STATEMENT({ _impl->SetBlob(get_legacy_name_from_port(port), tensor._impl); });
+    // Port-level entry point caches the legacy name resolution inside the request and lets
+    // plugins consume the tensor directly without the legacy blob machinery
+    OV_INFER_REQ_CALL_STATEMENT({ _impl->SetBlobByPort(port, tensor._impl); });
 }
 
 void InferRequest::set_tensor(const ov::Output<ov::Node>& port, const Tensor& tensor) {
@@ -359,13 +362,7 @@ void InferRequest::set_output_tensor(const Tensor& tensor) {
 Tensor InferRequest::get_tensor(const ov::Output<const ov::Node>& port) {
     std::vector<std::shared_ptr<void>> soVec;
     OV_INFER_REQ_CALL_STATEMENT({
-        const auto& name = get_legacy_name_from_port(port);
-        OPENVINO_ASSERT(!_impl->GetBlobs(name),
-                        "get_tensor shall not be used together with batched "
-                        "set_tensors/set_input_tensors for name '",
-                        name,
-                        "'");
-        auto blob = _impl->GetBlob(name);
+        auto blob = _impl->GetBlobByPort(port);
         soVec = {_so, _impl->getPointerToSo()};
         Tensor tensor = {blob, soVec};
         return tensor;
@@ -413,8 +410,46 @@ Tensor InferRequest::get_output_tensor() {
     });
 }
 
+namespace {
+
+int64_t steady_now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Accounts the completion of an asynchronous request exactly once: the submission
+// timestamp is claimed atomically, so whichever of the completion callback, wait() or
+// wait_for() observes the finished request first updates the counters
+void record_async_completion(ie::IInferRequestInternal* impl) {
+    const auto exeNetwork = impl->getPointerToExecutableNetworkInternal();
+    if (!exeNetwork)
+        return;
+    const auto startUs = impl->_telemetryStartUs.exchange(-1, std::memory_order_relaxed);
+    if (startUs < 0)
+        return;
+    const auto nowUs = steady_now_us();
+    exeNetwork->inferCounters().onComplete(nowUs > startUs ? static_cast<uint64_t>(nowUs - startUs) : 0);
+}
+
+}  // namespace
+
 void InferRequest::infer() {
-    OV_INFER_REQ_CALL_STATEMENT(_impl->Infer();)
+    OV_INFER_REQ_CALL_STATEMENT({
+        auto& recorder = InferTraceRecorder::get();
+        const auto exeNetwork = _impl->getPointerToExecutableNetworkInternal();
+        const auto start = InferTraceRecorder::clock::now();
+        _impl->Infer();
+        const auto finish = InferTraceRecorder::clock::now();
+        if (exeNetwork) {
+            auto& counters = exeNetwork->inferCounters();
+            counters.onSubmit();
+            counters.onComplete(
+                std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count());
+        }
+        if (recorder.enabled())
+            recorder.record(*_impl, start, finish);
+    })
 }
 
 void InferRequest::cancel() {
@@ -460,14 +495,30 @@ std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
 }
 
 void InferRequest::start_async() {
-    OV_INFER_REQ_CALL_STATEMENT(_impl->StartAsync();)
+    OV_INFER_REQ_CALL_STATEMENT({
+        auto& recorder = InferTraceRecorder::get();
+        if (recorder.enabled()) {
+            // Shapes are captured before the submission; completion of asynchronous
+            // requests is not tracked, so the entry carries the arrival moment only
+            const auto now = InferTraceRecorder::clock::now();
+            recorder.record(*_impl, now, now);
+        }
+        const auto exeNetwork = _impl->getPointerToExecutableNetworkInternal();
+        if (exeNetwork) {
+            exeNetwork->inferCounters().onSubmit();
+            _impl->_telemetryStartUs.store(steady_now_us(), std::memory_order_relaxed);
+        }
+        _impl->StartAsync();
+    })
 }
 
 void InferRequest::wait() {
     OPENVINO_ASSERT(_impl != nullptr, "InferRequest was not initialized.");
     try {
         _impl->Wait(ie::InferRequest::RESULT_READY);
+        record_async_completion(_impl.get());
     } catch (const ie::InferCancelled& e) {
+        record_async_completion(_impl.get());
         throw Cancelled{e.what()};
     } catch (const std::exception& ex) {
         throw Exception(ex.what());
@@ -479,8 +530,12 @@ void InferRequest::wait() {
 bool InferRequest::wait_for(const std::chrono::milliseconds timeout) {
     OPENVINO_ASSERT(_impl != nullptr, "InferRequest was not initialized.");
     try {
-        return _impl->Wait(timeout.count()) == ie::OK;
+        const bool ready = _impl->Wait(timeout.count()) == ie::OK;
+        if (ready)
+            record_async_completion(_impl.get());
+        return ready;
     } catch (const ie::InferCancelled& e) {
+        record_async_completion(_impl.get());
         throw Cancelled{e.what()};
     } catch (const std::exception& ex) {
         throw Exception(ex.what());
@@ -490,7 +545,15 @@ bool InferRequest::wait_for(const std::chrono::milliseconds timeout) {
 }
 
 void InferRequest::set_callback(std::function<void(std::exception_ptr)> callback) {
-    OV_INFER_REQ_CALL_STATEMENT(_impl->SetCallback(std::move(callback));)
+    OV_INFER_REQ_CALL_STATEMENT({
+        // The raw pointer dodges a reference cycle: the request owns the callback and is
+        // guaranteed to be alive while it runs
+        auto* rawImpl = _impl.get();
+        _impl->SetCallback([rawImpl, callback = std::move(callback)](std::exception_ptr ex) {
+            record_async_completion(rawImpl);
+            callback(ex);
+        });
+    })
 }
 
 std::vector<VariableState> InferRequest::query_state() {
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/pipeline.hpp"
+
+#include <string>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+
+bool share_any_name(const ov::Output<const ov::Node>& output, const ov::Output<const ov::Node>& input) {
+    const auto& output_names = output.get_names();
+    for (const auto& name : input.get_names()) {
+        if (output_names.find(name) != output_names.end())
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+namespace ov {
+
+Pipeline::Pipeline(const std::vector<CompiledModel>& stages) : _models(stages) {
+    OPENVINO_ASSERT(!_models.empty(), "Pipeline requires at least one compiled model");
+
+    _requests.reserve(_models.size());
+    for (auto& model : _models) {
+        _requests.emplace_back(model.create_infer_request());
+    }
+
+    for (size_t i = 0; i + 1 < _models.size(); ++i) {
+        const auto outputs = _models[i].outputs();
+        const auto inputs = _models[i + 1].inputs();
+        OPENVINO_ASSERT(inputs.size() <= outputs.size(),
+                        "Pipeline stage ",
+                        i + 1,
+                        " has more inputs (",
+                        inputs.size(),
+                        ") than stage ",
+                        i,
+                        " outputs (",
+                        outputs.size(),
+                        ")");
+
+        for (size_t j = 0; j < inputs.size(); ++j) {
+            const auto& input = inputs[j];
+            // match by a shared tensor name first and fall back to the positional order
+            auto output = outputs[j];
+            for (const auto& candidate : outputs) {
+                if (share_any_name(candidate, input)) {
+                    output = candidate;
+                    break;
+                }
+            }
+
+            OPENVINO_ASSERT(output.get_element_type() == input.get_element_type(),
+                            "Pipeline cannot chain output '",
+                            output.get_any_name(),
+                            "' of element type ",
+                            output.get_element_type(),
+                            " to input '",
+                            input.get_any_name(),
+                            "' of element type ",
+                            input.get_element_type());
+            OPENVINO_ASSERT(output.get_partial_shape().compatible(input.get_partial_shape()),
+                            "Pipeline cannot chain output '",
+                            output.get_any_name(),
+                            "' of shape ",
+                            output.get_partial_shape(),
+                            " to input '",
+                            input.get_any_name(),
+                            "' of shape ",
+                            input.get_partial_shape());
+
+            // the consumer reads the producer's output memory directly: the tensors are validated
+            // and wired here once instead of being copied and re-validated on every frame
+            _requests[i + 1].set_tensor(input, _requests[i].get_tensor(output));
+        }
+    }
+}
+
+void Pipeline::infer() {
+    OPENVINO_ASSERT(!_requests.empty(), "Pipeline was not initialized.");
+    for (auto& request : _requests) {
+        request.infer();
+    }
+}
+
+void Pipeline::set_input_tensor(size_t idx, const Tensor& tensor) {
+    OPENVINO_ASSERT(!_requests.empty(), "Pipeline was not initialized.");
+    _requests.front().set_input_tensor(idx, tensor);
+}
+
+void Pipeline::set_input_tensor(const Tensor& tensor) {
+    OPENVINO_ASSERT(!_requests.empty(), "Pipeline was not initialized.");
+    _requests.front().set_input_tensor(tensor);
+}
+
+Tensor Pipeline::get_input_tensor(size_t idx) {
+    OPENVINO_ASSERT(!_requests.empty(), "Pipeline was not initialized.");
+    return _requests.front().get_input_tensor(idx);
+}
+
+Tensor Pipeline::get_input_tensor() {
+    OPENVINO_ASSERT(!_requests.empty(), "Pipeline was not initialized.");
+    return _requests.front().get_input_tensor();
+}
+
+Tensor Pipeline::get_output_tensor(size_t idx) {
+    OPENVINO_ASSERT(!_requests.empty(), "Pipeline was not initialized.");
+    return _requests.back().get_output_tensor(idx);
+}
+
+Tensor Pipeline::get_output_tensor() {
+    OPENVINO_ASSERT(!_requests.empty(), "Pipeline was not initialized.");
+    return _requests.back().get_output_tensor();
+}
+
+size_t Pipeline::get_stage_count() const {
+    return _requests.size();
+}
+
+InferRequest& Pipeline::get_stage_request(size_t idx) {
+    OPENVINO_ASSERT(idx < _requests.size(), "Pipeline stage index ", idx, " is out of range");
+    return _requests[idx];
+}
+
+}  // namespace ov
@@ -21,6 +21,7 @@
 #include "ie_ngraph_utils.hpp"
 #include "ie_preprocess.hpp"
 #include "ie_remote_context.hpp"
+#include "openvino/op/result.hpp"
 #include "transformations/utils/utils.hpp"
 
 namespace InferenceEngine {
@@ -406,6 +407,32 @@ BatchedBlob::Ptr IInferRequestInternal::GetBlobs(const std::string& name) {
     return nullptr;
 }
 
+void IInferRequestInternal::SetBlobByPort(const ov::Output<const ov::Node>& port, const Blob::Ptr& data) {
+    SetBlob(legacyNameFromPort(port), data);
+}
+
+Blob::Ptr IInferRequestInternal::GetBlobByPort(const ov::Output<const ov::Node>& port) {
+    const auto& name = legacyNameFromPort(port);
+    if (GetBlobs(name)) {
+        IE_THROW() << "get_tensor shall not be used together with batched set_tensors/set_input_tensors for name '"
+                   << name << "'";
+    }
+    return GetBlob(name);
+}
+
+const std::string& IInferRequestInternal::legacyNameFromPort(const ov::Output<const ov::Node>& port) {
+    const auto key = std::make_pair(port.get_node(), port.get_index());
+    auto it = _legacyPortNames.find(key);
+    if (it == _legacyPortNames.end()) {
+        ov::Output<ov::Node> p(std::const_pointer_cast<ov::Node>(port.get_node_shared_ptr()), port.get_index());
+        if (auto node = std::dynamic_pointer_cast<ov::op::v0::Result>(p.get_node_shared_ptr())) {
+            p = node->input_value(0);
+        }
+        it = _legacyPortNames.emplace(key, ngraph::op::util::create_ie_output_name(p)).first;
+    }
+    return it->second;
+}
+
 void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& data, const PreProcessInfo& info) {
     InputInfo::Ptr foundInput;
     DataPtr foundOutput;
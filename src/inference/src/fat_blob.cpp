@@ -0,0 +1,137 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fat_blob.hpp"
+
+#include <cstring>
+
+#include "ie_common.h"
+
+namespace ov {
+
+namespace {
+
+// 8 bytes so a fat blob can never be confused with an IR, ONNX model or a plugin blob
+constexpr char FAT_BLOB_MAGIC[] = {'O', 'V', 'F', 'A', 'T', 'B', 'L', 'B'};
+constexpr uint32_t FAT_BLOB_VERSION = 1;
+
+void writeString(std::ostream& stream, const std::string& str) {
+    const uint32_t length = static_cast<uint32_t>(str.size());
+    stream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    stream.write(str.data(), length);
+}
+
+std::string readString(std::istream& stream) {
+    uint32_t length = 0;
+    stream.read(reinterpret_cast<char*>(&length), sizeof(length));
+    std::string str(length, '\0');
+    stream.read(&str[0], length);
+    if (!stream)
+        IE_THROW(NetworkNotRead) << "Fat blob header is truncated";
+    return str;
+}
+
+}  // namespace
+
+bool isFatBlob(std::istream& stream) {
+    const auto pos = stream.tellg();
+    char magic[sizeof(FAT_BLOB_MAGIC)] = {};
+    stream.read(magic, sizeof(magic));
+    const bool matched = stream && std::memcmp(magic, FAT_BLOB_MAGIC, sizeof(magic)) == 0;
+    stream.clear();
+    stream.seekg(pos, std::ios::beg);
+    return matched;
+}
+
+std::vector<FatBlobEntry> readFatBlobIndex(std::istream& stream) {
+    char magic[sizeof(FAT_BLOB_MAGIC)] = {};
+    stream.read(magic, sizeof(magic));
+    if (!stream || std::memcmp(magic, FAT_BLOB_MAGIC, sizeof(magic)) != 0)
+        IE_THROW(NetworkNotRead) << "The stream does not contain a fat blob";
+
+    uint32_t version = 0;
+    stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!stream || version != FAT_BLOB_VERSION)
+        IE_THROW(NetworkNotRead) << "Unsupported fat blob version: " << version;
+
+    uint32_t count = 0;
+    stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!stream)
+        IE_THROW(NetworkNotRead) << "Fat blob header is truncated";
+
+    std::vector<FatBlobEntry> index(count);
+    for (auto& entry : index) {
+        entry.deviceName = readString(stream);
+        entry.architecture = readString(stream);
+        stream.read(reinterpret_cast<char*>(&entry.size), sizeof(entry.size));
+        if (!stream)
+            IE_THROW(NetworkNotRead) << "Fat blob header is truncated";
+    }
+
+    uint64_t offset = static_cast<uint64_t>(stream.tellg());
+    for (auto& entry : index) {
+        entry.offset = offset;
+        offset += entry.size;
+    }
+
+    return index;
+}
+
+void seekFatBlobSection(std::istream& stream, const std::string& deviceName, const std::string& architecture) {
+    const auto index = readFatBlobIndex(stream);
+
+    // "GPU.1" still picks a section compiled for the "GPU" family
+    const auto deviceFamily = deviceName.substr(0, deviceName.find('.'));
+
+    const FatBlobEntry* fallback = nullptr;
+    const FatBlobEntry* selected = nullptr;
+    for (const auto& entry : index) {
+        if (entry.deviceName != deviceName && entry.deviceName != deviceFamily)
+            continue;
+        if (!architecture.empty() && entry.architecture == architecture) {
+            selected = &entry;
+            break;
+        }
+        if (entry.architecture.empty() && !fallback)
+            fallback = &entry;
+    }
+    if (!selected)
+        selected = fallback;
+    if (!selected) {
+        std::stringstream targets;
+        for (const auto& entry : index) {
+            targets << " " << entry.deviceName;
+            if (!entry.architecture.empty())
+                targets << "(" << entry.architecture << ")";
+        }
+        IE_THROW(NotFound) << "The fat blob has no section for device " << deviceName
+                           << (architecture.empty() ? "" : " with architecture " + architecture)
+                           << "; available targets:" << targets.str();
+    }
+
+    stream.seekg(static_cast<std::streamoff>(selected->offset), std::ios::beg);
+}
+
+void writeFatBlob(std::ostream& stream,
+                  const std::vector<std::string>& deviceNames,
+                  const std::vector<std::string>& architectures,
+                  const std::vector<std::string>& blobs) {
+    IE_ASSERT(deviceNames.size() == blobs.size() && architectures.size() == blobs.size());
+
+    stream.write(FAT_BLOB_MAGIC, sizeof(FAT_BLOB_MAGIC));
+    stream.write(reinterpret_cast<const char*>(&FAT_BLOB_VERSION), sizeof(FAT_BLOB_VERSION));
+    const uint32_t count = static_cast<uint32_t>(blobs.size());
+    stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (size_t i = 0; i < blobs.size(); ++i) {
+        writeString(stream, deviceNames[i]);
+        writeString(stream, architectures[i]);
+        const uint64_t size = blobs[i].size();
+        stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    }
+    for (const auto& blob : blobs) {
+        stream.write(blob.data(), blob.size());
+    }
+}
+
+}  // namespace ov
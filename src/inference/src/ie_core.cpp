@@ -21,10 +21,12 @@
 #include "cpp/ie_plugin.hpp"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "fat_blob.hpp"
 #include "file_utils.h"
 #include "ie_cache_guard.hpp"
 #include "ie_cache_manager.hpp"
 #include "ie_icore.hpp"
+#include "compilation_memory_profiler.hpp"
 #include "ie_itt.hpp"
 #include "ie_network_reader.hpp"
 #include "ie_ngraph_utils.hpp"
@@ -418,12 +420,16 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                                                  bool forceDisableCache = false) {
         OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CoreImpl::compile_model_impl");
         ov::SoPtr<ie::IExecutableNetworkInternal> execNetwork;
-        execNetwork = context ? plugin.compile_model(network, context, parsedConfig)
-                              : plugin.compile_model(network, parsedConfig);
+        {
+            CompilationMemoryProfiler::Scope memScope("compile");
+            execNetwork = context ? plugin.compile_model(network, context, parsedConfig)
+                                  : plugin.compile_model(network, parsedConfig);
+        }
         if (!forceDisableCache && cacheContent.cacheManager && DeviceSupportsImportExport(plugin)) {
             try {
                 // need to export network for further import from "cache"
                 OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Export");
+                CompilationMemoryProfiler::Scope memScope("export_cache");
                 cacheContent.cacheManager->writeCacheEntry(cacheContent.blobId, [&](std::ostream& networkStream) {
                     networkStream << ie::CompiledBlobHeader(
                         ie::GetInferenceEngineVersion()->buildNumber,
@@ -448,6 +454,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         struct HeaderException {};
 
         OPENVINO_ASSERT(cacheContent.cacheManager != nullptr);
+        CompilationMemoryProfiler::Scope memScope("import_cache");
         try {
             cacheContent.cacheManager->readCacheEntry(cacheContent.blobId, [&](std::istream& networkStream) {
                 OV_ITT_SCOPE(FIRST_INFERENCE,
@@ -657,6 +664,7 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
+        CompilationMemoryProfiler::Scope memScope("read_model");
         return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
     }
 
@@ -664,6 +672,7 @@ public:
                                const ie::Blob::CPtr& weights,
                                bool frontendMode = false) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from memory");
+        CompilationMemoryProfiler::Scope memScope("read_model");
         return InferenceEngine::details::ReadNetwork(model, weights, extensions, ov_extensions, newAPI, frontendMode);
     }
 
@@ -937,7 +946,23 @@ public:
                                                   const std::string& deviceName,
                                                   const std::map<std::string, std::string>& config) override {
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        auto exec = GetCPPPluginByName(parsed._deviceName).import_model(networkModel, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+        if (ov::isFatBlob(networkModel)) {
+            // a fat blob carries one exported model per target configuration; pick the
+            // section compiled for this device (and its architecture, when reported) and
+            // hand the plugin a stream positioned at that section
+            std::string architecture;
+            if (DeviceSupportsConfigKey(plugin, ov::device::architecture.name())) {
+                std::map<std::string, Any> getMetricConfig;
+                auto deviceIt = parsed._config.find(ov::device::id.name());
+                if (deviceIt != parsed._config.end()) {
+                    getMetricConfig[deviceIt->first] = deviceIt->second;
+                }
+                architecture = plugin.get_property(ov::device::architecture, getMetricConfig);
+            }
+            ov::seekFatBlobSection(networkModel, deviceName, architecture);
+        }
+        auto exec = plugin.import_model(networkModel, parsed._config);
 
         return {exec._ptr, exec._so};
     }
@@ -1074,6 +1099,9 @@ public:
         } else if (name == ov::hint::allow_auto_batching.name()) {
             const auto flag = coreConfig.flag_allow_auto_batching;
             return decltype(ov::hint::allow_auto_batching)::value_type(flag);
+        } else if (name == ov::compilation_memory_profile.name()) {
+            return decltype(ov::compilation_memory_profile)::value_type(
+                CompilationMemoryProfiler::get().get_stats());
         }
 
         IE_THROW() << "Exception is thrown while trying to call get_property with unsupported property: '" << name
@@ -2052,6 +2080,45 @@ CompiledModel Core::compile_model(const std::string& modelPath, const std::strin
     });
 }
 
+namespace {
+
+// Runs the compilation task on an idle executor from the shared pool; concurrent calls each get
+// a dedicated idle executor, so compilations of different models overlap. The executor is kept
+// alive by the scheduled task until the compilation finishes.
+std::future<CompiledModel> schedule_compilation(std::function<CompiledModel()> compile) {
+    auto executor = executorManager()->getIdleCPUStreamsExecutor(
+        InferenceEngine::IStreamsExecutor::Config{"OVCompileModelAsync"});
+    auto task = std::make_shared<std::packaged_task<CompiledModel()>>(std::move(compile));
+    auto future = task->get_future();
+    executor->run([task, executor] {
+        (*task)();
+    });
+    return future;
+}
+
+}  // namespace
+
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const std::string& device_name,
+                                                     const AnyMap& properties) {
+    OV_CORE_CALL_STATEMENT({
+        // Capture the Core by value to keep the implementation alive until the task completes
+        return schedule_compilation([core = *this, model, device_name, properties]() mutable {
+            return core.compile_model(model, device_name, properties);
+        });
+    });
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& model_path,
+                                                     const std::string& device_name,
+                                                     const AnyMap& properties) {
+    OV_CORE_CALL_STATEMENT({
+        return schedule_compilation([core = *this, model_path, device_name, properties]() mutable {
+            return core.compile_model(model_path, device_name, properties);
+        });
+    });
+}
+
 CompiledModel Core::compile_model(const std::string& model,
                                   const ov::Tensor& weights,
                                   const std::string& deviceName,
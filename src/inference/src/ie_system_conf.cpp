@@ -6,6 +6,9 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "threading/ie_parallel_custom_arena.hpp"
@@ -128,6 +131,38 @@ int getNumberOfLogicalCPUCores(bool bigCoresOnly) {
 }
 #endif
 
+std::vector<int> getNumaNodeProcessors(int numaNodeId) {
+#if defined(__linux__)
+    // the sysfs cpulist format is a ',' separated list of ids or inclusive 'first-last' ranges
+    std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(numaNodeId) + "/cpulist");
+    std::string line;
+    if (!cpulist || !std::getline(cpulist, line))
+        return {};
+    std::vector<int> processors;
+    std::stringstream tokens{line};
+    std::string token;
+    try {
+        while (std::getline(tokens, token, ',')) {
+            const auto dash = token.find('-');
+            if (dash == std::string::npos) {
+                processors.push_back(std::stoi(token));
+            } else {
+                const int first = std::stoi(token.substr(0, dash));
+                const int last = std::stoi(token.substr(dash + 1));
+                for (int id = first; id <= last; id++)
+                    processors.push_back(id);
+            }
+        }
+    } catch (const std::exception&) {
+        return {};
+    }
+    return processors;
+#else
+    (void)numaNodeId;
+    return {};
+#endif
+}
+
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() {
     return custom::info::numa_nodes();
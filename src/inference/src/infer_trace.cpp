@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "infer_trace.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+#include "openvino/core/node.hpp"
+
+namespace ov {
+
+namespace {
+
+// Keep the single-line trace format parseable even for exotic tensor names
+std::string sanitize_name(std::string name) {
+    std::replace_if(
+        name.begin(),
+        name.end(),
+        [](char c) {
+            return c == ' ' || c == ';' || c == '=' || c == '\n' || c == '\t';
+        },
+        '_');
+    return name;
+}
+
+}  // namespace
+
+InferTraceRecorder& InferTraceRecorder::get() {
+    static InferTraceRecorder instance;
+    return instance;
+}
+
+InferTraceRecorder::InferTraceRecorder() {
+    const char* path = std::getenv("OV_INFER_TRACE_RECORD");
+    if (path == nullptr || path[0] == '\0')
+        return;
+    m_file.open(path, std::ios::out | std::ios::trunc);
+    m_enabled = m_file.is_open();
+}
+
+void InferTraceRecorder::record(InferenceEngine::IInferRequestInternal& request,
+                                clock::time_point start,
+                                clock::time_point finish) {
+    if (!m_enabled)
+        return;
+
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    // Input shapes are collected outside the lock; a trace must never break the inference
+    // it observes, so any failure just degrades the entry to an empty shape list
+    std::ostringstream shapes;
+    try {
+        const auto& inputs = request.GetInputs();
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            const auto port = inputs[i]->output(0);
+            const auto& names = port.get_names();
+            const auto blob = request.GetBlobByPort(port);
+            if (!blob)
+                continue;
+            if (shapes.tellp() > 0)
+                shapes << ';';
+            shapes << sanitize_name(names.empty() ? inputs[i]->get_friendly_name() : *names.begin()) << '=';
+            const auto& dims = blob->getTensorDesc().getDims();
+            for (size_t d = 0; d < dims.size(); ++d) {
+                if (d > 0)
+                    shapes << ',';
+                shapes << dims[d];
+            }
+        }
+    } catch (...) {
+        shapes.str({});
+    }
+    const auto shapes_str = shapes.str();
+    const auto duration_us = duration_cast<microseconds>(finish - start).count();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto gap_us = m_has_prev ? duration_cast<microseconds>(start - m_prev_submit).count() : 0;
+    m_prev_submit = start;
+    m_has_prev = true;
+    m_file << (finish == start ? "async" : "sync") << ' ' << gap_us << ' ' << duration_us << ' '
+           << (shapes_str.empty() ? "-" : shapes_str) << '\n';
+    m_file.flush();
+}
+
+}  // namespace ov
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+#include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
+
+namespace ov {
+
+/**
+ * @brief Opt-in recorder of the real request stream seen by an application.
+ *
+ * When the OV_INFER_TRACE_RECORD environment variable is set to a file path, every
+ * submission through ov::InferRequest appends one line to that file:
+ *
+ *     <sync|async> <gap_us> <duration_us> <name>=<dim,dim,...>[;<name>=...]
+ *
+ * where gap_us is the arrival gap since the previous submission, duration_us is the
+ * synchronous latency (0 for asynchronous submissions, whose completion is not tracked)
+ * and the tail lists the actual input tensor shapes. The resulting trace captures the
+ * shapes and arrival pattern of a production run and can be replayed by the benchmark
+ * tool against a candidate build.
+ */
+class InferTraceRecorder {
+public:
+    static InferTraceRecorder& get();
+
+    bool enabled() const {
+        return m_enabled;
+    }
+
+    using clock = std::chrono::steady_clock;
+
+    /// Appends one trace entry; start == finish for asynchronous submissions
+    void record(InferenceEngine::IInferRequestInternal& request, clock::time_point start, clock::time_point finish);
+
+private:
+    InferTraceRecorder();
+
+    bool m_enabled = false;
+    std::ofstream m_file;
+    std::mutex m_mutex;
+    bool m_has_prev = false;
+    clock::time_point m_prev_submit;
+};
+
+}  // namespace ov
@@ -4,16 +4,19 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
 #include <queue>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -35,6 +38,7 @@ struct CPUStreamsExecutor::Impl {
             int _threadBindingStep = 0;
             int _offset = 0;
             int _cpuIdxOffset = 0;
+            std::vector<int> _cpuIds;
             Observer(custom::task_arena& arena,
                      CpuSet mask,
                      int ncpus,
@@ -42,14 +46,22 @@ struct CPUStreamsExecutor::Impl {
                      const int threadsPerStream,
                      const int threadBindingStep,
                      const int threadBindingOffset,
-                     const int cpuIdxOffset = 0)
+                     const int cpuIdxOffset = 0,
+                     std::vector<int> cpuIds = {})
                 : custom::task_scheduler_observer(arena),
                   _mask{std::move(mask)},
                   _ncpus(ncpus),
                   _threadBindingStep(threadBindingStep),
                   _offset{streamId * threadsPerStream + threadBindingOffset},
-                  _cpuIdxOffset(cpuIdxOffset) {}
+                  _cpuIdxOffset(cpuIdxOffset),
+                  _cpuIds(std::move(cpuIds)) {}
             void on_scheduler_entry(bool) override {
+                if (!_cpuIds.empty()) {
+                    PinThreadToCpuId(_cpuIds[tbb::this_task_arena::current_thread_index() % _cpuIds.size()],
+                                     _ncpus,
+                                     _mask);
+                    return;
+                }
                 PinThreadToVacantCore(_offset + tbb::this_task_arena::current_thread_index(),
                                       _threadBindingStep,
                                       _ncpus,
@@ -80,7 +92,20 @@ struct CPUStreamsExecutor::Impl {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             const auto concurrency = (0 == _impl->_config._threadsPerStream) ? custom::task_arena::automatic
                                                                              : _impl->_config._threadsPerStream;
-            if (ThreadBindingType::HYBRID_AWARE == _impl->_config._threadBindingType) {
+            if (!_impl->_config._stream_core_ids.empty()) {
+                // Explicit composition: the requested core set both defines the stream concurrency
+                // and pins the stream threads, so two models sharing the process do not overlap
+                const auto& coreIds =
+                    _impl->_config._stream_core_ids[_streamId % _impl->_config._stream_core_ids.size()];
+                _taskArena.reset(new custom::task_arena{static_cast<int>(coreIds.size())});
+                CpuSet processMask;
+                int ncpus = 0;
+                std::tie(processMask, ncpus) = GetProcessMask();
+                if (nullptr != processMask) {
+                    _observer.reset(new Observer{*_taskArena, std::move(processMask), ncpus, 0, 0, 0, 0, 0, coreIds});
+                    _observer->observe(true);
+                }
+            } else if (ThreadBindingType::HYBRID_AWARE == _impl->_config._threadBindingType) {
                 if (Config::PreferredCoreType::ROUND_ROBIN != _impl->_config._threadPreferredCoreType) {
                     if (Config::PreferredCoreType::ANY == _impl->_config._threadPreferredCoreType) {
                         _taskArena.reset(new custom::task_arena{concurrency});
@@ -179,21 +204,46 @@ struct CPUStreamsExecutor::Impl {
                 }
             }
 #elif IE_THREAD == IE_THREAD_OMP
-            omp_set_num_threads(_impl->_config._threadsPerStream);
-            if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
+            if (!_impl->_config._stream_core_ids.empty()) {
+                const auto& coreIds =
+                    _impl->_config._stream_core_ids[_streamId % _impl->_config._stream_core_ids.size()];
+                omp_set_num_threads(static_cast<int>(coreIds.size()));
+                if (!checkOpenMpEnvVars(false)) {
+                    CpuSet processMask;
+                    int ncpus = 0;
+                    std::tie(processMask, ncpus) = GetProcessMask();
+                    if (nullptr != processMask) {
+                        parallel_nt(static_cast<int>(coreIds.size()), [&](int threadIndex, int threadsPerStream) {
+                            PinThreadToCpuId(coreIds[threadIndex % coreIds.size()], ncpus, processMask);
+                        });
+                    }
+                }
+            } else {
+                omp_set_num_threads(_impl->_config._threadsPerStream);
+                if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
+                    CpuSet processMask;
+                    int ncpus = 0;
+                    std::tie(processMask, ncpus) = GetProcessMask();
+                    if (nullptr != processMask) {
+                        parallel_nt(_impl->_config._threadsPerStream, [&](int threadIndex, int threadsPerStream) {
+                            int thrIdx = _streamId * _impl->_config._threadsPerStream + threadIndex +
+                                         _impl->_config._threadBindingOffset;
+                            PinThreadToVacantCore(thrIdx, _impl->_config._threadBindingStep, ncpus, processMask);
+                        });
+                    }
+                }
+            }
+#elif IE_THREAD == IE_THREAD_SEQ
+            if (!_impl->_config._stream_core_ids.empty()) {
+                const auto& coreIds =
+                    _impl->_config._stream_core_ids[_streamId % _impl->_config._stream_core_ids.size()];
                 CpuSet processMask;
                 int ncpus = 0;
                 std::tie(processMask, ncpus) = GetProcessMask();
                 if (nullptr != processMask) {
-                    parallel_nt(_impl->_config._threadsPerStream, [&](int threadIndex, int threadsPerStream) {
-                        int thrIdx = _streamId * _impl->_config._threadsPerStream + threadIndex +
-                                     _impl->_config._threadBindingOffset;
-                        PinThreadToVacantCore(thrIdx, _impl->_config._threadBindingStep, ncpus, processMask);
-                    });
+                    PinThreadToCpuId(coreIds.front(), ncpus, processMask);
                 }
-            }
-#elif IE_THREAD == IE_THREAD_SEQ
-            if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
+            } else if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 PinCurrentThreadToSocket(_numaNodeId);
             } else if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
                 CpuSet processMask;
@@ -275,6 +325,7 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        _pinnedTaskQueues.resize(_config._streams);
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
@@ -283,11 +334,25 @@ struct CPUStreamsExecutor::Impl {
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return !_taskQueue.empty() || !_highPriorityTaskQueue.empty() ||
+                                   !_lowPriorityTaskQueue.empty() || !_pinnedTaskQueues[streamId].empty() ||
+                                   (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
+                        // the own pinned tasks go first to preserve the session affinity,
+                        // the rest is dequeued in the priority class order
+                        if (!_pinnedTaskQueues[streamId].empty()) {
+                            task = std::move(_pinnedTaskQueues[streamId].front());
+                            _pinnedTaskQueues[streamId].pop();
+                        } else if (!_highPriorityTaskQueue.empty()) {
+                            task = std::move(_highPriorityTaskQueue.front().second);
+                            _highPriorityTaskQueue.pop_front();
+                            _highPriorityTasksCount.fetch_sub(1, std::memory_order_relaxed);
+                        } else if (!_taskQueue.empty()) {
                             task = std::move(_taskQueue.front());
                             _taskQueue.pop();
+                        } else if (!_lowPriorityTaskQueue.empty()) {
+                            task = std::move(_lowPriorityTaskQueue.front());
+                            _lowPriorityTaskQueue.pop();
                         }
                     }
                     if (task) {
@@ -306,6 +371,66 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    void EnqueuePrioritized(Task task, TaskPriority priority, const void* owner) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            switch (priority) {
+            case TaskPriority::High:
+                _highPriorityTaskQueue.emplace_back(owner, std::move(task));
+                _highPriorityTasksCount.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case TaskPriority::Normal:
+                _taskQueue.emplace(std::move(task));
+                break;
+            case TaskPriority::Low:
+                _lowPriorityTaskQueue.emplace(std::move(task));
+                break;
+            }
+        }
+        _queueCondVar.notify_one();
+    }
+
+    bool RunHighPriorityTask(const void* currentOwner) {
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = std::find_if(_highPriorityTaskQueue.begin(),
+                                   _highPriorityTaskQueue.end(),
+                                   [currentOwner](const std::pair<const void*, Task>& entry) {
+                                       return entry.first != currentOwner;
+                                   });
+            if (it == _highPriorityTaskQueue.end()) {
+                return false;
+            }
+            task = std::move(it->second);
+            _highPriorityTaskQueue.erase(it);
+            _highPriorityTasksCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+        Execute(task, *(_streams.local()));
+        return true;
+    }
+
+    void EnqueuePinned(Task task, std::size_t affinityKey) {
+        std::size_t streamIdx = 0;
+        {
+            std::lock_guard<std::mutex> lock(_affinityMutex);
+            auto itr = _affinityMap.find(affinityKey);
+            if (itr == _affinityMap.end()) {
+                // new sessions are bound to the streams in a round-robin fashion and the
+                // binding stays sticky afterwards
+                itr = _affinityMap.emplace(affinityKey, _nextAffinityStream).first;
+                _nextAffinityStream = (_nextAffinityStream + 1) % _threads.size();
+            }
+            streamIdx = itr->second;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pinnedTaskQueues[streamIdx].emplace(std::move(task));
+        }
+        // the task is consumable by a single specific thread, so all the waiters have to recheck
+        _queueCondVar.notify_all();
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -343,6 +468,16 @@ struct CPUStreamsExecutor::Impl {
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
+    // tasks scheduled with an explicit priority class (guarded by _mutex); the high queue keeps
+    // the owner tags, so a preemption point can skip the tasks of its own caller
+    std::deque<std::pair<const void*, Task>> _highPriorityTaskQueue;
+    std::queue<Task> _lowPriorityTaskQueue;
+    std::atomic<std::size_t> _highPriorityTasksCount{0};
+    // per stream thread queues of the tasks pinned by an affinity key (guarded by _mutex)
+    std::vector<std::queue<Task>> _pinnedTaskQueues;
+    std::mutex _affinityMutex;
+    std::unordered_map<std::size_t, std::size_t> _affinityMap;
+    std::size_t _nextAffinityStream = 0;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
@@ -395,4 +530,28 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run(Task task, std::size_t affinityKey) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->EnqueuePinned(std::move(task), affinityKey);
+    }
+}
+
+void CPUStreamsExecutor::run(Task task, TaskPriority priority, const void* owner) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->EnqueuePrioritized(std::move(task), priority, owner);
+    }
+}
+
+bool CPUStreamsExecutor::HasHighPriorityTasksPending() const {
+    return 0 != _impl->_highPriorityTasksCount.load(std::memory_order_relaxed);
+}
+
+bool CPUStreamsExecutor::RunHighPriorityTask(const void* currentOwner) {
+    return _impl->RunHighPriorityTask(currentOwner);
+}
+
 }  // namespace InferenceEngine
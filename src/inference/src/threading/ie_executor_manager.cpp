@@ -16,16 +16,76 @@
 
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <string>
 #include <utility>
 
 namespace InferenceEngine {
 namespace {
+/* A per-network view of the shared CPU streams executor. The view forwards at most `quota` of its
+ * tasks to the underlying pool at a time and keeps the rest in a local backlog; a pool stream that
+ * completes a task of the view picks the next backlog entry without giving the slot away, so a busy
+ * network drains its backlog on whatever streams the pool has idle. Stream observers are delegated
+ * to the pool, so code running inside a task sees the pool stream it was scheduled to. */
+class SharedStreamsExecutorView : public IStreamsExecutor,
+                                  public std::enable_shared_from_this<SharedStreamsExecutorView> {
+public:
+    SharedStreamsExecutorView(IStreamsExecutor::Ptr pool, int quota)
+        : _pool{std::move(pool)},
+          _quota{std::max(1, quota)} {}
+
+    void run(Task task) override {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (_inFlight >= _quota) {
+                _backlog.push(std::move(task));
+                return;
+            }
+            ++_inFlight;
+        }
+        auto self = shared_from_this();
+        _pool->run([self, task]() mutable {
+            Task current = std::move(task);
+            while (true) {
+                current();
+                std::lock_guard<std::mutex> lock{self->_mutex};
+                if (self->_backlog.empty()) {
+                    --self->_inFlight;
+                    return;
+                }
+                current = std::move(self->_backlog.front());
+                self->_backlog.pop();
+            }
+        });
+    }
+
+    int GetStreamId() override {
+        return _pool->GetStreamId();
+    }
+
+    int GetNumaNodeId() override {
+        return _pool->GetNumaNodeId();
+    }
+
+    void Execute(Task task) override {
+        _pool->Execute(std::move(task));
+    }
+
+private:
+    IStreamsExecutor::Ptr _pool;
+    const int _quota;
+    int _inFlight = 0;
+    std::queue<Task> _backlog;
+    std::mutex _mutex;
+};
+
 class ExecutorManagerImpl : public ExecutorManager {
 public:
     ~ExecutorManagerImpl();
     ITaskExecutor::Ptr getExecutor(const std::string& id) override;
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) override;
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                      int streamsQuota) override;
     size_t getExecutorsNumber() const override;
     size_t getIdleCPUStreamsExecutorsNumber() const override;
     void clear(const std::string& id = {}) override;
@@ -36,6 +96,7 @@ private:
     void resetTbb();
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>> cpuStreamsExecutors;
+    IStreamsExecutor::Ptr sharedStreamsExecutor;
     mutable std::mutex streamExecutorMutex;
     mutable std::mutex taskExecutorMutex;
     bool tbbTerminateFlag = false;
@@ -135,6 +196,22 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                                       int streamsQuota) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    if (!sharedStreamsExecutor) {
+        auto poolConfig = config;
+        poolConfig._name = "CPUSharedStreamsExecutor";
+        // The pool serves every network loaded into the process, so it is sized for the whole
+        // machine even when the first requesting network alone asks for fewer streams.
+        poolConfig._streams = std::max(config._streams, IStreamsExecutor::Config::GetDefaultNumStreams());
+        sharedStreamsExecutor = std::make_shared<CPUStreamsExecutor>(poolConfig);
+        tbbThreadsCreated = true;
+    }
+    const int quota = streamsQuota > 0 ? streamsQuota : config._streams;
+    return std::make_shared<SharedStreamsExecutorView>(sharedStreamsExecutor, quota);
+}
+
 size_t ExecutorManagerImpl::getExecutorsNumber() const {
     std::lock_guard<std::mutex> guard(taskExecutorMutex);
     return executors.size();
@@ -151,8 +228,11 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedStreamsExecutor = nullptr;
     } else {
         executors.erase(id);
+        if ("CPUSharedStreamsExecutor" == id)
+            sharedStreamsExecutor = nullptr;
         cpuStreamsExecutors.erase(
             std::remove_if(cpuStreamsExecutors.begin(),
                            cpuStreamsExecutors.end(),
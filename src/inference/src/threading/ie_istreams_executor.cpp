@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <openvino/util/log.hpp>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
@@ -34,6 +35,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
         CONFIG_KEY_INTERNAL(THREADS_PER_STREAM_SMALL),
         CONFIG_KEY_INTERNAL(SMALL_CORE_OFFSET),
         CONFIG_KEY_INTERNAL(ENABLE_HYPER_THREAD),
+        CONFIG_KEY_INTERNAL(STREAM_CORE_IDS),
         ov::num_streams.name(),
         ov::inference_num_threads.name(),
         ov::affinity.name(),
@@ -290,6 +292,38 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
         } else {
             OPENVINO_UNREACHABLE("Unsupported enable hyper thread type");
         }
+    } else if (key == CONFIG_KEY_INTERNAL(STREAM_CORE_IDS)) {
+        std::vector<std::vector<int>> stream_core_ids;
+        try {
+            std::stringstream streams{value};
+            std::string stream_token;
+            while (std::getline(streams, stream_token, ';')) {
+                std::vector<int> core_ids;
+                std::stringstream cores{stream_token};
+                std::string core_token;
+                while (std::getline(cores, core_token, ',')) {
+                    const auto dash = core_token.find('-');
+                    if (dash == std::string::npos) {
+                        core_ids.push_back(std::stoi(core_token));
+                    } else {
+                        const int first = std::stoi(core_token.substr(0, dash));
+                        const int last = std::stoi(core_token.substr(dash + 1));
+                        for (int id = first; id <= last; id++)
+                            core_ids.push_back(id);
+                    }
+                }
+                if (core_ids.empty() || std::any_of(core_ids.begin(), core_ids.end(), [](int id) {
+                        return id < 0;
+                    }))
+                    throw std::logic_error{"invalid core set"};
+                stream_core_ids.push_back(std::move(core_ids));
+            }
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(STREAM_CORE_IDS)
+                       << ". Expected a ';' separated list of per stream core sets, where each set is a ','"
+                       << " separated list of non negative logical processor ids or 'first-last' ranges, e.g. 0-7;8-15";
+        }
+        _stream_core_ids = std::move(stream_core_ids);
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -340,6 +374,18 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) const {
         return {std::to_string(_small_core_offset)};
     } else if (key == CONFIG_KEY_INTERNAL(ENABLE_HYPER_THREAD)) {
         return {_enable_hyper_thread ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (key == CONFIG_KEY_INTERNAL(STREAM_CORE_IDS)) {
+        std::string value;
+        for (size_t stream = 0; stream < _stream_core_ids.size(); stream++) {
+            if (stream)
+                value += ';';
+            for (size_t core = 0; core < _stream_core_ids[stream].size(); core++) {
+                if (core)
+                    value += ',';
+                value += std::to_string(_stream_core_ids[stream][core]);
+            }
+        }
+        return {value};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
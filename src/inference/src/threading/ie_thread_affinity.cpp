@@ -75,6 +75,19 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
     return res;
 }
 
+bool PinThreadToCpuId(int cpuId, int ncores, const CpuSet& procMask) {
+    if (procMask == nullptr)
+        return false;
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    if (cpuId >= ncores || !CPU_ISSET_S(cpuId, size, procMask.get()))
+        return false;
+
+    CpuSet targetMask{CPU_ALLOC(ncores)};
+    CPU_ZERO_S(size, targetMask.get());
+    CPU_SET_S(cpuId, size, targetMask.get());
+    return PinCurrentThreadByMask(ncores, targetMask);
+}
+
 bool PinCurrentThreadToSocket(int socket) {
     const int sockets = InferenceEngine::getAvailableNUMANodes().size();
     const int cores = InferenceEngine::getNumberOfCPUCores();
@@ -113,5 +126,8 @@ bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
 bool PinCurrentThreadToSocket(int socket) {
     return false;
 }
+bool PinThreadToCpuId(int cpuId, int ncores, const CpuSet& procMask) {
+    return false;
+}
 #endif  // !(defined(__APPLE__) || defined(__EMSCRIPTEN__) || defined(_WIN32))
 }  //  namespace InferenceEngine
@@ -85,4 +85,15 @@ bool PinCurrentThreadByMask(int ncores, const CpuSet& processMask);
  * @return     `True` in case of success, `false` otherwise
  */
 bool PinCurrentThreadToSocket(int socket);
+
+/**
+ * @brief      Pins current thread to the explicitly given logical processor, while respecting the process mask
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  cpuId        The logical processor id
+ * @param[in]  ncores       The ncores
+ * @param[in]  processMask  The process mask
+ * @return     `True` in case of success, `false` otherwise
+ */
+bool PinThreadToCpuId(int cpuId, int ncores, const CpuSet& processMask);
 }  //  namespace InferenceEngine
@@ -280,3 +280,91 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+static CPUStreamsExecutor::Ptr makeSingleStreamExecutor() {
+    return std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+}
+
+TEST(PriorityTaskExecutorTests, highPriorityTasksAreDequeuedFirst) {
+    auto taskExecutor = makeSingleStreamExecutor();
+    std::promise<void> blockerStarted;
+    std::promise<void> unblock;
+    // occupy the only stream, so the order of the tasks enqueued below is decided by the queue
+    taskExecutor->run([&] {
+        blockerStarted.set_value();
+        unblock.get_future().wait();
+    });
+    blockerStarted.get_future().wait();
+    std::vector<int> order;
+    std::promise<void> done;
+    taskExecutor->run(
+        [&] {
+            order.push_back(2);
+        },
+        CPUStreamsExecutor::TaskPriority::Low,
+        nullptr);
+    taskExecutor->run(
+        [&] {
+            order.push_back(1);
+        },
+        CPUStreamsExecutor::TaskPriority::Normal,
+        nullptr);
+    taskExecutor->run(
+        [&] {
+            order.push_back(0);
+            done.set_value();
+        },
+        CPUStreamsExecutor::TaskPriority::High,
+        nullptr);
+    unblock.set_value();
+    done.get_future().wait();
+    // the low task runs last, so it observes the full order
+    std::promise<void> lowDone;
+    taskExecutor->run(
+        [&] {
+            lowDone.set_value();
+        },
+        CPUStreamsExecutor::TaskPriority::Low,
+        nullptr);
+    lowDone.get_future().wait();
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(PriorityTaskExecutorTests, preemptionPointSkipsOwnTasks) {
+    auto taskExecutor = makeSingleStreamExecutor();
+    const int ownTag = 0;
+    const int otherTag = 0;
+    std::promise<void> blockerStarted;
+    std::promise<void> unblock;
+    taskExecutor->run([&] {
+        blockerStarted.set_value();
+        unblock.get_future().wait();
+    });
+    blockerStarted.get_future().wait();
+    ASSERT_FALSE(taskExecutor->HasHighPriorityTasksPending());
+    bool ownTaskExecuted = false;
+    bool otherTaskExecuted = false;
+    taskExecutor->run(
+        [&] {
+            ownTaskExecuted = true;
+        },
+        CPUStreamsExecutor::TaskPriority::High,
+        &ownTag);
+    taskExecutor->run(
+        [&] {
+            otherTaskExecuted = true;
+        },
+        CPUStreamsExecutor::TaskPriority::High,
+        &otherTag);
+    ASSERT_TRUE(taskExecutor->HasHighPriorityTasksPending());
+    // a preemption point picks up the foreign task and leaves the caller's own one queued
+    ASSERT_TRUE(taskExecutor->RunHighPriorityTask(&ownTag));
+    ASSERT_TRUE(otherTaskExecuted);
+    ASSERT_FALSE(ownTaskExecuted);
+    ASSERT_FALSE(taskExecutor->RunHighPriorityTask(&ownTag));
+    ASSERT_TRUE(taskExecutor->RunHighPriorityTask(&otherTag));
+    ASSERT_TRUE(ownTaskExecuted);
+    ASSERT_FALSE(taskExecutor->HasHighPriorityTasksPending());
+    unblock.set_value();
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "fat_blob.hpp"
+
+using namespace ov;
+
+namespace {
+
+std::stringstream makeFatBlob(const std::vector<std::string>& devices,
+                              const std::vector<std::string>& architectures,
+                              const std::vector<std::string>& blobs) {
+    std::stringstream stream;
+    writeFatBlob(stream, devices, architectures, blobs);
+    return stream;
+}
+
+std::string readSection(std::istream& stream, size_t size) {
+    std::string section(size, '\0');
+    stream.read(&section[0], size);
+    return section;
+}
+
+}  // namespace
+
+TEST(FatBlobTests, PlainStreamIsNotAFatBlob) {
+    std::stringstream stream{"<?xml version"};
+    ASSERT_FALSE(isFatBlob(stream));
+    // the check must not consume the stream
+    ASSERT_EQ(0, stream.tellg());
+}
+
+TEST(FatBlobTests, WriteReadRoundTrip) {
+    auto stream = makeFatBlob({"CPU", "GPU", "GPU"}, {"", "GPU.0.0", "GPU.12.0"}, {"cpu_blob", "gen9", "dg2_blob"});
+    ASSERT_TRUE(isFatBlob(stream));
+
+    auto index = readFatBlobIndex(stream);
+    ASSERT_EQ(3, index.size());
+    EXPECT_EQ("CPU", index[0].deviceName);
+    EXPECT_EQ("", index[0].architecture);
+    EXPECT_EQ(8, index[0].size);
+    EXPECT_EQ("GPU", index[2].deviceName);
+    EXPECT_EQ("GPU.12.0", index[2].architecture);
+    EXPECT_EQ(index[1].offset, index[0].offset + index[0].size);
+
+    stream.seekg(static_cast<std::streamoff>(index[2].offset), std::ios::beg);
+    EXPECT_EQ("dg2_blob", readSection(stream, index[2].size));
+}
+
+TEST(FatBlobTests, SeekSelectsMatchingArchitecture) {
+    auto stream = makeFatBlob({"GPU", "GPU"}, {"GPU.0.0", "GPU.12.0"}, {"gen9", "dg2_blob"});
+    seekFatBlobSection(stream, "GPU", "GPU.12.0");
+    EXPECT_EQ("dg2_blob", readSection(stream, 8));
+}
+
+TEST(FatBlobTests, SeekFallsBackToEmptyArchitecture) {
+    auto stream = makeFatBlob({"GPU", "GPU"}, {"GPU.0.0", ""}, {"gen9", "fallback"});
+    seekFatBlobSection(stream, "GPU", "GPU.12.0");
+    EXPECT_EQ("fallback", readSection(stream, 8));
+}
+
+TEST(FatBlobTests, SeekMatchesDeviceFamily) {
+    auto stream = makeFatBlob({"CPU", "GPU"}, {"", ""}, {"cpu_blob", "gpu_blob"});
+    seekFatBlobSection(stream, "GPU.1", "");
+    EXPECT_EQ("gpu_blob", readSection(stream, 8));
+}
+
+TEST(FatBlobTests, SeekThrowsWhenNoSectionFits) {
+    auto stream = makeFatBlob({"CPU"}, {""}, {"cpu_blob"});
+    ASSERT_THROW(seekFatBlobSection(stream, "MYRIAD", ""), InferenceEngine::NotFound);
+}
+
+TEST(FatBlobTests, TruncatedHeaderThrows) {
+    auto fat = makeFatBlob({"CPU"}, {""}, {"cpu_blob"}).str();
+    std::stringstream truncated{fat.substr(0, 14)};
+    ASSERT_THROW(readFatBlobIndex(truncated), InferenceEngine::NetworkNotRead);
+}
@@ -36,6 +36,10 @@ std::string GetNetworkPrecision(const IE::CNNNetwork& network) {
     }
     return METRIC_VALUE(FP32);
 }
+// the pool grows by at most one request per cooldown, so a single burst cannot
+// inflate it to the cap at once; parking starts only after the overflow-free window
+constexpr auto growCooldown = std::chrono::milliseconds{100};
+constexpr auto shrinkIdleWindow = std::chrono::milliseconds{5000};
 }  // namespace
 
 void AutoSchedule::GenerateWorkers(const std::string& device,
@@ -62,40 +66,132 @@ void AutoSchedule::GenerateWorkers(const std::string& device,
     }
     const auto numRequests = (_autoSContext->_devicePriorities.end() == itNumRequests ||
                               itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
-    auto& workerRequests = _workerRequests[device];
     auto& idleWorkerRequests = _idleWorkerRequests[device];
-    workerRequests.resize(numRequests);
+    auto& workerPool = _workerPools[device];
+    workerPool.executableNetwork = executableNetwork;
+    workerPool.initialSize = numRequests;
+    workerPool.maxSize = numRequests * 2;
+    workerPool.activeSize = numRequests;
+    workerPool.lastGrow = std::chrono::steady_clock::now();
+    workerPool.lastOverflow = workerPool.lastGrow;
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>(new IE::ThreadSafeQueue<IE::Task>);
-    auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
-    idleWorkerRequests.set_capacity(numRequests);
-    int num = 0;
-    for (auto&& workerRequest : workerRequests) {
-        workerRequest._inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
-        auto* workerRequestPtr = &workerRequest;
-        workerRequestPtr->_index = num++;
-        IE_ASSERT(idleWorkerRequests.try_push(std::make_pair(workerRequestPtr->_index, workerRequestPtr)) == true);
-        workerRequest._inferRequest->SetCallback(
-            [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
-                IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
-                workerRequestPtr->_exceptionPtr = exceptionPtr;
-                {
-                    auto capturedTask = std::move(workerRequestPtr->_task);
-                    capturedTask();
-                }
-                // try to return the request to the idle list (fails if the overall object destruction has began)
-                if (idleGuard.Release()->try_push(std::make_pair(workerRequestPtr->_index, workerRequestPtr))) {
-                    // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
-                    // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
-                    IE::Task t;
-                    do {
-                        _inferPipelineTasks.try_pop(t);
-                    } while (t && ScheduleToWorkerInferRequest(std::move(t)));
-                    do {
-                        _inferPipelineTasksDeviceSpecific[device]->try_pop(t);
-                    } while (t && ScheduleToWorkerInferRequest(std::move(t), device));
-                }
-            });
+    // the capacity covers the fully grown pool, so a grown request always fits back
+    idleWorkerRequests.set_capacity(workerPool.maxSize);
+    for (auto num = 0u; num < numRequests; num++) {
+        CreateWorkerRequest(device, executableNetwork);
+    }
+}
+
+void AutoSchedule::CreateWorkerRequest(const std::string& device, const SoExecNetwork& executableNetwork) {
+    auto& workerRequests = _workerRequests[device];
+    auto* idleWorkerRequestsPtr = &(_idleWorkerRequests[device]);
+    workerRequests.emplace_back();
+    auto* workerRequestPtr = &(workerRequests.back());
+    workerRequestPtr->_index = static_cast<int>(workerRequests.size() - 1);
+    workerRequestPtr->_inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
+    IE_ASSERT(idleWorkerRequestsPtr->try_push(std::make_pair(workerRequestPtr->_index, workerRequestPtr)) == true);
+    workerRequestPtr->_inferRequest->SetCallback(
+        [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
+            IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
+            workerRequestPtr->_exceptionPtr = exceptionPtr;
+            if (_autoSContext->_runtimeBalancing) {
+                // update the per-device latency average used for the migration decisions
+                const auto latencyUs = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                          workerRequestPtr->_startTime)
+                        .count());
+                auto& avg = (device == "CPU_HELP") ? _cpuHelpAvgLatencyUs : _actualAvgLatencyUs;
+                const auto prev = avg.load(std::memory_order_relaxed);
+                avg.store(prev ? (prev * 7 + latencyUs) / 8 : latencyUs, std::memory_order_relaxed);
+            }
+            {
+                auto capturedTask = std::move(workerRequestPtr->_task);
+                capturedTask();
+            }
+            // a grown request is parked instead of returned to the idle list once the pool
+            // saw no scheduling overflow for a while
+            if (TryParkWorkerRequest(device, workerRequestPtr)) {
+                idleGuard.Release();
+                return;
+            }
+            // try to return the request to the idle list (fails if the overall object destruction has began)
+            if (idleGuard.Release()->try_push(std::make_pair(workerRequestPtr->_index, workerRequestPtr))) {
+                // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
+                // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
+                IE::Task t;
+                do {
+                    _inferPipelineTasks.try_pop(t);
+                } while (t && ScheduleToWorkerInferRequest(std::move(t)));
+                do {
+                    _inferPipelineTasksDeviceSpecific[device]->try_pop(t);
+                } while (t && ScheduleToWorkerInferRequest(std::move(t), device));
+            }
+        });
+}
+
+void AutoSchedule::TryGrowWorkerPool(const std::string& device) {
+    // the CPU_HELP pool is recycled as a whole once the actual device is ready, which
+    // requires all of its requests to show up in the idle list, so it stays fixed-size
+    if (device == "CPU_HELP") {
+        return;
+    }
+    auto workerPoolIter = _workerPools.find(device);
+    if (workerPoolIter == _workerPools.end()) {
+        return;
+    }
+    auto& workerPool = workerPoolIter->second;
+    WorkerInferRequest* recycledRequestPtr = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(workerPool.mutex);
+        const auto now = std::chrono::steady_clock::now();
+        workerPool.lastOverflow = now;
+        if (workerPool.activeSize >= workerPool.maxSize || now - workerPool.lastGrow < growCooldown) {
+            return;
+        }
+        workerPool.lastGrow = now;
+        workerPool.activeSize++;
+        if (!workerPool.parked.empty()) {
+            recycledRequestPtr = workerPool.parked.back();
+            workerPool.parked.pop_back();
+        }
+    }
+    if (recycledRequestPtr) {
+        // the underlying device request stayed alive while parked, just re-enlist it
+        if (!_idleWorkerRequests[device].try_push(std::make_pair(recycledRequestPtr->_index, recycledRequestPtr))) {
+            return;
+        }
+    } else {
+        CreateWorkerRequest(device, workerPool.executableNetwork);
     }
+    LOG_DEBUG_TAG("worker pool of %s grown, %s a request", device.c_str(),
+        recycledRequestPtr ? "recycled" : "created");
+    // there is a vacant request now, drain the tasks queued before the pool grew
+    IE::Task t;
+    do {
+        _inferPipelineTasks.try_pop(t);
+    } while (t && ScheduleToWorkerInferRequest(std::move(t)));
+    do {
+        _inferPipelineTasksDeviceSpecific[device]->try_pop(t);
+    } while (t && ScheduleToWorkerInferRequest(std::move(t), device));
+}
+
+bool AutoSchedule::TryParkWorkerRequest(const std::string& device, WorkerInferRequest* workerRequestPtr) {
+    if (device == "CPU_HELP") {
+        return false;
+    }
+    auto workerPoolIter = _workerPools.find(device);
+    if (workerPoolIter == _workerPools.end()) {
+        return false;
+    }
+    auto& workerPool = workerPoolIter->second;
+    std::lock_guard<std::mutex> lock(workerPool.mutex);
+    if (workerPool.activeSize <= workerPool.initialSize ||
+        std::chrono::steady_clock::now() - workerPool.lastOverflow < shrinkIdleWindow) {
+        return false;
+    }
+    workerPool.parked.push_back(workerRequestPtr);
+    workerPool.activeSize--;
+    return true;
 }
 
 void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
@@ -229,10 +325,12 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
             // initialize containers before run async task
             _idleWorkerRequests[device.deviceName];
             _workerRequests[device.deviceName];
+            _workerPools[device.deviceName];
             _inferPipelineTasksDeviceSpecific[device.deviceName] = nullptr;
         }
         _idleWorkerRequests["CPU_HELP"];
         _workerRequests["CPU_HELP"];
+        _workerPools["CPU_HELP"];
         _inferPipelineTasksDeviceSpecific["CPU_HELP"] = nullptr;
         _executor->run(_loadContext[CPU].task);
         _executor->run(_loadContext[ACTUALDEVICE].task);
@@ -287,7 +385,12 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
                 }
             }
         };
-        _executor->run(std::move(recycleTask));
+        if (_autoSContext->_runtimeBalancing) {
+            // the helper network keeps serving the overflow traffic, so do not recycle it
+            LOG_INFO_TAG("runtime load balancing enabled, CPU helper is kept for the overflow traffic");
+        } else {
+            _executor->run(std::move(recycleTask));
+        }
     } else {
         // only one device need to load network, do not need to load it async
         _loadContext[ACTUALDEVICE].task();
@@ -449,6 +552,18 @@ bool AutoSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Devi
         // _acceleratorDevice could be the same as _cpuDevice, such as AUTO:CPU
         if (_loadContext[ACTUALDEVICE].isAlready) {
             devices.push_back(_loadContext[ACTUALDEVICE].deviceInfo);
+            // with the runtime load balancing the CPU helper stays alive after the actual device
+            // became ready and takes the overflow traffic when all the actual device requests are
+            // busy, unless its observed latency makes such migration counterproductive
+            if (_autoSContext->_runtimeBalancing && _loadContext[CPU].isEnabled && _loadContext[CPU].isAlready) {
+                const auto cpuAvg = _cpuHelpAvgLatencyUs.load(std::memory_order_relaxed);
+                const auto actualAvg = _actualAvgLatencyUs.load(std::memory_order_relaxed);
+                if (!cpuAvg || !actualAvg || cpuAvg <= actualAvg * 4) {
+                    auto deviceInfo = _loadContext[CPU].deviceInfo;
+                    deviceInfo.deviceName = _loadContext[CPU].workName;
+                    devices.push_back(std::move(deviceInfo));
+                }
+            }
         } else {
             // replace deviceName with workName, so schedule can select correct
             // idleWorkerQueue
@@ -471,6 +586,14 @@ bool AutoSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Devi
     } else {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
     }
+    // the task is safely queued, on a sustained overflow let the pools of the attempted
+    // devices grow, the grown request will drain the queue
+    for (auto&& device : devices) {
+        if (!preferred_device.empty() && (device.deviceName != preferred_device)) {
+            continue;
+        }
+        TryGrowWorkerPool(device.deviceName);
+    }
     return false;
 }
 
@@ -38,6 +38,21 @@ enum AutoLoadContextIndex {
     ACTUALDEVICE = 1,
     CONTEXTNUM = 2
 };
+
+// bookkeeping of the elastic per-device worker pool: the pool starts with the optimal
+// number of requests, grows on sustained scheduling overflow up to twice that number
+// and parks the extra requests again once the overflow traffic is gone, keeping the
+// underlying device requests alive for a cheap re-enlisting later
+struct WorkerPoolState {
+    SoExecNetwork                     executableNetwork;
+    unsigned int                      initialSize = 0;
+    unsigned int                      maxSize = 0;
+    unsigned int                      activeSize = 0;
+    std::vector<WorkerInferRequest*>  parked;
+    Time                              lastGrow;
+    Time                              lastOverflow;
+    std::mutex                        mutex;
+};
 class AutoSchedule : public MultiSchedule {
 public:
     using Ptr = std::shared_ptr<AutoSchedule>;
@@ -53,7 +68,11 @@ protected:
     void GenerateWorkers(const std::string& device, const SoExecNetwork& executableNetwork) override;
     bool ScheduleToWorkerInferRequest(IE::Task, DeviceName preferred_device = "") override;
     static bool RunPipelineTask(IE::Task& inferPipelineTask, NotBusyPriorityWorkerRequests& idleWorkerRequests, const DeviceName& preferred_device);
+    void CreateWorkerRequest(const std::string& device, const SoExecNetwork& executableNetwork);
+    void TryGrowWorkerPool(const std::string& device);
+    bool TryParkWorkerRequest(const std::string& device, WorkerInferRequest* workerRequestPtr);
     DeviceMap<NotBusyPriorityWorkerRequests> _idleWorkerRequests;
+    DeviceMap<WorkerPoolState>               _workerPools;
 
 private:
     void WaitFirstNetworkReady();
@@ -68,6 +87,10 @@ private:
     bool                                     _exitFlag = {false};
     size_t                                   _cpuHelpInferCount = 0;
     std::atomic_size_t                       _numRequestsCreated = {0};
+    // observed per-device request latency (exponential moving average, in microseconds),
+    // only maintained when the runtime load balancing is enabled
+    std::atomic<uint64_t>                    _cpuHelpAvgLatencyUs = {0};
+    std::atomic<uint64_t>                    _actualAvgLatencyUs = {0};
     AutoScheduleContext::Ptr                 _autoSContext;
 };
 
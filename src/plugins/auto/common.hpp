@@ -58,6 +58,7 @@ struct WorkerInferRequest {
     std::list<Time>    _startTimes;
     std::list<Time>    _endTimes;
     int                _index = 0;
+    Time               _startTime;
 };
 
 using NotBusyPriorityWorkerRequests = IE::ThreadSafeBoundedPriorityQueue<std::pair<int, WorkerInferRequest*>>;
@@ -136,6 +137,7 @@ public:
     unsigned int                _modelPriority = 0;
     std::string                 _performanceHint;
     std::mutex                  _confMutex;
+    bool                        _runtimeBalancing = false;
     MultiDeviceInferencePlugin* _plugin;
     virtual ~AutoScheduleContext() = default;
 };
@@ -94,6 +94,7 @@ Pipeline MultiSchedule::GetPipeline(const IInferPtr& syncInferRequest, WorkerInf
                     *workerInferRequest = _thisWorkerInferRequest;
                     auto multiSyncInferRequest = std::dynamic_pointer_cast<MultiDeviceInferRequest>(syncInferRequest);
                     multiSyncInferRequest->SetBlobsToAnotherRequest(_thisWorkerInferRequest->_inferRequest);
+                    (*workerInferRequest)->_startTime = std::chrono::steady_clock::now();
                     INFO_RUN([workerInferRequest]() {
                         (*workerInferRequest)->_startTimes.push_back(std::move(std::chrono::steady_clock::now()));
                 });
@@ -139,6 +140,7 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
                               itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
     auto& workerRequests = _workerRequests[device];
     auto& idleWorkerRequests = _idleWorkerRequests[device];
+    _poolStats[device].total = numRequests;
     workerRequests.resize(numRequests);
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>(new IE::ThreadSafeQueue<IE::Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
@@ -153,6 +155,14 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
             [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
                 IdleGuard<NotBusyWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                // saturating decrement: derived schedules may dispatch to a worker without
+                // going through ScheduleToWorkerInferRequest, so no matching increment exists
+                auto statsIt = _poolStats.find(device);
+                if (statsIt != _poolStats.end()) {
+                    auto inflight = statsIt->second.inflight.load(std::memory_order_relaxed);
+                    while (inflight > 0 && !statsIt->second.inflight.compare_exchange_weak(inflight, inflight - 1)) {
+                    }
+                }
                 {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
@@ -178,11 +188,22 @@ bool MultiSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Dev
         std::lock_guard<std::mutex> lock(_multiSContext->_mutex);
         return _multiSContext->_devicePriorities;
     }();
+    if (preferred_device.empty() && devices.size() > 1) {
+        // a device that drains its pool faster exposes more free slots, so ordering by the
+        // free slot count assigns the bigger request share to the faster device and keeps
+        // all of them saturated; ties fall back to the configured priority order
+        std::stable_sort(devices.begin(), devices.end(), [this](const DeviceInformation& a, const DeviceInformation& b) {
+            return FreeWorkerSlots(a.deviceName) > FreeWorkerSlots(b.deviceName);
+        });
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device)) {
             continue;
         }
         if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+            auto statsIt = _poolStats.find(device.deviceName);
+            if (statsIt != _poolStats.end())
+                statsIt->second.inflight++;
             return true;
         }
     }
@@ -213,6 +234,15 @@ bool MultiSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
     return false;
 }
 
+unsigned int MultiSchedule::FreeWorkerSlots(const DeviceName& device) const {
+    const auto it = _poolStats.find(device);
+    if (it == _poolStats.end()) {
+        return 0;
+    }
+    const auto inflight = it->second.inflight.load(std::memory_order_relaxed);
+    return it->second.total > inflight ? it->second.total - inflight : 0;
+}
+
 void MultiSchedule::run(IE::Task inferPipelineTask) {
     ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName);
 }
@@ -5,6 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <atomic>
+#include <deque>
+
 #include "schedule.hpp"
 
 #ifdef  MULTIUNITTEST
@@ -47,13 +50,24 @@ protected:
     virtual void GenerateWorkers(const std::string& device, const IE::SoExecutableNetworkInternal& executableNetwork);
     static bool RunPipelineTask(IE::Task& inferPipelineTask, NotBusyWorkerRequests& idleWorkerRequests, const DeviceName& preferred_device);
     virtual bool ScheduleToWorkerInferRequest(IE::Task, DeviceName preferred_device = "");
+    unsigned int FreeWorkerSlots(const DeviceName& device) const;
     std::string GetLogTag() const noexcept;
 
 protected:
+    // per device pool occupancy used to pick the device with the most free slots when a request
+    // comes without a preference; the pools are sized by each device's optimal request number
+    // and refill at its completion rate, so the shares track the device throughput
+    struct WorkerPoolStats {
+        unsigned int total = 0;
+        std::atomic<unsigned int> inflight{0};
+    };
+
     IE::ThreadSafeQueue<IE::Task>                             _inferPipelineTasks;
     DeviceMap<std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                          _idleWorkerRequests;
-    DeviceMap<std::vector<WorkerInferRequest>>                _workerRequests;
+    DeviceMap<WorkerPoolStats>                                _poolStats;
+    // deque keeps the worker requests addresses stable when the pool grows at runtime
+    DeviceMap<std::deque<WorkerInferRequest>>                 _workerRequests;
     mutable std::mutex                                        _mutex;
     std::atomic_size_t                                        _numRequestsCreated = {0};
     MultiScheduleContext::Ptr                                 _multiSContext;
@@ -243,6 +243,8 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
                 return ov::util::from_string(val, ov::auto_batch_timeout);
             } else if (name == ov::intel_auto::device_bind_buffer) {
                 return val == PluginConfigParams::YES ? true : false;
+            } else if (name == ov::intel_auto::runtime_load_balancing) {
+                return val == PluginConfigParams::YES ? true : false;
             } else if (name == ov::log::level) {
                 return ov::util::from_string(val, ov::log::level);
             } else if (name == ov::device::priorities) {
@@ -449,6 +451,9 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
         auto tmpiter = fullConfig.find(ov::intel_auto::device_bind_buffer.name());
         if (tmpiter != fullConfig.end() && tmpiter->second == PluginConfigParams::YES)
             autoSContext->_bindBuffer = true;
+        auto balanceIter = fullConfig.find(ov::intel_auto::runtime_load_balancing.name());
+        if (balanceIter != fullConfig.end() && balanceIter->second == PluginConfigParams::YES)
+            autoSContext->_runtimeBalancing = true;
         return std::make_shared<AutoExecutableNetwork>(autoSContext, std::make_shared<AutoSchedule>());
     }
     OV_ITT_SCOPED_TASK(itt::domains::MULTIPlugin, "MultiDeviceInferencePlugin::LoadNetworkImpl:MultiMode");
@@ -24,6 +24,7 @@ struct PluginConfig {
                 _devicePriority(""),
                 _modelPriority(1),
                 _deviceBindBuffer(false),
+                _runtimeLoadBalancing(false),
                 _logLevel("LOG_NONE") {
         adjustKeyMapValues();
     }
@@ -37,6 +38,7 @@ struct PluginConfig {
             res.push_back(ov::hint::allow_auto_batching.name());
             res.push_back(ov::log::level.name());
             res.push_back(ov::intel_auto::device_bind_buffer.name());
+            res.push_back(ov::intel_auto::runtime_load_balancing.name());
             res.push_back(ov::auto_batch_timeout.name());
             return res;
         }();
@@ -65,6 +67,7 @@ struct PluginConfig {
                                                        RW_property(ov::hint::performance_mode.name()),
                                                        RW_property(ov::hint::num_requests.name()),
                                                        RW_property(ov::intel_auto::device_bind_buffer.name()),
+                                                       RW_property(ov::intel_auto::runtime_load_balancing.name()),
                                                        RW_property(ov::cache_dir.name())};
             std::vector<ov::PropertyName> supportedProperties;
             supportedProperties.reserve(roProperties.size() + rwProperties.size());
@@ -158,6 +161,12 @@ struct PluginConfig {
                 else
                     IE_THROW() << "Unsupported config value: " << kvp.second
                             << " for key: " << kvp.first;
+            } else if (kvp.first == ov::intel_auto::runtime_load_balancing.name()) {
+                if (kvp.second == PluginConfigParams::YES) _runtimeLoadBalancing = true;
+                else if (kvp.second == PluginConfigParams::NO) _runtimeLoadBalancing = false;
+                else
+                    IE_THROW() << "Unsupported config value: " << kvp.second
+                            << " for key: " << kvp.first;
             } else if (kvp.first == ov::device::priorities.name()) {
                 if (!kvp.second.empty())
                     ParsePrioritiesDevices(kvp.second);
@@ -261,6 +270,10 @@ struct PluginConfig {
             _keyConfigMap[ov::intel_auto::device_bind_buffer.name()] = PluginConfigParams::YES;
         else
             _keyConfigMap[ov::intel_auto::device_bind_buffer.name()] = PluginConfigParams::NO;
+        if (_runtimeLoadBalancing)
+            _keyConfigMap[ov::intel_auto::runtime_load_balancing.name()] = PluginConfigParams::YES;
+        else
+            _keyConfigMap[ov::intel_auto::runtime_load_balancing.name()] = PluginConfigParams::NO;
 
         _keyConfigMap[ov::auto_batch_timeout.name()] = _batchTimeout;
 
@@ -281,6 +294,7 @@ struct PluginConfig {
     std::string _devicePriority;
     int _modelPriority;
     bool _deviceBindBuffer;
+    bool _runtimeLoadBalancing;
     std::string _logLevel;
     PerfHintsConfig  _perfHintsConfig;
     // Add this flag to check if user app sets hint with none value that is equal to the default value of hint.
@@ -371,6 +371,42 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     }
 }
 
+void AutoBatchInferRequest::SetInputsToPartialRequest(SoIInferRequestInternal& req, size_t slot) {
+    for (const auto& it : _networkInputs) {
+        // this request is already in BUSY state, so using the internal functions safely
+        auto src = GetBlob(it.first);
+        auto dst = req->GetBlob(it.first);
+        const ptrdiff_t szSrc = src->byteSize();
+        const ptrdiff_t szDst = dst->byteSize();
+        auto ptrSrc = src->cbuffer().as<const char*>();
+        auto ptrDst = dst->buffer().as<char*>();
+        if (szSrc != szDst) {
+            // batched input: this request holds a single item that goes into the given slot
+            memcpy(ptrDst + slot * szSrc, ptrSrc, szSrc);
+        } else if (!slot && (ptrDst != ptrSrc)) {
+            // non-batched data is assumed equal for all the requests of the group, copy once
+            memcpy(ptrDst, ptrSrc, szSrc);
+        }
+    }
+}
+
+void AutoBatchInferRequest::GetOutputsFromPartialRequest(SoIInferRequestInternal& req, size_t slot) {
+    for (const auto& it : _networkOutputs) {
+        // this request is already in BUSY state, so using the internal functions safely
+        auto src = req->GetBlob(it.first);
+        auto dst = GetBlob(it.first);
+        const ptrdiff_t szSrc = src->byteSize();
+        const ptrdiff_t szDst = dst->byteSize();
+        auto ptrSrc = src->cbuffer().as<const char*>();
+        auto ptrDst = dst->buffer().as<char*>();
+        if (szSrc != szDst) {
+            memcpy(ptrDst, ptrSrc + slot * szDst, szDst);
+        } else if (!slot && (ptrDst != ptrSrc)) {
+            memcpy(ptrDst, ptrSrc, szDst);
+        }
+    }
+}
+
 AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
     const AutoBatchInferRequest::Ptr& inferRequest,
     InferenceEngine::SoIInferRequestInternal& inferRequestWithoutBatch,
@@ -386,6 +422,13 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            workerInferRequest.RecordArrival();
+            // stage the inputs into the batched blobs right away, so that the copies of the individual
+            // requests run concurrently (on the callers' threads) and overlap with the execution of the
+            // other in-flight batches, instead of being serialized on the worker thread at the batch start.
+            // Writing the slot is safe before the push: the slot belongs to this request exclusively and
+            // the batched request never executes with this slot in-flight until the task is queued
+            _this->_inferRequest->CopyInputsIfNeeded();
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = static_cast<int>(workerInferRequest._tasks.size());
@@ -429,6 +472,7 @@ AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
 AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
     const InferenceEngine::SoExecutableNetworkInternal& networkWithoutBatch,
+    const InferenceEngine::SoExecutableNetworkInternal& networkWithHalfBatch,
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
@@ -437,6 +481,7 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _networkHalfBatch{networkWithHalfBatch},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -516,13 +561,22 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                 // reset the timeout
                 workerRequestPtr->_cond.notify_one();
             });
+        if (_networkHalfBatch) {
+            workerRequestPtr->_inferRequestBatchedHalf = {_networkHalfBatch->CreateInferRequest(),
+                                                          _networkHalfBatch._so};
+            workerRequestPtr->_halfBatchSize = _device.batchForDevice / 2;
+        }
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
             while (1) {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    // the timeout is adapted to the observed requests arrival rate,
+                    // the configured AUTO_BATCH_TIMEOUT value remains the upper bound
+                    status = workerRequestPtr->_cond.wait_for(
+                        lock,
+                        std::chrono::milliseconds(workerRequestPtr->EstimateTimeoutMs(_timeOut)));
                 }
                 if (_terminate) {
                     break;
@@ -535,34 +589,69 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completionTasks[n] = std::move(t.second);
-                            t.first->_inferRequest->CopyInputsIfNeeded();
+                            // the inputs were already staged into the batched blobs on the arrival
+                            // (see ThisRequestExecutor::run), nothing to copy here
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                        // timeout to collect the full batch is over, drain the partially filled batch
+                        int left = sz;
+                        // first, run the groups that fill the half-batch request completely (if compiled)
+                        const int szHalf = workerRequestPtr->_halfBatchSize;
+                        while (workerRequestPtr->_inferRequestBatchedHalf && left >= szHalf) {
+                            std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> group(szHalf);
+                            std::promise<void> group_completed;
+                            auto group_completed_future = group_completed.get_future();
+                            workerRequestPtr->_inferRequestBatchedHalf->SetCallback(
+                                [&group, &group_completed](std::exception_ptr p) {
                                     if (p)
-                                        t.first->_inferRequest->_exceptionPtr = p;
-                                    t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
+                                        for (auto& g : group)
+                                            g.first->_inferRequest->_exceptionPtr = p;
+                                    group_completed.set_value();
                                 });
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
-                            t.first->_inferRequestWithoutBatch->StartAsync();
+                            for (int m = 0; m < szHalf; m++) {
+                                IE_ASSERT(workerRequestPtr->_tasks.try_pop(group[m]));
+                                group[m].first->_inferRequest->_wasBatchedRequestUsed =
+                                    AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                                group[m].first->_inferRequest->SetInputsToPartialRequest(
+                                    workerRequestPtr->_inferRequestBatchedHalf,
+                                    m);
+                            }
+                            workerRequestPtr->_inferRequestBatchedHalf->StartAsync();
+                            group_completed_future.get();
+                            for (int m = 0; m < szHalf; m++) {
+                                group[m].first->_inferRequest->GetOutputsFromPartialRequest(
+                                    workerRequestPtr->_inferRequestBatchedHalf,
+                                    m);
+                                group[m].second();
+                            }
+                            left -= szHalf;
+                        }
+                        if (left) {
+                            // the remainder is executed in the batch1 mode
+                            std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+                            std::atomic<int> arrived = {0};
+                            std::promise<void> all_completed;
+                            auto all_completed_future = all_completed.get_future();
+                            for (int n = 0; n < left; n++) {
+                                IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                                t.first->_inferRequestWithoutBatch->SetCallback(
+                                    [t, left, &arrived, &all_completed](std::exception_ptr p) {
+                                        if (p)
+                                            t.first->_inferRequest->_exceptionPtr = p;
+                                        t.second();
+                                        if (left == ++arrived)
+                                            all_completed.set_value();
+                                    });
+                                t.first->_inferRequest->_wasBatchedRequestUsed =
+                                    AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                                t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+                                t.first->_inferRequestWithoutBatch->StartAsync();
+                            }
+                            all_completed_future.get();
                         }
-                        all_completed_future.get();
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -974,8 +1063,26 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
         }
     }
 
+    // additionally compile with half of the batch size, so that the partially filled batches
+    // (collected on the time-out) can still be executed batched rather than one by one
+    InferenceEngine::SoExecutableNetworkInternal executableNetworkWithHalfBatch;
+    if (executableNetworkWithBatch && metaDevice.batchForDevice >= 4) {
+        try {
+            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+            for (const auto& input : batched_inputs)
+                shapes[input][0] = metaDevice.batchForDevice / 2;
+            reshaped.reshape(shapes);
+            executableNetworkWithHalfBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                                                 : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+        } catch (...) {
+            // no half-batch network then, the partial batches fall back to the batch1 execution
+        }
+    }
+
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
+                                                        executableNetworkWithHalfBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <string>
@@ -37,17 +38,77 @@ public:
         using Ptr = std::shared_ptr<WorkerInferRequest>;
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
         int _batchSize;
+        // second, smaller request used to drain partially filled batches on timeout (optional)
+        InferenceEngine::SoIInferRequestInternal _inferRequestBatchedHalf;
+        int _halfBatchSize = 0;
         InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
         std::vector<InferenceEngine::Task> _completionTasks;
         std::thread _thread;
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+
+        // Inter-arrival histogram (log2 buckets over microseconds) of the requests routed to this
+        // worker, periodically decayed so that it tracks the current traffic window. The collection
+        // timeout is then adapted to the observed rate instead of always waiting the full
+        // AUTO_BATCH_TIMEOUT under bursty traffic.
+        static constexpr int kNumArrivalBuckets = 20;
+        std::atomic<uint32_t> _arrivalHist[kNumArrivalBuckets] = {};
+        std::atomic<uint64_t> _lastArrivalUs{0};
+        std::atomic<uint32_t> _arrivalCount{0};
+
+        void RecordArrival() {
+            using namespace std::chrono;
+            const uint64_t now =
+                duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+            const uint64_t prev = _lastArrivalUs.exchange(now, std::memory_order_relaxed);
+            if (!prev || now <= prev)
+                return;
+            uint64_t gap = now - prev;
+            int bucket = 0;
+            while (gap > 1 && bucket < kNumArrivalBuckets - 1) {
+                gap >>= 1;
+                bucket++;
+            }
+            _arrivalHist[bucket].fetch_add(1, std::memory_order_relaxed);
+            if ((_arrivalCount.fetch_add(1, std::memory_order_relaxed) & 0xFF) == 0xFF) {
+                // exponential decay, so old windows stop dominating the estimate
+                for (auto& c : _arrivalHist)
+                    c.store(c.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+            }
+        }
+
+        // Estimates how long collecting a full batch takes at the observed arrival rate
+        // (90th percentile of the inter-arrival gap times the batch size) and clamps the result
+        // to [1 ms, cap], where cap is the configured AUTO_BATCH_TIMEOUT value.
+        unsigned int EstimateTimeoutMs(unsigned int cap) const {
+            uint64_t total = 0;
+            for (const auto& c : _arrivalHist)
+                total += c.load(std::memory_order_relaxed);
+            if (total < static_cast<uint64_t>(_batchSize))  // not enough signal collected yet
+                return cap;
+            const uint64_t target = total * 9 / 10;
+            uint64_t acc = 0;
+            int bucket = 0;
+            for (; bucket < kNumArrivalBuckets - 1; bucket++) {
+                acc += _arrivalHist[bucket].load(std::memory_order_relaxed);
+                if (acc >= target)
+                    break;
+            }
+            const uint64_t gapUs = 1ull << (bucket + 1);  // upper bound of the bucket
+            uint64_t timeoutMs = gapUs * static_cast<uint64_t>(_batchSize) / 1000;
+            if (timeoutMs < 1)
+                timeoutMs = 1;
+            if (timeoutMs > cap)
+                timeoutMs = cap;
+            return static_cast<unsigned int>(timeoutMs);
+        }
     };
 
     explicit AutoBatchExecutableNetwork(
         const InferenceEngine::SoExecutableNetworkInternal& networkForDevice,
         const InferenceEngine::SoExecutableNetworkInternal& networkForDeviceWithoutBatch,
+        const InferenceEngine::SoExecutableNetworkInternal& networkForDeviceWithHalfBatch,
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
@@ -73,6 +134,9 @@ protected:
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    // compiled with half of the device batch size; partially filled batches run here on timeout
+    // instead of degrading all the way to per-request batch1 execution (may be empty)
+    InferenceEngine::SoExecutableNetworkInternal _networkHalfBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
@@ -107,6 +171,9 @@ public:
 
     // Batch-Device impl specific: sets the data (blobs from the device request to the batched device request)
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
+    // Batch-Device impl specific: gather/scatter copies for executing on the half-batch request
+    void SetInputsToPartialRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot);
+    void GetOutputsFromPartialRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
@@ -934,10 +934,14 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (ov::model_name == name) {
         return decltype(ov::model_name)::value_type{_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // each hetero infer request owns a dedicated set of subgraph requests and intermediate
+        // blobs, and its async pipeline runs one stage per subgraph, so the device subgraphs of
+        // consecutive requests overlap. To keep every stage of such pipeline busy the application
+        // needs as many requests as all the stages can hold concurrently, hence the sum of the
+        // per-subgraph optimal numbers (the max would only saturate the deepest single stage)
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (name == ov::execution_devices) {
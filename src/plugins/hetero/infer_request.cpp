@@ -6,6 +6,7 @@
 
 #include <ie_blob.h>
 #include <ie_layouts.h>
+#include <ie_remote_context.hpp>
 
 #include <cassert>
 #include <description_buffer.hpp>
@@ -67,13 +68,69 @@ void HeteroInferRequest::CreateInferRequest(
         }
     });
 
+    auto intermediateName = [&](const std::string& blobName) {
+        auto itName = subgraphInputToOutputBlobNames.find(blobName);
+        return itName != subgraphInputToOutputBlobNames.end() ? itName->second : blobName;
+    };
+
+    auto contextOf = [](const SubRequestDesc& desc) -> InferenceEngine::RemoteContext::Ptr {
+        try {
+            return desc._network->GetContext();
+        } catch (const InferenceEngine::Exception&) {
+            return nullptr;  // the device does not expose a remote context (e.g. CPU)
+        }
+    };
+
     // go over all subnet and create requests
+    std::map<std::string, SubRequestDesc*> intermediateProducers;
+    std::map<std::string, std::string> producerOutputNames;
     for (auto&& desc : _inferRequests) {
         desc._request = {desc._network->CreateInferRequest(), desc._network._so};
         desc._request->setModelInputsOutputs(desc._network->getInputs(), desc._network->getOutputs());
         // go over all inputs and get blobs from subnet infer requests
         for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
             requestBlob(outputInfo.first, desc._request, true);
+            if (!InferenceEngine::details::contains(_networkOutputs, outputInfo.first)) {
+                intermediateProducers[intermediateName(outputInfo.first)] = &desc;
+                producerOutputNames[intermediateName(outputInfo.first)] = outputInfo.first;
+            }
+        }
+    }
+
+    // try to promote the intermediate blobs to device-resident ones: when the producing subgraph
+    // and all the consuming subgraphs run on the same remote-context-capable device, the handoff
+    // goes through a remote blob of that context instead of a host round-trip
+    std::map<std::string, bool> promotable;
+    for (auto&& desc : _inferRequests) {
+        for (auto&& inputInfo : desc._network->GetInputsInfo()) {
+            if (InferenceEngine::details::contains(_networkInputs, inputInfo.first))
+                continue;
+            const auto name = intermediateName(inputInfo.first);
+            auto itProducer = intermediateProducers.find(name);
+            if (itProducer == intermediateProducers.end())
+                continue;
+            auto producerCtx = contextOf(*itProducer->second);
+            auto consumerCtx = contextOf(desc);
+            const bool sameDevice =
+                producerCtx && consumerCtx && producerCtx->getDeviceName() == consumerCtx->getDeviceName();
+            auto itPromotable = promotable.find(name);
+            promotable[name] = (itPromotable == promotable.end() ? sameDevice : itPromotable->second && sameDevice);
+        }
+    }
+    for (auto&& promoted : promotable) {
+        if (!promoted.second)
+            continue;
+        auto* producerDesc = intermediateProducers[promoted.first];
+        try {
+            auto remoteBlob = producerDesc->_network->GetContext()->CreateBlob(
+                _blobs.at(promoted.first)->getTensorDesc());
+            if (remoteBlob) {
+                remoteBlob->allocate();
+                _blobs[promoted.first] = remoteBlob;
+                producerDesc->_request->SetBlob(producerOutputNames[promoted.first], remoteBlob);
+            }
+        } catch (const InferenceEngine::Exception&) {
+            // keep the host blob, the transfer falls back to the usual host round-trip
         }
     }
 
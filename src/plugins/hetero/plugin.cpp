@@ -11,11 +11,13 @@
 #include <string>
 #include <utility>
 #include <fstream>
+#include <unordered_map>
 #include <unordered_set>
 #include "ie_plugin_config.hpp"
 #include "executable_network.hpp"
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <openvino/runtime/properties.hpp>
+#include <ngraph/function.hpp>
 // clang-format on
 
 using namespace InferenceEngine;
@@ -40,6 +42,7 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(COST_TABLE_PATH),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
@@ -47,6 +50,42 @@ const std::vector<std::string>& getSupportedConfigKeys() {
     return supported_configKeys;
 }
 
+// Measured per-op cost table of one device, loaded from <dir>/<device>.costs. The file is a
+// plain text list of "<op_type> <cost_in_microseconds>" lines produced by the benchmark
+// tooling; the reserved "__transfer_per_byte__" entry holds the cost of moving one byte of
+// a tensor across the boundary of this device.
+struct DeviceCostTable {
+    std::map<std::string, double> opCosts;
+    double transferPerByte = 0.0;
+};
+
+bool loadCostTable(const std::string& dir, const std::string& deviceName, DeviceCostTable* table) {
+    std::string path = dir;
+    if (!path.empty() && path.back() != '/' && path.back() != '\\')
+        path += '/';
+    path += deviceName + ".costs";
+    std::ifstream file(path);
+    if (!file.good())
+        return false;
+    std::string opType;
+    double cost = 0.0;
+    while (file >> opType >> cost) {
+        if (opType == "__transfer_per_byte__")
+            table->transferPerByte = cost;
+        else
+            table->opCosts[opType] = cost;
+    }
+    return !table->opCosts.empty();
+}
+
+// Returns the byte size of the tensor, or 0 when it cannot be computed statically
+size_t outputByteSize(const ngraph::Output<ngraph::Node>& output) {
+    const auto& shape = output.get_partial_shape();
+    if (shape.is_dynamic())
+        return 0;
+    return ngraph::shape_size(shape.to_shape()) * output.get_element_type().size();
+}
+
 }  // namespace
 
 InferenceEngine::IExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork& network,
@@ -149,9 +188,57 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
-    for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
-            qr.supportedLayersMap.emplace(layerQueryResult);
+    // When measured per-op cost tables are available for every fallback device, solve for the
+    // split which minimizes the estimated end-to-end latency instead of assigning each
+    // supported node to the highest priority device: walking the ops in topological order,
+    // each node is placed on the supporting device with the smallest sum of its own measured
+    // cost and the cost of transferring the inputs produced on other devices.
+    std::map<std::string, DeviceCostTable> costTables;
+    auto itCostDir = tconfig.find(HETERO_CONFIG_KEY(COST_TABLE_PATH));
+    if (itCostDir != tconfig.end()) {
+        for (auto&& deviceName : fallbackDevices) {
+            DeviceCostTable table;
+            if (loadCostTable(itCostDir->second, deviceName, &table))
+                costTables.emplace(deviceName, std::move(table));
+        }
+    }
+
+    if (fallbackDevices.size() >= 2 && costTables.size() == fallbackDevices.size()) {
+        std::unordered_map<ngraph::Node*, std::string> assigned;
+        for (auto&& node : function->get_ordered_ops()) {
+            const auto& name = node->get_friendly_name();
+            std::string bestDevice;
+            double bestScore = 0.0;
+            for (auto&& deviceName : fallbackDevices) {
+                const auto& supported = queryResults[deviceName].supportedLayersMap;
+                if (supported.find(name) == supported.end())
+                    continue;
+                const auto& table = costTables.at(deviceName);
+                auto itCost = table.opCosts.find(node->get_type_name());
+                // op types without a measurement are treated as free, so their placement is
+                // driven by the transfer terms of the surrounding nodes
+                double score = itCost != table.opCosts.end() ? itCost->second : 0.0;
+                for (auto&& input : node->inputs()) {
+                    auto itProducer = assigned.find(input.get_source_output().get_node());
+                    if (itProducer != assigned.end() && itProducer->second != deviceName)
+                        score += outputByteSize(input.get_source_output()) * table.transferPerByte;
+                }
+                // ties keep the user set priority order
+                if (bestDevice.empty() || score < bestScore) {
+                    bestDevice = deviceName;
+                    bestScore = score;
+                }
+            }
+            if (!bestDevice.empty()) {
+                assigned[node.get()] = bestDevice;
+                qr.supportedLayersMap.emplace(name, bestDevice);
+            }
+        }
+    } else {
+        for (auto&& deviceName : fallbackDevices) {
+            for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+                qr.supportedLayersMap.emplace(layerQueryResult);
+            }
         }
     }
 
@@ -219,6 +306,9 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return {dump};
+    } else if (name == HETERO_CONFIG_KEY(COST_TABLE_PATH)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(COST_TABLE_PATH));
+        return {it != _config.end() ? it->second : std::string{}};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -0,0 +1,260 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "batch_split_infer_request.h"
+
+#include <blob_factory.hpp>
+#include <cpp/ie_infer_request.hpp>
+
+#include "exec_network.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// Only dense blobs with the default strides can be sliced along the outermost dimension into
+// zero-copy views
+bool isDenselyPacked(const InferenceEngine::TensorDesc& desc) {
+    return desc == InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), desc.getLayout());
+}
+
+bool isBatchFirst(const InferenceEngine::TensorDesc& desc) {
+    const auto& order = desc.getBlockingDesc().getOrder();
+    return !desc.getDims().empty() && !order.empty() && order[0] == 0;
+}
+
+}  // namespace
+
+BatchSplitInferRequest::BatchSplitInferRequest(const std::shared_ptr<ExecNetwork>& execNetwork)
+    : IInferRequestInternal(execNetwork->_networkInputs, execNetwork->_networkOutputs),
+      _execNetwork(execNetwork) {
+    setPointerToExecutableNetworkInternal(execNetwork);
+    if (!execNetwork->getInputs().empty() || !execNetwork->getOutputs().empty())
+        setModelInputsOutputs(execNetwork->getInputs(), execNetwork->getOutputs());
+    // the first sub-request also serves as the reference for the blob descriptors and names
+    ensureSubRequests(1);
+}
+
+BatchSplitInferRequest::~BatchSplitInferRequest() {
+    // no sub-request callback may fire into a partially destroyed object
+    try {
+        Wait(InferenceEngine::InferRequest::RESULT_READY);
+    } catch (...) {
+    }
+}
+
+void BatchSplitInferRequest::ensureSubRequests(size_t count) {
+    while (_subRequests.size() < count) {
+        auto request = _execNetwork->CreateStreamInferRequest();
+        request->SetCallback([this](std::exception_ptr exception) {
+            onSubRequestDone(exception);
+        });
+        _subRequests.push_back(std::move(request));
+    }
+}
+
+bool BatchSplitInferRequest::isInputName(const std::string& name) const {
+    if (_networkInputs.count(name))
+        return true;
+    if (_networkOutputs.count(name))
+        return false;
+    // the new API addresses blobs by tensor names which may differ from the map keys
+    for (const auto& param : _parameters) {
+        if (param->get_output_tensor(0).get_names().count(name))
+            return true;
+    }
+    for (const auto& result : _results) {
+        if (result->get_output_tensor(0).get_names().count(name))
+            return false;
+    }
+    IE_THROW(NotFound) << "Failed to find input or output with name: '" << name << "'";
+}
+
+void BatchSplitInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data) {
+    if (!data)
+        IE_THROW(NotAllocated) << "Failed to set empty blob with name: '" << name << "'";
+
+    const bool isInput = isInputName(name);
+    // throws NotFound for names unknown to the compiled network
+    const auto refDesc = _subRequests.front()->GetBlob(name)->getTensorDesc();
+    const auto& desc = data->getTensorDesc();
+    const auto& dims = desc.getDims();
+    const auto& refDims = refDesc.getDims();
+
+    if (desc.getPrecision() != refDesc.getPrecision())
+        IE_THROW(ParameterMismatch) << "Failed to set blob with precision not corresponding to user "
+                                    << (isInput ? "input" : "output") << " precision for '" << name << "'";
+    if (desc.getLayout() != refDesc.getLayout() || dims.size() != refDims.size() || dims.empty())
+        IE_THROW(ParameterMismatch) << "Failed to set blob with layout or rank not corresponding to the "
+                                    << (isInput ? "input" : "output") << " '" << name << "'";
+    for (size_t i = 1; i < dims.size(); i++) {
+        if (dims[i] != refDims[i])
+            IE_THROW(ParameterMismatch) << "Failed to set blob for '" << name
+                                        << "': only the batch dimension may differ from the compiled shape";
+    }
+    if (dims[0] == 0 || dims[0] % refDims[0] != 0)
+        IE_THROW(ParameterMismatch) << "Failed to set blob for '" << name << "': batch " << dims[0]
+                                    << " is not a multiple of the compiled batch " << refDims[0];
+    if (!isDenselyPacked(desc) || !isBatchFirst(desc))
+        IE_THROW(ParameterMismatch) << "Failed to set blob for '" << name
+                                    << "': batch splitting requires a dense blob with the batch as the outermost dimension";
+
+    if (isInput)
+        _fullInputs[name] = data;
+    else
+        _fullOutputs[name] = data;
+}
+
+InferenceEngine::Blob::Ptr BatchSplitInferRequest::GetBlob(const std::string& name) {
+    auto input = _fullInputs.find(name);
+    if (input != _fullInputs.end())
+        return input->second;
+    auto output = _fullOutputs.find(name);
+    if (output != _fullOutputs.end())
+        return output->second;
+    // no full-batch blob was provided: expose the compiled-batch blob of the reference
+    // sub-request, so descriptor introspection and the plain single-batch flow keep working
+    return _subRequests.front()->GetBlob(name);
+}
+
+size_t BatchSplitInferRequest::prepareSubRequests() {
+    if (_fullInputs.empty()) {
+        // the user works with the compiled-batch blobs of the reference sub-request directly
+        return 1;
+    }
+    if (_fullInputs.size() != _networkInputs.size())
+        IE_THROW() << "Batch splitting requires all input blobs to be set with the same batch multiple";
+
+    // the batch multiple must agree between all inputs
+    size_t splitCount = 0;
+    for (const auto& input : _fullInputs) {
+        const auto refBatch = _subRequests.front()->GetBlob(input.first)->getTensorDesc().getDims()[0];
+        const auto count = input.second->getTensorDesc().getDims()[0] / refBatch;
+        if (splitCount == 0)
+            splitCount = count;
+        else if (splitCount != count)
+            IE_THROW() << "Batch splitting requires all input blobs to be set with the same batch multiple";
+    }
+
+    ensureSubRequests(splitCount);
+
+    // the outputs the user did not provide are allocated for the full batch here
+    for (const auto& output : _networkOutputs) {
+        const auto refDesc = _subRequests.front()->GetBlob(output.first)->getTensorDesc();
+        auto found = _fullOutputs.find(output.first);
+        if (found != _fullOutputs.end()) {
+            const auto batch = found->second->getTensorDesc().getDims()[0];
+            if (batch != refDesc.getDims()[0] * splitCount)
+                IE_THROW() << "Output blob '" << output.first << "' batch " << batch
+                           << " doesn't match the input batch multiple " << splitCount;
+            continue;
+        }
+        auto fullDims = refDesc.getDims();
+        fullDims[0] *= splitCount;
+        auto blob = make_blob_with_precision(
+            InferenceEngine::TensorDesc(refDesc.getPrecision(), fullDims, refDesc.getLayout()));
+        blob->allocate();
+        _fullOutputs[output.first] = blob;
+    }
+
+    // bind the zero-copy per-slice views; the batch is outermost and the blobs are dense, so
+    // every slice is a contiguous chunk of byteSize / splitCount bytes
+    auto bind = [&](const InferenceEngine::BlobMap& fullBlobs) {
+        for (const auto& item : fullBlobs) {
+            const auto& full = item.second;
+            const auto& desc = full->getTensorDesc();
+            auto subDims = desc.getDims();
+            subDims[0] /= splitCount;
+            const InferenceEngine::TensorDesc subDesc(desc.getPrecision(), subDims, desc.getLayout());
+            const size_t stride = full->byteSize() / splitCount;
+            auto* base = full->buffer().as<uint8_t*>();
+            for (size_t i = 0; i < splitCount; i++) {
+                _subRequests[i]->SetBlob(item.first, make_blob_with_precision(subDesc, base + i * stride));
+            }
+        }
+    };
+    bind(_fullInputs);
+    bind(_fullOutputs);
+
+    return splitCount;
+}
+
+void BatchSplitInferRequest::startSubRequests(size_t count, bool invokeCallbackOnCompletion) {
+    {
+        std::lock_guard<std::mutex> lock(_completionMutex);
+        if (_pendingSubRequests)
+            IE_THROW(RequestBusy) << "Batch splitting request is already started";
+        _pendingSubRequests = count;
+        _startedSubRequests = count;
+        _invokeCallbackOnCompletion = invokeCallbackOnCompletion;
+        _subRequestException = nullptr;
+    }
+    for (size_t i = 0; i < count; i++)
+        _subRequests[i]->StartAsync();
+}
+
+void BatchSplitInferRequest::onSubRequestDone(const std::exception_ptr& exception) {
+    Callback callbackToInvoke;
+    std::exception_ptr exceptionToReport;
+    {
+        std::lock_guard<std::mutex> lock(_completionMutex);
+        if (exception && !_subRequestException)
+            _subRequestException = exception;
+        if (--_pendingSubRequests != 0)
+            return;
+        if (_invokeCallbackOnCompletion && _callback) {
+            callbackToInvoke = _callback;
+            exceptionToReport = _subRequestException;
+        }
+    }
+    if (callbackToInvoke)
+        callbackToInvoke(exceptionToReport);
+}
+
+void BatchSplitInferRequest::Infer() {
+    const auto splitCount = prepareSubRequests();
+    startSubRequests(splitCount, false);
+    Wait(InferenceEngine::InferRequest::RESULT_READY);
+}
+
+void BatchSplitInferRequest::StartAsync() {
+    const auto splitCount = prepareSubRequests();
+    startSubRequests(splitCount, true);
+}
+
+InferenceEngine::StatusCode BatchSplitInferRequest::Wait(int64_t millis_timeout) {
+    size_t started;
+    {
+        std::lock_guard<std::mutex> lock(_completionMutex);
+        started = _startedSubRequests;
+    }
+    // Note: a finite timeout is applied to every sub-request in turn, so the overall wait may
+    // exceed it; RESULT_READY and STATUS_ONLY keep their exact semantics
+    InferenceEngine::StatusCode status = InferenceEngine::StatusCode::OK;
+    for (size_t i = 0; i < started; i++) {
+        const auto rc = _subRequests[i]->Wait(millis_timeout);
+        if (rc != InferenceEngine::StatusCode::OK && status == InferenceEngine::StatusCode::OK)
+            status = rc;
+    }
+    return status;
+}
+
+void BatchSplitInferRequest::Cancel() {
+    for (auto& request : _subRequests)
+        request->Cancel();
+}
+
+std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> BatchSplitInferRequest::GetPerformanceCounts() const {
+    // the slices run the same graph, so the counters of the reference sub-request are representative
+    return _subRequests.front()->GetPerformanceCounts();
+}
+
+std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> BatchSplitInferRequest::QueryState() {
+    // batch splitting is only engaged for stateless networks
+    return {};
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
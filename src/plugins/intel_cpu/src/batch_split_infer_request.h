@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+class ExecNetwork;
+
+/**
+ * @brief Splits a batch-N infer request into per-stream sub-requests over the compiled batch
+ * (see CPU_CONFIG_KEY(BATCH_SPLITTING)).
+ *
+ * The network stays compiled with its original batch; the request accepts blobs whose batch is
+ * any multiple of it, slices them along the batch dimension into zero-copy views and runs one
+ * ordinary per-stream sub-request per slice, so the slices execute concurrently on the
+ * configured streams. The output views write straight into the full-batch output blobs, so no
+ * reassembly copy is needed. When no full-batch blobs are set the request degrades to a single
+ * sub-request and behaves like a regular one.
+ */
+class BatchSplitInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    explicit BatchSplitInferRequest(const std::shared_ptr<ExecNetwork>& execNetwork);
+    ~BatchSplitInferRequest() override;
+
+    void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data) override;
+    InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
+
+    void Infer() override;
+    void StartAsync() override;
+    InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
+    void Cancel() override;
+
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
+
+private:
+    bool isInputName(const std::string& name) const;
+    // Validates the full-batch blobs, allocates the missing outputs, binds the per-slice views
+    // and returns the number of sub-requests to run
+    size_t prepareSubRequests();
+    void ensureSubRequests(size_t count);
+    void startSubRequests(size_t count, bool invokeCallbackOnCompletion);
+    void onSubRequestDone(const std::exception_ptr& exception);
+
+    std::shared_ptr<ExecNetwork> _execNetwork;
+
+    // full-batch blobs as the user provided them (outputs may be allocated on demand)
+    InferenceEngine::BlobMap _fullInputs;
+    InferenceEngine::BlobMap _fullOutputs;
+
+    std::mutex _completionMutex;
+    size_t _pendingSubRequests = 0;
+    size_t _startedSubRequests = 0;
+    bool _invokeCallbackOnCompletion = false;
+    std::exception_ptr _subRequestException;
+
+    // declared last so that the sub-requests (whose callbacks point back here) are destroyed
+    // before the completion state above
+    std::vector<InferenceEngine::IInferRequestInternal::Ptr> _subRequests;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
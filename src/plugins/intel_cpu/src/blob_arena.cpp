@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "blob_arena.h"
+
+#include <common/utils.hpp>
+
+#include "onednn/dnnl.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr size_t cacheLineSize = 64;
+constexpr size_t minChunkSize = 4096;
+
+size_t roundUpToPowerOfTwo(size_t size) {
+    size_t capacity = minChunkSize;
+    while (capacity < size)
+        capacity <<= 1;
+    return capacity;
+}
+}  // namespace
+
+void* BlobArena::sysAlloc(size_t size) noexcept {
+    return dnnl::impl::malloc(size, cacheLineSize);
+}
+
+void BlobArena::sysFree(void* ptr) noexcept {
+    dnnl::impl::free(ptr);
+}
+
+void* BlobArena::alloc(size_t size) noexcept {
+    if (size == 0)
+        size = 1;
+    const size_t capacity = roundUpToPowerOfTwo(size);
+
+    std::lock_guard<std::mutex> guard(_mutex);
+    auto it = _freeChunks.lower_bound(capacity);
+    if (it != _freeChunks.end()) {
+        void* ptr = it->second;
+        _takenChunks[ptr] = it->first;
+        _freeChunks.erase(it);
+        return ptr;
+    }
+
+    void* ptr = sysAlloc(capacity);
+    if (ptr == nullptr)
+        return nullptr;
+    _takenChunks[ptr] = capacity;
+    return ptr;
+}
+
+bool BlobArena::free(void* handle) noexcept {
+    std::lock_guard<std::mutex> guard(_mutex);
+    auto it = _takenChunks.find(handle);
+    if (it == _takenChunks.end())
+        return false;
+    try {
+        _freeChunks.emplace(it->second, handle);
+    } catch (...) {
+        // no way to keep the chunk, give it back to the system
+        sysFree(handle);
+    }
+    _takenChunks.erase(it);
+    return true;
+}
+
+BlobArena::~BlobArena() {
+    for (const auto& chunk : _freeChunks)
+        sysFree(chunk.second);
+    for (const auto& chunk : _takenChunks)
+        sysFree(chunk.first);
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
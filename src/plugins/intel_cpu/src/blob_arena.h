@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief An IAllocator implementation that recycles buffers across allocations.
+ *
+ * Freed buffers are kept in a size-indexed free list instead of being returned to the system, so
+ * infer requests which repeatedly allocate I/O blobs for changing shapes reuse upper-bound-sized
+ * chunks instead of hitting malloc on every shape change. The arena lives in the GraphContext and
+ * is shared by all requests of a compiled model; all memory is released when the model is unloaded.
+ */
+class BlobArena : public InferenceEngine::IAllocator {
+public:
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    ~BlobArena() override;
+
+private:
+    static void* sysAlloc(size_t size) noexcept;
+    static void sysFree(void* ptr) noexcept;
+
+    std::mutex _mutex;
+    // free chunks: capacity -> pointer (multimap allows several chunks of equal capacity)
+    std::multimap<size_t, void*> _freeChunks;
+    // chunks handed out to blobs: pointer -> capacity
+    std::unordered_map<void*, size_t> _takenChunks;
+};
+
+using BlobArenaPtr = std::shared_ptr<BlobArena>;
+
+}  // namespace intel_cpu
+}  // namespace ov
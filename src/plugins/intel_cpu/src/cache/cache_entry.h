@@ -18,6 +18,8 @@ public:
         Miss
     };
 public:
+    virtual size_t getSize() const = 0;
+    virtual size_t getEvictionCount() const = 0;
     virtual ~CacheEntryBase() = default;
 };
 
@@ -66,6 +68,14 @@ public:
         return {retVal, retStatus};
     }
 
+    size_t getSize() const override {
+        return _impl.getSize();
+    }
+
+    size_t getEvictionCount() const override {
+        return _impl.getEvictionCount();
+    }
+
 public:
     ImplType _impl;
 };
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Process-wide thread-safe cache for generated JIT kernels.
+ *
+ * Unlike the per-stream MultiCache owned by a GraphContext, this cache is shared by all streams
+ * and all compiled models in the process, so a kernel generated for some emitter parameters + ISA
+ * is emitted exactly once and then reused. Only immutable, stateless objects (compiled code
+ * buffers) may be stored here since they are accessed concurrently without further locking.
+ *
+ * The lookup path is lock free: hits are served from an immutable snapshot map published through
+ * an atomic shared_ptr (RCU style), so streams hammering the same kernel key never serialize.
+ * Only a miss takes the write mutex, builds the kernel and publishes a new snapshot with the
+ * added record. Kernels are built once and live for the process lifetime, so the copy-on-write
+ * insertion cost is paid only on the first occurrence of a key.
+ */
+class KernelCache {
+public:
+    static KernelCache& get() {
+        static KernelCache cache;
+        return cache;
+    }
+
+    template <typename KeyType, typename BuilderType>
+    typename std::result_of<BuilderType&(const KeyType&)>::type getOrCreate(const KeyType& key,
+                                                                            BuilderType builder) {
+        using ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type;
+        auto& storage = getStorage<KeyType, ValueType>();
+        using MapType = typename Storage<KeyType, ValueType>::MapType;
+
+        auto snapshot = std::atomic_load_explicit(&storage.map, std::memory_order_acquire);
+        auto hit = snapshot->find(key);
+        if (hit != snapshot->end()) {
+            return hit->second;
+        }
+
+        std::lock_guard<std::mutex> guard(storage.writeMutex);
+        // another thread may have published the kernel while we were acquiring the lock
+        snapshot = std::atomic_load_explicit(&storage.map, std::memory_order_acquire);
+        hit = snapshot->find(key);
+        if (hit != snapshot->end()) {
+            return hit->second;
+        }
+
+        auto value = builder(key);
+        if (snapshot->size() < capacity) {
+            auto updated = std::make_shared<MapType>(*snapshot);
+            updated->emplace(key, value);
+            std::atomic_store_explicit(&storage.map,
+                                       std::shared_ptr<const MapType>(std::move(updated)),
+                                       std::memory_order_release);
+        }
+        return value;
+    }
+
+    KernelCache(const KernelCache&) = delete;
+    KernelCache& operator=(const KernelCache&) = delete;
+
+private:
+    KernelCache() = default;
+
+    // maximum number of records per kernel type; since published snapshots are immutable there is
+    // no LRU bookkeeping - once the limit is reached new kernels are built but no longer cached
+    static constexpr size_t capacity = 20000;
+
+    template <typename KeyType, typename ValueType>
+    struct Storage {
+        struct KeyHasher {
+            std::size_t operator()(const KeyType& k) const {
+                return k.hash();
+            }
+        };
+        using MapType = std::unordered_map<KeyType, ValueType, KeyHasher>;
+
+        std::shared_ptr<const MapType> map = std::make_shared<MapType>();
+        std::mutex writeMutex;
+    };
+
+    template <typename KeyType, typename ValueType>
+    Storage<KeyType, ValueType>& getStorage() {
+        static Storage<KeyType, ValueType> storage;
+        return storage;
+    }
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
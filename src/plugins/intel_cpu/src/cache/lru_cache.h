@@ -74,6 +74,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            ++_evictionCount;
         }
     }
 
@@ -85,6 +86,20 @@ public:
          return _capacity;
      }
 
+    /**
+     * @brief Returns the number of currently stored records
+     */
+     size_t getSize() const noexcept {
+         return _cacheMapper.size();
+     }
+
+    /**
+     * @brief Returns the number of records evicted over the cache lifetime
+     */
+     size_t getEvictionCount() const noexcept {
+         return _evictionCount;
+     }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key &k) const {
@@ -102,6 +117,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    size_t _evictionCount = 0;
 };
 
 }   // namespace intel_cpu
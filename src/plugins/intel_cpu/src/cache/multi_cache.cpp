@@ -9,5 +9,16 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::Statistics MultiCache::getStatistics() const {
+    Statistics stats;
+    for (const auto& item : _storage) {
+        stats.records += item.second->getSize();
+        stats.evictions += item.second->getEvictionCount();
+    }
+    stats.hits = _hits;
+    stats.misses = _misses;
+    return stats;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
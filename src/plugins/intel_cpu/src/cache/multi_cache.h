@@ -46,9 +46,25 @@ public:
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
         auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        auto result = entry->getOrCreate(key, std::move(builder));
+        ++((result.second == CacheEntryBase::LookUpStatus::Hit) ? _hits : _misses);
+        return result;
     }
 
+    /**
+     * @brief Growth statistics aggregated over all the cache entries.
+     * @note As the rest of the interface, getStatistics() must be serialized with getOrCreate()
+     *       calls (e.g. by the graph lock of the stream owning the cache).
+     */
+    struct Statistics {
+        size_t records = 0;     //!< number of currently stored records
+        size_t evictions = 0;   //!< number of records evicted by the LRU policy
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    Statistics getStatistics() const;
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -59,6 +75,8 @@ private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    uint64_t _hits = 0;
+    uint64_t _misses = 0;
 };
 
 template<typename T>
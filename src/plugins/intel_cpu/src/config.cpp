@@ -3,6 +3,7 @@
 //
 
 #include "config.h"
+#include "cpu_memory.h"
 
 #include <string>
 #include <map>
@@ -18,6 +19,7 @@
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "utils/debug_capabilities.h"
+#include "utils/execution_trace.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 
 namespace ov {
@@ -155,15 +157,25 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
                     enforceBF16 = true;
                     manualEnforceBF16 = true;
+                    enforceFP16 = false;
                 } else {
                     IE_THROW() << "Platform doesn't support BF16 format";
                 }
+            } else if (val == "f16") {
+                if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_fp16)) {
+                    enforceFP16 = true;
+                    enforceBF16 = false;
+                    manualEnforceBF16 = false;
+                } else {
+                    IE_THROW() << "Platform doesn't support FP16 format";
+                }
             } else if (val == "f32") {
                 enforceBF16 = false;
                 manualEnforceBF16 = false;
+                enforceFP16 = false;
             } else {
                 IE_THROW() << "Wrong value for property key " << ov::hint::inference_precision.name()
-                    << ". Supported values: bf16, f32";
+                    << ". Supported values: bf16, f16, f32";
             }
         } else if (key == PluginConfigParams::KEY_CACHE_DIR) {
             cache_dir = val;
@@ -178,6 +190,50 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (CPUConfigParams::KEY_CPU_RUNTIME_CACHE_BUDGET == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_RUNTIME_CACHE_BUDGET
+                           << ". Expected only integer numbers";
+            }
+            // one knob for all the per-shape runtime caches: the parameter cache of every graph
+            // copy and the oneDNN primitive cache; the latter is process-wide by its nature
+            rtCacheCapacity = static_cast<size_t>(std::max(val_i, 0));
+            dnnl::set_primitive_cache_capacity(std::max(val_i, 0));
+        } else if (CPUConfigParams::KEY_CPU_STREAM_CORE_IDS == key) {
+            // the streams executor owns the placement logic, so the parsing and the validation
+            // of the core sets live there as well
+            streamExecutorConfig.SetConfig(PluginConfigInternalParams::KEY_STREAM_CORE_IDS, val);
+        } else if (PluginConfigParams::KEY_DEVICE_ID == key) {
+            // CPU.<N> sub-devices: N addresses a NUMA domain and the model is confined to its
+            // processors through an explicit stream core set, so the stream threads and every
+            // first-touch allocation they make (scratch, intermediate tensors) land on that
+            // domain; plain "CPU" (an empty id) keeps the whole machine
+            if (!val.empty()) {
+                int node = -1;
+                try {
+                    node = std::stoi(val);
+                } catch (const std::exception&) {
+                    IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_DEVICE_ID
+                    << ". Expected a NUMA domain number, got " << val;
+                }
+                const auto numaNodes = getAvailableNUMANodes();
+                if (std::find(numaNodes.begin(), numaNodes.end(), node) == numaNodes.end())
+                    IE_THROW() << "CPU." << val << " is not available, the machine reports "
+                               << numaNodes.size() << " NUMA domain(s)";
+                const auto processors = getNumaNodeProcessors(node);
+                if (processors.empty())
+                    IE_THROW() << "CPU sub-devices are not supported on this platform";
+                std::string coreIds;
+                for (const auto processor : processors) {
+                    if (!coreIds.empty())
+                        coreIds += ',';
+                    coreIds += std::to_string(processor);
+                }
+                streamExecutorConfig.SetConfig(PluginConfigInternalParams::KEY_STREAM_CORE_IDS, coreIds);
+            }
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -188,6 +244,188 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION
                 << ". Expected only YES/NO";
             }
+        } else if (CPUConfigParams::KEY_CPU_INTRA_GRAPH_PARALLELISM == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_INTRA_GRAPH_PARALLELISM
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_INTRA_GRAPH_PARALLELISM
+                           << ". Expected a non-negative number";
+            intraGraphParallelism = val_i;
+        } else if (CPUConfigParams::KEY_CPU_WEIGHTS_NUMA_REPLICATION == key) {
+            if (val == PluginConfigParams::YES) {
+                weightsNumaReplication = true;
+            } else if (val == PluginConfigParams::NO) {
+                weightsNumaReplication = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WEIGHTS_NUMA_REPLICATION
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_RELEASE_SOURCE_WEIGHTS == key) {
+            if (val == PluginConfigParams::YES) {
+                releaseSourceWeights = true;
+            } else if (val == PluginConfigParams::NO) {
+                releaseSourceWeights = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_RELEASE_SOURCE_WEIGHTS
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_PMU_PERF_COUNT == key) {
+            if (val == PluginConfigParams::YES) {
+                collectPmuCounters = true;
+            } else if (val == PluginConfigParams::NO) {
+                collectPmuCounters = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PMU_PERF_COUNT
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_EXECUTION_TRACE == key) {
+            executionTracePath = val;
+            // the collector is process wide so the timelines of all streams and networks
+            // end up merged in one file; the first network to enable it fixes the path
+            if (!executionTracePath.empty())
+                ExecutionTrace::get().enable(executionTracePath);
+        } else if (CPUConfigParams::KEY_CPU_STREAMS_POOL_SHARING == key) {
+            if (val == PluginConfigParams::YES) {
+                streamsPoolSharing = true;
+            } else if (val == PluginConfigParams::NO) {
+                streamsPoolSharing = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_STREAMS_POOL_SHARING
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_HUGE_PAGES == key) {
+            if (val == PluginConfigParams::YES) {
+                useHugePages = true;
+                EnableHugePages();
+            } else if (val == PluginConfigParams::NO) {
+                useHugePages = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_HUGE_PAGES
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_ADAPTIVE_IMPL_SELECTION == key) {
+            if (val == PluginConfigParams::YES) {
+                adaptiveImplSelection = true;
+            } else if (val == PluginConfigParams::NO) {
+                adaptiveImplSelection = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_ADAPTIVE_IMPL_SELECTION
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_DELTA_INFERENCE == key) {
+            if (val == PluginConfigParams::YES) {
+                deltaInference = true;
+            } else if (val == PluginConfigParams::NO) {
+                deltaInference = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DELTA_INFERENCE
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_BATCH_SPLITTING == key) {
+            if (val == PluginConfigParams::YES) {
+                batchSplitting = true;
+            } else if (val == PluginConfigParams::NO) {
+                batchSplitting = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_BATCH_SPLITTING
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_TIERED_COMPILATION == key) {
+            if (val == PluginConfigParams::YES) {
+                tieredCompilation = true;
+            } else if (val == PluginConfigParams::NO) {
+                tieredCompilation = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_TIERED_COMPILATION
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_CROSS_MODEL_SHARING == key) {
+            if (val == PluginConfigParams::YES) {
+                crossModelSharing = true;
+            } else if (val == PluginConfigParams::NO) {
+                crossModelSharing = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_CROSS_MODEL_SHARING
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_WEIGHTS_SHM_SHARING == key) {
+            if (val == PluginConfigParams::YES) {
+                weightsShmSharing = true;
+            } else if (val == PluginConfigParams::NO) {
+                weightsShmSharing = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WEIGHTS_SHM_SHARING
+                << ". Expected only YES/NO";
+            }
+        } else if (CPUConfigParams::KEY_CPU_MEMORY_BUDGET == key) {
+            long long val_l = -1;
+            try {
+                val_l = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_MEMORY_BUDGET
+                << ". Expected only integer numbers";
+            }
+            if (val_l < 0) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_MEMORY_BUDGET
+                << ". The budget must not be negative";
+            }
+            memoryBudget = static_cast<size_t>(val_l);
+        } else if (CPUConfigParams::KEY_CPU_WEIGHTS_STREAMING_BUDGET == key) {
+            long long val_l = -1;
+            try {
+                val_l = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WEIGHTS_STREAMING_BUDGET
+                << ". Expected only integer numbers";
+            }
+            if (val_l < 0) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WEIGHTS_STREAMING_BUDGET
+                << ". The budget must not be negative";
+            }
+            weightsStreamingBudget = static_cast<size_t>(val_l);
+        } else if (CPUConfigParams::KEY_CPU_EXEC_GRAPH_DUMP == key) {
+            if (!val.empty() && val != "cout" &&
+                (val.size() < 4 || val.compare(val.size() - 4, 4, ".xml") != 0)) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_EXEC_GRAPH_DUMP
+                << ". Expected either 'cout' or a '*.xml' file path";
+            }
+            execGraphDumpPath = val;
+        } else if (CPUConfigParams::KEY_CPU_COMPILATION_CHECKPOINTING == key) {
+            if (val == PluginConfigParams::YES) {
+                compilationCheckpointing = true;
+            } else if (val == PluginConfigParams::NO) {
+                compilationCheckpointing = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_COMPILATION_CHECKPOINTING
+                << ". Expected only YES/NO";
+            }
+        } else if (key == ov::hint::scheduling_core_type.name()) {
+            if (val == "ANY_CORE") {
+                schedulingCoreType = ov::hint::SchedulingCoreType::ANY_CORE;
+            } else if (val == "PCORE_ONLY") {
+                schedulingCoreType = ov::hint::SchedulingCoreType::PCORE_ONLY;
+            } else if (val == "ECORE_ONLY") {
+                schedulingCoreType = ov::hint::SchedulingCoreType::ECORE_ONLY;
+            } else {
+                IE_THROW() << "Wrong value for property key " << ov::hint::scheduling_core_type.name()
+                << ". Expected only ANY_CORE/PCORE_ONLY/ECORE_ONLY";
+            }
+        } else if (key == ov::hint::model_priority.name()) {
+            if (val == "LOW") {
+                modelPriority = ov::hint::Priority::LOW;
+            } else if (val == "MEDIUM") {
+                modelPriority = ov::hint::Priority::MEDIUM;
+            } else if (val == "HIGH") {
+                modelPriority = ov::hint::Priority::HIGH;
+            } else {
+                IE_THROW() << "Wrong value for property key " << ov::hint::model_priority.name()
+                << ". Expected only LOW/MEDIUM/HIGH";
+            }
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -8,6 +8,7 @@
 #include <ie_performance_hints.hpp>
 #include <ie/ie_common.h>
 #include <openvino/util/common_util.hpp>
+#include <openvino/runtime/properties.hpp>
 #include "utils/debug_caps_config.h"
 
 #include <bitset>
@@ -51,10 +52,84 @@ struct Config {
     bool manualEnforceBF16 = false;
 #endif
 
+    // Enforce FP16 inference precision (requires avx512_core_fp16); set via ov::hint::inference_precision
+    bool enforceFP16 = false;
+
+    // Re-select node implementations by measuring alternatives during the first infer requests
+    bool adaptiveImplSelection = false;
+
     std::string cache_dir{};
 
     DenormalsOptMode denormalsOptMode = DenormalsOptMode::DO_Keep;
 
+    // Keep one replica of constant weights per NUMA node so every stream works with local memory
+    bool weightsNumaReplication = false;
+
+    // Max number of nodes executed concurrently within one stream; 0 means sequential execution
+    int intraGraphParallelism = 0;
+
+    // Drop the source model after compilation to release repacked constants; disables export
+    bool releaseSourceWeights = false;
+
+    // Sample PMU hardware counters around every node execution (effective with collectPerfCounters)
+    bool collectPmuCounters = false;
+
+    // Path of the Chrome trace file the per-node execution timeline is dumped to; empty disables tracing
+    std::string executionTracePath = "";
+
+    // Submit infer requests to the process-wide shared pool of CPU streams instead of an own pool
+    bool streamsPoolSharing = false;
+
+    // Weights the share of the shared streams pool the network may occupy (effective with streamsPoolSharing)
+    ov::hint::Priority modelPriority = ov::hint::Priority::MEDIUM;
+
+    // Advise huge page backing for large allocations (applies to the whole process once enabled)
+    bool useHugePages = false;
+
+    // Restricts the core types the stream threads may run on; ANY_CORE keeps the automatic
+    // hybrid-aware selection driven by the performance hint
+    ov::hint::SchedulingCoreType schedulingCoreType = ov::hint::SchedulingCoreType::ANY_CORE;
+
+    // Store resumable snapshots of the intermediate model in cache_dir after the expensive
+    // transformation pipeline stages (effective only when cache_dir is set)
+    bool compilationCheckpointing = false;
+
+    // Memory budget of the compiled model in bytes; past it streams stop materializing own graph
+    // copies and the requests queue on the existing ones. Zero means no limit
+    size_t memoryBudget = 0;
+
+    // Skip inference of a frame whose inputs are byte-identical to the previous call of the same
+    // infer request and replay the cached outputs instead (video feeds with static scenes)
+    bool deltaInference = false;
+
+    // Publish/adopt packed constant buffers through named shared memory segments, so identical
+    // worker processes on one host map a single physical copy of the weights
+    bool weightsShmSharing = false;
+
+    // Split batch-N infer requests into per-stream sub-requests over the compiled batch
+    // (the inverse of automatic batching), see BatchSplitInferRequest
+    bool batchSplitting = false;
+
+    // Resident working-set budget in bytes for streaming mmap-backed weights through memory,
+    // see WeightsPrefetcher; 0 (the default) keeps all the weights resident
+    size_t weightsStreamingBudget = 0;
+
+    // Path of the IR file ('cout' for the short stdout summary) the annotated execution graph is
+    // dumped to; available in release builds, empty disables the dump
+    std::string execGraphDumpPath = "";
+
+    // Serve the first requests from a quickly built fusion-free graph while the optimized
+    // per-stream graphs compile in the background, see ExecNetwork
+    bool tieredCompilation = false;
+
+    // Hand out the already compiled executable network when an identical model is compiled with
+    // identical options again, see Engine::LoadExeNetworkImpl
+    bool crossModelSharing = false;
+
+    // Not a user property: set on the config copy the tier-0 bring-up graph is compiled with,
+    // makes Graph::InitGraph skip the optimizer passes
+    bool tier0FastCompile = false;
+
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
 
@@ -2,10 +2,16 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <vector>
 #include <numeric>
 #include <unordered_set>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <dnnl_types.h>
 #include <common/memory_desc_wrapper.hpp>
 #include "cpu_memory.h"
@@ -31,8 +37,33 @@ namespace {
             }
         }
     }
+
+    std::atomic<bool> hugePagesEnabled{false};
+
+    // huge pages only pay off when an allocation spans at least one of them
+    constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+    // Advises the kernel to back the given region with transparent huge pages. madvise()
+    // operates on whole pages, so the region boundaries are aligned inwards; when the
+    // advice is unsupported or rejected the kernel just keeps regular pages.
+    inline void adviseHugePages(void* ptr, size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        const uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) & ~(pageSize - 1);
+        const uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(pageSize - 1);
+        if (end > begin)
+            madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+#else
+        (void)ptr;
+        (void)size;
+#endif
+    }
 }   // namespace
 
+void EnableHugePages() {
+    hugePagesEnabled.store(true, std::memory_order_relaxed);
+}
+
 Memory::Memory(const dnnl::engine& eng) :
     eng(eng), mgrHandle(std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse())), this) {}
 Memory::Memory(const dnnl::engine& eng, std::unique_ptr<IMemoryMngr> mngr) :
@@ -110,7 +141,10 @@ void Memory::SetData(const Memory& src, bool ftz) const {
 
 void Memory::FillZero() {
     void* dataPtr = GetData();
-    if (dataPtr != nullptr)
+    if (dataPtr == nullptr)
+        return;
+    // a manager with page granular backing drops the pages instead of touching every byte
+    if (!mgrHandle->resetToZero())
         memset(dataPtr, 0, getDesc().getMaxMemSize());
 }
 
@@ -183,10 +217,17 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
+        // a buffer that has to grow belongs to a tensor without a defined upper bound (bounded
+        // tensors are sized to the bound right away), so overprovision to amortize the number of
+        // reallocations while the shapes keep varying
+        if (_memUpperBound > 0 && !_useExternalStorage)
+            size = std::max(size, _memUpperBound + _memUpperBound / 2);
         void *ptr = dnnl::impl::malloc(size, cacheLineSize);
         if (!ptr) {
             IE_THROW() << "Failed to allocate " << size << " bytes of memory";
         }
+        if (size >= hugePageSize && hugePagesEnabled.load(std::memory_order_relaxed))
+            adviseHugePages(ptr, size);
         _memUpperBound = size;
         _useExternalStorage = false;
         _data = decltype(_data)(ptr, destroy);
@@ -205,6 +246,84 @@ void MemoryMngrWithReuse::destroy(void *ptr) {
     dnnl::impl::free(ptr);
 }
 
+MemoryMngrDemandPaged::~MemoryMngrDemandPaged() {
+    destroy();
+}
+
+void* MemoryMngrDemandPaged::getRawPtr() const noexcept {
+    return _data;
+}
+
+void MemoryMngrDemandPaged::setExtBuff(void *ptr, size_t size) {
+    destroy();
+    _useExternalStorage = true;
+    _memUpperBound = size;
+    _data = ptr;
+}
+
+bool MemoryMngrDemandPaged::resize(size_t size) {
+    bool sizeChanged = false;
+    if (size > _memUpperBound) {
+        void* ptr = nullptr;
+        bool mapped = false;
+#if defined(__linux__)
+        // an anonymous private mapping starts as untouched zero pages, so only the part of the
+        // buffer which actually gets written becomes resident
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            ptr = nullptr;
+        mapped = ptr != nullptr;
+#endif
+        if (!ptr) {
+            constexpr int cacheLineSize = 64;
+            ptr = dnnl::impl::malloc(size, cacheLineSize);
+            if (!ptr) {
+                IE_THROW() << "Failed to allocate " << size << " bytes of memory";
+            }
+        }
+        if (_data && !_useExternalStorage)
+            cpu_memcpy(ptr, _data, _memUpperBound);
+        destroy();
+        _memUpperBound = size;
+        _useExternalStorage = false;
+        _mapped = mapped;
+        _data = ptr;
+        sizeChanged = true;
+    }
+    return sizeChanged;
+}
+
+bool MemoryMngrDemandPaged::hasExtBuffer() const noexcept {
+    return _useExternalStorage;
+}
+
+bool MemoryMngrDemandPaged::resetToZero() noexcept {
+#if defined(__linux__) && defined(MADV_DONTNEED)
+    // dropping the pages both zeroes the content and returns the physical memory to the OS,
+    // so a reset session stops paying for the state it has touched so far
+    if (_mapped && _data)
+        return madvise(_data, _memUpperBound, MADV_DONTNEED) == 0;
+#endif
+    return false;
+}
+
+void MemoryMngrDemandPaged::destroy() {
+    if (!_data || _useExternalStorage) {
+        _data = nullptr;
+        return;
+    }
+#if defined(__linux__)
+    if (_mapped) {
+        munmap(_data, _memUpperBound);
+        _data = nullptr;
+        _mapped = false;
+        return;
+    }
+#endif
+    dnnl::impl::free(_data);
+    _data = nullptr;
+}
+
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
     return _pMemMngr->getRawPtr();
 }
@@ -226,6 +345,10 @@ bool DnnlMemoryMngr::hasExtBuffer() const noexcept {
     return _pMemMngr->hasExtBuffer();
 }
 
+bool DnnlMemoryMngr::resetToZero() noexcept {
+    return _pMemMngr->resetToZero();
+}
+
 void DnnlMemoryMngr::registerMemory(Memory* memPtr) {
     if (memPtr) {
         _setMemPtrs.insert(memPtr);
@@ -67,8 +67,25 @@ public:
      * @return status whether the object has control over underlying memory buffer
      */
     virtual bool hasExtBuffer() const noexcept = 0;
+
+    /**
+     * @brief Returns the buffer content to all zeroes, when the manager can do it cheaper than a plain memset
+     * @return false when the caller has to zero the buffer itself
+     */
+    virtual bool resetToZero() noexcept {
+        return false;
+    }
 };
 
+/**
+ * @brief Requests transparent huge page backing for subsequent large plugin allocations.
+ *
+ * The switch is process-wide and one-way: once enabled, every allocation big enough to span
+ * huge pages is advised to the kernel accordingly. On platforms without such advice the call
+ * has no effect.
+ */
+void EnableHugePages();
+
 /**
  * @brief An implementation of the mem manager where memory reallocation occures only if bigger buffer is requested.
  */
@@ -89,6 +106,33 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief A mem manager with page granular, demand committed backing.
+ *
+ * The buffer is a mapping of the full requested size, but physical pages are only committed
+ * when they are actually touched and resetToZero() returns them to the OS again. It is meant
+ * for upper-bound sized buffers which are typically used only partially, like the storages of
+ * variable states. Where such mappings are not available it degrades to a regular allocation.
+ */
+class MemoryMngrDemandPaged : public IMemoryMngr {
+public:
+    MemoryMngrDemandPaged() = default;
+    ~MemoryMngrDemandPaged() override;
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+    bool resetToZero() noexcept override;
+
+private:
+    void destroy();
+
+    bool _useExternalStorage = false;
+    bool _mapped = false;
+    size_t _memUpperBound = 0ul;
+    void* _data = nullptr;
+};
+
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
@@ -99,6 +143,7 @@ public:
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
     bool hasExtBuffer() const noexcept override;
+    bool resetToZero() noexcept override;
     void registerMemory(Memory* memPtr);
     void unregisterMemory(Memory* memPtr);
 
@@ -205,6 +205,8 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "PriorBoxClustered", Type::PriorBoxClustered},
         {"Interaction", Type::Interaction},
         { "MHA", Type::MHA},
+        { "SoftmaxTopK", Type::SoftmaxTopK},
+        { "LogSoftmaxGather", Type::LogSoftmaxGather},
         { "Unique", Type::Unique}
 };
 
@@ -311,6 +313,10 @@ std::string NameFromType(const Type type) {
             return "ScatterNDUpdate";
         case Type::Interaction:
             return "Interaction";
+        case Type::SoftmaxTopK:
+            return "SoftmaxTopK";
+        case Type::LogSoftmaxGather:
+            return "LogSoftmaxGather";
         case Type::Interpolate:
             return "Interpolate";
         case Type::Reduce:
@@ -111,6 +111,8 @@ enum class Type {
     PriorBoxClustered,
     Interaction,
     MHA,
+    SoftmaxTopK,
+    LogSoftmaxGather,
     Unique
 };
 
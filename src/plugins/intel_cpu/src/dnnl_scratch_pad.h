@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 
 #include "common/memory.hpp"
 #include "cpu_memory.h"
@@ -16,6 +18,11 @@ namespace intel_cpu {
 class DnnlScratchPad {
     DnnlMemoryMngrPtr mgrPtr;
     dnnl::engine eng;
+    // The underlying buffer is shared by all the nodes of a graph, so when primitive preparation
+    // runs concurrently with execution (see Graph::InferDynamic) a growth triggered here must not
+    // move the buffer from under a running primitive. Execution takes the same mutex per node.
+    std::mutex guard;
+    size_t maxRequestedSize = 0;
 
 public:
     DnnlScratchPad(dnnl::engine eng) : eng(eng) {
@@ -23,10 +30,22 @@ public:
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
+        std::lock_guard<std::mutex> lock(guard);
         auto mem = std::make_shared<Memory>(eng);
         mem->Create(md, mgrPtr);
+        maxRequestedSize = std::max(maxRequestedSize, md->getCurrentMemSize());
         return mem;
     }
+
+    // Upper bound of the underlying buffer size: the manager grows to the largest requested
+    // descriptor and never shrinks
+    size_t allocatedSize() const {
+        return maxRequestedSize;
+    }
+
+    std::mutex& executionGuard() {
+        return guard;
+    }
 };
 
 using DnnlScratchPadPtr = std::shared_ptr<DnnlScratchPad>;
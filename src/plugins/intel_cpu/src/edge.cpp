@@ -353,7 +353,7 @@ std::string Edge::name() const {
     return  result.str();
 }
 
-void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
+void Edge::externalAllocate(WeightsSharing::Ptr weightsCache, const std::string& scope) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -363,7 +363,9 @@ void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        // the record is keyed by the edge name, so it has to be scoped per network to avoid
+        // collisions with graphs of other networks sharing the same weights cache
+        auto ptr = weightsCache->findOrCreate(scope + name(), alloc, false);
         memoryPtr = *ptr;
         DEBUG_LOG(*this, " memoryPtr=", memoryPtr);
         useExternalMemory = true;
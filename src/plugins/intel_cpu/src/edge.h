@@ -52,7 +52,7 @@ public:
     void init();
     void allocate(const void* mem_ptr = nullptr);
     void allocate(DnnlMemoryMngrPtr memMngr);
-    void externalAllocate(WeightsSharing::Ptr weightsCache);
+    void externalAllocate(WeightsSharing::Ptr weightsCache, const std::string& scope);
     void reuse(MemoryPtr ptr);
     void validate();
     void drop();
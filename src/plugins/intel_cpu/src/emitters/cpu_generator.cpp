@@ -117,6 +117,9 @@ ov::intel_cpu::CPUTargetMachine::CPUTargetMachine(dnnl::impl::cpu::x64::cpu_isa_
 
     jitters[ov::intel_cpu::SwishNode::get_type_info_static()] = CREATE_EMITTER(ov::intel_cpu::jit_swish_emitter);
     jitters[ngraph::op::v4::HSwish::get_type_info_static()] = CREATE_EMITTER(ov::intel_cpu::jit_hswish_emitter);
+    jitters[ngraph::op::v4::Mish::get_type_info_static()] = CREATE_EMITTER(ov::intel_cpu::jit_mish_emitter);
+    jitters[ngraph::op::v5::HSigmoid::get_type_info_static()] = CREATE_EMITTER(ov::intel_cpu::jit_hsigmoid_emitter);
+    jitters[ngraph::op::v4::SoftPlus::get_type_info_static()] = CREATE_EMITTER(ov::intel_cpu::jit_softplus_emitter);
     // jitters[ngraph::opset1::HardSigmoid::get_type_info_static()] = CREATE_EMITTER(); // not supported
     // jitters[ngraph::opset1::Selu::get_type_info_static()] = CREATE_EMITTER(); // not supported
     jitters[ngraph::op::v0::Gelu::get_type_info_static()] = CREATE_EMITTER(ov::intel_cpu::jit_gelu_v0_emitter);
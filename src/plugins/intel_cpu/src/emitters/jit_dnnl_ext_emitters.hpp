@@ -130,6 +130,45 @@ public:
     }
 };
 
+class jit_mish_emitter : public jit_dnnl_emitter {
+public:
+    jit_mish_emitter(dnnl::impl::cpu::x64::jit_generator *host, dnnl::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32)
+            : jit_dnnl_emitter(host, host_isa, n, exec_prc) {
+        kind = dnnl_eltwise_mish;
+        alpha = 0.f;
+        beta = 0.f;
+
+        set_injector();
+    }
+};
+
+class jit_hsigmoid_emitter : public jit_dnnl_emitter {
+public:
+    jit_hsigmoid_emitter(dnnl::impl::cpu::x64::jit_generator *host, dnnl::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32)
+            : jit_dnnl_emitter(host, host_isa, n, exec_prc) {
+        kind = dnnl_eltwise_hsigmoid;
+        alpha = 0.f;
+        beta = 0.f;
+
+        set_injector();
+    }
+};
+
+class jit_softplus_emitter : public jit_dnnl_emitter {
+public:
+    jit_softplus_emitter(dnnl::impl::cpu::x64::jit_generator *host, dnnl::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32)
+            : jit_dnnl_emitter(host, host_isa, n, exec_prc) {
+        kind = dnnl_eltwise_soft_relu;
+        alpha = 0.f;
+        beta = 0.f;
+
+        set_injector();
+    }
+};
+
 class jit_gelu_v0_emitter : public jit_dnnl_emitter {
 public:
     jit_gelu_v0_emitter(dnnl::impl::cpu::x64::jit_generator *host, dnnl::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
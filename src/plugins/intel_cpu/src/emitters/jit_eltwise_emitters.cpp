@@ -790,7 +790,21 @@ void jit_equal_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const s
     Vmm vmm_aux0 = Vmm(aux_vec_idxs[0]);
     Vmm vmm_aux1 = Vmm(aux_vec_idxs[1]);
 
-    if (isa == x64::sse41) {
+    if (exec_prc_ == Precision::I32) {
+        if (isa == x64::sse41) {
+            h->movups(vmm_aux0, vmm_src0);
+            h->pcmpeqd(vmm_aux0, vmm_src1);
+            h->pand(vmm_aux0, table_val("one"));
+            h->movups(vmm_dst, vmm_aux0);
+        } else if (isa == x64::avx2) {
+            h->vpcmpeqd(vmm_aux0, vmm_src0, vmm_src1);
+            h->vpand(vmm_dst, vmm_aux0, table_val("one"));
+        } else {
+            h->vpcmpeqd(k_mask, vmm_src0, vmm_src1);
+            h->uni_vmovups(vmm_dst, table_val("zero"));
+            h->vpblendmd(vmm_dst | k_mask, vmm_dst, table_val("one"));
+        }
+    } else if (isa == x64::sse41) {
         h->movups(vmm_aux0, vmm_src0);
         h->cmpps(vmm_aux0, vmm_src1, _cmp_eq_oq);
         h->movups(vmm_aux1, table_val("one"));
@@ -809,13 +823,17 @@ void jit_equal_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const s
 
 void jit_equal_emitter::register_table_entries() {
     push_arg_entry_of("zero", 0x00000000, true);
-    push_arg_entry_of("one", CONST_1_F, true);
+    push_arg_entry_of("one", exec_prc_ == Precision::I32 ? 0x00000001 : CONST_1_F, true);
 }
 
 size_t jit_equal_emitter::aux_vecs_count() const {
     return 2;
 }
 
+std::set<Precision> jit_equal_emitter::get_supported_precisions() {
+    return {Precision::FP32, Precision::I32};
+}
+
 /// NOT_EQUAL ///
 jit_not_equal_emitter::jit_not_equal_emitter(x64::jit_generator *host, x64::cpu_isa_t host_isa, const std::shared_ptr<ov::Node>& node, Precision exec_prc)
 : jit_emitter(host, host_isa, node, exec_prc) {
@@ -851,7 +869,21 @@ void jit_not_equal_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, con
     Vmm vmm_aux0 = Vmm(aux_vec_idxs[0]);
     Vmm vmm_aux1 = Vmm(aux_vec_idxs[1]);
 
-    if (isa == x64::sse41) {
+    if (exec_prc_ == Precision::I32) {
+        if (isa == x64::sse41) {
+            h->movups(vmm_aux0, vmm_src0);
+            h->pcmpeqd(vmm_aux0, vmm_src1);
+            h->pandn(vmm_aux0, table_val("one"));
+            h->movups(vmm_dst, vmm_aux0);
+        } else if (isa == x64::avx2) {
+            h->vpcmpeqd(vmm_aux0, vmm_src0, vmm_src1);
+            h->vpandn(vmm_dst, vmm_aux0, table_val("one"));
+        } else {
+            h->vpcmpeqd(k_mask, vmm_src0, vmm_src1);
+            h->uni_vmovups(vmm_dst, table_val("one"));
+            h->vpblendmd(vmm_dst | k_mask, vmm_dst, table_val("zero"));
+        }
+    } else if (isa == x64::sse41) {
         h->movups(vmm_aux0, vmm_src0);
         h->cmpps(vmm_aux0, vmm_src1, _cmp_eq_oq);
         h->movups(vmm_dst, table_val("one"));
@@ -870,13 +902,17 @@ void jit_not_equal_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, con
 
 void jit_not_equal_emitter::register_table_entries() {
     push_arg_entry_of("zero", 0x00000000, true);
-    push_arg_entry_of("one", CONST_1_F, true);
+    push_arg_entry_of("one", exec_prc_ == Precision::I32 ? 0x00000001 : CONST_1_F, true);
 }
 
 size_t jit_not_equal_emitter::aux_vecs_count() const {
     return 2;
 }
 
+std::set<Precision> jit_not_equal_emitter::get_supported_precisions() {
+    return {Precision::FP32, Precision::I32};
+}
+
 /// GREATER ///
 jit_greater_emitter::jit_greater_emitter(x64::jit_generator *host, x64::cpu_isa_t host_isa, const std::shared_ptr<ov::Node>& node, Precision exec_prc)
 : jit_emitter(host, host_isa, node, exec_prc) {
@@ -912,7 +948,21 @@ void jit_greater_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const
     Vmm vmm_aux0 = Vmm(aux_vec_idxs[0]);
     Vmm vmm_aux1 = Vmm(aux_vec_idxs[1]);
 
-    if (isa == x64::sse41) {
+    if (exec_prc_ == Precision::I32) {
+        if (isa == x64::sse41) {
+            h->movups(vmm_aux0, vmm_src0);
+            h->pcmpgtd(vmm_aux0, vmm_src1);
+            h->pand(vmm_aux0, table_val("one"));
+            h->movups(vmm_dst, vmm_aux0);
+        } else if (isa == x64::avx2) {
+            h->vpcmpgtd(vmm_aux0, vmm_src0, vmm_src1);
+            h->vpand(vmm_dst, vmm_aux0, table_val("one"));
+        } else {
+            h->vpcmpgtd(k_mask, vmm_src0, vmm_src1);
+            h->uni_vmovups(vmm_dst, table_val("zero"));
+            h->vpblendmd(vmm_dst | k_mask, vmm_dst, table_val("one"));
+        }
+    } else if (isa == x64::sse41) {
         h->movups(vmm_aux0, vmm_src0);
         h->cmpps(vmm_aux0, vmm_src1, _cmp_gt_os);
         h->movups(vmm_aux1, table_val("one"));
@@ -931,13 +981,17 @@ void jit_greater_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const
 
 void jit_greater_emitter::register_table_entries() {
     push_arg_entry_of("zero", 0x00000000, true);
-    push_arg_entry_of("one", CONST_1_F, true);
+    push_arg_entry_of("one", exec_prc_ == Precision::I32 ? 0x00000001 : CONST_1_F, true);
 }
 
 size_t jit_greater_emitter::aux_vecs_count() const {
     return 2;
 }
 
+std::set<Precision> jit_greater_emitter::get_supported_precisions() {
+    return {Precision::FP32, Precision::I32};
+}
+
 /// GREATER_EQUAL ///
 jit_greater_equal_emitter::jit_greater_equal_emitter(x64::jit_generator *host, x64::cpu_isa_t host_isa, const std::shared_ptr<ov::Node>& node,
                                                      Precision exec_prc)
@@ -974,7 +1028,22 @@ void jit_greater_equal_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs,
     Vmm vmm_aux0 = Vmm(aux_vec_idxs[0]);
     Vmm vmm_aux1 = Vmm(aux_vec_idxs[1]);
 
-    if (isa == x64::sse41) {
+    if (exec_prc_ == Precision::I32) {
+        // There is no integer "greater or equal" compare, so the inverted "less than" is used.
+        if (isa == x64::sse41) {
+            h->movups(vmm_aux0, vmm_src1);
+            h->pcmpgtd(vmm_aux0, vmm_src0);
+            h->pandn(vmm_aux0, table_val("one"));
+            h->movups(vmm_dst, vmm_aux0);
+        } else if (isa == x64::avx2) {
+            h->vpcmpgtd(vmm_aux0, vmm_src1, vmm_src0);
+            h->vpandn(vmm_dst, vmm_aux0, table_val("one"));
+        } else {
+            h->vpcmpgtd(k_mask, vmm_src1, vmm_src0);
+            h->uni_vmovups(vmm_dst, table_val("one"));
+            h->vpblendmd(vmm_dst | k_mask, vmm_dst, table_val("zero"));
+        }
+    } else if (isa == x64::sse41) {
         h->movups(vmm_aux0, vmm_src0);
         h->cmpps(vmm_aux0, vmm_src1, _cmp_ge_os);
         h->movups(vmm_aux1, table_val("one"));
@@ -993,13 +1062,17 @@ void jit_greater_equal_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs,
 
 void jit_greater_equal_emitter::register_table_entries() {
     push_arg_entry_of("zero", 0x00000000, true);
-    push_arg_entry_of("one", CONST_1_F, true);
+    push_arg_entry_of("one", exec_prc_ == Precision::I32 ? 0x00000001 : CONST_1_F, true);
 }
 
 size_t jit_greater_equal_emitter::aux_vecs_count() const {
     return 2;
 }
 
+std::set<Precision> jit_greater_equal_emitter::get_supported_precisions() {
+    return {Precision::FP32, Precision::I32};
+}
+
 /// LESS ///
 jit_less_emitter::jit_less_emitter(x64::jit_generator *host, x64::cpu_isa_t host_isa, const std::shared_ptr<ov::Node>& node, Precision exec_prc)
 : jit_emitter(host, host_isa, node, exec_prc) {
@@ -1035,7 +1108,21 @@ void jit_less_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const st
     Vmm vmm_aux0 = Vmm(aux_vec_idxs[0]);
     Vmm vmm_aux1 = Vmm(aux_vec_idxs[1]);
 
-    if (isa == x64::sse41) {
+    if (exec_prc_ == Precision::I32) {
+        if (isa == x64::sse41) {
+            h->movups(vmm_aux0, vmm_src1);
+            h->pcmpgtd(vmm_aux0, vmm_src0);
+            h->pand(vmm_aux0, table_val("one"));
+            h->movups(vmm_dst, vmm_aux0);
+        } else if (isa == x64::avx2) {
+            h->vpcmpgtd(vmm_aux0, vmm_src1, vmm_src0);
+            h->vpand(vmm_dst, vmm_aux0, table_val("one"));
+        } else {
+            h->vpcmpgtd(k_mask, vmm_src1, vmm_src0);
+            h->uni_vmovups(vmm_dst, table_val("zero"));
+            h->vpblendmd(vmm_dst | k_mask, vmm_dst, table_val("one"));
+        }
+    } else if (isa == x64::sse41) {
         h->movups(vmm_aux0, vmm_src0);
         h->cmpps(vmm_aux0, vmm_src1, _cmp_lt_os);
         h->movups(vmm_aux1, table_val("one"));
@@ -1054,13 +1141,17 @@ void jit_less_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const st
 
 void jit_less_emitter::register_table_entries() {
     push_arg_entry_of("zero", 0x00000000, true);
-    push_arg_entry_of("one", CONST_1_F, true);
+    push_arg_entry_of("one", exec_prc_ == Precision::I32 ? 0x00000001 : CONST_1_F, true);
 }
 
 size_t jit_less_emitter::aux_vecs_count() const {
     return 2;
 }
 
+std::set<Precision> jit_less_emitter::get_supported_precisions() {
+    return {Precision::FP32, Precision::I32};
+}
+
 /// LESS_EQUAL ///
 jit_less_equal_emitter::jit_less_equal_emitter(x64::jit_generator *host, x64::cpu_isa_t host_isa, const std::shared_ptr<ov::Node>& node, Precision exec_prc)
 : jit_emitter(host, host_isa, node, exec_prc) {
@@ -1097,7 +1188,22 @@ void jit_less_equal_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, co
     Vmm vmm_aux0 = Vmm(aux_vec_idxs[0]);
     Vmm vmm_aux1 = Vmm(aux_vec_idxs[1]);
 
-    if (isa == x64::sse41) {
+    if (exec_prc_ == Precision::I32) {
+        // There is no integer "less or equal" compare, so the inverted "greater than" is used.
+        if (isa == x64::sse41) {
+            h->movups(vmm_aux0, vmm_src0);
+            h->pcmpgtd(vmm_aux0, vmm_src1);
+            h->pandn(vmm_aux0, table_val("one"));
+            h->movups(vmm_dst, vmm_aux0);
+        } else if (isa == x64::avx2) {
+            h->vpcmpgtd(vmm_aux0, vmm_src0, vmm_src1);
+            h->vpandn(vmm_dst, vmm_aux0, table_val("one"));
+        } else {
+            h->vpcmpgtd(k_mask, vmm_src0, vmm_src1);
+            h->uni_vmovups(vmm_dst, table_val("one"));
+            h->vpblendmd(vmm_dst | k_mask, vmm_dst, table_val("zero"));
+        }
+    } else if (isa == x64::sse41) {
         h->movups(vmm_aux0, vmm_src0);
         h->cmpps(vmm_aux0, vmm_src1, _cmp_le_os);
         h->movups(vmm_aux1, table_val("one"));
@@ -1116,13 +1222,17 @@ void jit_less_equal_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, co
 
 void jit_less_equal_emitter::register_table_entries() {
     push_arg_entry_of("zero", 0x00000000, true);
-    push_arg_entry_of("one", CONST_1_F, true);
+    push_arg_entry_of("one", exec_prc_ == Precision::I32 ? 0x00000001 : CONST_1_F, true);
 }
 
 size_t jit_less_equal_emitter::aux_vecs_count() const {
     return 2;
 }
 
+std::set<Precision> jit_less_equal_emitter::get_supported_precisions() {
+    return {Precision::FP32, Precision::I32};
+}
+
 /// LOGICAL_AND ///
 jit_logical_and_emitter::jit_logical_and_emitter(x64::jit_generator *host, x64::cpu_isa_t host_isa, const std::shared_ptr<ov::Node>& node, Precision exec_prc)
 : jit_emitter(host, host_isa, node, exec_prc) {
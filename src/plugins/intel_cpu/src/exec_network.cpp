@@ -8,6 +8,7 @@
 #include <low_precision/low_precision.hpp>
 
 #include "async_infer_request.h"
+#include "batch_split_infer_request.h"
 #include "infer_request.h"
 #include "memory_state.h"
 #include "itt.h"
@@ -22,14 +23,23 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/assign.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/common_optimizations/dimension_tracking.hpp>
+#include <dimension_tracker.hpp>
+#include <openvino/pass/manager.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
+#include "onednn/iml_type_mapper.h"
+#include "transformations/rt_info/primitives_priority_attribute.hpp"
+
 #include <algorithm>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -40,6 +50,44 @@ using namespace InferenceEngine::details;
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+
+CPUStreamsExecutor::TaskPriority TaskPriorityFromHint(ov::hint::Priority modelPriority) {
+    switch (modelPriority) {
+    case ov::hint::Priority::HIGH:
+        return CPUStreamsExecutor::TaskPriority::High;
+    case ov::hint::Priority::LOW:
+        return CPUStreamsExecutor::TaskPriority::Low;
+    default:
+        return CPUStreamsExecutor::TaskPriority::Normal;
+    }
+}
+
+// Routes the pipeline tasks of one network into the priority class derived from its
+// ov::hint::model_priority, so requests of an interactive network are dequeued ahead of the
+// batch backfill ones sharing the executor. The network itself serves as the owner tag, which
+// keeps the preemption points of its own graphs from picking these tasks up.
+class PriorityTaskExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    PriorityTaskExecutor(CPUStreamsExecutor::Ptr executor,
+                         CPUStreamsExecutor::TaskPriority priority,
+                         const void* owner)
+        : _executor(std::move(executor)),
+          _priority(priority),
+          _owner(owner) {}
+
+    void run(InferenceEngine::Task task) override {
+        _executor->run(std::move(task), _priority, _owner);
+    }
+
+private:
+    CPUStreamsExecutor::Ptr _executor;
+    CPUStreamsExecutor::TaskPriority _priority;
+    const void* _owner;
+};
+
+}  // namespace
+
 InferenceEngine::IInferRequestInternal::Ptr
 ExecNetwork::CreateInferRequestImpl(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                     const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
@@ -65,13 +113,17 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
+                         NumaNodesWeights& numaNodesWeights,
                          const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
+    _numaNodesWeights(numaNodesWeights),
     _cfg{cfg},
     _name{network.getName()},
     _network(network) {
     SetPointerToPlugin(plugin);
+    static std::atomic_size_t networkCounter{0};
+    _weightsCacheScope = "net" + std::to_string(networkCounter++) + "#";
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
@@ -81,6 +133,10 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     _cfg.isNewApi = !isLegacyAPI();
     _mutex = std::make_shared<std::mutex>();
 
+    // like huge pages, shared memory weights apply to the whole process once enabled
+    if (_cfg.weightsShmSharing)
+        _numaNodesWeights.enableCrossProcessSharing();
+
     // WA for inference dynamic batch cases in new API
     if (_cfg.isNewApi) {
         int64_t maxBatchSize = -1;
@@ -95,19 +151,56 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    if (_cfg.batchSplitting)
+        _batchSplittable = isBatchSplittable(function);
+
+    // stateful models keep their variable storage inside the executing graph, so serving from a
+    // tier-0 graph and migrating to the optimized replica later would silently drop the state;
+    // fall back to the regular synchronous compilation for them
+    if (_cfg.tieredCompilation &&
+        (ngraph::op::util::has_op_with_type<ngraph::op::v3::Assign>(function) ||
+         ngraph::op::util::has_op_with_type<ngraph::op::v6::Assign>(function))) {
+        _cfg.tieredCompilation = false;
+    }
+
+    int sharedPoolQuota = 0;
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = _plugin->executorManager()->getExecutor("CPU");
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
+        // a core type forced through ov::hint::scheduling_core_type wins over the automatic
+        // hybrid-aware selection done by MakeDefaultMultiThreaded
+        if (_cfg.schedulingCoreType == ov::hint::SchedulingCoreType::PCORE_ONLY) {
+            streamsExecutorConfig._threadPreferredCoreType = InferenceEngine::IStreamsExecutor::Config::PreferredCoreType::BIG;
+        } else if (_cfg.schedulingCoreType == ov::hint::SchedulingCoreType::ECORE_ONLY) {
+            streamsExecutorConfig._threadPreferredCoreType = InferenceEngine::IStreamsExecutor::Config::PreferredCoreType::LITTLE;
+        }
         _cfg.streamExecutorConfig._threads = streamsExecutorConfig._threads;
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
-        _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        if (_cfg.streamsPoolSharing) {
+            // The priority hint weights the share of the pool the network may occupy: a LOW
+            // priority network takes at most half of its configured streams, a HIGH priority one
+            // up to twice as many (a graph replica is built for every slot it may occupy below).
+            sharedPoolQuota = std::max(1, streamsExecutorConfig._streams);
+            if (_cfg.modelPriority == ov::hint::Priority::LOW) {
+                sharedPoolQuota = std::max(1, sharedPoolQuota / 2);
+            } else if (_cfg.modelPriority == ov::hint::Priority::HIGH) {
+                sharedPoolQuota *= 2;
+            }
+            _taskExecutor = _plugin->executorManager()->getSharedCPUStreamsExecutor(streamsExecutorConfig,
+                                                                                    sharedPoolQuota);
+        } else {
+            _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        }
 #endif
     }
+    // both the shared and the idle executors may serve several networks of the process, so the
+    // request tasks carry a priority class there (see CreateInferRequest)
+    _streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor);
     if (0 != cfg.streamExecutorConfig._streams) {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         // There is no additional threads but we still need serialize callback execution to preserve legacy behaviour
@@ -120,22 +213,78 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    // with the shared streams pool the network may occupy more pool streams than it has own
+    // streams configured, so keep a graph replica for every slot of its quota
+    streams = std::max(streams, sharedPoolQuota);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
-        auto all_graphs_ready = [&] {
-            return std::all_of(_graphs.begin(), _graphs.end(), [&] (Graph& graph) {
-                return graph.IsReady();
-            });
-        };
-        do {
+        if (_cfg.tieredCompilation) {
+            // Tier-0 bring-up: compile one fusion-free graph synchronously, which takes a
+            // fraction of the full compile, and let the regular warm-up run in the background.
+            // Every stream migrates from the shared tier-0 graph to its optimized replica the
+            // moment GetGraph() finds the replica ready, so a freshly scaled-up instance takes
+            // traffic within seconds instead of idling through the whole compile.
+            {
+                Config tier0Cfg = _cfg;
+                tier0Cfg.tier0FastCompile = true;
+                auto weightsCache = _numaNodesWeights[0];
+                auto isQuantizedFlag =
+                    (_cfg.lpTransformsMode == Config::On) &&
+                    ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(function);
+                auto ctx = std::make_shared<GraphContext>(tier0Cfg, extensionManager, weightsCache, _mutex,
+                                                          isQuantizedFlag, _weightsCacheScope,
+                                                          _streamsExecutor, this);
+                _tier0Graph = std::make_shared<GraphGuard>();
+                GraphGuard::Lock graphLock{*_tier0Graph};
+                graphLock._graph.CreateGraph(_network, ctx);
+            }
+            _pendingTierUpgrades = static_cast<int>(tasks.size());
             for (auto&& task : tasks) {
                 task = [this] {
-                    ExecNetwork::GetGraph();
+                    try {
+                        ExecNetwork::GetOrBuildGraph();
+                    } catch (...) {
+                        // the replica stays not ready; once the warm-up is over GetGraph()
+                        // retries the build synchronously on the request thread
+                    }
+                    std::lock_guard<std::mutex> lock{_tierUpgradeMutex};
+                    if (--_pendingTierUpgrades == 0)
+                        _tierUpgradeDone.notify_all();
                 };
+                _taskExecutor->run(task);
             }
-            _taskExecutor->runAndWait(tasks);
-        } while (!all_graphs_ready());
+        } else {
+            auto warm_up_done = [&] {
+                size_t allocated = 0;
+                bool allReady = true;
+                for (auto& graph : _graphs) {
+                    if (graph.IsReady())
+                        allocated += graph.GetAllocatedMemory();
+                    else
+                        allReady = false;
+                }
+                if (allReady)
+                    return true;
+                // under a memory budget the remaining replicas may be legitimately unbuildable:
+                // GetOrBuildGraph() refuses to materialize one more copy once the accounted
+                // consumption leaves no room for it (using the first copy as the size estimate),
+                // so another warm-up round would just spin
+                return _cfg.memoryBudget && _graphs[0].IsReady() &&
+                       allocated + _graphs[0].GetAllocatedMemory() > _cfg.memoryBudget;
+            };
+            do {
+                for (auto&& task : tasks) {
+                    task = [this] {
+                        ExecNetwork::GetOrBuildGraph();
+                    };
+                }
+                _taskExecutor->runAndWait(tasks);
+                // with the shared streams pool there is no guarantee that every replica gets a pool
+                // stream mapped to it during warm-up, so run a single round and let GetGraph() build
+                // the remaining replicas on first use
+            } while (!warm_up_done() && !_cfg.streamsPoolSharing);
+        }
     } else {
         ExecNetwork::GetGraph();
     }
@@ -162,9 +311,129 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
             }
         }
     }
+
+    if (_cfg.releaseSourceWeights && !_cfg.tieredCompilation && !_cfg.streamsPoolSharing && !_cfg.memoryBudget) {
+        // All stream graphs are built at this point and every constant is either repacked into
+        // them or kept alive by the Input node that uses it in place, so the source model only
+        // backs ExportNetwork() from now on. Drop it to release the repacked constant buffers.
+        // The model is kept whenever a replica build may still happen after the constructor:
+        // with tiered compilation the background warm-up compiles from it (and dropping it later
+        // would race with the requests), while the shared streams pool and the memory budget both
+        // defer some replica builds to the first use on a request thread.
+        _network = InferenceEngine::CNNNetwork{};
+    }
+}
+
+ExecNetwork::~ExecNetwork() {
+    if (_tier0Graph) {
+        // the background warm-up tasks capture `this`, so wait them out first
+        std::unique_lock<std::mutex> lock{_tierUpgradeMutex};
+        _tierUpgradeDone.wait(lock, [this] { return _pendingTierUpgrades == 0; });
+    }
+    for (auto& thread : _specializationThreads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+Graph* ExecNetwork::TryGetSpecializedGraph(const InferenceEngine::BlobMap& inputs, std::unique_lock<std::mutex>& guard) {
+    // the number of clones and the hotness threshold are deliberately conservative: every clone
+    // pays the full compilation time and keeps its own set of primitives alive
+    constexpr size_t hotShapeThreshold = 16;
+    constexpr size_t maxSpecializedGraphs = 3;
+    constexpr size_t maxTrackedShapes = 256;
+
+    // the source model is required for the clone (may be dropped by releaseSourceWeights)
+    if (_network.getFunction() == nullptr)
+        return nullptr;
+
+    std::map<std::string, InferenceEngine::SizeVector> shapes;
+    std::string signature;
+    for (const auto& input : inputs) {
+        const auto& dims = input.second->getTensorDesc().getDims();
+        shapes[input.first] = dims;
+        signature += input.first;
+        signature += '(';
+        for (const auto dim : dims) {
+            signature += std::to_string(dim);
+            signature += ',';
+        }
+        signature += ')';
+    }
+    // an incomplete shape set would produce a partially dynamic clone which is of no use
+    if (shapes.size() != _network.getInputsInfo().size())
+        return nullptr;
+
+    std::shared_ptr<GraphGuard> specialized;
+    {
+        std::lock_guard<std::mutex> lock{_specializationMutex};
+        auto itr = _specializedGraphs.find(signature);
+        if (itr != _specializedGraphs.end()) {
+            specialized = itr->second;
+        } else if (_specializedGraphs.size() < maxSpecializedGraphs &&
+                   // bound the histogram so shape-diverse workloads do not grow it unattended
+                   (_shapeHistogram.size() < maxTrackedShapes || _shapeHistogram.count(signature)) &&
+                   ++_shapeHistogram[signature] >= hotShapeThreshold) {
+            specialized = std::make_shared<GraphGuard>();
+            _specializedGraphs.emplace(signature, specialized);
+            _specializationThreads.emplace_back([this, specialized, shapes] {
+                try {
+                    auto clonedNetwork = InferenceEngine::details::cloneNetwork(_network);
+                    clonedNetwork.reshape(shapes);
+                    GraphContext::Ptr ctx;
+                    {
+                        std::lock_guard<std::mutex> ctxLock{*_mutex.get()};
+                        auto weightsCache = _numaNodesWeights[0];
+                        auto isQuantizedFlag =
+                            (_cfg.lpTransformsMode == Config::On) &&
+                            ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(clonedNetwork.getFunction());
+                        ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex,
+                                                             isQuantizedFlag, _weightsCacheScope,
+                                                             _streamsExecutor, this);
+                    }
+                    GraphGuard::Lock graphLock{*specialized};
+                    graphLock._graph.CreateGraph(clonedNetwork, ctx);
+                } catch (...) {
+                    // the entry stays in the map not ready, so this shape set is not retried
+                }
+            });
+            return nullptr;
+        }
+    }
+
+    if (!specialized)
+        return nullptr;
+
+    // the clone is shared across the streams; when it is busy (or still being compiled) the
+    // caller simply falls back to the generic graph
+    std::unique_lock<std::mutex> tryLock{specialized->_mutex, std::try_to_lock};
+    if (!tryLock.owns_lock() || !specialized->IsReady())
+        return nullptr;
+    guard = std::move(tryLock);
+    return specialized.get();
 }
 
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
+    // while the tiered bring-up is in progress, requests whose stream replica is still compiling
+    // are served from the shared tier-0 graph (they serialize on it, which is still better than
+    // blocking on the full compile); afterwards any replica the warm-up could not build - a
+    // pool-mapping gap or a failure - is built synchronously right here, as in the regular mode
+    if (_tier0Graph && _pendingTierUpgrades.load() > 0) {
+        int streamId = 0;
+        auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+        if (nullptr != streamsExecutor)
+            streamId = streamsExecutor->GetStreamId();
+        if (!_graphs[streamId % _graphs.size()].IsReady()) {
+            auto tier0Lock = GraphGuard::Lock(*_tier0Graph);
+            if (tier0Lock._graph.IsReady())
+                return tier0Lock;
+        }
+    }
+    return GetOrBuildGraph();
+}
+
+ExecNetwork::GraphGuard::Lock ExecNetwork::GetOrBuildGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
@@ -172,7 +441,23 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
+    const auto graphIdx = streamId % _graphs.size();
+    if (_cfg.memoryBudget && graphIdx != 0 && !_graphs[graphIdx].IsReady()) {
+        // Under a memory budget a stream materializes its own graph copy only while the accounted
+        // consumption leaves room for one more; otherwise the request queues on the first copy,
+        // trading throughput for staying below the limit (see KEY_CPU_MEMORY_BUDGET)
+        size_t allocated = 0;
+        for (auto& graph : _graphs) {
+            if (graph.IsReady())
+                allocated += graph.GetAllocatedMemory();
+        }
+        auto sharedLock = GraphGuard::Lock(_graphs[0]);
+        if (sharedLock._graph.IsReady() &&
+            allocated + sharedLock._graph.GetAllocatedMemory() > _cfg.memoryBudget) {
+            return sharedLock;
+        }
+    }
+    auto graphLock = GraphGuard::Lock(_graphs[graphIdx]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
@@ -180,15 +465,17 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                 GraphContext::Ptr ctx;
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
-                    // disable weights caching if graph was created only once
-                    auto weightsCache =
-                        _cfg.streamExecutorConfig._streams != 1 ? _numaNodesWeights[numaNodeId] : nullptr;
+                    // the weights cache is always used since it is process-wide: even a single
+                    // stream network benefits from sharing packed weights with other networks
+                    // compiled from an identical model
+                    auto weightsCache = _numaNodesWeights[numaNodeId];
 
                     auto isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantizedFlag,
+                                                         _weightsCacheScope, _streamsExecutor, this);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -208,7 +495,29 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
 }
 
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
+    if (_batchSplittable)
+        return std::make_shared<BatchSplitInferRequest>(std::static_pointer_cast<ExecNetwork>(shared_from_this()));
+    return CreateStreamInferRequest();
+}
+
+InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateStreamInferRequest() {
+    if (!_streamsExecutor)
+        return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
+    // same as CreateAsyncInferRequestFromSync, but the pipeline tasks go through the priority
+    // class of the network, so the shared stream threads serve the requests in priority order
+    InferenceEngine::IInferRequestInternal::Ptr syncRequestImpl;
+    try {
+        syncRequestImpl = CreateInferRequestImpl(_parameters, _results);
+    } catch (const InferenceEngine::NotImplemented&) {
+    }
+    if (!syncRequestImpl) {
+        syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+        syncRequestImpl->setModelInputsOutputs(_parameters, _results);
+    }
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto taskExecutor =
+        std::make_shared<PriorityTaskExecutor>(_streamsExecutor, TaskPriorityFromHint(_cfg.modelPriority), this);
+    return std::make_shared<AsyncInferRequest>(syncRequestImpl, taskExecutor, _callbackExecutor);
 }
 
 std::shared_ptr<ngraph::Function> ExecNetwork::GetExecGraphInfo() {
@@ -261,6 +570,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(CPUConfigParams::KEY_CPU_MEMORY_USAGE);
+        metrics.push_back(CPUConfigParams::KEY_CPU_RUNTIME_CACHE_STATISTICS);
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -275,6 +586,29 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == CPUConfigParams::KEY_CPU_MEMORY_USAGE) {
+        std::map<std::string, uint64_t> usage;
+        uint64_t total = 0;
+        for (size_t i = 0; i < _graphs.size(); i++) {
+            if (!_graphs[i].IsReady())
+                continue;
+            const auto bytes = static_cast<uint64_t>(_graphs[i].GetAllocatedMemory());
+            usage["stream_" + std::to_string(i)] = bytes;
+            total += bytes;
+        }
+        usage["total"] = total;
+        return usage;
+    } else if (name == CPUConfigParams::KEY_CPU_RUNTIME_CACHE_STATISTICS) {
+        // only the locked graph copy is inspected: its cache cannot be mutated concurrently,
+        // while the sibling streams own identical caches of their own
+        const auto cacheStats = graph.getGraphContext()->getParamsCache()->getStatistics();
+        std::map<std::string, uint64_t> stats;
+        stats["records"] = static_cast<uint64_t>(cacheStats.records);
+        stats["evictions"] = static_cast<uint64_t>(cacheStats.evictions);
+        stats["hits"] = cacheStats.hits;
+        stats["misses"] = cacheStats.misses;
+        stats["primitive_cache_capacity"] = static_cast<uint64_t>(dnnl::get_primitive_cache_capacity());
+        return stats;
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -307,8 +641,11 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::enable_profiling.name()),
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
+            RO_property(ov::hint::scheduling_core_type.name()),
             RO_property(ov::hint::num_requests.name()),
             RO_property(ov::execution_devices.name()),
+            RO_property(CPUConfigParams::KEY_CPU_MEMORY_USAGE),
+            RO_property(CPUConfigParams::KEY_CPU_RUNTIME_CACHE_STATISTICS),
         };
     }
 
@@ -342,12 +679,15 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         const bool perfCount = config.collectPerfCounters;
         return decltype(ov::enable_profiling)::value_type(perfCount);
     } else if (name == ov::hint::inference_precision) {
-        const auto enforceBF16 = config.enforceBF16;
-        const auto inference_precision = enforceBF16 ? ov::element::bf16 : ov::element::f32;
+        const auto inference_precision = config.enforceFP16 ? ov::element::f16
+            : config.enforceBF16 ? ov::element::bf16 : ov::element::f32;
         return decltype(ov::hint::inference_precision)::value_type(inference_precision);
     } else if (name == ov::hint::performance_mode) {
         const auto perfHint = ov::util::from_string(config.perfHintsConfig.ovPerfHint, ov::hint::performance_mode);
         return perfHint;
+    } else if (name == ov::hint::scheduling_core_type) {
+        const auto coreType = config.schedulingCoreType;
+        return coreType;
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
@@ -359,6 +699,34 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     return GetMetricLegacy(name, graph);
 }
 
+bool ExecNetwork::isBatchSplittable(const std::shared_ptr<const ov::Model>& model) const {
+    // the legacy dynamic batch path owns the batch dimension and stateful networks carry
+    // cross-batch state, so neither can be split
+    if (_cfg.batchLimit > 0 || !model->get_variables().empty() || !model->get_sinks().empty())
+        return false;
+    for (const auto& param : model->get_parameters()) {
+        if (param->get_partial_shape().is_dynamic())
+            return false;
+    }
+    // let the dimension tracking pass confirm that the 0th dimension of every input and output
+    // is the batch - the same check the automatic batching uses for the opposite direction
+    auto clone = model->clone();
+    ov::pass::Manager m;
+    m.register_pass<ov::pass::FindBatch>(false, true);
+    m.run_passes(clone);
+    for (const auto& param : clone->get_parameters()) {
+        const auto& shape = param->get_partial_shape();
+        if (shape.size() == 0 || !ov::DimensionTracker::get_label(shape[0]))
+            return false;
+    }
+    for (const auto& result : clone->get_results()) {
+        const auto& shape = result->get_output_partial_shape(0);
+        if (shape.size() == 0 || !ov::DimensionTracker::get_label(shape[0]))
+            return false;
+    }
+    return true;
+}
+
 bool ExecNetwork::canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const {
     maxBatchSize = -1;
     auto isDynBatchWithUpperBound = [maxBatchSize](const ov::PartialShape& shape) -> bool {
@@ -542,8 +910,59 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 }
 
 void ExecNetwork::Export(std::ostream& modelStream) {
+    if (!_network.getFunction()) {
+        IE_THROW() << "Network export isn't supported: the source model was released by the "
+                   << CPUConfigParams::KEY_CPU_RELEASE_SOURCE_WEIGHTS << " option";
+    }
+
+    // Pin the implementation selected for every executable node onto the serialized model
+    // as a PrimitivesPriority hint, so importing the blob on identical hardware replays the
+    // lowering decisions directly instead of re-running the selection with its fallbacks.
+    auto function = _network.getFunction();
+    std::unordered_map<std::string, std::string> implByNode;
+    {
+        auto graphLock = GetGraph();
+        for (const auto& node : graphLock._graph.GetNodes()) {
+            const auto selectedPd = node->getSelectedPrimitiveDescriptor();
+            if (!selectedPd)
+                continue;
+            const auto implType = selectedPd->getImplementationType();
+            const std::string implName = impl_type_to_string(implType);
+            // only record names that parse back to the same type: composite flag values
+            // without a dedicated name would turn into rejected "cpu:unknown" entries
+            if (implType == impl_desc_type::unknown || implType == impl_desc_type::undef ||
+                parse_impl_name(implName) != implType)
+                continue;
+            implByNode.emplace(node->getName(), implName);
+        }
+    }
+
+    std::unordered_map<std::string, ov::Any> previousPriorities;
+    for (const auto& op : function->get_ops()) {
+        auto it = implByNode.find(op->get_friendly_name());
+        if (it == implByNode.end())
+            continue;
+        auto& rtInfo = op->get_rt_info();
+        auto prev = rtInfo.find(ov::PrimitivesPriority::get_type_info_static());
+        if (prev != rtInfo.end())
+            previousPriorities.emplace(op->get_friendly_name(), prev->second);
+        rtInfo[ov::PrimitivesPriority::get_type_info_static()] = ov::PrimitivesPriority("cpu:" + it->second);
+    }
+
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+
+    // the hints are only meant for the blob: restore the rt_info of the live model
+    for (const auto& op : function->get_ops()) {
+        if (implByNode.find(op->get_friendly_name()) == implByNode.end())
+            continue;
+        auto& rtInfo = op->get_rt_info();
+        auto prev = previousPriorities.find(op->get_friendly_name());
+        if (prev != previousPriorities.end())
+            rtInfo[ov::PrimitivesPriority::get_type_info_static()] = prev->second;
+        else
+            rtInfo.erase(ov::PrimitivesPriority::get_type_info_static());
+    }
 }
 
 }   // namespace intel_cpu
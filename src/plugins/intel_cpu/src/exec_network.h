@@ -16,6 +16,9 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
 #include <unordered_map>
 
 namespace ov {
@@ -35,10 +38,17 @@ public:
 
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
+    // Creates an ordinary per-stream async request, bypassing the batch splitting wrapper;
+    // used by BatchSplitInferRequest to create its sub-requests
+    InferenceEngine::IInferRequestInternal::Ptr CreateStreamInferRequest();
+
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
+                NumaNodesWeights &numaNodesWeights,
                 const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
 
+    ~ExecNetwork() override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -49,15 +59,20 @@ public:
 
 protected:
     friend class InferRequestBase;
+    friend class BatchSplitInferRequest;
     ExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
-    const InferenceEngine::CNNNetwork           _network;
+    // Dropped after compilation when releaseSourceWeights is enabled, see the ctor
+    InferenceEngine::CNNNetwork                 _network;
     // Generic synchronization primitive on ExecNetwork level.
     // Usage example: helps to avoid data races during CPU Graph initialization in multi-streams scenario
     mutable std::shared_ptr<std::mutex>         _mutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // _taskExecutor downcast to the CPU streams executor; set when the executor supports the
+    // request priority classes (it may be shared with other networks of the process)
+    std::shared_ptr<InferenceEngine::CPUStreamsExecutor> _streamsExecutor;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -68,7 +83,12 @@ protected:
 
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
-    mutable NumaNodesWeights                    _numaNodesWeights;
+    // Process-wide weights cache owned by the plugin, so executable networks compiled from
+    // identical models share one set of packed weights (records are content-hash keyed)
+    NumaNodesWeights&                           _numaNodesWeights;
+    // Unique per-network prefix for the cache records that are not content-addressed (see
+    // Edge::externalAllocate), to keep them private to this network
+    std::string                                 _weightsCacheScope;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -76,9 +96,42 @@ protected:
      */
     GraphGuard::Lock GetGraph() const;
 
+    // The building part of GetGraph(): returns the replica of the current stream, compiling it
+    // first when needed. With tiered compilation GetGraph() serves requests from the tier-0
+    // graph instead of blocking here until the background warm-up builds the replica.
+    GraphGuard::Lock GetOrBuildGraph() const;
+
+    /* Tiered compilation (see the ctor): a single fusion-free graph is compiled synchronously
+     * and serves the requests of all the streams until their optimized replicas, compiled by
+     * the background warm-up tasks, become ready. Kept allocated for the network lifetime since
+     * a request may reference it at any point (as the specialized shape clones are).
+     */
+    std::shared_ptr<GraphGuard>                 _tier0Graph;
+    mutable std::mutex                          _tierUpgradeMutex;
+    std::condition_variable                     _tierUpgradeDone;
+    std::atomic<int>                            _pendingTierUpgrades{0};
+
+    /* Speculative shape specialization: the observed input shape combinations are counted and
+     * fully static graph clones are compiled in the background for the hottest ones, since a
+     * static graph skips the generic dynamic-path overhead (runtime shape inference, dynamic
+     * memory descriptors). Returns a ready clone matching the given inputs with the guard
+     * locked, or nullptr when there is none (a background compilation may be kicked off).
+     */
+    Graph* TryGetSpecializedGraph(const InferenceEngine::BlobMap& inputs, std::unique_lock<std::mutex>& guard);
+
+    // speculative shape specialization data (see TryGetSpecializedGraph)
+    std::mutex                                  _specializationMutex;
+    std::unordered_map<std::string, size_t>     _shapeHistogram;
+    std::unordered_map<std::string, std::shared_ptr<GraphGuard>> _specializedGraphs;
+    std::vector<std::thread>                    _specializationThreads;
+
     bool canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const;
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 
+    // whether infer requests are wrapped into BatchSplitInferRequest, see the ctor
+    bool _batchSplittable = false;
+    bool isBatchSplittable(const std::shared_ptr<const ov::Model>& model) const;
+
     bool isLegacyAPI() const;
 
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cstdio>
 #include <string>
 #include <map>
 #include <vector>
@@ -10,6 +11,7 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <thread>
 #include <unordered_map>
 #include <memory>
 #include <utility>
@@ -22,6 +24,7 @@
 #include "memory_solver.hpp"
 #include "itt.h"
 #include "infer_request.h"
+#include "weights_prefetch.h"
 #include "nodes/input.h"
 #include <nodes/reorder.h>
 #include "nodes/convert.h"
@@ -30,6 +33,7 @@
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
 
@@ -41,6 +45,7 @@
 #include "utils/node_dumper.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
+#include "utils/execution_trace.h"
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
@@ -69,6 +74,9 @@ typedef std::vector<edge_cluster_t> edge_clusters_t;
 
 Graph::~Graph() {
     CPU_DEBUG_CAP_ENABLE(summary_perf(*this));
+    // refresh the on-demand dump with the runtime annotations accumulated over the lifetime of
+    // the graph (per-node average times require ov::enable_profiling)
+    serialize(*this);
 }
 
 template<typename NET>
@@ -84,7 +92,7 @@ void Graph::CreateGraph(NET &net, const GraphContext::CPtr ctx) {
 
     InitGraph();
 
-    CPU_DEBUG_CAP_ENABLE(serialize(*this));
+    serialize(*this);
 }
 
 void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
@@ -112,7 +120,7 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
 
     InitGraph();
 
-    CPU_DEBUG_CAP_ENABLE(serialize(*this));
+    serialize(*this);
 }
 
 template void Graph::CreateGraph(const std::shared_ptr<const ngraph::Function>&, const GraphContext::CPtr);
@@ -193,8 +201,8 @@ void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph) {
         graphNodes.push_back(outNode);
     }
 
-    if (getConfig().enforceBF16)
-        EnforceBF16();
+    if (getConfig().enforceBF16 || getConfig().enforceFP16)
+        EnforceInferencePrecision();
 }
 
 void Graph::Replicate(const CNNNetwork &network) {
@@ -309,8 +317,8 @@ void Graph::Replicate(const CNNNetwork &network) {
         graphNodes.push_back(outNode);
     }
 
-    if (getConfig().enforceBF16)
-        EnforceBF16();
+    if (getConfig().enforceBF16 || getConfig().enforceFP16)
+        EnforceInferencePrecision();
 
     auto hasSubgraphConsumers = [] (const NodePtr& node) -> bool {
         const auto & childEdges = node->getChildEdges();
@@ -369,8 +377,13 @@ void Graph::InitGraph() {
     SortTopologically();
     InitNodes();
 
-    optimizer.ApplyCommonGraphOptimizations(*this);
-    SortTopologically();
+    // a tier-0 bring-up graph trades runtime for compile time: the fusion passes are skipped
+    // both for their own cost and for the fused primitive descriptors they would create
+    // (see KEY_CPU_TIERED_COMPILATION)
+    if (!getConfig().tier0FastCompile) {
+        optimizer.ApplyCommonGraphOptimizations(*this);
+        SortTopologically();
+    }
 
     InitDescriptors();
 
@@ -378,8 +391,10 @@ void Graph::InitGraph() {
 
     InitEdges();
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
-    SortTopologically();
+    if (!getConfig().tier0FastCompile) {
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+        SortTopologically();
+    }
 
     bool haveDynNodes = false;
     for (size_t i = 0; i < graphNodes.size(); ++i) {
@@ -417,7 +432,17 @@ void Graph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    if (!haveDynNodes && getConfig().intraGraphParallelism > 0)
+        PrepareParallelExecution();
+
+    if (haveDynNodes)
+        ResolveShapeOnlyNodes();
+
     ExecuteConstantNodesOnly();
+
+    if (getConfig().weightsStreamingBudget > 0)
+        ResolveWeightsStreaming();
+
     status = haveDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -489,6 +514,208 @@ void Graph::ExtractConstantAndExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    // map each model output to the executable node which finalizes its memory, so that
+    // Infer() can report per-output readiness; walk up through nodes which are not
+    // executed at inference time (optimized-out ones) to reach the actual producer
+    outputProducersMap.clear();
+    std::unordered_set<Node*> executableSet;
+    executableSet.reserve(executableGraphNodes.size());
+    for (const auto& node : executableGraphNodes)
+        executableSet.insert(node.get());
+    for (const auto& outputMap : outputNodesMap) {
+        auto producer = outputMap.second;
+        while (producer && !executableSet.count(producer.get())) {
+            if (producer->getParentEdges().empty()) {
+                producer = nullptr;
+                break;
+            }
+            producer = producer->getParentEdgeAt(0)->getParent();
+        }
+        if (producer)
+            outputProducersMap[producer.get()].push_back(outputMap.first);
+    }
+}
+
+void Graph::PrepareParallelExecution() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::PrepareParallelExecution");
+
+    std::unordered_map<Node*, size_t> execNodeIndex;
+    for (size_t i = 0; i < executableGraphNodes.size(); ++i) {
+        execNodeIndex[executableGraphNodes[i].get()] = i;
+    }
+
+    parallelExecSuccessors.assign(executableGraphNodes.size(), {});
+    parallelExecInitialDeps.assign(executableGraphNodes.size(), 0);
+
+    for (size_t i = 0; i < executableGraphNodes.size(); ++i) {
+        std::unordered_set<size_t> successors;
+        // collect the nearest executable consumers, walking through nodes which are not executed
+        // at inference time (constants, optimized-out nodes) since they impose no runtime ordering
+        std::function<void(const NodePtr&)> collectSuccessors = [&](const NodePtr& producer) {
+            for (const auto& childEdge : producer->getChildEdges()) {
+                const auto edge = childEdge.lock();
+                if (!edge)
+                    continue;
+                const auto child = edge->getChild();
+                const auto itr = execNodeIndex.find(child.get());
+                if (itr != execNodeIndex.end()) {
+                    if (itr->second != i)
+                        successors.insert(itr->second);
+                } else {
+                    collectSuccessors(child);
+                }
+            }
+        };
+        collectSuccessors(executableGraphNodes[i]);
+
+        parallelExecSuccessors[i].assign(successors.begin(), successors.end());
+        for (const auto succ : parallelExecSuccessors[i]) {
+            parallelExecInitialDeps[succ]++;
+        }
+    }
+}
+
+void Graph::ResolveShapeOnlyNodes() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ResolveShapeOnlyNodes");
+
+    // The output values of a ShapeOf node are a pure function of the graph input shapes, and so
+    // are the outputs of any node fed exclusively by such nodes and constants. Stateful nodes and
+    // nodes with an inner graph are excluded since their execution is observable beyond the outputs.
+    std::unordered_set<Node*> shapeOnlyNodes;
+    for (const auto& node : graphNodes) {
+        if (node->getType() == Type::ShapeOf) {
+            shapeOnlyNodes.insert(node.get());
+            continue;
+        }
+        if (one_of(node->getType(), Type::Input, Type::Output, Type::MemoryInput, Type::MemoryOutput,
+                   Type::TensorIterator, Type::If, Type::Generic))
+            continue;
+        if (node->getParentEdges().empty())
+            continue;
+        bool shapeDerivedOnly = true;
+        for (size_t i = 0; i < node->getParentEdges().size(); ++i) {
+            const auto parent = node->getParentEdgeAt(i)->getParent();
+            if (!shapeOnlyNodes.count(parent.get()) && !parent->isConstant()) {
+                shapeDerivedOnly = false;
+                break;
+            }
+        }
+        if (shapeDerivedOnly)
+            shapeOnlyNodes.insert(node.get());
+    }
+
+    shapeOnlyNodeFlags.assign(executableGraphNodes.size(), false);
+    size_t flaggedCount = 0;
+    for (size_t i = 0; i < executableGraphNodes.size(); ++i) {
+        if (shapeOnlyNodes.count(executableGraphNodes[i].get())) {
+            shapeOnlyNodeFlags[i] = true;
+            flaggedCount++;
+        }
+    }
+    if (flaggedCount == 0)
+        shapeOnlyNodeFlags.clear();
+    DEBUG_LOG("Graph ", _name, " has ", flaggedCount, " shape calculation nodes eligible for memoization");
+}
+
+void Graph::ResolveWeightsStreaming() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ResolveWeightsStreaming");
+
+    // Only sufficiently large constant inputs are worth streaming: the advice granularity is a
+    // page and the small tensors come essentially for free with the large ones of the same node
+    constexpr size_t minStreamedRegionSize = 1ul << 21;
+
+    // the intra-graph parallel mode executes the nodes out of order, so a walk along the
+    // execution order cannot run ahead of it
+    if (getConfig().intraGraphParallelism > 0 && !parallelExecSuccessors.empty())
+        return;
+
+    std::vector<std::vector<WeightsPrefetcher::Region>> regions(executableGraphNodes.size());
+    size_t totalBytes = 0;
+    for (size_t i = 0; i < executableGraphNodes.size(); ++i) {
+        const auto& node = executableGraphNodes[i];
+        for (size_t p = 0; p < node->getParentEdges().size(); ++p) {
+            const auto edge = node->getParentEdgeAt(p);
+            const auto parent = edge->getParent();
+            if (!parent->isConstant())
+                continue;
+            const auto& memory = edge->getMemory();
+            const auto* data = memory.GetPtr();
+            const auto size = memory.GetSize();
+            if (!data || size < minStreamedRegionSize)
+                continue;
+            regions[i].push_back({data, size});
+            totalBytes += size;
+        }
+    }
+
+    // when the whole model fits into the working set there is nothing to stream and the
+    // prefetch thread would only burn a core
+    if (totalBytes <= getConfig().weightsStreamingBudget)
+        return;
+
+    DEBUG_LOG("Graph ", _name, " streams ", totalBytes, " bytes of weights through a ",
+              getConfig().weightsStreamingBudget, " bytes working set");
+    weightsPrefetcher.reset(new WeightsPrefetcher(std::move(regions), getConfig().weightsStreamingBudget));
+}
+
+std::string Graph::MakeInputShapesSignature() const {
+    // a plain string key is fine here: the lookup happens once per infer request and the
+    // number of inputs is small
+    std::string signature;
+    for (const auto& input : inputNodesMap) {
+        signature += input.first;
+        signature += '(';
+        for (const auto dim : input.second->getChildEdgeAt(0)->getMemory().getStaticDims()) {
+            signature += std::to_string(dim);
+            signature += ',';
+        }
+        signature += ')';
+    }
+    return signature;
+}
+
+bool Graph::RestoreShapeOnlyNodeOutputs(const ShapeSubgraphOutputs& entry, size_t execIndex) const {
+    const auto itr = entry.find(execIndex);
+    if (itr == entry.end())
+        return false;
+
+    const auto& node = executableGraphNodes[execIndex];
+    const auto& outputs = itr->second;
+    // also covers the nodes with internal dynamism, where the actual output shapes are normally
+    // defined by the execution itself
+    node->redefineOutputMemory(outputs.dims);
+    for (size_t port = 0; port < outputs.data.size(); ++port) {
+        const auto& memory = node->getChildEdgesAtPort(port)[0]->getMemory();
+        if (memory.GetSize() != outputs.data[port].size())
+            return false;  // never expected, fall back to the regular execution
+        cpu_memcpy(memory.GetPtr(), outputs.data[port].data(), outputs.data[port].size());
+    }
+    node->updateLastInputDims();
+    DEBUG_LOG("restored the outputs of #", node->getExecIndex(), " ", node->getName(),
+              " from the shape subgraph cache");
+    return true;
+}
+
+void Graph::HarvestShapeOnlyNodeOutputs(ShapeSubgraphOutputs& entry, size_t execIndex) const {
+    // only tiny results (shape vectors and alike) are worth the copies; the nodes above the limit
+    // are simply re-executed on a cache hit, which is still correct since the whole subgraph is a
+    // pure function of the input shapes
+    constexpr size_t maxCachedBytesPerNode = 4096;
+
+    const auto& node = executableGraphNodes[execIndex];
+    ShapeOnlyNodeOutputs outputs;
+    size_t totalSize = 0;
+    for (size_t port = 0; port < node->outputShapes.size(); ++port) {
+        const auto& memory = node->getChildEdgesAtPort(port)[0]->getMemory();
+        totalSize += memory.GetSize();
+        if (totalSize > maxCachedBytesPerNode)
+            return;
+        const auto* data = reinterpret_cast<const uint8_t*>(memory.GetPtr());
+        outputs.dims.push_back(memory.getStaticDims());
+        outputs.data.emplace_back(data, data + memory.GetSize());
+    }
+    entry.emplace(execIndex, std::move(outputs));
 }
 
 void Graph::ExecuteConstantNodesOnly() const {
@@ -506,7 +733,7 @@ void Graph::ExecuteConstantNodesOnly() const {
             auto edgePtr = node->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = context->getWeightsCache()->get(edgePtr->name());
+                    auto ptr = context->getWeightsCache()->get(context->getWeightsCacheScope() + edgePtr->name());
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -689,7 +916,7 @@ void Graph::AllocateWithReuse() {
                     auto constNode = std::static_pointer_cast<node::Input>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<Memory>(constNode->getMemoryPtr()));
                 } else {
-                    edge->externalAllocate(context->getWeightsCache());
+                    edge->externalAllocate(context->getWeightsCache(), context->getWeightsCacheScope());
                 }
                 erase = true;
             }
@@ -761,12 +988,18 @@ void Graph::AllocateWithReuse() {
 
     memWorkspace = std::make_shared<Memory>(getEngine());
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    allocatedMemSize += total_size;
 
     if (edge_clusters.empty())
         return;
 
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
+    // The memory solver derives buffer lifetimes from the sequential execution order, which does
+    // not hold when independent nodes run concurrently, so the parallel mode allocates each edge
+    // individually.
+    const bool individualAllocation = getConfig().intraGraphParallelism > 0;
+
     for (auto& box : definedBoxes) {
         int count = 0;
         for (auto& edge : edge_clusters[box.id]) {
@@ -774,7 +1007,12 @@ void Graph::AllocateWithReuse() {
                 int64_t offset = staticMemSolver.getOffset(box.id);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                if (individualAllocation) {
+                    edge->allocate();
+                    allocatedMemSize += edge->getDesc().getMaxMemSize();
+                }
+                else
+                    edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
 
                 // TODO: WA for some test (like strided_slice_test) which use tensors with
                 //       shapes {0}. And it is implisitly converted into {1} tensor.
@@ -872,6 +1110,11 @@ void Graph::Allocate() {
     for (auto& edge : graphEdges) edge->validate();
 }
 
+size_t Graph::GetAllocatedMemory() const {
+    auto scratchPad = context ? context->getScratchPad() : nullptr;
+    return allocatedMemSize + (scratchPad ? scratchPad->allocatedSize() : 0);
+}
+
 void Graph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::CreatePrimitives");
     for (auto& node : graphNodes) {
@@ -901,7 +1144,10 @@ void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = childEdge->getMemory().GetData();
 
-        if (ext_data_ptr != inter_data_ptr) {
+        // compare the first element rather than the buffer start, so a blob view wrapped
+        // in place with a nonzero offset (see InferRequest::SetBlob) is not pushed onto itself
+        const auto extViewOffset = inTensorDesc.getBlockingDesc().getOffsetPadding() * in->element_size();
+        if (static_cast<const uint8_t*>(ext_data_ptr) + extViewOffset != inter_data_ptr) {
             auto ext_tdesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(in->getTensorDesc());
 
             Memory ext_mem(getEngine());
@@ -936,119 +1182,219 @@ void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::
     }
 }
 
-void Graph::PullOutputData(BlobMap &out) {
+void Graph::PullOutput(const std::string& name, const NodePtr& node, const InferenceEngine::Blob::Ptr& ext_blob) {
+    auto parentEdge = node->getParentEdgeAt(0);
+    const Memory& intr_blob = parentEdge->getMemory();
+
+    const auto actualDesc = MemoryDescUtils::convertToTensorDesc(intr_blob.getDesc());
+    auto &expectedDesc = ext_blob->getTensorDesc();
+
+    // TODO [NM]: need to create universal reorder which will be detect cases when we really need to use it
+    // WA: for cases when output shape after transformation will be 1x1x1x1 but model output is scalar
+    bool isScalarOutput = false;
+    if (actualDesc.getLayout() == SCALAR) {
+        isScalarOutput = expectedDesc.getLayout() == SCALAR ||
+                         (!expectedDesc.getDims().empty() &&
+                         std::accumulate(expectedDesc.getDims().begin(), expectedDesc.getDims().end(), (size_t)1, std::multiplies<size_t>()) == 1);
+    } else if (expectedDesc.getLayout() == SCALAR) {
+        isScalarOutput = actualDesc.getLayout() == SCALAR ||
+                         (!actualDesc.getDims().empty() &&
+                         std::accumulate(actualDesc.getDims().begin(), actualDesc.getDims().end(), (size_t)1, std::multiplies<size_t>()) == 1);
+    }
+
+    auto outDims = intr_blob.getStaticDims();
+    if (ext_blob->getTensorDesc().getDims() != outDims && !isScalarOutput) {
+        // WA: because input/output info initially contains non empty dims, order etc.
+        // and setDims (called inside setShape) can't correct modify blocked desc for desc with blocked layout
+        if (expectedDesc.getLayout() == InferenceEngine::Layout::BLOCKED) {
+            expectedDesc = TensorDesc(expectedDesc.getPrecision(), expectedDesc.getLayout());
+        }
+        if (getConfig().isNewApi && getConfig().batchLimit > 0) {
+            outDims[0] = node->batchToProcess();
+        }
+        ext_blob->setShape(outDims);
+    }
+
+    // check for empty output blob
+    if (std::any_of(outDims.begin(), outDims.end(), [](const Dim dim) {return dim == 0;})) {
+        return;
+    }
+
+    auto srcPrec = actualDesc.getPrecision();
+    auto dstPrec = expectedDesc.getPrecision();
+
+    if ((getConfig().isNewApi && !getConfig().batchLimit) && srcPrec == dstPrec && ext_blob->byteSize() != intr_blob.GetSize())
+            IE_THROW() << "Output blob byte size is not equal network output byte size ("
+                               << ext_blob->byteSize() << "!=" << intr_blob.GetSize() << ").";
+
+    void *ext_blob_ptr = ext_blob->buffer();
+    void *intr_blob_ptr = intr_blob.GetData();
+
+    // That is the same memory. No need to copy. The external offset is nonzero when a blob
+    // view was wrapped in place by SetBlob, in which case the graph wrote there directly.
+    const auto extViewOffset = expectedDesc.getLayout() != InferenceEngine::Layout::ANY
+                                   ? expectedDesc.getBlockingDesc().getOffsetPadding() * ext_blob->element_size()
+                                   : 0;
+    if (static_cast<uint8_t*>(ext_blob_ptr) + extViewOffset == intr_blob_ptr) return;
+
+    if (actualDesc.getBlockingDesc() != expectedDesc.getBlockingDesc() && !isScalarOutput) {
+        // User can initialize output via SetOutput API using tensorDesc with ANY layout.
+        // For these cases we create planar memory descriptor.
+        auto outBlobDesc = expectedDesc.getLayout() == InferenceEngine::Layout::ANY
+                            ? DnnlBlockedMemoryDesc(expectedDesc.getPrecision(), Shape(expectedDesc.getDims()))
+                            : MemoryDescUtils::convertToDnnlBlockedMemoryDesc(expectedDesc);
+        Memory outBloMem(getEngine());
+        outBloMem.Create(outBlobDesc, ext_blob_ptr, false);
+
+        // branch for handling dynamic batch feature in new API
+        if (getConfig().isNewApi && getConfig().batchLimit > 0 && outBloMem.getStaticDims()[0] != intr_blob.getStaticDims()[0]) {
+            auto newDims = intr_blob.getStaticDims();
+            newDims[0] = outBloMem.getStaticDims()[0];
+
+            Memory tmpMem(getEngine());
+            auto newDesc = intr_blob.getDesc().cloneWithNewDims(newDims, true);
+            tmpMem.Create(newDesc, intr_blob.GetData(), false);
+
+            outBloMem.SetData(tmpMem, false);
+        } else {
+            outBloMem.SetData(intr_blob, false);
+        }
+    } else {
+        size_t size_to_copy = intr_blob.GetDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
+        // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
+        // TODO [DS]: phase 2: should we support this behaviour? Looks obsolete in the dynamic shapes paradigm
+        if (getConfig().batchLimit) {
+            if (node->isDynamicNode() && !getConfig().isNewApi) {
+                IE_THROW(NotImplemented) << "[DS] not implemented dynamic batch for node with dynamic shape";
+            }
+            int MB_to_process = node->batchToProcess();
+            size_to_copy = std::accumulate(outDims.begin() + 1, outDims.end(), (size_t)1, std::multiplies<size_t>()) * MB_to_process;
+        }
+
+        cpu_convert(intr_blob_ptr, ext_blob_ptr, srcPrec, dstPrec, size_to_copy);
+    }
+}
+
+void Graph::PullOutputData(BlobMap &out, const std::unordered_set<std::string> &skip) {
     if (!IsReady())
         IE_THROW() << "Wrong state. Topology not ready.";
 
     for (auto &outputMap : outputNodesMap) {
         auto name = outputMap.first;
         auto node = outputMap.second;
-        auto parentEdge = node->getParentEdgeAt(0);
-        const Memory& intr_blob = parentEdge->getMemory();
+
+        if (skip.count(name))
+            continue;
 
         const auto ext_blob_map = out.find(name);
-        const auto ext_blob = ext_blob_map->second;
         if (ext_blob_map == out.end()) {
             IE_THROW(Unexpected) << "The CPU plugin graph doesn't contain output node with name: \"" << name << "\"";
         }
 
-        const auto actualDesc = MemoryDescUtils::convertToTensorDesc(intr_blob.getDesc());
-        auto &expectedDesc = ext_blob->getTensorDesc();
-
-        // TODO [NM]: need to create universal reorder which will be detect cases when we really need to use it
-        // WA: for cases when output shape after transformation will be 1x1x1x1 but model output is scalar
-        bool isScalarOutput = false;
-        if (actualDesc.getLayout() == SCALAR) {
-            isScalarOutput = expectedDesc.getLayout() == SCALAR ||
-                             (!expectedDesc.getDims().empty() &&
-                             std::accumulate(expectedDesc.getDims().begin(), expectedDesc.getDims().end(), (size_t)1, std::multiplies<size_t>()) == 1);
-        } else if (expectedDesc.getLayout() == SCALAR) {
-            isScalarOutput = actualDesc.getLayout() == SCALAR ||
-                             (!actualDesc.getDims().empty() &&
-                             std::accumulate(actualDesc.getDims().begin(), actualDesc.getDims().end(), (size_t)1, std::multiplies<size_t>()) == 1);
-        }
-
-        auto outDims = intr_blob.getStaticDims();
-        if (out[name]->getTensorDesc().getDims() != outDims && !isScalarOutput) {
-            // WA: because input/output info initially contains non empty dims, order etc.
-            // and setDims (called inside setShape) can't correct modify blocked desc for desc with blocked layout
-            if (expectedDesc.getLayout() == InferenceEngine::Layout::BLOCKED) {
-                expectedDesc = TensorDesc(expectedDesc.getPrecision(), expectedDesc.getLayout());
-            }
-            if (getConfig().isNewApi && getConfig().batchLimit > 0) {
-                outDims[0] = node->batchToProcess();
-            }
-            out[name]->setShape(outDims);
-        }
+        PullOutput(name, node, ext_blob_map->second);
+    }
+}
 
-        // check for empty output blob
-        if (std::any_of(outDims.begin(), outDims.end(), [](const Dim dim) {return dim == 0;})) {
-            continue;
-        }
+void Graph::PullOutputData(const std::string& name, const InferenceEngine::Blob::Ptr &out) {
+    if (!IsReady())
+        IE_THROW() << "Wrong state. Topology not ready.";
 
-        auto srcPrec = actualDesc.getPrecision();
-        auto dstPrec = expectedDesc.getPrecision();
+    PullOutput(name, getOutputNodeByName(name), out);
+}
 
-        if ((getConfig().isNewApi && !getConfig().batchLimit) && srcPrec == dstPrec && ext_blob->byteSize() != intr_blob.GetSize())
-                IE_THROW() << "Output blob byte size is not equal network output byte size ("
-                                   << ext_blob->byteSize() << "!=" << intr_blob.GetSize() << ").";
+void Graph::InferStatic(InferRequestBase* request) {
+    dnnl::stream stream(getEngine());
 
-        void *ext_blob_ptr = ext_blob->buffer();
-        void *intr_blob_ptr = intr_blob.GetData();
+    for (size_t execIndex = 0; execIndex < executableGraphNodes.size(); ++execIndex) {
+        const auto& node = executableGraphNodes[execIndex];
+        VERBOSE(node, getConfig().debugCaps.verbose);
+        PERF(node, getConfig().collectPerfCounters, getConfig().collectPmuCounters);
 
-        // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+        if (request)
+            request->ThrowIfCanceled();
+        MaybeYieldToHighPriorityTask();
+        if (weightsPrefetcher)
+            weightsPrefetcher->advance(execIndex);
+        ExecuteNode(node, stream);
+        NotifyOutputsReady(node);
+    }
+}
 
-        if (actualDesc.getBlockingDesc() != expectedDesc.getBlockingDesc() && !isScalarOutput) {
-            // User can initialize output via SetOutput API using tensorDesc with ANY layout.
-            // For these cases we create planar memory descriptor.
-            auto outBlobDesc = expectedDesc.getLayout() == InferenceEngine::Layout::ANY
-                                ? DnnlBlockedMemoryDesc(expectedDesc.getPrecision(), Shape(expectedDesc.getDims()))
-                                : MemoryDescUtils::convertToDnnlBlockedMemoryDesc(expectedDesc);
-            Memory outBloMem(getEngine());
-            outBloMem.Create(outBlobDesc, ext_blob_ptr, false);
+void Graph::MaybeYieldToHighPriorityTask() const {
+    // cooperative preemption point: between two nodes a non-high-priority inference lends its
+    // stream thread to a waiting high priority request, so interactive traffic takes over
+    // mid-graph instead of queueing behind a long batch inference
+    if (getConfig().modelPriority == ov::hint::Priority::HIGH)
+        return;
+    const auto& executor = context->getStreamsExecutor();
+    if (!executor || !executor->HasHighPriorityTasksPending())
+        return;
+    // tasks of the own network are skipped inside - this very graph is busy right here;
+    // a picked up high priority inference never yields itself, so the nesting depth is bounded
+    while (executor->RunHighPriorityTask(context->getPreemptionDomain()) &&
+           executor->HasHighPriorityTasksPending()) {
+    }
+}
 
-            // branch for handling dynamic batch feature in new API
-            if (getConfig().isNewApi && getConfig().batchLimit > 0 && outBloMem.getStaticDims()[0] != intr_blob.getStaticDims()[0]) {
-                auto newDims = intr_blob.getStaticDims();
-                newDims[0] = outBloMem.getStaticDims()[0];
+void Graph::InferStaticParallel(InferRequestBase* request) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    dnnl::stream stream(getEngine());
 
-                Memory tmpMem(getEngine());
-                auto newDesc = intr_blob.getDesc().cloneWithNewDims(newDims, true);
-                tmpMem.Create(newDesc, intr_blob.GetData(), false);
+    std::vector<std::atomic<int>> depCount(parallelExecInitialDeps.size());
+    for (size_t i = 0; i < parallelExecInitialDeps.size(); ++i) {
+        depCount[i].store(parallelExecInitialDeps[i], std::memory_order_relaxed);
+    }
 
-                outBloMem.SetData(tmpMem, false);
-            } else {
-                outBloMem.SetData(intr_blob, false);
+    std::atomic<bool> stopped(false);
+    std::exception_ptr execException;
+    std::mutex exceptionMutex;
+
+    tbb::task_arena arena(std::min(getConfig().intraGraphParallelism, parallel_get_max_threads()));
+    arena.execute([&] {
+        tbb::task_group tg;
+        std::function<void(size_t)> runNode = [&](size_t indx) {
+            if (!stopped.load(std::memory_order_relaxed)) {
+                try {
+                    if (request)
+                        request->ThrowIfCanceled();
+
+                    const auto& node = executableGraphNodes[indx];
+                    VERBOSE(node, getConfig().debugCaps.verbose);
+                    PERF(node, getConfig().collectPerfCounters, getConfig().collectPmuCounters);
+                    ExecuteNode(node, stream);
+                    NotifyOutputsReady(node);
+                } catch (...) {
+                    std::lock_guard<std::mutex> guard(exceptionMutex);
+                    if (!execException)
+                        execException = std::current_exception();
+                    stopped.store(true, std::memory_order_relaxed);
+                }
             }
-        } else {
-            size_t size_to_copy = intr_blob.GetDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
-            // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
-            // TODO [DS]: phase 2: should we support this behaviour? Looks obsolete in the dynamic shapes paradigm
-            if (getConfig().batchLimit) {
-                if (node->isDynamicNode() && !getConfig().isNewApi) {
-                    IE_THROW(NotImplemented) << "[DS] not implemented dynamic batch for node with dynamic shape";
+            // release the successors even when stopped so every scheduled task terminates
+            for (const auto succ : parallelExecSuccessors[indx]) {
+                if (--depCount[succ] == 0) {
+                    tg.run([&runNode, succ] {
+                        runNode(succ);
+                    });
                 }
-                int MB_to_process = node->batchToProcess();
-                size_to_copy = std::accumulate(outDims.begin() + 1, outDims.end(), (size_t)1, std::multiplies<size_t>()) * MB_to_process;
             }
+        };
 
-            cpu_convert(intr_blob_ptr, ext_blob_ptr, srcPrec, dstPrec, size_to_copy);
+        for (size_t i = 0; i < parallelExecInitialDeps.size(); ++i) {
+            if (parallelExecInitialDeps[i] == 0) {
+                tg.run([&runNode, i] {
+                    runNode(i);
+                });
+            }
         }
-    }
-}
-
-void Graph::InferStatic(InferRequestBase* request) {
-    dnnl::stream stream(getEngine());
-
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, getConfig().debugCaps.verbose);
-        PERF(node, getConfig().collectPerfCounters);
+        tg.wait();
+    });
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
-    }
+    if (execException)
+        std::rethrow_exception(execException);
+#else
+    InferStatic(request);
+#endif
 }
 
 void Graph::InferDynamic(InferRequestBase* request) {
@@ -1063,6 +1409,40 @@ void Graph::InferDynamic(InferRequestBase* request) {
     }
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
+    // shape calculation subgraphs are memoized across infer requests: on a repeated combination
+    // of the input shapes the cached outputs are restored instead of executing the producers
+    const ShapeSubgraphOutputs* shapeCacheHit = nullptr;
+    ShapeSubgraphOutputs harvestedShapeOutputs;
+    bool harvestShapeOutputs = false;
+    std::string shapeSignature;
+    if (!shapeOnlyNodeFlags.empty()) {
+        // the entries are tiny, but still bound the cache to not grow unattended on
+        // shape-diverse workloads
+        constexpr size_t shapeSubgraphCacheCapacity = 256;
+        shapeSignature = MakeInputShapesSignature();
+        const auto itr = shapeSubgraphCache.find(shapeSignature);
+        if (itr != shapeSubgraphCache.end()) {
+            shapeCacheHit = &itr->second;
+        } else {
+            harvestShapeOutputs = shapeSubgraphCache.size() < shapeSubgraphCacheCapacity;
+        }
+    }
+
+    // On a memoized signature the whole shape calculation subgraph is hoisted out of the
+    // pipeline: the cached outputs are restored in one pass right on the submitting stream
+    // thread, and the restored nodes are dropped from both the preparation lanes and the
+    // execution loop below, so they no longer pay node dispatch or shape inference
+    std::vector<bool> restoredShapeNodes;
+    if (shapeCacheHit) {
+        restoredShapeNodes.assign(executableGraphNodes.size(), false);
+        // ascending execution order matters here: a restored node may share its output memory
+        // in-place with a restored producer
+        for (size_t i = 0; i < executableGraphNodes.size(); ++i) {
+            if (shapeOnlyNodeFlags[i])
+                restoredShapeNodes[i] = RestoreShapeOnlyNodeOutputs(*shapeCacheHit, i);
+        }
+    }
+
     std::function<void(size_t)> updateNodes;
 
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -1074,17 +1454,44 @@ void Graph::InferDynamic(InferRequestBase* request) {
     }
 
     tbb::task_group tg;
+    // Primitive preparation is overlapped with execution: the executing thread waits for the
+    // shape lane of a section (shape updates resize the shared intermediate buffers), but
+    // consumes prepared primitives node by node, so the expensive oneDNN primitive creation of
+    // the tail of a section is hidden behind the execution of its head.
+    std::atomic<size_t> shapesReadyCounter(0);
+    std::atomic<size_t> paramsReadyCounter(0);
+    std::atomic<bool> updateFailed(false);
+    std::exception_ptr updateException;
+    std::mutex updateExceptionMutex;
     std::function<void(size_t, size_t)> updateShapes;
     std::function<void(size_t, size_t)> updateDynParams;
 
+    auto reportUpdateError = [&](size_t stop_indx) {
+        {
+            std::lock_guard<std::mutex> lock(updateExceptionMutex);
+            if (!updateException)
+                updateException = std::current_exception();
+        }
+        updateFailed.store(true);
+        // unblock the executing thread; the stored exception is rethrown there
+        shapesReadyCounter.store(stop_indx);
+        paramsReadyCounter.store(stop_indx);
+    };
+
     updateShapes = [&](size_t node_indx, size_t stop_indx) {
         const auto& node = executableGraphNodes[node_indx];
         prepareCounter.store(node_indx);
         if (node_indx >= stop_indx) {
+            shapesReadyCounter.store(node_indx);
             return;
         }
-        if (node->isDynamicNode()) {
-            node->updateShapes();
+        try {
+            if (node->isDynamicNode() && (restoredShapeNodes.empty() || !restoredShapeNodes[node_indx])) {
+                node->updateShapes();
+            }
+        } catch (...) {
+            reportUpdateError(stop_indx);
+            return;
         }
         if (--waveFrontCount[node_indx] == 0) {
             tg.run([=, &updateDynParams](){ updateDynParams(node_indx, stop_indx); });
@@ -1098,9 +1505,15 @@ void Graph::InferDynamic(InferRequestBase* request) {
             prepareCounter.store(node_indx);
             return;
         }
-        if (node->isDynamicNode()) {
-            node->updateDynamicParams();
+        try {
+            if (node->isDynamicNode() && (restoredShapeNodes.empty() || !restoredShapeNodes[node_indx])) {
+                node->updateDynamicParams();
+            }
+        } catch (...) {
+            reportUpdateError(stop_indx);
+            return;
         }
+        paramsReadyCounter.store(node_indx + 1);
         if (node_indx + 1 < waveFrontCount.size() && --waveFrontCount[node_indx + 1] == 0) {
             tg.run([=, &updateDynParams](){ updateDynParams(node_indx + 1, stop_indx); });
         }
@@ -1109,14 +1522,16 @@ void Graph::InferDynamic(InferRequestBase* request) {
     updateNodes = [&](size_t stopIndx) {
         auto startCounter = prepareCounter.load();
         tg.run([=, &updateShapes](){ updateShapes(startCounter, stopIndx); });
-        tg.wait();
+        // only the shape lane is a barrier; prepared primitives are consumed below
+        while (shapesReadyCounter.load() < stopIndx && !updateFailed.load())
+            std::this_thread::yield();
     };
 #else
     size_t prepareCounter = 0;
     updateNodes = [&](size_t stopIndx) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = executableGraphNodes[prepareCounter];
-            if (node->isDynamicNode()) {
+            if (node->isDynamicNode() && (restoredShapeNodes.empty() || !restoredShapeNodes[prepareCounter])) {
                 node->updateShapes();
                 node->updateDynamicParams();
             }
@@ -1125,18 +1540,54 @@ void Graph::InferDynamic(InferRequestBase* request) {
 #endif
     size_t inferCounter = 0;
 
-    for (auto stopIndx : syncIndsWorkSet) {
-        updateNodes(stopIndx);
-        for (; inferCounter < stopIndx; ++inferCounter) {
-            auto& node = executableGraphNodes[inferCounter];
-            VERBOSE(node, getConfig().debugCaps.verbose);
-            PERF(node, getConfig().collectPerfCounters);
-
-            if (request)
-                request->ThrowIfCanceled();
-            ExecuteNode(node, stream);
+    auto executeSections = [&]() {
+        for (auto stopIndx : syncIndsWorkSet) {
+            updateNodes(stopIndx);
+            for (; inferCounter < stopIndx; ++inferCounter) {
+                auto& node = executableGraphNodes[inferCounter];
+                VERBOSE(node, getConfig().debugCaps.verbose);
+                PERF(node, getConfig().collectPerfCounters, getConfig().collectPmuCounters);
+
+                if (request)
+                    request->ThrowIfCanceled();
+                MaybeYieldToHighPriorityTask();
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+                while (paramsReadyCounter.load() < inferCounter + 1 && !updateFailed.load())
+                    std::this_thread::yield();
+                if (updateFailed.load())
+                    std::rethrow_exception(updateException);
+                // the scratchpad may still grow while primitives of the section tail are
+                // prepared, so execution of each node is serialized against such a growth
+                std::lock_guard<std::mutex> execLock(context->getScratchPad()->executionGuard());
+#endif
+                if (weightsPrefetcher)
+                    weightsPrefetcher->advance(inferCounter);
+                const bool restored = !restoredShapeNodes.empty() && restoredShapeNodes[inferCounter];
+                if (!restored) {
+                    ExecuteNode(node, stream);
+                    if (harvestShapeOutputs && shapeOnlyNodeFlags[inferCounter])
+                        HarvestShapeOnlyNodeOutputs(harvestedShapeOutputs, inferCounter);
+                }
+                NotifyOutputsReady(node);
+            }
         }
+    };
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // the preparation lanes may still have tasks in flight - always collect them before leaving
+    try {
+        executeSections();
+    } catch (...) {
+        tg.wait();
+        throw;
     }
+    tg.wait();
+#else
+    executeSections();
+#endif
+
+    if (harvestShapeOutputs && !harvestedShapeOutputs.empty())
+        shapeSubgraphCache.emplace(std::move(shapeSignature), std::move(harvestedShapeOutputs));
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -1144,7 +1595,18 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
 
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, node->profiling.execute);
 
-    if (node->isDynamicNode()) {
+    if (!getConfig().executionTracePath.empty()) {
+        // mirror the ITT region above into the built-in trace collector, which merges the
+        // timelines of all streams into one Chrome trace file, see utils/execution_trace.h
+        const auto begin = std::chrono::high_resolution_clock::now();
+        if (node->isDynamicNode()) {
+            node->executeDynamic(stream);
+        } else {
+            node->execute(stream);
+        }
+        ExecutionTrace::get().record(node->getName(), node->getTypeStr(),
+                                     begin, std::chrono::high_resolution_clock::now());
+    } else if (node->isDynamicNode()) {
         node->executeDynamic(stream);
     } else {
         node->execute(stream);
@@ -1152,19 +1614,42 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     DEBUG_LOG(*node);
 }
 
+inline void Graph::NotifyOutputsReady(const NodePtr& node) const {
+    if (!outputReadyCallback)
+        return;
+    const auto itr = outputProducersMap.find(node.get());
+    if (itr == outputProducersMap.end())
+        return;
+    for (const auto& name : itr->second)
+        outputReadyCallback(name);
+}
+
 void Graph::Infer(InferRequestBase* request) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
+    if (weightsPrefetcher)
+        weightsPrefetcher->startPass();
+
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        if (getConfig().intraGraphParallelism > 0 && !parallelExecSuccessors.empty()) {
+            InferStaticParallel(request);
+        } else {
+            InferStatic(request);
+        }
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
 
+    if (weightsPrefetcher)
+        weightsPrefetcher->endPass();
+
+    if (!getConfig().executionTracePath.empty())
+        ExecutionTrace::get().flush();
+
     if (infer_count != -1) infer_count++;
 }
 
@@ -1265,6 +1750,20 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
+        const auto& counter = node->PerfCounter();
+        if (counter.pmu_count() > 0 && counter.cycles() > 0) {
+            // InferenceEngineProfileInfo is a fixed ABI struct, so the PMU derived metrics are
+            // reported as a suffix of the free-form exec_type field. The DRAM bandwidth is
+            // estimated from the LLC miss count assuming a 64 byte cache line.
+            const double ipc = static_cast<double>(counter.instructions()) / counter.cycles();
+            const double llcMissRate = counter.llc_references() > 0
+                    ? static_cast<double>(counter.llc_misses()) / counter.llc_references() : 0.0;
+            const uint64_t total_uSec = static_cast<uint64_t>(counter.avg()) * counter.count();
+            const double dramGBps = total_uSec > 0 ? counter.llc_misses() * 64.0 / (total_uSec * 1e3) : 0.0;
+            char pmuStr[64];
+            snprintf(pmuStr, sizeof(pmuStr), ";ipc=%.2f;llc_miss=%.3f;dram_gbps=%.2f", ipc, llcMissRate, dramGBps);
+            pdType += pmuStr;
+        }
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
         size_t layerTypeLen = sizeof(pc.layer_type) / sizeof(pc.layer_type[0]);
@@ -1283,6 +1782,7 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
         if (graphNodes[i]->isConstant())
             continue;
         getPerfMapFor(perfMap, graphNodes[i]);
+        graphNodes[i]->appendSubGraphPerfData(perfMap);
     }
 }
 
@@ -1497,11 +1997,190 @@ bool Graph::InsertNode(NodePtr parent, NodePtr child, NodePtr node, int parentPo
     return true;
 }
 
-// Set all non const data paths precision to BF16
-void Graph::EnforceBF16() {
+bool Graph::ReplaceSubgraph(const std::vector<NodePtr>& region, const NodePtr& replacement) {
+    if (status != Status::ReadyStatic)
+        return false;
+    // the parallel execution structures are built for the whole graph, localized updates are not supported
+    if (getConfig().intraGraphParallelism > 0)
+        return false;
+    if (region.empty() || !replacement || replacement->isConstant() || replacement->isDynamicNode())
+        return false;
+
+    std::unordered_set<Node*> regionSet;
+    for (const auto& node : region) {
+        if (graphNodes.end() == std::find(graphNodes.begin(), graphNodes.end(), node))
+            return false;
+        regionSet.insert(node.get());
+    }
+    // the model inputs and outputs are exposed by name and must keep their nodes
+    for (const auto& entry : inputNodesMap) {
+        if (regionSet.count(entry.second.get()))
+            return false;
+    }
+    for (const auto& entry : outputNodesMap) {
+        if (regionSet.count(entry.second.get()))
+            return false;
+    }
+
+    // Collect the boundary in the execution order of the region: the external input edges map to
+    // the replacement input ports and the distinct region output ports map to the replacement
+    // output ports, both in the order of encounter.
+    std::vector<EdgePtr> inputBoundary;
+    std::vector<EdgePtr> outputBoundary;
+    std::map<std::pair<Node*, int>, int> outputPortMap;
+    for (const auto& node : graphNodes) {
+        if (!regionSet.count(node.get()))
+            continue;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            if (!regionSet.count(edge->getParent().get()))
+                inputBoundary.push_back(edge);
+        }
+        for (const auto& childEdge : node->childEdges) {
+            auto edge = childEdge.lock();
+            if (!edge || regionSet.count(edge->getChild().get()))
+                continue;
+            const auto key = std::make_pair(node.get(), edge->getInputNum());
+            if (!outputPortMap.count(key))
+                outputPortMap[key] = static_cast<int>(outputPortMap.size());
+            outputBoundary.push_back(edge);
+        }
+    }
+    if (inputBoundary.size() != replacement->inputShapes.size() ||
+        outputPortMap.size() != replacement->outputShapes.size())
+        return false;
+
+    // The boundary memory is adopted by the new edges so that the already created primitives of
+    // the outside nodes keep their data handles; bail out if any of it is not materialized.
+    std::vector<MemoryPtr> boundaryMemory;
+    for (const auto& edge : inputBoundary) {
+        if (!edge->getMemoryPtr())
+            return false;
+        boundaryMemory.push_back(edge->getMemoryPtr());
+    }
+    for (const auto& edge : outputBoundary) {
+        if (!edge->getMemoryPtr())
+            return false;
+        boundaryMemory.push_back(edge->getMemoryPtr());
+    }
+
+    // Rewire the boundary. The output side entries are replaced in place within the consumers'
+    // parent edge lists, since the outside nodes look their edges up by index.
+    std::vector<EdgePtr> newEdges;
+    int inPort = 0;
+    for (const auto& oldEdge : inputBoundary) {
+        auto parent = oldEdge->getParent();
+        EdgePtr newEdge(new Edge(parent, replacement, oldEdge->getInputNum(), inPort++));
+        parent->childEdges.push_back(newEdge);
+        replacement->parentEdges.push_back(newEdge);
+        newEdges.push_back(newEdge);
+    }
+    for (const auto& oldEdge : outputBoundary) {
+        auto child = oldEdge->getChild();
+        const int outPort = outputPortMap[std::make_pair(oldEdge->getParent().get(), oldEdge->getInputNum())];
+        EdgePtr newEdge(new Edge(replacement, child, outPort, oldEdge->getOutputNum()));
+        replacement->childEdges.push_back(newEdge);
+        for (auto& parentEdge : child->parentEdges) {
+            if (parentEdge.lock() == oldEdge)
+                parentEdge = newEdge;
+        }
+        newEdges.push_back(newEdge);
+    }
+    for (const auto& oldEdge : inputBoundary) {
+        auto& list = oldEdge->getParent()->childEdges;
+        list.erase(std::remove_if(list.begin(), list.end(), [&](const EdgeWeakPtr& e) {
+            return e.lock() == oldEdge;
+        }), list.end());
+    }
+    graphEdges.erase(std::remove_if(graphEdges.begin(), graphEdges.end(), [&](const EdgePtr& e) {
+        return regionSet.count(e->getParent().get()) || regionSet.count(e->getChild().get());
+    }), graphEdges.end());
+    graphNodes.erase(std::remove_if(graphNodes.begin(), graphNodes.end(), [&](const NodePtr& n) {
+        return regionSet.count(n.get()) != 0;
+    }), graphNodes.end());
+    for (const auto& edge : newEdges)
+        graphEdges.push_back(edge);
+
+    // initialize the replacement the same way InitGraph does for a whole graph
+    replacement->init();
+    replacement->getSupportedDescriptors();
+    replacement->initSupportedPrimitiveDescriptors();
+    replacement->filterSupportedPrimitiveDescriptors();
+    replacement->selectOptimalPrimitiveDescriptor();
+    replacement->initOptimalPrimitiveDescriptor();
+    graphNodes.push_back(replacement);
+
+    std::unordered_set<std::string> uniqueLayerNames;
+    for (const auto& node : graphNodes)
+        uniqueLayerNames.insert(node->getName());
+
+    // resolve the boundary layout mismatches and attach the memory; optimized (zero copy)
+    // reorders are executed as regular ones here since the in-place clusters of the memory
+    // reuse plan are not re-resolved for a localized update
+    std::vector<NodePtr> newReorders;
+    for (size_t i = 0; i < newEdges.size(); i++) {
+        auto edge = newEdges[i];
+        EdgePtr outerEdge = edge;  // the half which adopts the boundary memory
+        EdgePtr innerEdge;         // the half on the replacement side which needs own memory
+        if (edge->needReorder() != Edge::ReorderStatus::No) {
+            std::string basicLayerName = edge->getParent()->getName() + "_" +
+                                         node::Reorder::getReorderArgs(edge->getInputDesc(), edge->getOutputDesc()) + "_" +
+                                         edge->getChild()->getName();
+            std::string layerName = basicLayerName;
+            int idx = 0;
+            while (uniqueLayerNames.find(layerName) != uniqueLayerNames.end()) {
+                idx++;
+                layerName = basicLayerName + "_" + std::to_string(idx);
+            }
+            uniqueLayerNames.insert(layerName);
+
+            auto reorder = InsertReorder(edge, layerName, edge->getInputDesc(), edge->getOutputDesc(), false);
+            newReorders.push_back(reorder);
+            graphEdges.erase(std::find(graphEdges.begin(), graphEdges.end(), edge));
+
+            const bool inputSide = i < inputBoundary.size();
+            outerEdge = inputSide ? reorder->getParentEdgeAt(0) : reorder->getChildEdgeAt(0);
+            innerEdge = inputSide ? reorder->getChildEdgeAt(0) : reorder->getParentEdgeAt(0);
+        }
+        outerEdge->changeStatus(Edge::Status::NeedAllocation);
+        outerEdge->reuse(boundaryMemory[i]);
+        if (innerEdge) {
+            innerEdge->changeStatus(Edge::Status::NeedAllocation);
+            innerEdge->allocate();
+        }
+    }
+
+    // InsertReorder rebuilds edge lists with push_back, restore the index == port invariant
+    // the outside consumers rely on
+    auto restoreParentEdgeOrder = [](const NodePtr& node) {
+        std::sort(node->parentEdges.begin(), node->parentEdges.end(),
+                  [](const EdgeWeakPtr& a, const EdgeWeakPtr& b) {
+                      return a.lock()->getOutputNum() < b.lock()->getOutputNum();
+                  });
+    };
+    restoreParentEdgeOrder(replacement);
+    for (const auto& oldEdge : outputBoundary)
+        restoreParentEdgeOrder(oldEdge->getChild());
+
+    for (const auto& reorder : newReorders)
+        reorder->createPrimitive();
+    replacement->createPrimitive();
+
+    // refresh the derived execution structures
+    SortTopologically();
+    constantGraphNodes.clear();
+    executableGraphNodes.clear();
+    ExtractConstantAndExecutableNodes();
+    return true;
+}
+
+// Set all non const data paths precision to BF16 or FP16 depending on the inference precision
+void Graph::EnforceInferencePrecision() {
+    const Precision inferPrec = getConfig().enforceFP16 ? Precision::FP16 : Precision::BF16;
+
     // Floating point parts of FP32 + INT8 or FP32 + BIN mixed precision models will be executed in BF16 precision
     // only if enforceBF16 flag was set manually because current performance is not good enough to enable it by default
-    if (!implication(context->isGraphQuantized(), getConfig().manualEnforceBF16))
+    if (inferPrec == Precision::BF16 && !implication(context->isGraphQuantized(), getConfig().manualEnforceBF16))
         return;
 
     std::function<void(const NodePtr&, std::unordered_set<NodePtr>& skipNodes)> searchForNodesToSkip;
@@ -1509,7 +2188,7 @@ void Graph::EnforceBF16() {
         for (size_t i = 0; i < node->getParentEdges().size(); i++) {
             const auto& parent = node->getParentEdgeAt(i)->getParent();
 
-            /* list of node types that must be forced to be executed in BF16 precision
+            /* list of node types that must be forced to be executed in the reduced precision
              * because of performance gains */
             if (one_of(parent->getType(),
                     Type::Convolution,    // conv nets
@@ -1527,7 +2206,7 @@ void Graph::EnforceBF16() {
         }
     };
 
-    /* Skip BF16 enforcement for tail of the graph by forming set of nodes to skip.
+    /* Skip enforcement for tail of the graph by forming set of nodes to skip.
      * Necessary to maintain accuracy.
      * Experiments show zero peformance impact on average */
     std::unordered_set<NodePtr> nodesToSkip;
@@ -1541,27 +2220,39 @@ void Graph::EnforceBF16() {
         if (nodesToSkip.count(node) && !node->enforceBF16evenForGraphTail)
             continue;
 
+        /* Keep numerically sensitive ops in FP32 regardless of the enforced precision:
+         * softmax-like ops accumulate the denominator over a whole axis and normalization
+         * ops accumulate (squared) sums, both of which lose too much precision in the
+         * 16 bit formats and are a known source of accuracy cliffs. Reorders to/from FP32
+         * are inserted around such nodes automatically on precision mismatch. */
+        if (one_of(node->getType(), Type::Softmax, Type::LogSoftmax, Type::MVN, Type::NormalizeL2, Type::Reduce)) {
+            DEBUG_LOG("#", node->getExecIndex(),
+                      " ", node->getName(),
+                      " is kept in FP32 as numerically sensitive\n");
+            continue;
+        }
+
         if (node->getType() != Type::Input && node->getType() != Type::Output) {
             DEBUG_LOG("#", node->getExecIndex(),
                       " ", node->getName(),
-                      " is enforced to use BF16\n");
+                      " is enforced to use ", inferPrec, "\n");
             for (size_t i = 0; i < node->getOriginalInputsNumber(); i++) {
                 const auto &parent = node->getParentEdgesAtPort(i)[0]->getParent();
-                /* Skip BF16 enforcement for nodes after Constant Inputs for maintaining precision for fusing.
-                 * Precision conversion to BF16 does automatically, if convolution follows up after Constant Inputs
-                 * and if activation is BF16 */
+                /* Skip enforcement for nodes after Constant Inputs for maintaining precision for fusing.
+                 * Precision conversion happens automatically, if convolution follows up after Constant Inputs
+                 * and if activation is in the reduced precision */
                 if (!(parent->getType() == Type::Input && parent->isConstant() &&
-                    // Concatenation node is exception because it doesn't change an accuracy for BF16 activation
+                    // Concatenation node is exception because it doesn't change an accuracy for the activation
                       node->getType() != Type::Concatenation) &&
-                    // exclude Eltwise after Input since it supports conversion to BF16
+                    // exclude Eltwise after Input since it supports conversion to the reduced precision
                     !(parent->getType() == Type::Input && (node->getType() == Type::Eltwise || node->getType() == Type::Subgraph)) &&
                     node->getOriginalInputPrecisionAtPort(i) == Precision::FP32)
-                    node->setOriginalInputPrecisionAtPort(i, Precision::BF16);
+                    node->setOriginalInputPrecisionAtPort(i, inferPrec);
             }
 
             for (size_t i = 0; i < node->getOriginalOutputsNumber(); i++) {
                 if (node->getOriginalOutputPrecisionAtPort(i) == Precision::FP32)
-                    node->setOriginalOutputPrecisionAtPort(i, Precision::BF16);
+                    node->setOriginalOutputPrecisionAtPort(i, inferPrec);
             }
         }
     }
@@ -18,12 +18,16 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace ov {
 namespace intel_cpu {
 
 class InferRequestBase;
 class InferRequest;
+class WeightsPrefetcher;
 
 class Graph {
 public:
@@ -59,10 +63,23 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
-    void PullOutputData(InferenceEngine::BlobMap &out);
+    void PullOutputData(InferenceEngine::BlobMap &out, const std::unordered_set<std::string> &skip = {});
+    // Per-output variant for pulling a single result as soon as its producer has finished
+    // (see SetOutputReadyCallback), while the rest of the graph is still executing
+    void PullOutputData(const std::string& name, const InferenceEngine::Blob::Ptr &out);
 
     void Infer(InferRequestBase* request = nullptr);
 
+    // Registers a callback fired from Infer() right after the node producing the
+    // corresponding output has finished, so per-tensor postprocessing can be overlapped
+    // with the rest of the graph execution. Outputs which are not produced at inference
+    // time (e.g. constant ones) are valid before Infer() starts and are not reported.
+    // With intra-graph parallelism the callback may be invoked from a worker thread, so
+    // it must be thread-safe and cheap.
+    void SetOutputReadyCallback(std::function<void(const std::string&)> callback) {
+        outputReadyCallback = std::move(callback);
+    }
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -75,6 +92,11 @@ public:
         return _name;
     }
 
+    // Bytes owned by this graph copy: the workspace of the intermediate tensors (plus the
+    // individually allocated edges) and the run-time scratch pad. Constant weights are not
+    // accounted since they are shared between the graph copies through the weights cache.
+    size_t GetAllocatedMemory() const;
+
     std::vector<EdgePtr>& GetEdges() {
         return graphEdges;
     }
@@ -180,6 +202,23 @@ public:
      */
     bool InsertNode(NodePtr parent, NodePtr child, NodePtr node, int parentPort, int childPort, bool initNode = false);
 
+    /**
+     * @brief Replaces a region of the initialized graph with a single new node (localized recompile).
+     * The boundary edges adopt the memory of the edges they replace, so the primitives of the nodes
+     * outside the region stay valid and only the replacement (plus the boundary reorders it may need)
+     * is initialized and allocated. Intended for runtime kernel experiments, e.g. swapping a fused
+     * subgraph for an alternative implementation without recompiling the whole network.
+     * @param region
+     * nodes to be removed; the external input edges of the region map to the replacement input ports
+     * and the distinct external output ports map to the replacement output ports, both in the
+     * execution order of the region
+     * @param replacement
+     * a fresh node consuming and producing the region boundary tensors
+     * @return true when the region was replaced; false when the graph or the arguments do not
+     * support the localized path (the graph stays unchanged in that case)
+     */
+    bool ReplaceSubgraph(const std::vector<NodePtr>& region, const NodePtr& replacement);
+
     std::shared_ptr<ngraph::Function> dump() const;
 
     void ResetInferCount() { infer_count = 0; }
@@ -212,6 +251,7 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    size_t allocatedMemSize = 0;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -232,10 +272,16 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
+    void PrepareParallelExecution();
+    void ResolveShapeOnlyNodes();
+    void ResolveWeightsStreaming();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
+    void NotifyOutputsReady(const NodePtr& node) const;
     void ExecuteConstantNodesOnly() const;
     void InferStatic(InferRequestBase* request);
+    void InferStaticParallel(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
+    void MaybeYieldToHighPriorityTask() const;
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -255,9 +301,41 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // dependency-counting scheduler data for the intra-graph parallel execution mode:
+    // per executable node - indices of executable successors and the initial dependency count
+    std::vector<std::vector<size_t>> parallelExecSuccessors;
+    std::vector<int> parallelExecInitialDeps;
+
+    // per executable node - names of the model outputs whose memory is finalized by this node
+    std::unordered_map<Node*, std::vector<std::string>> outputProducersMap;
+    std::function<void(const std::string&)> outputReadyCallback;
+
+    // runtime memoization of the shape calculation subgraphs (ShapeOf->Gather->Concat alike
+    // chains): their outputs are a pure function of the input shapes, so when the shapes of a
+    // previous infer request repeat, the small cached results are restored instead of executing
+    // dozens of tiny nodes whose cost is dominated by the per-node overhead
+    struct ShapeOnlyNodeOutputs {
+        std::vector<VectorDims> dims;
+        std::vector<std::vector<uint8_t>> data;
+    };
+    using ShapeSubgraphOutputs = std::unordered_map<size_t, ShapeOnlyNodeOutputs>;
+
+    std::vector<bool> shapeOnlyNodeFlags;  // per executable node; empty when there is nothing to memoize
+    std::unordered_map<std::string, ShapeSubgraphOutputs> shapeSubgraphCache;
+
+    // streams the mmap-backed weights through a bounded resident working set,
+    // see CPU_CONFIG_KEY(WEIGHTS_STREAMING_BUDGET); null when streaming is not engaged
+    std::unique_ptr<WeightsPrefetcher> weightsPrefetcher;
+
+    void PullOutput(const std::string& name, const NodePtr& node, const InferenceEngine::Blob::Ptr& ext_blob);
+
+    std::string MakeInputShapesSignature() const;
+    bool RestoreShapeOnlyNodeOutputs(const ShapeSubgraphOutputs& entry, size_t execIndex) const;
+    void HarvestShapeOnlyNodeOutputs(ShapeSubgraphOutputs& entry, size_t execIndex) const;
+
     GraphContext::CPtr context;
 
-    void EnforceBF16();
+    void EnforceInferencePrecision();
 };
 
 }   // namespace intel_cpu
@@ -4,12 +4,17 @@
 
 #pragma once
 
+#include "blob_arena.h"
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
 #include "weights_cache.hpp"
 
+namespace InferenceEngine {
+class CPUStreamsExecutor;
+}  // namespace InferenceEngine
+
 namespace ov {
 namespace intel_cpu {
 
@@ -22,14 +27,21 @@ public:
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
                  std::shared_ptr<std::mutex> sharedMutex,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 std::string weightsCacheScope = {},
+                 std::shared_ptr<InferenceEngine::CPUStreamsExecutor> streamsExecutor = nullptr,
+                 const void* preemptionDomain = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          weightsCacheScope(std::move(weightsCacheScope)),
           sharedMutex(sharedMutex),
+          streamsExecutor(std::move(streamsExecutor)),
+          preemptionDomain(preemptionDomain),
           isGraphQuantizedFlag(isGraphQuantized) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
+        blobArena = std::make_shared<BlobArena>();
     }
 
     const Config& getConfig() const {
@@ -44,10 +56,29 @@ public:
         return weightsCache;
     }
 
+    // The weights cache is shared between all networks of the plugin, so records that are keyed
+    // by node/edge names rather than by content hash must be prefixed with this scope to stay
+    // private to the network the graph belongs to
+    const std::string& getWeightsCacheScope() const {
+        return weightsCacheScope;
+    }
+
     std::shared_ptr<std::mutex> getSharedMutex() const {
         return sharedMutex;
     }
 
+    // the streams executor the network tasks are scheduled on; only set when the executor
+    // supports the priority classes, so the graph may lend its stream at the preemption points
+    const std::shared_ptr<InferenceEngine::CPUStreamsExecutor>& getStreamsExecutor() const {
+        return streamsExecutor;
+    }
+
+    // the tag the network schedules its own tasks with; a preemption point must never pick up
+    // a task of the same network, since its stream-local graph is busy mid-inference right there
+    const void* getPreemptionDomain() const {
+        return preemptionDomain;
+    }
+
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
     }
@@ -56,6 +87,10 @@ public:
         return rtScratchPad;
     }
 
+    BlobArenaPtr getBlobArena() const {
+        return blobArena;
+    }
+
     dnnl::engine getEngine() const {
         return eng;
     }
@@ -69,10 +104,14 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    std::string weightsCacheScope;            // per-network prefix for name-keyed cache records
     std::shared_ptr<std::mutex> sharedMutex;  // mutex for protection of type-relaxed Op in clone_model()
+    std::shared_ptr<InferenceEngine::CPUStreamsExecutor> streamsExecutor;  // for the preemption points
+    const void* preemptionDomain = nullptr;   // scheduling tag of the network owning the graph
 
     MultiCachePtr rtParamsCache;     // primitive cache
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
+    BlobArenaPtr blobArena;          // recycles request I/O blob buffers across shapes
 
     bool isGraphQuantizedFlag = false;
     static dnnl::engine eng;  // onednn engine (singleton)
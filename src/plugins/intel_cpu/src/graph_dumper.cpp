@@ -109,6 +109,24 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr &node) {
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    // Alias tracking for the reshape class (Reshape/Squeeze/Unsqueeze): such a node is expected
+    // to resolve to a zero-cost descriptor rewrite over the same memory. Report how it actually
+    // resolved: 'view' means the output aliases the input, 'copy' means the in-place chain was
+    // broken and the node materializes its output, and the reorder suffixes flag a layout
+    // disagreement with the producer/consumer paid for by an inserted Reorder next to the node.
+    if (node->getType() == Type::Reshape) {
+        std::string alias = node->isExecutable() ? "copy" : "view";
+        if (node->getParentEdgeAt(0)->getParent()->getType() == Type::Reorder)
+            alias += "+src_reorder";
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            if (node->getChildEdgeAt(i)->getChild()->getType() == Type::Reorder) {
+                alias += "+dst_reorder";
+                break;
+            }
+        }
+        serialization_info["memoryAlias"] = alias;
+    }
+
     return serialization_info;
 }
 
@@ -208,9 +226,14 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const Graph &graph
     return std::make_shared<ngraph::Function>(results, params, graph._name);
 }
 
-#ifdef CPU_DEBUG_CAPS
 void serialize(const Graph &graph) {
-    const std::string& path = graph.getConfig().debugCaps.execGraphPath;
+    // the release knob takes precedence; debug-caps builds additionally honor the
+    // OV_CPU_EXEC_GRAPH_PATH environment driven path for backward compatibility
+    std::string path = graph.getConfig().execGraphDumpPath;
+#ifdef CPU_DEBUG_CAPS
+    if (path.empty())
+        path = graph.getConfig().debugCaps.execGraphPath;
+#endif
 
     if (path.empty())
         return;
@@ -254,8 +277,22 @@ void serializeToCout(const Graph &graph) {
         }
         std::cout << " ]"  << std::endl;
     }
+
+    // quick zero-copy health check for reshape-heavy models (see memoryAlias in the XML dump)
+    size_t reshapeViews = 0;
+    size_t reshapeCopies = 0;
+    for (const auto& node : graph.GetNodes()) {
+        if (node->getType() != Type::Reshape)
+            continue;
+        ++(node->isExecutable() ? reshapeCopies : reshapeViews);
+    }
+    if (reshapeViews != 0 || reshapeCopies != 0) {
+        std::cout << "reshape-class nodes: " << reshapeViews << " executed as views, "
+                  << reshapeCopies << " forced to materialize" << std::endl;
+    }
 }
 
+#ifdef CPU_DEBUG_CAPS
 void summary_perf(const Graph &graph) {
     const std::string& summaryPerf = graph.getConfig().debugCaps.summaryPerf;
 
@@ -14,8 +14,8 @@ namespace ov {
 namespace intel_cpu {
 
 std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const Graph &graph);
-#ifdef CPU_DEBUG_CAPS
 void serialize(const Graph &graph);
+#ifdef CPU_DEBUG_CAPS
 void summary_perf(const Graph &graph);
 #endif // CPU_DEBUG_CAPS
 
@@ -20,6 +20,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/pad.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -69,10 +70,18 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FoldConvertChains");
+    FoldConvertChains(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MergeConvertAndScaleShift");
     MergeConvertAndScaleShift(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MergeConvertAndInterpolate");
+    MergeConvertAndInterpolate(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseDeconvolutionAndSimpleOperation");
     FuseDeconvolutionAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -93,6 +102,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FoldPadIntoConvolutionOrPooling");
+    FoldPadIntoConvolutionOrPooling(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndSimpleOperationThroughMaxPool");
     FuseConvolutionAndSimpleOperationThroughMaxPool(graph);
     graph.RemoveDroppedNodes();
@@ -478,6 +491,83 @@ void GraphOptimizer::FuseMultiplyAndAdd(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FoldConvertChains(Graph& graph) {
+    // The frontends insert Converts around integral subgraphs fairly liberally, so chains like
+    // u8 -> f32 -> f16 are common. When the intermediate precision represents every value of the
+    // first Convert's input exactly, the first Convert neither saturates nor rounds and the pair
+    // collapses into a single Convert to the final precision.
+    auto& graphNodes = graph.GetNodes();
+
+    auto valueBits = [](const Precision& prec) -> int {
+        switch (prec) {
+            case Precision::BOOL: return 1;
+            case Precision::U8: return 8;
+            case Precision::I8: return 7;
+            case Precision::U16: return 16;
+            case Precision::I16: return 15;
+            case Precision::U32: return 32;
+            case Precision::I32: return 31;
+            case Precision::U64: return 64;
+            case Precision::I64: return 63;
+            case Precision::BF16: return 8;   // mantissa incl. the implicit bit
+            case Precision::FP16: return 11;
+            case Precision::FP32: return 24;
+            case Precision::FP64: return 53;
+            default: return 0;
+        }
+    };
+    auto exponentBits = [](const Precision& prec) -> int {
+        switch (prec) {
+            case Precision::BF16:
+            case Precision::FP32: return 8;
+            case Precision::FP16: return 5;
+            case Precision::FP64: return 11;
+            default: return 0;
+        }
+    };
+    auto isLosslesslyRepresentable = [&](const Precision& from, const Precision& to) {
+        if (valueBits(from) == 0 || valueBits(to) == 0)
+            return false;
+        if (from == to)
+            return true;
+        if (!from.is_float()) {
+            if (to.is_float())  // integral fits into the mantissa
+                return valueBits(from) <= valueBits(to);
+            // integral -> integral: enough value bits, and a signed source needs a signed target
+            return valueBits(from) <= valueBits(to) && (!from.isSigned() || to.isSigned());
+        }
+        // float -> float: the mantissa must not shrink and the exponent range must not shrink
+        return to.is_float() && valueBits(from) <= valueBits(to) &&
+               exponentBits(from) <= exponentBits(to);
+    };
+
+    auto isSuitableNode = [](const NodePtr& node) {
+        return node->getType() == Type::Convert && node->getChildEdges().size() == 1 &&
+               node->getFusedWith().empty();
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (childNode->getType() != Type::Convert ||
+            !isLosslesslyRepresentable(parentNode->getOriginalInputPrecisionAtPort(0),
+                                       parentNode->getOriginalOutputPrecisionAtPort(0))) {
+            parent++;
+            continue;
+        }
+
+        childNode->setOriginalInputPrecisionAtPort(0, parentNode->getOriginalInputPrecisionAtPort(0));
+        childNode->addOriginalLayer(parentNode->getOriginalLayers());
+        graph.DropNode(parentNode);
+    }
+}
+
 void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -545,6 +635,81 @@ void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
     }
 }
 
+void GraphOptimizer::MergeConvertAndInterpolate(Graph& graph) {
+    // Typical preprocessing chain is Convert(u8->f32) -> Interpolate -> ScaleShift: the Interpolate
+    // kernels take u8/i8 input directly (upconverting per block in registers), so the standalone
+    // Convert only materializes a full-size f32 copy of the image. Merge it into the Interpolate
+    // data input; the normalization eltwises are fused into the same kernel later by
+    // FuseInterpolateAndSimpleOperation, so the whole resize+convert+normalize chain becomes one
+    // pass over the image.
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](NodePtr parentNode) {
+        return parentNode->getType() == Type::Convert && parentNode->getChildEdges().size() == 1 &&
+               (parentNode->getOriginalInputPrecisionAtPort(0) == Precision::U8 ||
+                parentNode->getOriginalInputPrecisionAtPort(0) == Precision::I8) &&
+               parentNode->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    auto isSuitableChildNode = [](NodePtr parentNode, NodePtr childNode) {
+        // only the data input may change precision; axes/scales/sizes inputs stay intact
+        return childNode->getType() == Type::Interpolate && parentNode->getChildEdgeAt(0)->getOutputNum() == 0 &&
+               childNode->getFusedWith().empty();
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildNode(parentNode, childNode)) {
+            parent++;
+            continue;
+        }
+
+        auto parents = parentNode->parentEdges;
+        for (size_t i = 0; i < parents.size(); i++) {
+            auto p_edge = parents[i].lock();
+            if (!p_edge) continue;
+            auto parent = p_edge->getParent();
+            if (!parent) continue;
+
+            if (!parentNode->childEdges[0].lock())
+                continue;
+            auto child = parentNode->childEdges[0].lock()->getChild();
+            if (!child)
+                continue;
+
+            EdgePtr& remEdge = p_edge;
+            int inNum = 0;
+            if (remEdge) {
+                inNum = remEdge->getInputNum();
+                remEdge->drop();
+                graph.RemoveEdge(remEdge);
+            }
+            remEdge = parentNode->childEdges[0].lock();
+            int outNum = 0;
+            if (remEdge) {
+                outNum = remEdge->getOutputNum();
+                remEdge->drop();
+                graph.RemoveEdge(remEdge);
+            }
+            EdgePtr newEdge(new Edge(parent, child, inNum, outNum));
+            auto& graphEdges = graph.GetEdges();
+            graphEdges.push_back(newEdge);
+            parent->addEdge(newEdge);
+        }
+
+        childNode->setOriginalInputPrecisionAtPort(0, parentNode->getOriginalInputPrecisionAtPort(0));
+        childNode->addOriginalLayer(parentNode->getOriginalLayers());
+        graph.DropNode(parentNode);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionAndZeroPoints(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -712,6 +877,120 @@ void GraphOptimizer::FuseConvolutionAndZeroPoints(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FoldPadIntoConvolutionOrPooling(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitablePadNode = [](const NodePtr& node) {
+        if (node->getType() != Type::Pad || node->isDynamicNode() || node->getChildEdges().size() != 1)
+            return false;
+
+        auto* padNode = dynamic_cast<node::Pad*>(node.get());
+        if (padNode == nullptr)
+            IE_THROW() << "Cannot cast to Pad node " << node->getName();
+
+        // only a statically known constant zero padding matches the implicit zero padding
+        // of the conv/pooling primitives
+        return padNode->isConstantZeroPad() && node->getChildEdgeAt(0)->getOutputNum() == 0;
+    };
+
+    auto isSuitableChildNode = [](const node::Pad* padNode, const NodePtr& childNode) {
+        if (childNode->isDynamicNode())
+            return false;
+
+        const auto& padsBegin = padNode->getPadsBegin();
+        const auto& padsEnd = padNode->getPadsEnd();
+        const auto rank = padsBegin.size();
+
+        std::vector<ptrdiff_t> curPadL, curPadR, effKernel;
+        if (childNode->getType() == Type::Convolution) {
+            auto* convNode = dynamic_cast<node::Convolution*>(childNode.get());
+            if (convNode == nullptr)
+                IE_THROW() << "Cannot cast to convolution node " << childNode->getName();
+
+            // an int8 convolution with a fused input zero point implicitly pads with the zero
+            // point value rather than with a literal zero, so the folding is not equivalent
+            if (!convNode->legacyInputZeroPoints.empty() || !convNode->inputZeroPoints.empty())
+                return false;
+
+            curPadL = convNode->getPaddingL();
+            curPadR = convNode->getPaddingR();
+            const auto& weightDims = convNode->getWeightDims();
+            const auto& dilation = convNode->getDilation();
+            for (size_t i = 0; i < curPadL.size(); i++) {
+                const ptrdiff_t krn = weightDims[weightDims.size() - curPadL.size() + i];
+                effKernel.push_back((krn - 1) * (dilation[i] + 1) + 1);
+            }
+        } else if (childNode->getType() == Type::Pooling) {
+            auto* poolNode = dynamic_cast<node::Pooling*>(childNode.get());
+            if (poolNode == nullptr)
+                IE_THROW() << "Cannot cast to pooling node " << childNode->getName();
+
+            // max pooling treats the implicitly padded area as -inf while the Pad node writes
+            // real zeros there, and average pooling which excludes the padded area from the
+            // divisor would average over fewer elements than the padded tensor provides
+            if (childNode->getAlgorithm() != Algorithm::PoolingAvg || poolNode->isExcludePad())
+                return false;
+
+            curPadL = poolNode->getDataPadBegin();
+            curPadR = poolNode->getDataPadEnd();
+            const auto& kernel = poolNode->getKernel();
+            const auto& dilation = poolNode->getDilation();
+            for (size_t i = 0; i < kernel.size(); i++)
+                effKernel.push_back((kernel[i] - 1) * dilation[i] + 1);
+        } else {
+            return false;
+        }
+
+        if (rank != childNode->getInputShapeAtPort(0).getRank() || curPadL.size() != curPadR.size() ||
+            curPadL.size() + 2 != rank)
+            return false;
+
+        // only the spatial dims may be padded
+        for (size_t i = 0; i < rank - curPadL.size(); i++) {
+            if (padsBegin[i] != 0 || padsEnd[i] != 0)
+                return false;
+        }
+
+        // oneDNN jit kernels expect the padding not to exceed the effective kernel span
+        const size_t spatialOffset = rank - curPadL.size();
+        for (size_t i = 0; i < curPadL.size(); i++) {
+            if (curPadL[i] + padsBegin[spatialOffset + i] >= effKernel[i] ||
+                curPadR[i] + padsEnd[spatialOffset + i] >= effKernel[i])
+                return false;
+        }
+
+        return true;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto pad = graphNodes[i];
+        if (!isSuitablePadNode(pad))
+            continue;
+
+        auto* padNode = dynamic_cast<node::Pad*>(pad.get());
+        auto childNode = pad->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildNode(padNode, childNode))
+            continue;
+
+        if (childNode->getType() == Type::Convolution) {
+            dynamic_cast<node::Convolution*>(childNode.get())->absorbInputPadding(padNode->getPadsBegin(),
+                                                                                  padNode->getPadsEnd());
+        } else {
+            dynamic_cast<node::Pooling*>(childNode.get())->absorbInputPadding(padNode->getPadsBegin(),
+                                                                              padNode->getPadsEnd());
+        }
+        childNode->addOriginalLayer(pad->getOriginalLayers());
+
+        // detach the pads_begin/pads_end/pad_value constant inputs, so that DropNode
+        // reconnects only the data path
+        for (size_t port = pad->getParentEdges().size(); port > 1; port--) {
+            auto p_edge = pad->getParentEdgesAtPort(port - 1)[0];
+            graph.RemoveEdge(p_edge);
+        }
+        graph.DropNode(pad);
+    }
+}
+
 /**
  * @todo FQ fusing was disabled for BF16 output since oneDNN primitives lack support
  *       for bf16 depthwise postops.
@@ -1721,6 +2000,12 @@ void GraphOptimizer::DropDoubleReorders(Graph &graph) {
             if (!edge) IE_THROW() << "Inappropriate graph processing";
 
 
+            // When the chain converts back to the original layout (e.g. nhwc -> nchw -> nhwc),
+            // the surviving edge is already consistent and the merged reorder would degenerate
+            // into a plain copy, so the pair is dropped without a replacement
+            if (n->getInput().isCompatible(nn->getOutput()))
+                continue;
+
             std::string layerName = edge->getParent()->getName() + "_ScaleReorder_" + edge->getChild()->getName();
             graph.InsertReorder(edge, layerName, n->getInput(), nn->getOutput(), false);
             graph.GetEdges().erase(std::remove(graph.GetEdges().begin(), graph.GetEdges().end(), edge), graph.GetEdges().end());
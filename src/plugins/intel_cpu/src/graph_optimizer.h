@@ -23,7 +23,9 @@ private:
     void FuseConvolutionMatMulDeconvAndBias(Graph &graph);
     void FuseDeconvolutionAndSimpleOperation(Graph &graph);
     void FuseMultiplyAndAdd(Graph &graph);
+    void FoldConvertChains(Graph& graph);
     void MergeConvertAndScaleShift(Graph& graph);
+    void MergeConvertAndInterpolate(Graph& graph);
     void FuseFullyConnectedAndSimpleOperation(Graph &graph);
     void FuseMatMulAndSimpleOperation(Graph &graph);
     void FuseConvolutionAndSimpleOperationThroughMaxPool(Graph &graph);
@@ -38,6 +40,7 @@ private:
 
     void DropDoubleReorders(Graph& graph);
     void FuseConvolutionAndZeroPoints(Graph &graph);
+    void FoldPadIntoConvolutionOrPooling(Graph &graph);
     void FuseBroadcastAndEltwise(Graph &graph);
     void FuseEltwiseAndSimple(Graph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(Graph &graph);
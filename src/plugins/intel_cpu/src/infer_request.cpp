@@ -4,9 +4,12 @@
 
 #include "infer_request.h"
 #include "dnnl_extension_utils.h"
+#include <cmath>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <map>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/concat.h"
 #include "nodes/split.h"
@@ -92,50 +95,6 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
-void InferRequestBase::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
-        }
-    }
-}
-
-void InferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
-        }
-    }
-}
-
 void InferRequestBase::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
 
@@ -158,8 +117,19 @@ void InferRequestBase::InferImpl() {
     ThrowIfCanceled();
     convertBatchedInputBlobs();
 
+    std::unique_lock<std::mutex> specializedGraphGuard;
     if (graph->hasDynamicInput()) {
-        redefineMemoryForInputNodes();
+        // hot input shape combinations get fully static graph clones compiled in the background,
+        // which skip the dynamic-path overhead entirely; stateful networks are excluded since a
+        // clone would keep a separate state storage
+        if (memoryStates.empty()) {
+            if (auto specialized = execNetwork->TryGetSpecializedGraph(_inputs, specializedGraphGuard)) {
+                graph = specialized;
+            }
+        }
+        if (graph->hasDynamicInput()) {
+            redefineMemoryForInputNodes();
+        }
     } else if (graph->getConfig().isNewApi && graph->getConfig().batchLimit > 0) {
         const auto batch = _inputs.begin()->second->getTensorDesc().getDims()[0];
         SetBatch(batch);
@@ -167,25 +137,95 @@ void InferRequestBase::InferImpl() {
 
     execDataPreprocessing(_inputs);
 
+    // unchanged inputs produce unchanged outputs, so a static scene frame replays the cached
+    // outputs without executing the graph; stateful and dynamic models depend on more than the
+    // inputs and always run in full
+    const bool deltaMode = graph->getConfig().deltaInference && !graph->hasDynamicInput() &&
+                           memoryStates.empty() && graph->getConfig().batchLimit == 0;
+    if (deltaMode && deltaSnapshotsValid && deltaInputsUnchanged() && deltaReplayOutputs()) {
+        return;
+    }
+
     changeDefaultPtr();
 
     ThrowIfCanceled();
 
     PushInputData();
 
-    if (memoryStates.size() != 0) {
-        PushStates();
-    }
+    // the memory states are views over the MemoryInput nodes' storage (see VariableState),
+    // so no per-infer synchronization copies are needed here
+
+    // pull each output as soon as its producer has finished, so the output precision/layout
+    // conversions overlap with the execution of the remaining graph tail; an output whose early
+    // pull failed is simply retried by the final pass below
+    earlyPulledOutputs.clear();
+    graph->SetOutputReadyCallback([this](const std::string& name) {
+        const auto blob = _outputs.find(name);
+        if (blob == _outputs.end())
+            return;
+        graph->PullOutputData(name, blob->second);
+        std::lock_guard<std::mutex> lock(earlyPullMutex);
+        earlyPulledOutputs.insert(name);
+    });
 
     graph->Infer(this);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
+    ThrowIfCanceled();
+
+    graph->PullOutputData(_outputs, earlyPulledOutputs);
+
+    if (deltaMode)
+        deltaSnapshot();
+}
+
+bool InferRequestBase::deltaInputsUnchanged() const {
+    if (_inputs.size() != deltaPrevInputs.size())
+        return false;
+    for (const auto& input : _inputs) {
+        const auto prev = deltaPrevInputs.find(input.first);
+        if (prev == deltaPrevInputs.end())
+            return false;
+        const auto* data = input.second->cbuffer().as<const uint8_t*>();
+        if (data == nullptr || input.second->byteSize() != prev->second.size())
+            return false;
+        if (std::memcmp(data, prev->second.data(), prev->second.size()) != 0)
+            return false;
     }
+    return true;
+}
 
-    ThrowIfCanceled();
+bool InferRequestBase::deltaReplayOutputs() {
+    // the user may have rebound the output blobs since the cached run, so check all of them first
+    for (const auto& output : _outputs) {
+        const auto prev = deltaPrevOutputs.find(output.first);
+        if (prev == deltaPrevOutputs.end() || output.second->byteSize() != prev->second.size() ||
+            output.second->buffer().as<uint8_t*>() == nullptr)
+            return false;
+    }
+    for (const auto& output : _outputs) {
+        const auto& prev = deltaPrevOutputs.at(output.first);
+        cpu_memcpy(output.second->buffer().as<uint8_t*>(), prev.data(), prev.size());
+    }
+    return true;
+}
 
-    graph->PullOutputData(_outputs);
+void InferRequestBase::deltaSnapshot() {
+    deltaSnapshotsValid = false;
+    deltaPrevInputs.clear();
+    deltaPrevOutputs.clear();
+    for (const auto& input : _inputs) {
+        const auto* data = input.second->cbuffer().as<const uint8_t*>();
+        if (data == nullptr)
+            return;
+        deltaPrevInputs[input.first].assign(data, data + input.second->byteSize());
+    }
+    for (const auto& output : _outputs) {
+        const auto* data = output.second->cbuffer().as<const uint8_t*>();
+        if (data == nullptr)
+            return;
+        deltaPrevOutputs[output.first].assign(data, data + output.second->byteSize());
+    }
+    deltaSnapshotsValid = true;
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
@@ -431,8 +471,9 @@ void LegacyInferRequest::SetBlob(const std::string& name, const InferenceEngine:
                 IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
             }
 
-            auto pBlobDesc = MemoryDescUtils::interpretAsBlobDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory());
-            if (data->getTensorDesc() == pBlobDesc &&
+            const auto& pMemDesc = graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc();
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                pMemDesc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(data->getTensorDesc())) &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getConfig().batchLimit) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -465,8 +506,9 @@ void LegacyInferRequest::SetBlob(const std::string& name, const InferenceEngine:
                 IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
         }
 
-        auto pBlobDesc = MemoryDescUtils::interpretAsBlobDesc(graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory());
-        if (data->getTensorDesc() == pBlobDesc &&
+        const auto& pMemDesc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
+        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                pMemDesc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(data->getTensorDesc())) &&
                 !graph->getConfig().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -506,7 +548,8 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 desc = InferenceEngine::TensorDesc(p, dims, l);
             }
 
-            _inputs[name] = make_blob_with_precision(desc);
+            // allocate through the graph-context arena so buffers are recycled across requests/shapes
+            _inputs[name] = make_blob_with_precision(desc, graph->getGraphContext()->getBlobArena());
             _inputs[name]->allocate();
             if (pBlobDesc == desc &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getConfig().batchLimit) {
@@ -548,7 +591,7 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
                 desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-                data = make_blob_with_precision(desc);
+                data = make_blob_with_precision(desc, graph->getGraphContext()->getBlobArena());
                 data->allocate();
             } else {
                 const auto& expectedTensorDesc = pBlobDesc;
@@ -703,9 +746,14 @@ void InferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob:
             actualDesc = actualDesc->cloneWithNewDims(blobDesc.getLayout() == InferenceEngine::Layout::SCALAR ? InferenceEngine::SizeVector{1} :
                                                                                                                 blobDesc.getDims());
         }
-        if (actualDesc->isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc)) &&
+        // the offset is masked out of the comparison, so a view over the outermost dimension of
+        // a bigger tensor (e.g. a ROI tensor wrapping one batch element of a batched buffer) is
+        // consumed in place as well: such a view keeps the dense strides of its parent and only
+        // the start of the data differs
+        if (actualDesc->as<BlockedMemoryDesc>()->isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc),
+                                                              BLOCKED_DESC_SKIP_OFFSET_MASK) &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getConfig().batchLimit) {
-            externalPtr[name] = data->buffer();
+            externalPtr[name] = data->buffer().as<uint8_t*>() + blobDesc.getBlockingDesc().getOffsetPadding() * data->element_size();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
@@ -736,8 +784,14 @@ void InferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob:
         }
 
         const auto &desc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
-        if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc) && !graph->getConfig().batchLimit) {
-            externalPtr[name] = data->buffer();
+        // compare the actual blocked layouts rather than the TensorDesc objects, so a user blob
+        // that matches the graph memory (e.g. with a different layout enum) is wrapped in-place
+        // instead of being copied on every PullOutputData
+        if (!isDynamic && blobDesc.getLayout() != InferenceEngine::Layout::ANY &&
+                desc.as<BlockedMemoryDesc>()->isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc),
+                                                           BLOCKED_DESC_SKIP_OFFSET_MASK) &&
+                !graph->getConfig().batchLimit) {
+            externalPtr[name] = data->buffer().as<uint8_t*>() + blobDesc.getBlockingDesc().getOffsetPadding() * data->element_size();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
@@ -749,6 +803,107 @@ void InferRequest::SetBlobsImpl(const std::string& name, const InferenceEngine::
     _batched_inputs[name] = batched_blob;
 }
 
+namespace {
+
+// Bilinearly resamples one (possibly strided) source plane into a dense dstH x dstW plane,
+// using half-pixel coordinate mapping. Strides are given in elements.
+template <typename T>
+void gatherRoiPlane(const T* src, const size_t srcH, const size_t srcW,
+                    const size_t srcStrideH, const size_t srcStrideW,
+                    T* dst, const size_t dstH, const size_t dstW) {
+    const float scaleH = static_cast<float>(srcH) / dstH;
+    const float scaleW = static_cast<float>(srcW) / dstW;
+    for (size_t oy = 0; oy < dstH; oy++) {
+        const float fy = std::max((oy + 0.5f) * scaleH - 0.5f, 0.f);
+        const size_t y0 = std::min(static_cast<size_t>(fy), srcH - 1);
+        const size_t y1 = std::min(y0 + 1, srcH - 1);
+        const float wy = fy - y0;
+        for (size_t ox = 0; ox < dstW; ox++) {
+            const float fx = std::max((ox + 0.5f) * scaleW - 0.5f, 0.f);
+            const size_t x0 = std::min(static_cast<size_t>(fx), srcW - 1);
+            const size_t x1 = std::min(x0 + 1, srcW - 1);
+            const float wx = fx - x0;
+            const float top = src[y0 * srcStrideH + x0 * srcStrideW] * (1.f - wx) +
+                              src[y0 * srcStrideH + x1 * srcStrideW] * wx;
+            const float bottom = src[y1 * srcStrideH + x0 * srcStrideW] * (1.f - wx) +
+                                 src[y1 * srcStrideH + x1 * srcStrideW] * wx;
+            const float value = top * (1.f - wy) + bottom * wy;
+            dst[oy * dstW + ox] = std::is_integral<T>::value ? static_cast<T>(std::roundf(value))
+                                                             : static_cast<T>(value);
+        }
+    }
+}
+
+}  // namespace
+
+void InferRequest::convertBatchedInputBlob(const std::string& name, const InferenceEngine::BatchedBlob::Ptr& batched_blob) {
+    // The default implementation only concatenates tensors that already have the input spatial
+    // size and a dense layout, which does not cover the detection-then-classification case: a
+    // list of ROI views over one frame with a per-ROI spatial size. Such lists are gathered here
+    // directly - every ROI is bilinearly resized into its slot of the batch - so one request with
+    // N ROIs replaces N single-crop requests and N preprocessing runs.
+    const auto modelInput = modelInputsMap.find(name);
+    if (modelInput == modelInputsMap.end() || !modelInput->second)
+        return IInferRequestInternal::convertBatchedInputBlob(name, batched_blob);
+
+    const auto& shape = modelInput->second->get_output_partial_shape(0);
+    const auto prec = batched_blob->getBlob(0)->getTensorDesc().getPrecision();
+    if (shape.rank().is_dynamic() || shape.rank().get_length() != 4 ||
+        shape[1].is_dynamic() || shape[2].is_dynamic() || shape[3].is_dynamic() ||
+        (prec != InferenceEngine::Precision::FP32 && prec != InferenceEngine::Precision::U8)) {
+        return IInferRequestInternal::convertBatchedInputBlob(name, batched_blob);
+    }
+    const size_t C = shape[1].get_length();
+    const size_t H = shape[2].get_length();
+    const size_t W = shape[3].get_length();
+
+    const InferenceEngine::SizeVector defaultOrder = {0, 1, 2, 3};
+    bool needGather = false;
+    for (size_t i = 0; i < batched_blob->size(); i++) {
+        const auto& desc = batched_blob->getBlob(i)->getTensorDesc();
+        const auto& blkDesc = desc.getBlockingDesc();
+        const auto& dims = desc.getDims();
+        if (desc.getPrecision() != prec || dims.size() != 4 || dims[1] != C || blkDesc.getOrder() != defaultOrder)
+            return IInferRequestInternal::convertBatchedInputBlob(name, batched_blob);
+        needGather = needGather || dims[2] != H || dims[3] != W || blkDesc.getOffsetPadding() != 0 ||
+                     blkDesc.getStrides() != InferenceEngine::SizeVector{C * H * W, H * W, W, 1};
+    }
+    if (!needGather) {
+        // equal sized dense tensors take the plain concatenation path
+        return IInferRequestInternal::convertBatchedInputBlob(name, batched_blob);
+    }
+
+    const InferenceEngine::TensorDesc batchedDesc(prec,
+                                                  {batched_blob->size(), C, H, W},
+                                                  InferenceEngine::Layout::NCHW);
+    const auto mem_blob =
+        std::dynamic_pointer_cast<InferenceEngine::MemoryBlob>(make_blob_with_precision(batchedDesc));
+    OPENVINO_ASSERT(mem_blob, "Internal error - can't create host memory blob");
+    mem_blob->allocate();
+    auto dstLock = mem_blob->wmap();
+
+    InferenceEngine::parallel_for2d(batched_blob->size(), C, [&](size_t i, size_t c) {
+        const auto& blob = InferenceEngine::as<InferenceEngine::MemoryBlob>(batched_blob->getBlob(i));
+        OPENVINO_ASSERT(blob, "Internal error - can't cast blob ", i, " to MemoryBlob");
+        const auto& desc = blob->getTensorDesc();
+        const auto& blkDesc = desc.getBlockingDesc();
+        const auto& strides = blkDesc.getStrides();
+        const size_t srcH = desc.getDims()[2];
+        const size_t srcW = desc.getDims()[3];
+        const size_t srcOffset = blkDesc.getOffsetPadding() + c * strides[1];
+        const size_t dstOffset = (i * C + c) * H * W;
+        if (prec == InferenceEngine::Precision::FP32) {
+            gatherRoiPlane(blob->rmap().as<const float*>() + srcOffset, srcH, srcW, strides[2], strides[3],
+                           dstLock.as<float*>() + dstOffset, H, W);
+        } else {
+            gatherRoiPlane(blob->rmap().as<const uint8_t*>() + srcOffset, srcH, srcW, strides[2], strides[3],
+                           dstLock.as<uint8_t*>() + dstOffset, H, W);
+        }
+    });
+
+    SetBlob(name, mem_blob);
+}
+
 InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "GetBlob");
 
@@ -779,7 +934,7 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                 InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(inputNode->second->get_output_element_type(0)),
                                                  dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                _inputs[name] = make_blob_with_precision(desc);
+                _inputs[name] = make_blob_with_precision(desc, graph->getGraphContext()->getBlobArena());
                 _inputs[name]->allocate();
 
                 if (!isDynamic &&
@@ -814,7 +969,7 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                     InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(outputNode->second->get_input_element_type(0)),
                                                      dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                    data = make_blob_with_precision(desc);
+                    data = make_blob_with_precision(desc, graph->getGraphContext()->getBlobArena());
                     data->allocate();
                 } else {
                     const auto& blobDims = data->getTensorDesc().getDims();
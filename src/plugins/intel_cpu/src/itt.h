@@ -34,3 +34,15 @@ OV_ITT_DOMAIN(intel_cpu_LT);
 #else
 #    define CPU_LPT_SCOPE(region) OV_ITT_SCOPED_TASK(ov::intel_cpu::itt::domains::intel_cpu, OV_PP_TOSTRING(region))
 #endif
+
+// Marks per-ISA JIT executor creation, so that a model-scoped selective build keeps only the kernel
+// generators for ISAs observed during the analysis run and the linker drops the rest.
+#if defined(SELECTIVE_BUILD_ANALYZER)
+#    define CPU_ISA_SCOPE(region) OV_SCOPE(intel_cpu, region)
+#elif defined(SELECTIVE_BUILD)
+#    define CPU_ISA_SCOPE(region)                                          \
+        if (OV_CC_SCOPE_IS_ENABLED(OV_PP_CAT3(intel_cpu, _, region)) == 0) \
+        throw ov::Exception(std::string(OV_PP_TOSTRING(OV_PP_CAT3(intel_cpu, _, region))) + " is disabled!")
+#else
+#    define CPU_ISA_SCOPE(region)
+#endif
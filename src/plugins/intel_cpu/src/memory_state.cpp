@@ -11,10 +11,20 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (newState->byteSize() != state->byteSize())
+        IE_THROW() << "Can't set state " << GetName() << " with byte size " << newState->byteSize()
+                   << ", expected " << state->byteSize();
+    // the data is copied into the node storage right away and the external blob is not retained,
+    // so the state blob remains a view of the storage
+    cpu_memcpy(storage->GetData(), newState->cbuffer().as<const void*>(), newState->byteSize());
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    // FillZero lets the storage manager decommit its pages where supported, so resetting
+    // a state also gives the resident memory of the finished session back to the OS
+    storage->FillZero();
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
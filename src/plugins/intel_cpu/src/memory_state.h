@@ -18,13 +18,19 @@ namespace intel_cpu {
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
     VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        : InferenceEngine::IVariableStateInternal{name},
+          storage{storage} {
+        // the state blob is a zero-copy view over the MemoryInput node storage, so neither
+        // GetState() nor the infer call needs to synchronize the data with a mirror copy
+        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()),
+                                         storage->GetData());
     }
 
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
     void Reset() override;
+
+private:
+    MemoryPtr storage;
 };
 
 }   // namespace intel_cpu
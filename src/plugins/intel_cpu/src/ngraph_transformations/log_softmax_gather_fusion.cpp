@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "log_softmax_gather_fusion.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include "op/log_softmax_gather.hpp"
+
+#include "itt.hpp"
+
+ov::intel_cpu::LogSoftmaxGatherFusion::LogSoftmaxGatherFusion() {
+    MATCHER_SCOPE(LogSoftmaxGatherFusion);
+    auto logSoftmax = ngraph::pattern::wrap_type<ngraph::opset5::LogSoftmax>({ ngraph::pattern::any_input() },
+                                                                             ngraph::pattern::consumers_count(1));
+    auto axis_constant = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto gather = ngraph::pattern::wrap_type<ngraph::opset8::Gather>({ logSoftmax,
+                                                                      ngraph::pattern::any_input(),
+                                                                      axis_constant });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto gatherNode = std::dynamic_pointer_cast<ngraph::opset8::Gather>(m.get_match_root());
+        if (!gatherNode) {
+            return false;
+        }
+        const auto& input_pshape = gatherNode->get_input_partial_shape(0);
+        if (input_pshape.rank().is_dynamic()) {
+            return false;
+        }
+        const auto rank = input_pshape.rank().get_length();
+
+        auto logSoftmaxNode = std::dynamic_pointer_cast<ngraph::opset5::LogSoftmax>(
+            gatherNode->get_input_node_shared_ptr(0));
+        if (!logSoftmaxNode) {
+            return false;
+        }
+        int64_t axis = logSoftmaxNode->get_axis();
+        if (axis < 0)
+            axis += rank;
+        // only the last-axis normalization (the vocabulary axis of a language model head) is
+        // handled by the fused kernel: the axis entries are then contiguous in memory
+        if (axis != rank - 1) {
+            return false;
+        }
+        if (gatherNode->get_axis() != axis) {
+            return false;
+        }
+        // the indices are either one shared list (batch_dims = 0) or one list per data row
+        // (all the leading dimensions are batch ones); the mixed layouts are left to the
+        // regular nodes
+        const auto batchDims = gatherNode->get_batch_dims();
+        if (batchDims != 0 && batchDims != axis) {
+            return false;
+        }
+        const auto indicesType = gatherNode->get_input_element_type(1);
+        if (indicesType != ngraph::element::i32 && indicesType != ngraph::element::i64) {
+            return false;
+        }
+
+        const auto logSoftmaxGather = std::make_shared<ov::intel_cpu::LogSoftmaxGatherNode>(
+            logSoftmaxNode->input_value(0),
+            gatherNode->input_value(1),
+            axis,
+            batchDims);
+        logSoftmaxGather->set_friendly_name(gatherNode->get_friendly_name());
+        ngraph::copy_runtime_info({ logSoftmaxNode, gatherNode }, logSoftmaxGather);
+        ngraph::replace_node(gatherNode, logSoftmaxGather);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(gather, matcher_name);
+    this->register_matcher(m, callback);
+}
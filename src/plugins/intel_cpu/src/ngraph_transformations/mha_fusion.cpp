@@ -7,6 +7,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include "op/mha.hpp"
 #include "simplify_fakequantize.hpp"
@@ -162,6 +163,7 @@ ov::intel_cpu::MHAFloatFusion2::MHAFloatFusion2() {
 
     auto in0 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto in1 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto in2 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in3 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto in4 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in5 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
@@ -173,7 +175,10 @@ ov::intel_cpu::MHAFloatFusion2::MHAFloatFusion2() {
     auto transpose0 = std::make_shared<ngraph::opset3::Transpose>(in0, in4);
     auto transpose1 = std::make_shared<ngraph::opset3::Transpose>(in1, in5);
     auto matmul0 = std::make_shared<ngraph::opset3::MatMul>(transpose0, transpose1);
-    auto add = std::make_shared<ngraph::opset4::Add>(matmul0, in3);
+    // the scale may also be applied to the matmul0 output (scores / sqrt(head_size))
+    auto mul = std::make_shared<ngraph::opset3::Multiply>(matmul0, in2);
+    auto matmul0_or_mul = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{mul, matmul0});
+    auto add = std::make_shared<ngraph::opset4::Add>(matmul0_or_mul, in3);
     auto softmax = std::make_shared<ngraph::opset1::Softmax>(add);
     auto transpose2 = std::make_shared<ngraph::opset3::Transpose>(in8, in9);
     auto matmul1 = std::make_shared<ngraph::opset3::MatMul>(softmax, transpose2);
@@ -210,6 +215,19 @@ ov::intel_cpu::MHAFloatFusion2::MHAFloatFusion2() {
         if (matmul0_node->get_transpose_a() || matmul0_node->get_transpose_b())
             return false;
 
+        std::vector<float> mul_scales;
+        if (pattern_to_output.count(mul)) {
+            auto mul_node = ngraph::as_type_ptr<ngraph::opset3::Multiply>(pattern_to_output.at(mul).get_node_shared_ptr());
+            if (!mul_node)
+                return false;
+            mul_scales = ngraph::as_type_ptr<ngraph::opset4::Constant>(mul_node->get_input_node_shared_ptr(1))->cast_vector<float>();
+
+            auto expected_shape = ngraph::Shape({1, transpose0_in.get_shape()[2], 1, 1});
+            if (mul_scales.size() != 1 && mul_node->get_input_shape(1) != expected_shape) {
+                return false;
+            }
+        }
+
         auto softmax_node = ngraph::as_type_ptr<ngraph::opset1::Softmax>(pattern_to_output.at(softmax).get_node_shared_ptr());
         if (!softmax_node)
             return false;
@@ -223,19 +241,20 @@ ov::intel_cpu::MHAFloatFusion2::MHAFloatFusion2() {
             return false;
 
         auto transpose3_node = pattern_to_output.at(transpose3).get_node_shared_ptr();
-        auto mha = std::make_shared<ov::intel_cpu::MHANode>(transpose0_in, transpose1_in, add_in1, transpose2_in, std::vector<float>(), false,
+        auto mha = std::make_shared<ov::intel_cpu::MHANode>(transpose0_in, transpose1_in, add_in1, transpose2_in, mul_scales, false,
                                                             transpose3_node->get_output_element_type(0));
         mha->set_friendly_name(m.get_match_root()->get_friendly_name());
-        ngraph::copy_runtime_info({pattern_to_output.at(transpose0).get_node_shared_ptr(),
-                                   pattern_to_output.at(transpose1).get_node_shared_ptr(),
-                                   pattern_to_output.at(matmul0).get_node_shared_ptr(),
-                                   pattern_to_output.at(add).get_node_shared_ptr(),
-                                   pattern_to_output.at(softmax).get_node_shared_ptr(),
-                                   pattern_to_output.at(transpose2).get_node_shared_ptr(),
-                                   pattern_to_output.at(matmul1).get_node_shared_ptr(),
-                                   pattern_to_output.at(transpose3).get_node_shared_ptr(),
-                                  },
-                                  mha);
+        ngraph::NodeVector fused_nodes = {pattern_to_output.at(transpose0).get_node_shared_ptr(),
+                                          pattern_to_output.at(transpose1).get_node_shared_ptr(),
+                                          pattern_to_output.at(matmul0).get_node_shared_ptr(),
+                                          pattern_to_output.at(add).get_node_shared_ptr(),
+                                          pattern_to_output.at(softmax).get_node_shared_ptr(),
+                                          pattern_to_output.at(transpose2).get_node_shared_ptr(),
+                                          pattern_to_output.at(matmul1).get_node_shared_ptr(),
+                                          pattern_to_output.at(transpose3).get_node_shared_ptr()};
+        if (pattern_to_output.count(mul))
+            fused_nodes.push_back(pattern_to_output.at(mul).get_node_shared_ptr());
+        ngraph::copy_runtime_info(fused_nodes, mha);
 
         if (transformation_callback(mha)) {
             return false;
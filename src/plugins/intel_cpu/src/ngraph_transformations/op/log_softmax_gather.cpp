@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "log_softmax_gather.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::LogSoftmaxGatherNode::LogSoftmaxGatherNode(const ngraph::Output<ngraph::Node>& data,
+                                                          const ngraph::Output<ngraph::Node>& indices,
+                                                          const int64_t axis,
+                                                          const int64_t batch_dims)
+    : Op({data, indices}), m_axis(axis), m_batch_dims(batch_dims) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::LogSoftmaxGatherNode::clone_with_new_inputs(
+        const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(LogSoftmaxGatherNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::LogSoftmaxGatherNode>(new_args.at(0), new_args.at(1), m_axis, m_batch_dims);
+}
+
+void ov::intel_cpu::LogSoftmaxGatherNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(LogSoftmaxGatherNode_validate_and_infer_types);
+    const auto& data_pshape = get_input_partial_shape(0);
+    const auto& indices_pshape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+        data_pshape.rank().is_static() && indices_pshape.rank().is_static(),
+        "input shape ranks must be static");
+    const auto rank = data_pshape.rank().get_length();
+    NODE_VALIDATION_CHECK(this,
+        m_axis == rank - 1,
+        "normalized axis must be the last data dimension");
+    const auto indices_rank = indices_pshape.rank().get_length();
+    NODE_VALIDATION_CHECK(this,
+        m_batch_dims >= 0 && m_batch_dims <= indices_rank && m_batch_dims <= m_axis,
+        "batch_dims must be within the indices and data ranks");
+
+    // Gather over the last axis: data.shape[:axis] + indices.shape[batch_dims:]
+    std::vector<ngraph::Dimension> output_dims;
+    for (int64_t i = 0; i < m_axis; i++)
+        output_dims.push_back(data_pshape[i]);
+    for (int64_t i = m_batch_dims; i < indices_rank; i++)
+        output_dims.push_back(indices_pshape[i]);
+    set_output_type(0, get_input_element_type(0), ngraph::PartialShape(output_dims));
+}
+
+bool ov::intel_cpu::LogSoftmaxGatherNode::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(LogSoftmaxGatherNode_visit_attributes);
+    visitor.on_attribute("axis", m_axis);
+    visitor.on_attribute("batch_dims", m_batch_dims);
+    return true;
+}
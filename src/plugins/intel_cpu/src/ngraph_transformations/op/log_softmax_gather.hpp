@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Fused LogSoftmax + Gather over the normalization axis. When only a handful of entries of a
+ * log-softmax output are looked up (scoring selected token ids of a language model head), the
+ * full normalized tensor never has to be materialized: the log-denominator is accumulated in a
+ * single streaming pass over the axis and only the gathered entries are normalized against it.
+ * Input 0 - the logits, input 1 - the indices to gather along the axis. The axis is the last
+ * dimension of the data; batch_dims carries the Gather semantics of the replaced node.
+ */
+class LogSoftmaxGatherNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("LogSoftmaxGather", "cpu_plugin_opset");
+
+    LogSoftmaxGatherNode() = default;
+
+    LogSoftmaxGatherNode(const ngraph::Output<ngraph::Node>& data,
+                         const ngraph::Output<ngraph::Node>& indices,
+                         const int64_t axis,
+                         const int64_t batch_dims);
+
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    int64_t get_axis() const { return m_axis; }
+    int64_t get_batch_dims() const { return m_batch_dims; }
+
+private:
+    int64_t m_axis = 0;
+    int64_t m_batch_dims = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
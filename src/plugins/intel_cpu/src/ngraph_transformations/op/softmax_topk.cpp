@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "softmax_topk.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::SoftmaxTopKNode::SoftmaxTopKNode(const ngraph::Output<ngraph::Node>& data,
+                                                const int64_t axis,
+                                                const size_t k,
+                                                const ngraph::op::TopKSortType sort_type,
+                                                const ngraph::element::Type index_element_type)
+    : Op({data}), m_axis(axis), m_k(k), m_sort_type(sort_type), m_index_element_type(index_element_type) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::SoftmaxTopKNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(SoftmaxTopKNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::SoftmaxTopKNode>(new_args.at(0), m_axis, m_k, m_sort_type, m_index_element_type);
+}
+
+void ov::intel_cpu::SoftmaxTopKNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(SoftmaxTopKNode_validate_and_infer_types);
+    const auto& input_pshape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+        input_pshape.rank().is_static(),
+        "input shape rank must be static");
+    const auto rank = input_pshape.rank().get_length();
+    NODE_VALIDATION_CHECK(this,
+        m_axis >= 0 && m_axis < rank,
+        "normalized axis must be within the input rank");
+    NODE_VALIDATION_CHECK(this, m_k > 0, "k must be positive");
+
+    auto output_pshape = input_pshape;
+    output_pshape[m_axis] = Dimension(m_k);
+    set_output_type(0, get_input_element_type(0), output_pshape);
+    set_output_type(1, m_index_element_type, output_pshape);
+}
+
+bool ov::intel_cpu::SoftmaxTopKNode::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(SoftmaxTopKNode_visit_attributes);
+    visitor.on_attribute("axis", m_axis);
+    visitor.on_attribute("k", m_k);
+    visitor.on_attribute("sort", m_sort_type);
+    visitor.on_attribute("index_element_type", m_index_element_type);
+    return true;
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+#include <ngraph/op/topk.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Fused Softmax + TopK(mode = max) over the same axis. Since softmax is monotonic,
+ * the top k probabilities correspond to the top k logits, so the full softmax output
+ * never has to be materialized: only the k selected entries are exponentiated and
+ * normalized (against the exact full-axis denominator).
+ * Output 0 - the k largest softmax values, output 1 - their indices along the axis.
+ */
+class SoftmaxTopKNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("SoftmaxTopK", "cpu_plugin_opset");
+
+    SoftmaxTopKNode() = default;
+
+    SoftmaxTopKNode(const ngraph::Output<ngraph::Node>& data,
+                    const int64_t axis,
+                    const size_t k,
+                    const ngraph::op::TopKSortType sort_type,
+                    const ngraph::element::Type index_element_type);
+
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    int64_t get_axis() const { return m_axis; }
+    size_t get_k() const { return m_k; }
+    ngraph::op::TopKSortType get_sort_type() const { return m_sort_type; }
+    ngraph::element::Type get_index_element_type() const { return m_index_element_type; }
+
+private:
+    int64_t m_axis = 0;
+    size_t m_k = 0;
+    ngraph::op::TopKSortType m_sort_type = ngraph::op::TopKSortType::SORT_VALUES;
+    ngraph::element::Type m_index_element_type = ngraph::element::i32;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "softmax_topk_fusion.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include "op/softmax_topk.hpp"
+
+#include "itt.hpp"
+
+ov::intel_cpu::SoftmaxTopKFusion::SoftmaxTopKFusion() {
+    MATCHER_SCOPE(SoftmaxTopKFusion);
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>({ ngraph::pattern::any_input() },
+                                                                                               ngraph::pattern::consumers_count(1));
+    auto k_constant = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto topk = ngraph::pattern::wrap_type<ngraph::opset1::TopK, ngraph::opset3::TopK>({ softmax, k_constant });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto topKNode = std::dynamic_pointer_cast<ngraph::op::v1::TopK>(m.get_match_root());
+        if (!topKNode) {
+            return false;
+        }
+        // only the max mode keeps the selection equivalent: softmax is monotonic, so the k largest
+        // probabilities are exactly the k largest logits
+        if (topKNode->get_mode() != ngraph::op::TopKMode::MAX) {
+            return false;
+        }
+        const auto& input_pshape = topKNode->get_input_partial_shape(0);
+        if (input_pshape.rank().is_dynamic()) {
+            return false;
+        }
+        const auto rank = input_pshape.rank().get_length();
+        const int64_t axis = topKNode->get_axis();
+
+        auto softmaxNode = topKNode->get_input_node_shared_ptr(0);
+        int64_t softmaxAxis = 0;
+        if (auto softmaxV1 = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(softmaxNode)) {
+            softmaxAxis = static_cast<int64_t>(softmaxV1->get_axis());
+        } else if (auto softmaxV8 = std::dynamic_pointer_cast<ngraph::opset8::Softmax>(softmaxNode)) {
+            softmaxAxis = softmaxV8->get_axis();
+            if (softmaxAxis < 0)
+                softmaxAxis += rank;
+        } else {
+            return false;
+        }
+        if (softmaxAxis != axis) {
+            return false;
+        }
+
+        auto kNode = std::dynamic_pointer_cast<ngraph::opset1::Constant>(topKNode->get_input_node_shared_ptr(1));
+        if (!kNode || ngraph::shape_size(kNode->get_shape()) != 1) {
+            return false;
+        }
+        const int64_t k = kNode->cast_vector<int64_t>()[0];
+        // the fused kernel keeps the candidates in a small insertion-sorted list, which loses to
+        // a full sort once k stops being small relative to the axis; classification heads use k <= 5
+        if (k < 1 || k > 32) {
+            return false;
+        }
+
+        const auto softmaxTopK = std::make_shared<ov::intel_cpu::SoftmaxTopKNode>(softmaxNode->input_value(0),
+                                                                                  axis,
+                                                                                  static_cast<size_t>(k),
+                                                                                  topKNode->get_sort_type(),
+                                                                                  topKNode->get_index_element_type());
+        softmaxTopK->set_friendly_name(topKNode->get_friendly_name());
+        ngraph::copy_runtime_info({ softmaxNode, topKNode }, softmaxTopK);
+        ngraph::replace_node(topKNode, softmaxTopK);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(topk, matcher_name);
+    this->register_matcher(m, callback);
+}
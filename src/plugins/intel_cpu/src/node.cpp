@@ -6,6 +6,7 @@
 #include "edge.h"
 #include "extension_mngr.h"
 #include "itt.h"
+#include "onednn/itt.h"
 
 #include "caseless.hpp"
 #include <vector>
@@ -531,8 +532,18 @@ std::vector<memory::format_tag> Node::getAvailableFormatsForDims(const Shape &di
     return {memory::format_tag::any};
 }
 
+openvino::itt::handle_t Node::primExecItt(const dnnl::primitive& prim) {
+    const auto rawPrim = prim.get();
+    if (primIttHandleFor != rawPrim) {
+        primIttHandle = primitive_itt_handle(getName(), prim);
+        primIttHandleFor = rawPrim;
+    }
+    return primIttHandle;
+}
+
 void Node::execute(dnnl::stream strm) {
     if (prim) {
+        OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, primExecItt(*prim));
         (*prim).execute(strm, primArgs);
     }
 }
@@ -1519,12 +1530,28 @@ std::vector<VectorDims> Node::shapeInfer() const {
         for (size_t port = 0; port < inputShapes.size(); ++port)
             input_shapes.emplace_back(std::ref(getParentEdgesAtPort(port)[0]->getMemory().getStaticDims()));
 
+        // when no input values participate, the result is a pure function of the input shapes, so
+        // it is memoized; this helps traffic which cycles over a small set of distinct shapes,
+        // where the inputShapesModified() check can't suppress the re-inference
+        if (EMPTY_PORT_MASK == input_value_port_mask) {
+            std::vector<VectorDims> key;
+            key.reserve(input_shapes.size());
+            for (const auto& shape : input_shapes)
+                key.push_back(shape.get());
+            auto itCache = shapeInferResultsCache.find(key);
+            if (itCache != shapeInferResultsCache.end())
+                return itCache->second;
+            auto result = shapeInference->infer(input_shapes, {});
+            if (shapeInferResultsCache.size() >= shapeInferResultsCacheCapacity)
+                shapeInferResultsCache.clear();
+            shapeInferResultsCache.emplace(std::move(key), result);
+            return result;
+        }
+
         std::unordered_map<size_t, MemoryPtr> input_values;
-        if (input_value_port_mask) {
-            for (size_t port = 0; port < inputShapes.size(); ++port) {
-                if (input_value_port_mask & (1 << port)) {
-                    input_values[port] = getParentEdgesAtPort(port)[0]->getMemoryPtr();
-                }
+        for (size_t port = 0; port < inputShapes.size(); ++port) {
+            if (input_value_port_mask & (1 << port)) {
+                input_values[port] = getParentEdgesAtPort(port)[0]->getMemoryPtr();
             }
         }
 
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <ie_api.h>
+#include <ie_common.h>
+#include <map>
 #include <memory>
 #include <vector>
 #include <string>
@@ -331,6 +333,13 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    /**
+     * @brief Appends profiling info of inner graph nodes to the perf map.
+     * Overridden by nodes which run nested graphs (e.g. If) so that per-branch
+     * counters show up in the profiling report; no-op for ordinary nodes.
+     */
+    virtual void appendSubGraphPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const {}
+
     virtual void setDynamicBatchLim(int lim);
 
     void resolveInPlaceEdges();
@@ -630,6 +639,11 @@ protected:
     Primitive prim;
     std::vector<DnnlDesriptor> descs;
 
+    // ITT region naming the given oneDNN primitive after this node and the implementation
+    // oneDNN actually instantiated; memoized per primitive, so dynamic shapes that
+    // re-dispatch to a different kernel refresh the attribution automatically.
+    openvino::itt::handle_t primExecItt(const dnnl::primitive& prim);
+
     const GraphContext::CPtr context;
 
     Algorithm algorithm = Algorithm::Default;
@@ -700,7 +714,15 @@ protected:
 
     MemoryPtr getScratchPadMem(const const_dnnl_primitive_desc_t& pd) {
         auto scratchpadMemoryDesc = DnnlExtensionUtils::query_md(pd, dnnl::query::scratchpad_md);
-        scratchpadMem = context->getScratchPad()->createScratchPadMem(scratchpadMemoryDesc);
+        if (context->getConfig().intraGraphParallelism > 0) {
+            // with intra-graph parallelism data-independent nodes execute concurrently, so the
+            // shared scratchpad (one buffer for the whole graph) cannot be used: every node keeps
+            // a private allocation, same as the individually allocated edges in Graph::Allocate
+            scratchpadMem = std::make_shared<Memory>(context->getEngine());
+            scratchpadMem->Create(scratchpadMemoryDesc);
+        } else {
+            scratchpadMem = context->getScratchPad()->createScratchPadMem(scratchpadMemoryDesc);
+        }
         return scratchpadMem;
     }
 
@@ -708,6 +730,11 @@ protected:
 
     std::shared_ptr<IShapeInfer> shapeInference;
 
+    // memoized shape inference results for the value-independent nodes, keyed by the input shapes
+    // (see Node::shapeInfer); sized for traffic cycling over a small set of distinct shapes
+    static constexpr size_t shapeInferResultsCacheCapacity = 16;
+    mutable std::map<std::vector<VectorDims>, std::vector<VectorDims>> shapeInferResultsCache;
+
 private:
     std::vector<EdgeWeakPtr> parentEdges;
     std::vector<EdgeWeakPtr> childEdges;
@@ -729,6 +756,11 @@ private:
     PerfCount perfCounter;
     PerfCounters profiling;
 
+    // cache behind primExecItt(): the handle stays valid for the collection lifetime,
+    // so only the raw primitive it was built for needs tracking
+    openvino::itt::handle_t primIttHandle = nullptr;
+    dnnl_primitive_t primIttHandleFor = nullptr;
+
     MemoryPtr scratchpadMem;
 
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
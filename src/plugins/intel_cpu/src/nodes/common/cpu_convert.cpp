@@ -55,6 +55,100 @@ void convert_vec<float, ov::float16>(jit_generator & gen,
     gen.movdqu(gen.xword[dst], f16vec);
 }
 
+// The specializations below cover the widening (lossless) pairs the frontends insert around
+// integral subgraphs; they need no saturation, so a plain vector conversion is exact.
+
+template <>
+void convert_vec<uint8_t, float>(jit_generator & gen,
+                                 const RegExp & src,
+                                 const RegExp & dst) {
+    auto const & i32vec = gen.ymm3;
+
+    gen.vpmovzxbd(i32vec, gen.qword[src]);
+    gen.vcvtdq2ps(i32vec, i32vec);
+    gen.vmovups(gen.yword[dst], i32vec);
+}
+
+template <>
+void convert_vec<int8_t, float>(jit_generator & gen,
+                                const RegExp & src,
+                                const RegExp & dst) {
+    auto const & i32vec = gen.ymm3;
+
+    gen.vpmovsxbd(i32vec, gen.qword[src]);
+    gen.vcvtdq2ps(i32vec, i32vec);
+    gen.vmovups(gen.yword[dst], i32vec);
+}
+
+template <>
+void convert_vec<uint16_t, float>(jit_generator & gen,
+                                  const RegExp & src,
+                                  const RegExp & dst) {
+    auto const & i32vec = gen.ymm3;
+
+    gen.vpmovzxwd(i32vec, gen.xword[src]);
+    gen.vcvtdq2ps(i32vec, i32vec);
+    gen.vmovups(gen.yword[dst], i32vec);
+}
+
+template <>
+void convert_vec<int16_t, float>(jit_generator & gen,
+                                 const RegExp & src,
+                                 const RegExp & dst) {
+    auto const & i32vec = gen.ymm3;
+
+    gen.vpmovsxwd(i32vec, gen.xword[src]);
+    gen.vcvtdq2ps(i32vec, i32vec);
+    gen.vmovups(gen.yword[dst], i32vec);
+}
+
+template <>
+void convert_vec<int32_t, float>(jit_generator & gen,
+                                 const RegExp & src,
+                                 const RegExp & dst) {
+    auto const & i32vec = gen.ymm3;
+
+    gen.vmovups(i32vec, gen.yword[src]);
+    gen.vcvtdq2ps(i32vec, i32vec);
+    gen.vmovups(gen.yword[dst], i32vec);
+}
+
+template <>
+void convert_vec<uint8_t, int64_t>(jit_generator & gen,
+                                   const RegExp & src,
+                                   const RegExp & dst) {
+    auto const & i64vec = gen.ymm3;
+
+    gen.vpmovzxbq(i64vec, gen.dword[src]);
+    gen.vmovups(gen.yword[dst], i64vec);
+    gen.vpmovzxbq(i64vec, gen.dword[src + 4]);
+    gen.vmovups(gen.yword[dst + 32], i64vec);
+}
+
+template <>
+void convert_vec<int8_t, int64_t>(jit_generator & gen,
+                                  const RegExp & src,
+                                  const RegExp & dst) {
+    auto const & i64vec = gen.ymm3;
+
+    gen.vpmovsxbq(i64vec, gen.dword[src]);
+    gen.vmovups(gen.yword[dst], i64vec);
+    gen.vpmovsxbq(i64vec, gen.dword[src + 4]);
+    gen.vmovups(gen.yword[dst + 32], i64vec);
+}
+
+template <>
+void convert_vec<float, double>(jit_generator & gen,
+                                const RegExp & src,
+                                const RegExp & dst) {
+    auto const & f64vec = gen.ymm4;
+
+    gen.vcvtps2pd(f64vec, gen.xword[src]);
+    gen.vmovups(gen.yword[dst], f64vec);
+    gen.vcvtps2pd(f64vec, gen.xword[src + 16]);
+    gen.vmovups(gen.yword[dst + 32], f64vec);
+}
+
 class jit_convert_array : public jit_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_convert_array)
 
@@ -80,23 +174,26 @@ class jit_convert_array : public jit_kernel {
         mov(size, argPtr(&args_t::count));
         size &= vlen - 1;
 
-        // Tail conversion
+        // Tail conversion. Separate staging areas are used for the source and the destination:
+        // the widening pairs write more bytes than they read, so an in-place conversion would
+        // clobber the not yet consumed source elements.
         _if(size != 0)
         ._then([&] {
-            auto tmp = stack(vlen * sizeof(float));
-            tmp.clear();
+            auto src_tmp = stack(vlen * sizeof(double));
+            auto dst_tmp = stack(vlen * sizeof(double));
+            src_tmp.clear();
 
             auto tail_size = var<size_t>();
 
             tail_size = size;
-            tail_size <<= static_cast<size_t>(std::logb(_src_size)) - 1;
-            copy<uint16_t>(tmp.pointer(), src, tail_size);
+            tail_size <<= static_cast<size_t>(std::logb(_src_size));
+            copy<uint8_t>(src_tmp.pointer(), src, tail_size);
 
-            _convert_vec(*this, tmp.pointer(), tmp.pointer());
+            _convert_vec(*this, src_tmp.pointer(), dst_tmp.pointer());
 
             tail_size = size;
-            tail_size <<= static_cast<size_t>(std::logb(_dst_size)) - 1;
-            copy<uint16_t>(dst, tmp.pointer(), tail_size);
+            tail_size <<= static_cast<size_t>(std::logb(_dst_size));
+            copy<uint8_t>(dst, dst_tmp.pointer(), tail_size);
         });
 
         postamble();
@@ -156,6 +253,41 @@ void jit_convert(const TI* arg, TO* out, size_t count) {
     }
 }
 
+// Pairs a convert_vec emitter exists for; jit_convert_array::get() must only be instantiated
+// for them, the primary convert_vec template is left undefined on purpose
+template <typename TI, typename TO>
+struct jit_has_conversion : std::false_type {};
+template <> struct jit_has_conversion<uint8_t, float> : std::true_type {};
+template <> struct jit_has_conversion<int8_t, float> : std::true_type {};
+template <> struct jit_has_conversion<uint16_t, float> : std::true_type {};
+template <> struct jit_has_conversion<int16_t, float> : std::true_type {};
+template <> struct jit_has_conversion<int32_t, float> : std::true_type {};
+template <> struct jit_has_conversion<uint8_t, int64_t> : std::true_type {};
+template <> struct jit_has_conversion<int8_t, int64_t> : std::true_type {};
+template <> struct jit_has_conversion<float, double> : std::true_type {};
+
+// Runs the jitted kernel when the pair has an emitter and the ISA prerequisites are met;
+// returns false (without touching the data) otherwise, so the caller falls back to the
+// scalar loop
+template <typename TI, typename TO>
+typename std::enable_if<jit_has_conversion<TI, TO>::value, bool>::type
+try_jit_convert(const TI* arg, TO* out, size_t count) {
+    using jit_impl = jit_convert_array;
+    static auto converter = jit_impl::get<TI, TO>();
+
+    if (!converter)
+        return false;
+    typename jit_impl::args_t args = { arg, out, count };
+    converter(&args);
+    return true;
+}
+
+template <typename TI, typename TO>
+typename std::enable_if<!jit_has_conversion<TI, TO>::value, bool>::type
+try_jit_convert(const TI*, TO*, size_t) {
+    return false;
+}
+
 template <Precision::ePrecision p>
 struct PrecisionInfo {
     using value_type = typename PrecisionTrait<p>::value_type;
@@ -296,6 +428,22 @@ struct ConvertPrecision<std::tuple<src_t, dst_t>> {
         src_t lbound, ubound;
         std::tie(lbound, ubound) = ctx.range<src_t>();
 
+        // When the composed range does not narrow the source domain the conversion is a plain
+        // cast, so the pairs covered by a jitted kernel skip the scalar loop entirely (the probe
+        // with a zero count only checks the kernel availability)
+        if (lbound <= std::numeric_limits<src_t>::lowest() && ubound >= std::numeric_limits<src_t>::max()
+            && (std::is_integral<src_t>::value || ctx.interimPrc.is_float())
+            && try_jit_convert(src, dst, 0)) {
+            constexpr size_t batch = 1024;
+            parallel_for(ov::intel_cpu::div_up(ctx.size, batch), [&](size_t i) {
+                const size_t offset = i * batch;
+                const size_t current_batch_size = std::min(ctx.size - offset, batch);
+                try_jit_convert(src + offset, dst + offset, current_batch_size);
+            });
+            ctx.converted = true;
+            return;
+        }
+
         if (std::is_integral<src_t>::value
             || ctx.interimPrc.is_float()
             || std::is_integral<dst_t>::value) {
@@ -4,9 +4,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include "ie_api.h"
 
+// The streaming stores below need SSE2, which is part of the x86-64 baseline so every compiler
+// enables it there unconditionally (32-bit MSVC reports it via _M_IX86_FP when /arch allows);
+// checking the compiler baseline instead of build-system flags keeps the path from silently
+// degrading to the scalar fallback when no SIMD definition reaches this target.
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CPU_MEMCPY_HAVE_STREAMING_STORES
+#include <immintrin.h>
+#endif
+
 namespace ov {
 namespace intel_cpu {
 
@@ -34,6 +45,38 @@ inline void cpu_memcpy(void* dst, const void* src, size_t count) {
 #endif
 }
 
+/**
+ * @brief Copies bytes between buffers bypassing the caches with streaming stores
+ * When the destination is much larger than the LLC its lines are not going to be
+ * read back soon, so streaming them out avoids both evicting useful data and the
+ * read-for-ownership traffic of regular stores. Falls back to cpu_memcpy when
+ * streaming stores are not available.
+ */
+inline void cpu_memcpy_nt(void* dst, const void* src, size_t count) {
+#ifdef CPU_MEMCPY_HAVE_STREAMING_STORES
+    auto dstU8 = static_cast<uint8_t*>(dst);
+    auto srcU8 = static_cast<const uint8_t*>(src);
+    // head part: bytes before the 16 byte alignment the streaming store requires
+    const size_t headPart = std::min(count, (16 - reinterpret_cast<uintptr_t>(dstU8) % 16) % 16);
+    cpu_memcpy(dstU8, srcU8, headPart);
+    dstU8 += headPart;
+    srcU8 += headPart;
+    count -= headPart;
+
+    const size_t mainPart = count / 16;
+    for (size_t e = 0; e < mainPart; ++e) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dstU8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcU8)));
+        dstU8 += 16;
+        srcU8 += 16;
+    }
+    cpu_memcpy(dstU8, srcU8, count - mainPart * 16);
+    // make the streamed data globally visible before the output is consumed
+    _mm_sfence();
+#else
+    cpu_memcpy(dst, src, count);
+#endif
+}
+
 inline int cpu_memcpy_s(void* dst, size_t dst_size, const void* src, size_t count) {
     if (!src ||
         count > dst_size ||
@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Software prefetch hint for gather-like access patterns.
+ * The addresses to be read are known from an index tensor well before the reads
+ * themselves happen, so hinting them a few iterations in advance hides a part of
+ * the memory latency when the accesses miss the caches.
+ * @param ptr
+ * address expected to be read soon
+ */
+
+inline void cpu_prefetch(const void* ptr) {
+#if defined(__GNUC__)
+    __builtin_prefetch(ptr);
+#else
+    (void)ptr;
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -14,6 +14,10 @@
 #include "cpu/x64/jit_generator.hpp"
 #include <common/primitive_hashing_utils.hpp>
 
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
 using namespace InferenceEngine;
 using namespace dnnl;
 using namespace dnnl::impl;
@@ -257,6 +261,17 @@ void PermuteKernel::prepareParams() {
     jcp.ndims = sorted_order.size();
     jcp.data_size = params.data_size;
 
+    // The jit kernel degrades to scalar element moves when the permutation swaps the innermost dims
+    // (e.g. the last two dims of an attention transpose), since neither the source nor the destination
+    // is contiguous along the common inner loop. For this stride pattern a cache blocked transpose
+    // over the two innermost dims with an in-register micro tile performs much better.
+    const size_t m = sorted_order.size();
+    use_blocked_transpose = m >= 2 &&
+                            sorted_dst_strides[m - 1] == 1 && sorted_src_strides[m - 2] == 1 &&
+                            sorted_src_strides[m - 1] != 1;
+    if (use_blocked_transpose)
+        return;
+
     if (mayiuse(cpu::x64::avx512_core)) {
         permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::avx512_core>(jcp));
     } else if (mayiuse(cpu::x64::avx2)) {
@@ -270,6 +285,11 @@ void PermuteKernel::prepareParams() {
 }
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    if (use_blocked_transpose) {
+        blockedTransposeExecute(src_data, dst_data, mb);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, mb);
         return;
@@ -280,6 +300,11 @@ void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const in
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data) {
     SizeVector dst_dims = jcp.dst_block_dims;
+    if (use_blocked_transpose) {
+        blockedTransposeExecute(src_data, dst_data, dst_dims[0]);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, dst_dims[0]);
         return;
@@ -337,6 +362,86 @@ void PermuteKernel::optimizedExecute(const uint8_t* src_data, uint8_t* dst_data,
     return;
 }
 
+void PermuteKernel::blockedTransposeExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    SizeVector dst_dims = jcp.dst_block_dims;
+    const SizeVector& dst_strides = jcp.dst_strides;
+    const SizeVector& src_strides = jcp.src_strides;
+    const size_t data_size = jcp.data_size;
+    const size_t ndims = dst_dims.size();
+
+    if (dst_dims[0] != mb)
+        dst_dims[0] = mb;
+
+    // the two innermost dims form a 2D transpose: the source is contiguous along the rows,
+    // the destination is contiguous along the columns
+    const size_t rows = dst_dims[ndims - 2];
+    const size_t cols = dst_dims[ndims - 1];
+    const size_t src_col_stride = src_strides[ndims - 1];
+    const size_t dst_row_stride = dst_strides[ndims - 2];
+
+    size_t outer_work = 1;
+    for (size_t i = 0; i + 2 < ndims; i++)
+        outer_work *= dst_dims[i];
+
+    //  the block edge is chosen so that the tiles of both tensors stay within L1
+    const size_t blk = 64;
+    const size_t row_blocks = div_up(rows, blk);
+
+    parallel_for2d(outer_work, row_blocks, [&](size_t o, size_t rb) {
+        size_t src_off = 0;
+        size_t dst_off = 0;
+        for (int i = static_cast<int>(ndims) - 3; i >= 0; i--) {
+            const size_t idx = o % dst_dims[i];
+            o /= dst_dims[i];
+            src_off += idx * src_strides[i];
+            dst_off += idx * dst_strides[i];
+        }
+
+        const size_t i_start = rb * blk;
+        const size_t i_end = std::min(i_start + blk, rows);
+        for (size_t k_start = 0; k_start < cols; k_start += blk) {
+            const size_t k_end = std::min(k_start + blk, cols);
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            if (data_size == 4) {
+                const float* src = reinterpret_cast<const float*>(src_data) + src_off;
+                float* dst = reinterpret_cast<float*>(dst_data) + dst_off;
+                size_t i = i_start;
+                for (; i + 4 <= i_end; i += 4) {
+                    size_t k = k_start;
+                    for (; k + 4 <= k_end; k += 4) {
+                        __m128 row0 = _mm_loadu_ps(&src[(k + 0) * src_col_stride + i]);
+                        __m128 row1 = _mm_loadu_ps(&src[(k + 1) * src_col_stride + i]);
+                        __m128 row2 = _mm_loadu_ps(&src[(k + 2) * src_col_stride + i]);
+                        __m128 row3 = _mm_loadu_ps(&src[(k + 3) * src_col_stride + i]);
+                        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+                        _mm_storeu_ps(&dst[(i + 0) * dst_row_stride + k], row0);
+                        _mm_storeu_ps(&dst[(i + 1) * dst_row_stride + k], row1);
+                        _mm_storeu_ps(&dst[(i + 2) * dst_row_stride + k], row2);
+                        _mm_storeu_ps(&dst[(i + 3) * dst_row_stride + k], row3);
+                    }
+                    for (; k < k_end; k++) {
+                        for (size_t ii = i; ii < i + 4; ii++)
+                            dst[ii * dst_row_stride + k] = src[k * src_col_stride + ii];
+                    }
+                }
+                for (; i < i_end; i++) {
+                    for (size_t k = k_start; k < k_end; k++)
+                        dst[i * dst_row_stride + k] = src[k * src_col_stride + i];
+                }
+                continue;
+            }
+#endif
+            for (size_t i = i_start; i < i_end; i++) {
+                for (size_t k = k_start; k < k_end; k++) {
+                    cpu_memcpy(&dst_data[(dst_off + i * dst_row_stride + k) * data_size],
+                               &src_data[(src_off + i + k * src_col_stride) * data_size],
+                               data_size);
+                }
+            }
+        }
+    });
+}
+
 static inline size_t parallel_init(size_t start, size_t nDims, const SizeVector& dims, SizeVector& indexes) {
     for (int j = nDims - 1; j >= 0; j--) {
         indexes[j] = start % dims[j];
@@ -69,8 +69,10 @@ private:
     void prepareParams();
 
     void optimizedExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
+    void blockedTransposeExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
     void referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
 
+    bool use_blocked_transpose = false;
     jit_permute_config_params jcp = {};
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
     PermuteParams params;
@@ -624,12 +624,19 @@ void Concat::execRef() {
         return i * elemSize;
     });
     if (!hasOuterLoop) {
+        // Back-to-back input copies are pure bandwidth; once an input no longer fits the LLC its
+        // destination lines won't be read back soon, so stream the stores instead of caching them
+        const auto LLCSize = static_cast<size_t>(dnnl::utils::get_cache_size(3, false));
         int nthr = parallel_get_max_threads();
         if (nthr == 1) {
             for (size_t a = 0; a < srcPtrs.size(); ++a) {
                 const auto inData = srcPtrs[a];
                 auto outputData = &dstPtr[dstOffset[a]];
-                std::memcpy(outputData, inData, nelemToCopy[a]);
+                if (LLCSize && nelemToCopy[a] > LLCSize) {
+                    cpu_memcpy_nt(outputData, inData, nelemToCopy[a]);
+                } else {
+                    std::memcpy(outputData, inData, nelemToCopy[a]);
+                }
             }
         } else {
             parallel_nt(nthr, [&](int ithr, int nthr) {
@@ -638,7 +645,11 @@ void Concat::execRef() {
                     splitter(nelemToCopy[a], nthr, ithr, start, end);
                     const uint8_t* i = srcPtrs[a] + start;
                     uint8_t* o = dstPtr + dstOffset[a] + start;
-                    std::memcpy(o, i, end - start);
+                    if (LLCSize && nelemToCopy[a] > LLCSize) {
+                        cpu_memcpy_nt(o, i, end - start);
+                    } else {
+                        std::memcpy(o, i, end - start);
+                    }
                 }
             });
         }
@@ -10,7 +10,10 @@
 #include "pooling.h"
 #include "concat.h"
 #include <graph.h>
+#include "itt.h"
+#include "onednn/itt.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include <chrono>
 #include <string>
 #include <vector>
 #include <dnnl_types.h>
@@ -283,6 +286,18 @@ Convolution::Convolution(const std::shared_ptr<ngraph::Node>& op, const GraphCon
     }
 }
 
+void Convolution::absorbInputPadding(const std::vector<unsigned int>& padsBegin, const std::vector<unsigned int>& padsEnd) {
+    auto srcDims = getInputShapeAtPort(0).getStaticDims();
+    const size_t spatialOffset = srcDims.size() - paddingL.size();
+    for (size_t i = 0; i < paddingL.size(); i++) {
+        paddingL[i] += padsBegin[spatialOffset + i];
+        paddingR[i] += padsEnd[spatialOffset + i];
+        srcDims[spatialOffset + i] -= padsBegin[spatialOffset + i] + padsEnd[spatialOffset + i];
+    }
+    // the data input edge now comes from the producer of the dropped Pad node
+    inputShapes[0] = Shape(srcDims);
+}
+
 bool Convolution::canBeExecutedInInt8() const {
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(0));
     if (!legacyInputZeroPoints.empty())
@@ -420,7 +435,7 @@ void Convolution::getSupportedDescriptors() {
 
     // We need to make sure that convolution output and second input of fused Eltwise operation
     // have equal precision sizes since they use the same physical memory. In case precisions are different we upscale to FP32.
-    if (outputDataType != memory::data_type::f32 && outputDataType != memory::data_type::bf16 && withSum) {
+    if (!one_of(outputDataType, memory::data_type::f32, memory::data_type::bf16, memory::data_type::f16) && withSum) {
         for (int i = 0; i < fusedWith.size(); i++) {
             if (fusedWith[i]->getAlgorithm() == Algorithm::EltwiseAdd) {
                 auto* eltwiseNode = dynamic_cast<Eltwise *>(fusedWith[i].get());
@@ -490,9 +505,9 @@ void Convolution::getSupportedDescriptors() {
     MemoryDescPtr in_candidate, out_candidate;
     if (canBeExecutedInInt8()) {
         //  We have to extend convolution_x8s8s32x from oneDNN to support BF16 output data type
-        if (outputDataType == memory::data_type::bf16)
+        if (outputDataType == memory::data_type::bf16 || outputDataType == memory::data_type::f16)
             outputDataType = memory::data_type::f32;
-        if (eltwisePrecision == Precision::BF16)
+        if (eltwisePrecision == Precision::BF16 || eltwisePrecision == Precision::FP16)
             eltwisePrecision = Precision::FP32;
         // initTryBrgconvFlag depends on outputDataType, should be after outputDataType computed
         if (!enforceBrgconv)
@@ -503,10 +518,12 @@ void Convolution::getSupportedDescriptors() {
             ndims == 3 ? memory::format_tag::nwc : (ndims == 4 ? memory::format_tag::nhwc : memory::format_tag::ndhwc));
         createDescriptor({ in_candidate }, { out_candidate });
     } else {
-        inputDataType = (getOriginalInputPrecisionAtPort(0) == Precision::BF16
-                && !(isDepthWise() && ndims == 5)) ? memory::data_type::bf16 : memory::data_type::f32;
-        outputDataType = (getOriginalOutputPrecisionAtPort(0) == Precision::BF16
-                && !(isDepthWise() && ndims == 5)) ? memory::data_type::bf16 : memory::data_type::f32;
+        inputDataType = (one_of(getOriginalInputPrecisionAtPort(0), Precision::BF16, Precision::FP16)
+                && !(isDepthWise() && ndims == 5)) ?
+                        DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(0)) : memory::data_type::f32;
+        outputDataType = (one_of(getOriginalOutputPrecisionAtPort(0), Precision::BF16, Precision::FP16)
+                && !(isDepthWise() && ndims == 5)) ?
+                        DnnlExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(0)) : memory::data_type::f32;
         eltwisePrecision = Precision::FP32;
         for (int i = 0; i < fusedWith.size(); i++) {
             if (fusedWith[i]->getAlgorithm() == Algorithm::EltwiseAdd) {
@@ -520,14 +537,16 @@ void Convolution::getSupportedDescriptors() {
                     // for input of inplace tensor precision) to FP32. This will add reorder for that in-place tensor
                     // bofore the fused convolution. This behaviour might be more correct regarding expected markup
                     // of the graph but performance of first and second approaches might be different. Need to verify
-                    outputDataType = eltwisePrecision == Precision::BF16 ? memory::data_type::bf16 : memory::data_type::f32;
+                    outputDataType = one_of(eltwisePrecision, Precision::BF16, Precision::FP16)
+                            ? DnnlExtensionUtils::IEPrecisionToDataType(eltwisePrecision) : memory::data_type::f32;
                     eltwisePrecision = DnnlExtensionUtils::DataTypeToIEPrecision(outputDataType);
                 }
             }
         }
-        // correction for cases of FP32 input - we do not have FP32 convolution supported BF16 output
+        // correction for cases of FP32 input - we do not have FP32 convolution supported BF16 or FP16 output
         if (inputDataType == memory::data_type::f32
-            && (outputDataType == memory::data_type::bf16 || eltwisePrecision == Precision::BF16)) {
+            && (one_of(outputDataType, memory::data_type::bf16, memory::data_type::f16)
+                || one_of(eltwisePrecision, Precision::BF16, Precision::FP16))) {
             outputDataType = memory::data_type::f32;
             eltwisePrecision = Precision::FP32;
         }
@@ -543,7 +562,7 @@ void Convolution::getSupportedDescriptors() {
             auto inputShape = getInputShapeAtPort(0);
             auto outputShape = getOutputShapeAtPort(0);
 
-            bool acceptedFormat = inputDataType == memory::data_type::bf16;
+            bool acceptedFormat = one_of(inputDataType, memory::data_type::bf16, memory::data_type::f16);
             bool nspcAdded = false;
             acceptedFormat |= (shouldTryBrgconv && inputDataType == memory::data_type::f32);
             if (acceptedFormat && impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core)) {
@@ -576,7 +595,7 @@ void Convolution::getSupportedDescriptors() {
             out_candidate = std::make_shared<DnnlBlockedMemoryDesc>(outputShape, outputDataType, ncsp);
             createDescriptor({ in_candidate }, { out_candidate });
 
-            if (!nspcAdded && (inputDataType != memory::data_type::bf16 && isNspcAvailable())) {
+            if (!nspcAdded && (!one_of(inputDataType, memory::data_type::bf16, memory::data_type::f16) && isNspcAvailable())) {
                 in_candidate = std::make_shared<DnnlBlockedMemoryDesc>(inputShape, inputDataType, nspc);
                 out_candidate = std::make_shared<DnnlBlockedMemoryDesc>(outputShape, outputDataType, nspc);
                 createDescriptor({ in_candidate }, { out_candidate });
@@ -1330,44 +1349,44 @@ void Convolution::prepareParams() {
                    selected_pd->getImplementationType()};
 
     auto engine = getEngine();
-    auto builder = [&engine](const ConvKey& key) -> executorPtr {
-        auto createDnnlConvDesc = [](const dnnl::memory::desc& srcDesc,
-                                     const dnnl::memory::desc& wghDesc,
-                                     const dnnl::memory::desc& dstDesc,
-                                     DnnlMemoryDescCPtr biasDescPtr,
-                                     const std::vector<size_t>& stride,
-                                     const std::vector<ptrdiff_t>& dilation,
-                                     const std::vector<ptrdiff_t>& paddingL,
-                                     const std::vector<ptrdiff_t>& paddingR,
-                                     dnnl::algorithm alg) -> std::shared_ptr<DnnlDesriptor> {
-            dnnl::memory::desc dnnlBiasDesc;
-            if (biasDescPtr) {
-                // WA to align IR bias representation (3 to 5 rank tensors) to oneDNN representation (1 rank tensor)
-                dnnlBiasDesc = biasDescPtr->getDnnlDesc().reshape({dstDesc.dims()[1]});
-            }
+    auto createDnnlConvDesc = [](const dnnl::memory::desc& srcDesc,
+                                 const dnnl::memory::desc& wghDesc,
+                                 const dnnl::memory::desc& dstDesc,
+                                 DnnlMemoryDescCPtr biasDescPtr,
+                                 const std::vector<size_t>& stride,
+                                 const std::vector<ptrdiff_t>& dilation,
+                                 const std::vector<ptrdiff_t>& paddingL,
+                                 const std::vector<ptrdiff_t>& paddingR,
+                                 dnnl::algorithm alg) -> std::shared_ptr<DnnlDesriptor> {
+        dnnl::memory::desc dnnlBiasDesc;
+        if (biasDescPtr) {
+            // WA to align IR bias representation (3 to 5 rank tensors) to oneDNN representation (1 rank tensor)
+            dnnlBiasDesc = biasDescPtr->getDnnlDesc().reshape({dstDesc.dims()[1]});
+        }
 
-            return std::make_shared<DnnlDesriptor>(createDescriptorInternal(srcDesc,
-                                                                            wghDesc,
-                                                                            dnnlBiasDesc,
-                                                                            dstDesc,
-                                                                            (biasDescPtr != nullptr),
-                                                                            stride,
-                                                                            dilation,
-                                                                            paddingL,
-                                                                            paddingR,
-                                                                            alg));
-        };
+        return std::make_shared<DnnlDesriptor>(createDescriptorInternal(srcDesc,
+                                                                        wghDesc,
+                                                                        dnnlBiasDesc,
+                                                                        dstDesc,
+                                                                        (biasDescPtr != nullptr),
+                                                                        stride,
+                                                                        dilation,
+                                                                        paddingL,
+                                                                        paddingR,
+                                                                        alg));
+    };
 
+    auto builder = [&engine, &createDnnlConvDesc](const ConvKey& key) -> executorPtr {
         const auto alg = (key.implType & impl_desc_type::winograd) ? dnnl::algorithm::convolution_winograd : dnnl::algorithm::convolution_direct;
         std::shared_ptr<DnnlDesriptor> desc = createDnnlConvDesc(key.inp0->getDnnlDesc(),
-                                                                      key.inp1->getDnnlDesc(),
-                                                                      key.out->getDnnlDesc(),
-                                                                      key.bias,
-                                                                      key.stride,
-                                                                      key.dilation,
-                                                                      key.paddingL,
-                                                                      key.paddingR,
-                                                                      alg);
+                                                                 key.inp1->getDnnlDesc(),
+                                                                 key.out->getDnnlDesc(),
+                                                                 key.bias,
+                                                                 key.stride,
+                                                                 key.dilation,
+                                                                 key.paddingL,
+                                                                 key.paddingR,
+                                                                 alg);
 
         auto itpd = desc->createPrimitiveDescriptorIterator(engine, key.attr);
 
@@ -1450,6 +1469,36 @@ void Convolution::prepareParams() {
         auto pd = execPtr->getPrimitiveDesc();
         auto scratchpadMem = getScratchPadMem(pd);
         primArgs[DNNL_ARG_SCRATCHPAD] = scratchpadMem->GetPrimitive();
+
+        // adaptive implementation selection: let the top priority oneDNN implementation
+        // compete with the selected one during the warm-up window
+        altExecPtr = nullptr;
+        adaptiveItersLeft = 0;
+        if (context->getConfig().adaptiveImplSelection && !isDynamicNode()) {
+            const auto alg = (key.implType & impl_desc_type::winograd) ? dnnl::algorithm::convolution_winograd
+                                                                       : dnnl::algorithm::convolution_direct;
+            auto altDesc = createDnnlConvDesc(key.inp0->getDnnlDesc(),
+                                              key.inp1->getDnnlDesc(),
+                                              key.out->getDnnlDesc(),
+                                              key.bias,
+                                              key.stride,
+                                              key.dilation,
+                                              key.paddingL,
+                                              key.paddingR,
+                                              alg);
+            auto altItpd = altDesc->createPrimitiveDescriptorIterator(engine, key.attr);
+            if (static_cast<bool>(altItpd) && parse_impl_name(altItpd.impl_info_str()) != key.implType) {
+                auto altPrimDesc = convolution_forward::primitive_desc(altItpd.get());
+                altExecPtr = std::make_shared<ConvolutionExecutor>(altPrimDesc,
+                                                                   key.inp0->getDnnlDesc(),
+                                                                   key.inp1->getDnnlDesc(),
+                                                                   key.out->getDnnlDesc(),
+                                                                   engine);
+                altScratchpadMem = getScratchPadMem(altExecPtr->getPrimitiveDesc());
+                adaptiveItersLeft = 16;
+                mainExecTimeUs = altExecTimeUs = 0;
+            }
+        }
 #ifdef CPU_DEBUG_CAPS
         if (result.second == CacheEntryBase::LookUpStatus::Miss) {
             DEBUG_LOG("verbose##", getName(), "##", pd->info(), "\n");
@@ -1485,9 +1534,41 @@ void Convolution::execute(dnnl::stream strm) {
         IE_THROW() << "Can't execute Convolution node with name: " << getName() << ", because executor is not compiled";
     }
 
+    if (altExecPtr && adaptiveItersLeft > 0) {
+        executeAdaptive(strm);
+        return;
+    }
+
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, primExecItt(*execPtr->getExecPrim()));
     execPtr->exec(primArgs, strm);
 }
 
+void Convolution::executeAdaptive(dnnl::stream strm) {
+    const bool runAlt = (adaptiveItersLeft % 2) != 0;
+    const auto start = std::chrono::steady_clock::now();
+    if (runAlt) {
+        auto altArgs = primArgs;
+        altArgs[DNNL_ARG_SCRATCHPAD] = altScratchpadMem->GetPrimitive();
+        OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, primExecItt(*altExecPtr->getExecPrim()));
+        altExecPtr->exec(altArgs, strm);
+    } else {
+        OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, primExecItt(*execPtr->getExecPrim()));
+        execPtr->exec(primArgs, strm);
+    }
+    // the dnnl CPU stream is synchronous, so the wall time covers the whole primitive execution
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    (runAlt ? altExecTimeUs : mainExecTimeUs) += us;
+
+    if (--adaptiveItersLeft == 0) {
+        if (altExecTimeUs < mainExecTimeUs) {
+            DEBUG_LOG(getName(), " adaptive selection switched to the alternative implementation");
+            execPtr = altExecPtr;
+            primArgs[DNNL_ARG_SCRATCHPAD] = altScratchpadMem->GetPrimitive();
+        }
+        altExecPtr = nullptr;
+    }
+}
+
 void Convolution::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
     if (withSumBroadcast) {
@@ -1616,7 +1697,11 @@ void Convolution::initTryBrgconvFlag() {
             setPostOps(attr, outputStaticShape(), false);
             const auto& ops = attr.get_post_ops();
             if (ops.get()->find(dnnl::impl::primitive_kind::binary) != -1) {
-                shouldTryBrgconv = false;
+                // quantized depthwise keeps trying brgconv regardless: the fallback dw kernels
+                // block channels by 16 and process the channel tail scalar, which is where
+                // MobileNet-class models with odd channel groups lose the most
+                if (!(canBeExecutedInInt8() && isDepthWise()))
+                    shouldTryBrgconv = false;
             }
         }
     }
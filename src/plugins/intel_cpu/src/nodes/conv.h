@@ -62,6 +62,10 @@ public:
     const std::vector<ptrdiff_t> &getPaddingL() { return paddingL; }
     const std::vector<ptrdiff_t> &getPaddingR() { return paddingR; }
 
+    // Folds an external constant-zero padding of the spatial dims into the native padding of the
+    // convolution; called by the graph optimizer when the producing Pad node is dropped
+    void absorbInputPadding(const std::vector<unsigned int>& padsBegin, const std::vector<unsigned int>& padsEnd);
+
     bool canFuse(const NodePtr& node) const override;
     bool isDepthWise() const {
         return isGrouped && 1 == groupOC && 1 == groupIC;
@@ -88,6 +92,14 @@ private:
     using executorPtr = std::shared_ptr<DnnlExecutor>;
     executorPtr execPtr = nullptr;
 
+    // adaptive implementation selection state: the alternative executor competes with execPtr
+    // during the warm-up window and the faster one is locked in afterwards
+    executorPtr altExecPtr = nullptr;
+    MemoryPtr altScratchpadMem;
+    size_t adaptiveItersLeft = 0;
+    uint64_t mainExecTimeUs = 0;
+    uint64_t altExecTimeUs = 0;
+
     class ConvolutionExecutor : public DnnlExecutor {
         public:
             ConvolutionExecutor(const dnnl::convolution_forward::primitive_desc& pd,
@@ -100,6 +112,7 @@ private:
     void prepareParams() override;
     void execute(dnnl::stream strm) override;
     void executeDynamicImpl(dnnl::stream strm) override;
+    void executeAdaptive(dnnl::stream strm);
     void addLegacyZeroPoints(dnnl::primitive_attr& attr);
     void addZeroPoints(dnnl::primitive_attr& attr);
     void setPostOps(dnnl::primitive_attr &attr, const VectorDims &dims, bool useLegacyPostOps, bool initWeights = false);
@@ -6,6 +6,8 @@
 #include "eltwise.h"
 #include "fake_quantize.h"
 #include "input.h"
+#include "itt.h"
+#include "onednn/itt.h"
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -596,6 +598,7 @@ void Deconvolution::execute(dnnl::stream strm) {
         IE_THROW() << "Can't execute Deconvolution node with name: " << getName() << ", because executor is not compiled";
     }
 
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, primExecItt(*execPtr->getExecPrim()));
     execPtr->exec(primArgs, strm);
 
     if (externOutShape) {
@@ -5,11 +5,13 @@
 #include "def_conv.h"
 #include <string>
 #include <vector>
+#include <cstring>
 #include <math.h>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include <cpu/x64/jit_generator.hpp>
 #include "ie_parallel.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
 
@@ -881,9 +883,8 @@ void DeformableConvolution::initSupportedPrimitiveDescriptors() {
     }
 }
 
-void DeformableConvolution::DefConvExecutor::prepareSamplingWeights(
-        const float* offsets, const float* modulation, bool enforceRef) {
-    const int MB = jcp.mb;
+void DeformableConvolution::DefConvExecutor::prepareSamplingWeightsForPixel(
+        const float* offsets, const float* modulation, bool enforceRef, int mb, int dg, int oh, int ow) {
     const int OH = jcp.oh;
     const int OW = jcp.ow;
 
@@ -907,100 +908,101 @@ void DeformableConvolution::DefConvExecutor::prepareSamplingWeights(
 
     const bool with_bi_pad = jcp.with_bi_pad;
 
-    auto precompKer = [&](int mb, int dg, int oh, int ow) {
-        int sampledCoordIndex = (mb * DG * OH * OW + dg * OH * OW + oh * OW + ow) * KH * KW * sampledPointsPerPixel;
-        const int h_in = oh * KSH - padT;
-        const int w_in = ow * KSW - padL;
+    int sampledCoordIndex = (mb * DG * OH * OW + dg * OH * OW + oh * OW + ow) * KH * KW * sampledPointsPerPixel;
+    const int h_in = oh * KSH - padT;
+    const int w_in = ow * KSW - padL;
 
-        const int waOffsetH = (enforceRef ? 0 : h_in);
-        const int waOffsetW = (enforceRef ? 0 : w_in);
+    const int waOffsetH = (enforceRef ? 0 : h_in);
+    const int waOffsetW = (enforceRef ? 0 : w_in);
 
-        const float *data_offset_ptr = offsets + mb * offStrides[0] + (dg * 2 * KH * KW) * offStrides[1];
-        const float *modulation_offset_ptr = nullptr;
-        if (modulation != nullptr) {
-            modulation_offset_ptr = modulation + mb * modStrides[0] + (dg * ker_size) * modStrides[1];
-        }
+    const float *data_offset_ptr = offsets + mb * offStrides[0] + (dg * 2 * KH * KW) * offStrides[1];
+    const float *modulation_offset_ptr = nullptr;
+    if (modulation != nullptr) {
+        modulation_offset_ptr = modulation + mb * modStrides[0] + (dg * ker_size) * modStrides[1];
+    }
 
-        for (int kh = 0; kh < KH; kh++) {
-            for (int kw = 0; kw < KW; kw++) {
-                const size_t data_offset_h_index = 2 * ((size_t) kh * KW + kw) * offStrides[1] + oh * offStrides[2] + ow * offStrides[3];
-                const size_t data_offset_w_index = (2 * ((size_t) kh * KW + kw) + 1) * offStrides[1] + oh * offStrides[2] + ow * offStrides[3];
-                const float offset_h = data_offset_ptr[data_offset_h_index];
-                const float offset_w = data_offset_ptr[data_offset_w_index];
-                float map_h = h_in + kh * (KDH + 1) + offset_h;
-                float map_w = w_in + kw * (KDW + 1) + offset_w;
-                bool skip_compute;
-                if (with_bi_pad) {
-                    skip_compute = !(static_cast<int>(map_w) > -1 &&
-                                     static_cast<int>(map_w) < IW &&
-                                     static_cast<int>(map_h) > -1 &&
-                                     static_cast<int>(map_h) < IH);
-                } else {
-                    skip_compute = !(map_w >= 0 && map_w < IW &&
-                                     map_h >= 0 && map_h < IH);
-                }
-                if (!skip_compute) {
-                    // modulations precomp.
-                    float modulation_scalar = 1.0f;
+    for (int kh = 0; kh < KH; kh++) {
+        for (int kw = 0; kw < KW; kw++) {
+            const size_t data_offset_h_index = 2 * ((size_t) kh * KW + kw) * offStrides[1] + oh * offStrides[2] + ow * offStrides[3];
+            const size_t data_offset_w_index = (2 * ((size_t) kh * KW + kw) + 1) * offStrides[1] + oh * offStrides[2] + ow * offStrides[3];
+            const float offset_h = data_offset_ptr[data_offset_h_index];
+            const float offset_w = data_offset_ptr[data_offset_w_index];
+            float map_h = h_in + kh * (KDH + 1) + offset_h;
+            float map_w = w_in + kw * (KDW + 1) + offset_w;
+            bool skip_compute;
+            if (with_bi_pad) {
+                skip_compute = !(static_cast<int>(map_w) > -1 &&
+                                 static_cast<int>(map_w) < IW &&
+                                 static_cast<int>(map_h) > -1 &&
+                                 static_cast<int>(map_h) < IH);
+            } else {
+                skip_compute = !(map_w >= 0 && map_w < IW &&
+                                 map_h >= 0 && map_h < IH);
+            }
+            if (!skip_compute) {
+                // modulations precomp.
+                float modulation_scalar = 1.0f;
 
-                    if (modulation_offset_ptr != nullptr) {
-                        size_t modulation_index = (kh * KW + kw) * modStrides[1] + oh * modStrides[2] + ow * modStrides[3];
-                        modulation_scalar = modulation_offset_ptr[modulation_index];
-                    }
-                    // interpolation precomp.
-                    const int cur_h_end = IH;
-                    const int cur_w_end = IW;
-                    int h_low = with_bi_pad ? static_cast<int>(floorf(map_h)) :
-                                std::max(static_cast<int>(floorf(map_h)), 0);
-                    int w_low = with_bi_pad ? static_cast<int>(floorf(map_w)) :
-                                std::max(static_cast<int>(floorf(map_w)), 0);
-                    int h_high = with_bi_pad ? h_low + 1 : std::min(static_cast<int>(ceilf(map_h)), cur_h_end - 1);
-                    int w_high = with_bi_pad ? w_low + 1 : std::min(static_cast<int>(ceilf(map_w)), cur_w_end - 1);
-
-                    float lh = map_h - h_low;
-                    float lw = map_w - w_low;
-                    float hh = 1 - lh, hw = 1 - lw;
-
-                    int h_ind_low = std::max(h_low, 0) - waOffsetH;
-                    int h_ind_high = std::min(h_high, cur_h_end - 1) - waOffsetH;
-                    int w_ind_low = std::max(w_low, 0) - waOffsetW;
-                    int w_ind_high = std::min(w_high, cur_w_end - 1) - waOffsetW;
-
-                    hh = (h_low >= 0 ? hh : 0);
-                    hw = (w_low >= 0 ? hw : 0);
-                    lh = (h_high < cur_h_end ? lh : 0);
-                    lw = (w_high < cur_w_end ? lw : 0);
-
-                    const int h_off_low = h_ind_low * (srcStrides[2] / srcStrides[3]);
-                    const int h_off_high = h_ind_high * (srcStrides[2] / srcStrides[3]);
-                    const int w_off_low  = w_ind_low;
-                    const int w_off_high = w_ind_high;
-                    pSampledCoordsVector[sampledCoordIndex] = h_off_high + w_off_high;
-                    pSampledCoordsVector[sampledCoordIndex + 1] = h_off_high + w_off_low;
-                    pSampledCoordsVector[sampledCoordIndex + 2] = h_off_low + w_off_high;
-                    pSampledCoordsVector[sampledCoordIndex + 3] = h_off_low + w_off_low;
-
-                    float w22 = hh * hw * modulation_scalar, w21 = hh * lw * modulation_scalar,
-                            w12 = lh * hw * modulation_scalar, w11 = lh * lw * modulation_scalar;
-
-                    pInterpWeightsVector[sampledCoordIndex] = w11;
-                    pInterpWeightsVector[sampledCoordIndex + 1] = w12;
-                    pInterpWeightsVector[sampledCoordIndex + 2] = w21;
-                    pInterpWeightsVector[sampledCoordIndex + 3] = w22;
-                } else {
-                    pSampledCoordsVector[sampledCoordIndex] = 0;
-                    pInterpWeightsVector[sampledCoordIndex] = 0;
-                    pInterpWeightsVector[sampledCoordIndex + 1] = 0;
-                    pInterpWeightsVector[sampledCoordIndex + 2] = 0;
-                    pInterpWeightsVector[sampledCoordIndex + 3] = 0;
+                if (modulation_offset_ptr != nullptr) {
+                    size_t modulation_index = (kh * KW + kw) * modStrides[1] + oh * modStrides[2] + ow * modStrides[3];
+                    modulation_scalar = modulation_offset_ptr[modulation_index];
                 }
-                sampledCoordIndex += sampledPointsPerPixel;
+                // interpolation precomp.
+                const int cur_h_end = IH;
+                const int cur_w_end = IW;
+                int h_low = with_bi_pad ? static_cast<int>(floorf(map_h)) :
+                            std::max(static_cast<int>(floorf(map_h)), 0);
+                int w_low = with_bi_pad ? static_cast<int>(floorf(map_w)) :
+                            std::max(static_cast<int>(floorf(map_w)), 0);
+                int h_high = with_bi_pad ? h_low + 1 : std::min(static_cast<int>(ceilf(map_h)), cur_h_end - 1);
+                int w_high = with_bi_pad ? w_low + 1 : std::min(static_cast<int>(ceilf(map_w)), cur_w_end - 1);
+
+                float lh = map_h - h_low;
+                float lw = map_w - w_low;
+                float hh = 1 - lh, hw = 1 - lw;
+
+                int h_ind_low = std::max(h_low, 0) - waOffsetH;
+                int h_ind_high = std::min(h_high, cur_h_end - 1) - waOffsetH;
+                int w_ind_low = std::max(w_low, 0) - waOffsetW;
+                int w_ind_high = std::min(w_high, cur_w_end - 1) - waOffsetW;
+
+                hh = (h_low >= 0 ? hh : 0);
+                hw = (w_low >= 0 ? hw : 0);
+                lh = (h_high < cur_h_end ? lh : 0);
+                lw = (w_high < cur_w_end ? lw : 0);
+
+                const int h_off_low = h_ind_low * (srcStrides[2] / srcStrides[3]);
+                const int h_off_high = h_ind_high * (srcStrides[2] / srcStrides[3]);
+                const int w_off_low  = w_ind_low;
+                const int w_off_high = w_ind_high;
+                pSampledCoordsVector[sampledCoordIndex] = h_off_high + w_off_high;
+                pSampledCoordsVector[sampledCoordIndex + 1] = h_off_high + w_off_low;
+                pSampledCoordsVector[sampledCoordIndex + 2] = h_off_low + w_off_high;
+                pSampledCoordsVector[sampledCoordIndex + 3] = h_off_low + w_off_low;
+
+                float w22 = hh * hw * modulation_scalar, w21 = hh * lw * modulation_scalar,
+                        w12 = lh * hw * modulation_scalar, w11 = lh * lw * modulation_scalar;
+
+                pInterpWeightsVector[sampledCoordIndex] = w11;
+                pInterpWeightsVector[sampledCoordIndex + 1] = w12;
+                pInterpWeightsVector[sampledCoordIndex + 2] = w21;
+                pInterpWeightsVector[sampledCoordIndex + 3] = w22;
+            } else {
+                pSampledCoordsVector[sampledCoordIndex] = 0;
+                pInterpWeightsVector[sampledCoordIndex] = 0;
+                pInterpWeightsVector[sampledCoordIndex + 1] = 0;
+                pInterpWeightsVector[sampledCoordIndex + 2] = 0;
+                pInterpWeightsVector[sampledCoordIndex + 3] = 0;
             }
+            sampledCoordIndex += sampledPointsPerPixel;
         }
-    };
+    }
+}
 
-    parallel_nd(MB, DG, OH, OW, [&](dim_t mb, dim_t dg, dim_t oh, dim_t ow) {
-        precompKer(mb, dg, oh, ow);
+void DeformableConvolution::DefConvExecutor::prepareSamplingWeights(
+        const float* offsets, const float* modulation, bool enforceRef) {
+    parallel_nd(jcp.mb, jcp.dg, jcp.oh, jcp.ow, [&](dim_t mb, dim_t dg, dim_t oh, dim_t ow) {
+        prepareSamplingWeightsForPixel(offsets, modulation, enforceRef, mb, dg, oh, ow);
     });
 }
 
@@ -1103,7 +1105,7 @@ DeformableConvolution::DefConvJitExecutor::DefConvJitExecutor(const DefConvAttr
 
 void DeformableConvolution::DefConvRefExecutor::exec(const float* src, const float* offsets,
         const float* weights, const float* modulation, float* dst,
-        int *pSampledCoordsVector, float *pInterpWeightsVector) {
+        int *pSampledCoordsVector, float *pInterpWeightsVector, float *pInputBuffer) {
     this->pSampledCoordsVector = pSampledCoordsVector;
     this->pInterpWeightsVector = pInterpWeightsVector;
     prepareSamplingWeights(offsets, modulation, true);
@@ -1215,10 +1217,6 @@ void DeformableConvolution::prepareParams() {
 
     const int DG = defConvAttr.deformable_group;
 
-    // allocate sampling weights and indices
-    sampledCoordsVector.resize(MB * DG * KH * KW * OH * OW * sampledPointsPerPixel);
-    interpWeightsVector.resize(MB * DG * KH * KW * OH * OW * sampledPointsPerPixel);
-
     execPtr = nullptr;
 
     auto cache = context->getParamsCache();
@@ -1233,23 +1231,42 @@ void DeformableConvolution::prepareParams() {
     if (!execPtr) {
         IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
     }
+
+    // sampling weights, indices and the implementation buffer are needed only while the node
+    // executes, so they share the graph-wide scratchpad arena with the oneDNN primitives
+    // instead of being pinned by every DeformableConvolution node
+    const size_t sampledElems = static_cast<size_t>(MB) * DG * KH * KW * OH * OW * sampledPointsPerPixel;
+    constexpr size_t scratchAlign = 64;  // the arena base is cache line aligned, keep the regions aligned too
+    interpWeightsOffset = rnd_up(sampledElems * sizeof(int), scratchAlign);
+    inputBufferOffset = interpWeightsOffset + rnd_up(sampledElems * sizeof(float), scratchAlign);
+    auto scratchDesc = std::make_shared<CpuBlockedMemoryDesc>(Precision::U8,
+                                                              Shape(VectorDims{inputBufferOffset + execPtr->implBufferSize()}));
+    scratchpadMem = context->getScratchPad()->createScratchPadMem(scratchDesc);
 }
 
 void DeformableConvolution::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+size_t DeformableConvolution::DefConvJitExecutor::implBufferSize() const {
+    // per thread region with the sampled source patch (see par_conv.buf)
+    return static_cast<size_t>(jcp.nthr) * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic * jcp.typesize_in;
+}
+
 void DeformableConvolution::DefConvJitExecutor::exec(const float* src, const float* offsets,
         const float* weights, const float* modulation, float* dst,
-        int *pSampledCoordsVector, float *pInterpWeightsVector) {
+        int *pSampledCoordsVector, float *pInterpWeightsVector, float *pInputBuffer) {
     this->pSampledCoordsVector = pSampledCoordsVector;
     this->pInterpWeightsVector = pInterpWeightsVector;
-    prepareSamplingWeights(offsets, modulation, false);
-    size_t buffer_size = (size_t)jcp.nthr * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic * jcp.typesize_in;
-    std::vector<float> input_buffer(buffer_size, 0);
-    float* input_buffer_ptr = input_buffer.data();
+    float* input_buffer_ptr = pInputBuffer;
 
-    parallel_for3d(jcp.mb, jcp.ngroups, jcp.oh, [&](size_t n, size_t g, size_t oh) {
+    // Each thread zeroes its own slice of the implementation buffer on first use: the
+    // kernel relies on the padding area staying zeroed, but wiping the whole arena from
+    // a single thread serializes the start and places the pages on the wrong NUMA node
+    const size_t bufSliceElems = static_cast<size_t>(jcp.ur_w) * jcp.kh * jcp.kw * jcp.ic;
+    std::vector<uint8_t> bufInitialized(jcp.nthr, 0);
+
+    auto runKernelRow = [&](size_t n, size_t g, size_t oh) {
         auto ithr = parallel_get_thread_num();
 
         auto par_conv = jit_def_conv_call_args();
@@ -1257,18 +1274,44 @@ void DeformableConvolution::DefConvJitExecutor::exec(const float* src, const flo
         const size_t _oc = g * jcp.nb_oc;
         const size_t _ic = g * jcp.nb_ic;
 
+        float* threadBuf = input_buffer_ptr + ithr * bufSliceElems;
+        if (!bufInitialized[ithr]) {
+            memset(threadBuf, 0, bufSliceElems * jcp.typesize_in);
+            bufInitialized[ithr] = 1;
+        }
+
         par_conv.src = &src[n * srcStrides[0] + _ic*jcp.ic_block * srcStrides[1] +
                             (oh * jcp.stride_h - jcp.t_pad) * srcStrides[2] - jcp.l_pad * srcStrides[3]];
         par_conv.sampledWei = &(pInterpWeightsVector[(n * jcp.dg * jcp.oh + oh) * jcp.kh * jcp.kw * jcp.ow * sampledPointsPerPixel]);
         par_conv.sampledCoords = &(pSampledCoordsVector[(n * jcp.dg * jcp.oh + oh) * jcp.kh * jcp.kw * jcp.ow * sampledPointsPerPixel]);
         par_conv.filt = &weights[g * jcp.nb_oc * jcp.nb_ic * jcp.kh * jcp.kw * jcp.ic_block * jcp.oc_block];
         par_conv.dst = &dst[n * dstStrides[0] + _oc * jcp.oc_block * dstStrides[1] + oh * dstStrides[2]];
-        par_conv.buf = input_buffer_ptr + ithr * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic;
+        par_conv.buf = threadBuf;
 
         par_conv.oh_pos = oh;
 
         (*def_conv_kernel)(&par_conv);
-    });
+    };
+
+    if (jcp.ngroups == 1) {
+        // With a single group every output row is consumed by exactly one kernel task, so
+        // the sampling preparation is fused into that task: the coordinates and bilinear
+        // weights of the row are still cache-hot when the kernel gathers through them,
+        // instead of a full write pass over the tables followed by a full read pass
+        parallel_for2d(jcp.mb, jcp.oh, [&](size_t n, size_t oh) {
+            for (int dg = 0; dg < jcp.dg; dg++) {
+                for (int ow = 0; ow < jcp.ow; ow++) {
+                    prepareSamplingWeightsForPixel(offsets, modulation, false, n, dg, oh, ow);
+                }
+            }
+            runKernelRow(n, 0, oh);
+        });
+    } else {
+        prepareSamplingWeights(offsets, modulation, false);
+        parallel_for3d(jcp.mb, jcp.ngroups, jcp.oh, [&](size_t n, size_t g, size_t oh) {
+            runKernelRow(n, g, oh);
+        });
+    }
 }
 
 void DeformableConvolution::execute(dnnl::stream strm) {
@@ -1295,7 +1338,11 @@ void DeformableConvolution::execute(dnnl::stream strm) {
     auto config = selectedPrimitiveDescriptor->getConfig();
 
     if (execPtr) {
-        execPtr->exec(src, offsets, weights, modulation, dst, sampledCoordsVector.data(), interpWeightsVector.data());
+        auto scratchPtr = reinterpret_cast<uint8_t *>(scratchpadMem->GetPtr());
+        execPtr->exec(src, offsets, weights, modulation, dst,
+                      reinterpret_cast<int *>(scratchPtr),
+                      reinterpret_cast<float *>(scratchPtr + interpWeightsOffset),
+                      reinterpret_cast<float *>(scratchPtr + inputBufferOffset));
     } else {
         IE_THROW() << "Deformable Convolution executor doesn't exist";
     }
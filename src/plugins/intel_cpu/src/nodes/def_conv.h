@@ -96,8 +96,11 @@ public:
     } defConvAttr;
 
 private:
-    std::vector<int> sampledCoordsVector;
-    std::vector<float> interpWeightsVector;
+    // the sampling coordinates, interpolation weights and the kernel input buffer are pure
+    // per-run scratch, so they are carved as one region from the graph-wide scratchpad arena
+    // (the base is kept in Node::scratchpadMem, only the region offsets are stored here)
+    size_t interpWeightsOffset = 0lu;
+    size_t inputBufferOffset = 0lu;
 
     void prepareParams() override;
     void updatePadding();
@@ -115,11 +118,15 @@ private:
 
             virtual void exec(const float* src, const float* offsets,
                 const float* weights, const float* modulation, float* dst,
-                int *pSampledCoordsVector, float *pInterpWeightsVector) = 0;
+                int *pSampledCoordsVector, float *pInterpWeightsVector, float *pInputBuffer) = 0;
+            // size in bytes of the input buffer the implementation needs on top of the sampling data
+            virtual size_t implBufferSize() const { return 0lu; }
             virtual ~DefConvExecutor() = default;
 
         protected:
             void prepareSamplingWeights(const float* offsets, const float* modulation = nullptr, bool enforceRef = false);
+            void prepareSamplingWeightsForPixel(const float* offsets, const float* modulation, bool enforceRef,
+                                                int mb, int dg, int oh, int ow);
             jit_def_conv_params jcp = {};
             VectorDims srcStrides;
             VectorDims offStrides;
@@ -138,7 +145,7 @@ private:
 
             void exec(const float* src, const float* offsets,
                 const float* weights, const float* modulation, float* dst,
-                int *pSampledCoordsVector, float *pInterpWeightsVector) override;
+                int *pSampledCoordsVector, float *pInterpWeightsVector, float *pInputBuffer) override;
     };
 
     class DefConvJitExecutor : public DefConvExecutor {
@@ -149,7 +156,8 @@ private:
 
             void exec(const float* src, const float* offsets,
                 const float* weights, const float* modulation, float* dst,
-                int *pSampledCoordsVector, float *pInterpWeightsVector) override;
+                int *pSampledCoordsVector, float *pInterpWeightsVector, float *pInputBuffer) override;
+            size_t implBufferSize() const override;
     };
 
     std::shared_ptr<DefConvExecutor> execPtr = nullptr;
@@ -136,6 +136,8 @@ void DetectionOutput::prepareParams() {
 
     detectionsCount.resize(imgNum * classesNum);
     numPriorsActual.resize(imgNum);
+    if (keepTopK > -1)
+        confIndicesClassMap.resize(classesNum * priorsNum);
 }
 
 void DetectionOutput::initSupportedPrimitiveDescriptors() {
@@ -305,9 +307,11 @@ void DetectionOutput::execute(dnnl::stream strm) {
 
         // combine detections of all class for this image and filter with global(image) topk(keep_topk)
         if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            // per class offsets into the preallocated map, so the gather needs no mutex
+            std::vector<int> classOffsets(classesNum + 1, 0);
+            for (int c = 0; c < classesNum; ++c)
+                classOffsets[c + 1] = classOffsets[c] + detectionsData[n * classesNum + c];
 
-            std::mutex mtx;
             parallel_for(classesNum, [&](int c) {
                 int detections = detectionsData[n * classesNum + c];
                 int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
@@ -316,20 +320,19 @@ void DetectionOutput::execute(dnnl::stream strm) {
 
                 for (int i = 0; i < detections; ++i) {
                     int pr = pindices[i];
-                    mtx.lock();
-                    confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
+                    confIndicesClassMap[classOffsets[c] + i] = std::make_pair(pconf[pr], std::make_pair(c, pr));
                 }
             });
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
-            confIndicesClassMap.resize(keepTopK);
+            // only the keepTopK best detections are kept, so a partial sort is enough
+            std::partial_sort(confIndicesClassMap.begin(), confIndicesClassMap.begin() + keepTopK,
+                              confIndicesClassMap.begin() + detectionsTotal,
+                              SortScorePairDescend<std::pair<int, int>>);
 
             // Store the new indices. Assign to class back
             memset(detectionsData + n * classesNum, 0, classesNum * sizeof(int));
 
-            for (size_t j = 0; j < confIndicesClassMap.size(); ++j) {
+            for (int j = 0; j < keepTopK; ++j) {
                 int cls = confIndicesClassMap[j].second.first;
                 int pr = confIndicesClassMap[j].second.second;
                 int *pindices = indicesData + n * classesNum * priorsNum + cls * priorsNum;
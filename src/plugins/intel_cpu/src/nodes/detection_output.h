@@ -106,6 +106,8 @@ private:
     std::vector<float> bboxSizes;
     std::vector<int> numPriorsActual;
     std::vector<int> confInfoForPrior;
+    // scratch for the global (per image) top-k filter: score, (class, prior)
+    std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
 
     std::string errorPrefix;
 };
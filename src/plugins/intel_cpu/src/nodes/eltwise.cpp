@@ -7,6 +7,7 @@
 #include <ie_parallel.hpp>
 
 #include "cpu_types.h"
+#include "itt.h"
 #include "utils/bfloat16.hpp"
 #include <cpu/x64/injectors/jit_uni_quantization_injector.hpp>
 #include <cpu/ref_eltwise.hpp>
@@ -17,6 +18,7 @@
 #include "pooling.h"
 #include "input.h"
 #include "common/cpu_convert.h"
+#include "cache/kernel_cache.h"
 
 #include "emitters/jit_emitter.hpp"
 #include "emitters/jit_eltwise_emitters.hpp"
@@ -205,6 +207,10 @@ struct jit_uni_eltwise_generic : public jit_uni_eltwise_kernel, public jit_gener
 
         for (int i = 0; i < jep_.inputs_number; i++) {
             if (jep_.src_prc[i] != exec_prc) {
+                // 1-byte sources are extended to i32 as part of the load, so they can feed the
+                // integer execution path directly instead of the round trip through fp32.
+                if (exec_prc == Precision::I32 && one_of(jep_.src_prc[i], Precision::U8, Precision::I8))
+                    continue;
                 exec_prc = Precision::FP32;
                 break;
             }
@@ -261,7 +267,13 @@ struct jit_uni_eltwise_generic : public jit_uni_eltwise_kernel, public jit_gener
         xor_(reg_oc_off, reg_oc_off);
         init_ptrs_with_offsets(reg_oc_off, jep.oc_offsets);
 
-        mov(reg_work_amount, jep.work_amount);
+        if (jep.work_amount == 0) {
+            // a zero compile-time work amount marks a shape-agnostic kernel: the actual element
+            // count of the contiguous run is taken from the call args at runtime
+            mov(reg_work_amount, ptr[reg_const_params + GET_OFF(work_amount)]);
+        } else {
+            mov(reg_work_amount, jep.work_amount);
+        }
 
         Xbyak::Label unroll_loop_label;
         Xbyak::Label unroll_loop_end_label;
@@ -672,6 +684,9 @@ private:
                     vpmovzxwd(vmm_src, op);
                     uni_vpslld(vmm_src, vmm_src, 16);
                     break;
+                case Precision::FP16:
+                    vcvtph2ps(vmm_src, op);
+                    break;
                 case Precision::U16:
                     uni_vpmovzxwd(vmm_src, op);
                     break;
@@ -690,11 +705,11 @@ private:
 
             switch (dst_prc) {
                 case Precision::FP32:
-                    if (src_prc != Precision::FP32 && src_prc != Precision::BF16)
+                    if (!one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                         uni_vcvtdq2ps(vmm_src, vmm_src);
                     break;
                 case Precision::I32:
-                    if (src_prc == Precision::FP32 || src_prc == Precision::BF16)
+                    if (one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                         uni_vcvtps2dq(vmm_src, vmm_src);
                     break;
                 default:
@@ -713,6 +728,10 @@ private:
                 uni_vpinsrw(xmm_src, xmm_src, op, 0);
                 uni_vpslld(xmm_src, xmm_src, 16);
                 break;
+            case Precision::FP16:
+                uni_vpinsrw(xmm_src, xmm_src, op, 0);
+                vcvtph2ps(xmm_src, xmm_src);
+                break;
             case Precision::I16:
                 uni_vpinsrw(xmm_src, xmm_src, op, 0);
                 uni_vpmovsxwd(xmm_src, op);
@@ -735,11 +754,11 @@ private:
 
         switch (dst_prc) {
             case Precision::FP32:
-                if (src_prc != Precision::FP32 && src_prc != Precision::BF16)
+                if (!one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtdq2ps(xmm_src, xmm_src);
                 break;
             case Precision::I32:
-                if (src_prc == Precision::FP32 || src_prc == Precision::BF16)
+                if (one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtps2dq(xmm_src, xmm_src);
                 break;
             default:
@@ -753,11 +772,11 @@ private:
 
         switch (src_prc) {
             case Precision::FP32:
-                if (dst_prc != Precision::FP32 && dst_prc != Precision::BF16)
+                if (!one_of(dst_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtps2dq(vmm_dst, vmm_dst);
                 break;
             case Precision::I32:
-                if (dst_prc == Precision::FP32 || dst_prc == Precision::BF16)
+                if (one_of(dst_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtdq2ps(vmm_dst, vmm_dst);
                 break;
             default:
@@ -773,6 +792,9 @@ private:
                 uni_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm_dst.getIdx())}, {static_cast<size_t>(ymm_dst.getIdx())});
                 vmovdqu16(op, ymm_dst);
                 break;
+            case Precision::FP16:
+                vcvtps2ph(op, vmm_dst, 0x4);
+                break;
             case Precision::I16:
                 if (isa == x64::avx512_core) {
                     vpmovsdw(op, vmm_dst);
@@ -837,11 +859,11 @@ private:
     inline void store_scalar(const Xbyak::Address &op, Xmm xmm_dst, Precision src_prc, Precision dst_prc) {
         switch (src_prc) {
             case Precision::FP32:
-                if (dst_prc != Precision::FP32 && dst_prc != Precision::BF16)
+                if (!one_of(dst_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtps2dq(xmm_dst, xmm_dst);
                 break;
             case Precision::I32:
-                if (dst_prc == Precision::FP32 || dst_prc == Precision::BF16)
+                if (one_of(dst_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtdq2ps(xmm_dst, xmm_dst);
                 break;
             default:
@@ -857,6 +879,10 @@ private:
                 uni_vpsrld(xmm_dst, xmm_dst, 16);
                 uni_vpextrw(op, xmm_dst, 0x0);
                 break;
+            case Precision::FP16:
+                vcvtps2ph(xmm_dst, xmm_dst, 0x4);
+                uni_vpextrw(op, xmm_dst, 0x0);
+                break;
             case Precision::I16:
                 uni_vpackssdw(xmm_dst, xmm_dst, xmm_dst);
                 movq(reg_tmp_64, xmm_dst);
@@ -1172,6 +1198,67 @@ struct EltwiseKey {
     }
 };
 
+// Key for the process-wide KernelCache. Unlike EltwiseKey it describes only the generated code:
+// the final jit_eltwise_params (dims are already collapsed there) plus the fused ops. The ISA is
+// not a part of the key since the mayiuse-based selection is invariant within a process.
+struct EltwiseKernelKey {
+    jit_eltwise_params jep;
+    std::vector<Eltwise::EltwiseData> eltwise_data;
+    std::vector<Type> ops_list;
+    dnnl::post_ops postOps;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        seed = hash_combine(seed, jep.inputs_number);
+        seed = hash_combine(seed, jep.input_size);
+        for (size_t i = 0; i < jep.inputs_number; i++) {
+            seed = hash_combine(seed, jep.src_prc[i].getPrecVal());
+            seed = get_vector_hash(seed, jep.src_offsets[i]);
+            seed = hash_combine(seed, jep.src_size[i]);
+        }
+        seed = hash_combine(seed, jep.dst_prc.getPrecVal());
+        seed = get_vector_hash(seed, jep.dims);
+        seed = get_vector_hash(seed, jep.dst_offsets);
+        seed = get_vector_hash(seed, jep.oc_offsets);
+        seed = hash_combine(seed, jep.dst_size);
+        seed = hash_combine(seed, jep.oc_size);
+        seed = hash_combine(seed, jep.work_amount);
+        std::for_each(eltwise_data.begin(), eltwise_data.end(), [&](const Eltwise::EltwiseData& item) {
+            seed = hash_combine(seed, item.algo);
+            seed = hash_combine(seed, item.onednnAlgorithm);
+            seed = hash_combine(seed, item.alpha);
+            seed = hash_combine(seed, item.beta);
+            seed = hash_combine(seed, item.gamma);
+        });
+        seed = get_vector_hash(seed, ops_list);
+        seed = get_post_op_hash(seed, *postOps.get());
+        return seed;
+    }
+
+    bool operator==(const EltwiseKernelKey& rhs) const {
+        bool result = jep.inputs_number == rhs.jep.inputs_number &&
+                      jep.input_size == rhs.jep.input_size &&
+                      jep.dst_prc == rhs.jep.dst_prc &&
+                      jep.dims == rhs.jep.dims &&
+                      jep.dst_offsets == rhs.jep.dst_offsets &&
+                      jep.oc_offsets == rhs.jep.oc_offsets &&
+                      jep.dst_size == rhs.jep.dst_size &&
+                      jep.oc_size == rhs.jep.oc_size &&
+                      jep.work_amount == rhs.jep.work_amount &&
+                      eltwise_data == rhs.eltwise_data &&
+                      ops_list == rhs.ops_list &&
+                      *postOps.get() == *rhs.postOps.get();
+        for (size_t i = 0; i < jep.inputs_number && result; i++) {
+            result = result && jep.src_prc[i] == rhs.jep.src_prc[i] &&
+                     jep.src_offsets[i] == rhs.jep.src_offsets[i] &&
+                     jep.src_size[i] == rhs.jep.src_size[i];
+        }
+        return result;
+    }
+};
+
 class EltwiseJitExecutor : public Eltwise::IEltwiseExecutor {
 public:
     static void offset_out_calc(VectorDims& offset, const VectorDims& dims) {
@@ -1384,18 +1471,27 @@ public:
         std::transform(jep.oc_offsets.begin(), jep.oc_offsets.end(), jep.oc_offsets.begin(),
                        [](size_t& offset) { return offset * sizeof(float);});
 
-        if (mayiuse(x64::avx512_core)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx512_core>(jep, eltwise_data, ops_list, post_ops));
-        } else if (mayiuse(x64::avx2)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep, eltwise_data, ops_list, post_ops));
-        } else if (mayiuse(x64::sse41)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, eltwise_data, ops_list, post_ops));
-        } else {
-            IE_THROW() << "Can't create jit eltwise kernel";
-        }
-
-        if (_pKernel)
-            _pKernel->create_ker();
+        // kernels are immutable once created, so identical ones are shared process-wide to avoid
+        // re-emitting the same code on every stream and every compiled model
+        EltwiseKernelKey kernelKey = {jep, eltwise_data, ops_list, post_ops};
+        auto buildKernel = [](const EltwiseKernelKey& key) -> std::shared_ptr<jit_uni_eltwise_kernel> {
+            std::shared_ptr<jit_uni_eltwise_kernel> kernel;
+            if (mayiuse(x64::avx512_core)) {
+                CPU_ISA_SCOPE(JitEltwise_avx512_core);
+                kernel.reset(new jit_uni_eltwise_generic<x64::avx512_core>(key.jep, key.eltwise_data, key.ops_list, key.postOps));
+            } else if (mayiuse(x64::avx2)) {
+                CPU_ISA_SCOPE(JitEltwise_avx2);
+                kernel.reset(new jit_uni_eltwise_generic<x64::avx2>(key.jep, key.eltwise_data, key.ops_list, key.postOps));
+            } else if (mayiuse(x64::sse41)) {
+                CPU_ISA_SCOPE(JitEltwise_sse41);
+                kernel.reset(new jit_uni_eltwise_generic<x64::sse41>(key.jep, key.eltwise_data, key.ops_list, key.postOps));
+            } else {
+                IE_THROW() << "Can't create jit eltwise kernel";
+            }
+            kernel->create_ker();
+            return kernel;
+        };
+        _pKernel = KernelCache::get().getOrCreate(kernelKey, buildKernel);
     }
 
     void exec(const jit_eltwise_call_args_ptrs &args_ptrs, const VectorDims &dims_out) override {
@@ -1448,7 +1544,7 @@ public:
     }
 
 private:
-    std::unique_ptr<jit_uni_eltwise_kernel> _pKernel;
+    std::shared_ptr<jit_uni_eltwise_kernel> _pKernel;
     size_t _schedulerWorkAmount = 0;
     size_t _batchDimIdx = 0;
 
@@ -1456,6 +1552,161 @@ public:
     static const int optimalTensorRank = 6;
 };
 
+// Per-input broadcast classification for the shape-agnostic executor
+enum class EltwiseBroadcastClass : uint8_t {
+    None,        // input dims match the output dims
+    Scalar,      // input is broadcast from a single element
+    PerChannel,  // input is broadcast from a per-channel vector (planar layouts only)
+};
+
+// Unlike EltwiseKey this key holds no dims at all: in dynamic scenarios every new shape of the
+// same broadcast classification maps to the same cache entry, so steady-state inference neither
+// rebuilds the executor nor rehashes the per-shape dims vectors
+struct EltwiseShapeAgnosticKey {
+    std::vector<Eltwise::EltwiseData> eltwise_data;
+    std::vector<Type> ops_list;
+    std::vector<EltwiseBroadcastClass> inpClass;
+    std::vector<InferenceEngine::Precision> inpPrc;
+    InferenceEngine::Precision outPrc;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        std::for_each(eltwise_data.begin(), eltwise_data.end(), [&](const Eltwise::EltwiseData& item) {
+            seed = hash_combine(seed, item.algo);
+            seed = hash_combine(seed, item.onednnAlgorithm);
+            seed = hash_combine(seed, item.alpha);
+            seed = hash_combine(seed, item.beta);
+            seed = hash_combine(seed, item.gamma);
+        });
+        seed = get_vector_hash(seed, ops_list);
+        std::for_each(inpClass.begin(), inpClass.end(), [&](const EltwiseBroadcastClass& item) {
+            seed = hash_combine(seed, static_cast<uint8_t>(item));
+        });
+        std::for_each(inpPrc.begin(), inpPrc.end(), [&](const Precision& item) {
+            seed = hash_combine(seed, item.getPrecVal());
+        });
+        seed = hash_combine(seed, outPrc.getPrecVal());
+        return seed;
+    }
+
+    bool operator==(const EltwiseShapeAgnosticKey& rhs) const {
+        return eltwise_data == rhs.eltwise_data &&
+               ops_list == rhs.ops_list &&
+               inpClass == rhs.inpClass &&
+               inpPrc == rhs.inpPrc &&
+               outPrc == rhs.outPrc;
+    }
+};
+
+// Serves the broadcast classes whose memory access pattern does not depend on the particular
+// shape: every (n, c) row is one contiguous stride-free run, non-broadcast inputs advance in
+// lockstep with the output, scalar and per-channel inputs contribute a single broadcast load.
+// The kernel takes the run length at runtime, so one piece of code covers all shapes.
+class EltwiseShapeAgnosticExecutor : public Eltwise::IEltwiseExecutor {
+public:
+    explicit EltwiseShapeAgnosticExecutor(const EltwiseShapeAgnosticKey& key) : _inpClass(key.inpClass) {
+        jit_eltwise_params jep = {};
+        jep.inputs_number = key.inpPrc.size();
+        jep.input_size = 1;
+        jep.dims.resize(1, 1);
+        jep.dst_offsets.resize(1, 0);
+        jep.oc_offsets.resize(1, 0);
+        for (size_t i = 0; i < key.inpPrc.size(); i++) {
+            jep.src_prc[i] = key.inpPrc[i];
+            jep.src_offsets[i].resize(1, 0);
+            // src_size == 1 requests the single broadcast load, any other value shared with
+            // dst_size makes the input advance together with the output
+            jep.src_size[i] = _inpClass[i] == EltwiseBroadcastClass::None ? 0 : 1;
+            _srcPrcSize[i] = key.inpPrc[i].size();
+        }
+        jep.dst_prc = key.outPrc;
+        jep.dst_size = 0;
+        jep.oc_size = 0;
+        jep.work_amount = 0;  // runtime work amount marker
+        _dstPrcSize = key.outPrc.size();
+
+        EltwiseKernelKey kernelKey = {jep, key.eltwise_data, key.ops_list, dnnl::post_ops()};
+        auto buildKernel = [](const EltwiseKernelKey& key) -> std::shared_ptr<jit_uni_eltwise_kernel> {
+            std::shared_ptr<jit_uni_eltwise_kernel> kernel;
+            if (mayiuse(x64::avx512_core)) {
+                CPU_ISA_SCOPE(JitEltwise_avx512_core);
+                kernel.reset(new jit_uni_eltwise_generic<x64::avx512_core>(key.jep, key.eltwise_data, key.ops_list, key.postOps));
+            } else if (mayiuse(x64::avx2)) {
+                CPU_ISA_SCOPE(JitEltwise_avx2);
+                kernel.reset(new jit_uni_eltwise_generic<x64::avx2>(key.jep, key.eltwise_data, key.ops_list, key.postOps));
+            } else if (mayiuse(x64::sse41)) {
+                CPU_ISA_SCOPE(JitEltwise_sse41);
+                kernel.reset(new jit_uni_eltwise_generic<x64::sse41>(key.jep, key.eltwise_data, key.ops_list, key.postOps));
+            } else {
+                IE_THROW() << "Can't create jit eltwise kernel";
+            }
+            kernel->create_ker();
+            return kernel;
+        };
+        _pKernel = KernelCache::get().getOrCreate(kernelKey, buildKernel);
+    }
+
+    void exec(const jit_eltwise_call_args_ptrs &args_ptrs, const VectorDims &dims_out) override {
+        if (!_pKernel)
+            IE_THROW() << "Can't execute, kernel for eltwise node is not compiled";
+
+        // dims_out carries the {N, C, inner} geometry of the current shape: a per-channel input
+        // is constant within one (n, c) row, so rows are contiguous runs of length inner
+        const size_t C = dims_out[1];
+        const size_t inner = dims_out[2];
+        const size_t total = dims_out[0] * C * inner;
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(total, nthr, ithr, start, end);
+
+            auto indexes = jit_eltwise_call_args_indexes();
+            while (start < end) {
+                const size_t row = start / inner;
+                const size_t pos = start % inner;
+                const size_t count = std::min(end - start, inner - pos);
+
+                auto args = args_ptrs;
+                for (size_t i = 0; i < _inpClass.size(); i++) {
+                    switch (_inpClass[i]) {
+                        case EltwiseBroadcastClass::None:
+                            args.src_ptr[i] = reinterpret_cast<const uint8_t*>(args_ptrs.src_ptr[i]) + start * _srcPrcSize[i];
+                            break;
+                        case EltwiseBroadcastClass::PerChannel:
+                            args.src_ptr[i] = reinterpret_cast<const uint8_t*>(args_ptrs.src_ptr[i]) + (row % C) * _srcPrcSize[i];
+                            break;
+                        case EltwiseBroadcastClass::Scalar:
+                            break;
+                    }
+                }
+                args.dst_ptr = reinterpret_cast<uint8_t*>(args_ptrs.dst_ptr) + start * _dstPrcSize;
+                args.work_amount = count;
+
+                (*_pKernel)(&args, &indexes);
+                start += count;
+            }
+        });
+    }
+
+    const VectorDims& getOutDims() const override {
+        // the executor is shared between shapes, the current dims live in the node instead
+        return _outDims;
+    }
+
+    size_t getBatchDimIdx() const override {
+        return 0;
+    }
+
+private:
+    std::shared_ptr<jit_uni_eltwise_kernel> _pKernel;
+    std::vector<EltwiseBroadcastClass> _inpClass;
+    size_t _srcPrcSize[MAX_ELTWISE_INPUTS] = {};
+    size_t _dstPrcSize = 0;
+    VectorDims _outDims = {};
+};
+
 class EltwiseRefExecutor : public Eltwise::IEltwiseExecutor {
 public:
     EltwiseRefExecutor(Eltwise::EltwiseData opData,
@@ -1509,15 +1760,30 @@ public:
                     static_cast<dnnl_alg_kind_t>(_opData.onednnAlgorithm), _opData.alpha, _opData.beta, 1.f);
         }
 
+        // The innermost output dimension is dense and every input either walks it with a fixed
+        // stride or broadcasts it, so the offsets are derived once per row rather than per element;
+        // the per-element work is reduced to strided loads and the computation itself.
+        const size_t inner_dim = dims_out.empty() ? 1 : dims_out.back();
+        const size_t rows_amount = inner_dim ? _fullWorkAmount / inner_dim : 0;
+
         parallel_nt(0, [&](const int ithr, const int nthr) {
             size_t start = 0, end = 0;
-            splitter(_fullWorkAmount, nthr, ithr, start, end);
+            splitter(rows_amount, nthr, ithr, start, end);
 
             std::vector<size_t> counters(dims_out.size(), 0);
 
-            for (size_t iwork = start; iwork < end; ++iwork) {
-                size_t tmp = iwork;
-                for (ptrdiff_t j = dims_out.size() - 1; j >= 0; j--) {
+            size_t src_steps[MAX_ELTWISE_INPUTS] = {0};
+            size_t dst_step = 0;
+            if (!dims_out.empty()) {
+                for (int i = 0; i < _inputNum; i++) {
+                    src_steps[i] = _src_offsets[i][dims_out.size() - 1] / sizeof(float);
+                }
+                dst_step = _dst_offsets[dims_out.size() - 1] / sizeof(float);
+            }
+
+            for (size_t irow = start; irow < end; ++irow) {
+                size_t tmp = irow;
+                for (ptrdiff_t j = dims_out.size() - 2; j >= 0; j--) {
                     counters[j] = tmp % dims_out[j];
                     tmp /= dims_out[j];
                 }
@@ -1525,75 +1791,77 @@ public:
                 size_t index_in[MAX_ELTWISE_INPUTS] = {0};
                 for (int i = 0; i < _inputNum; i++) {
                     index_in[i] = 0;
-                    for (int j = 0; j < counters.size(); j++) {
+                    for (int j = 0; j < static_cast<int>(counters.size()) - 1; j++) {
                         index_in[i] += counters[j] * _src_offsets[i][j];
                     }
                     index_in[i] /= sizeof(float);
                 }
 
                 size_t index_out = 0;
-                for (int j = 0; j < counters.size(); j++) {
+                for (int j = 0; j < static_cast<int>(counters.size()) - 1; j++) {
                     index_out += counters[j] * _dst_offsets[j];
                 }
                 index_out /= sizeof(float);
 
-                std::vector<float> src_f(_inputNum);
-                for (int i = 0; i < _inputNum; i++) {
-                    src_f[i] = (reinterpret_cast<const float*>(args_ptrs.src_ptr[i]) + index_in[i])[0];
-                }
-                float* dst_ptr_f = reinterpret_cast<float*>(args_ptrs.dst_ptr) + index_out;
-
-                switch (_opData.algo) {
-                    case Algorithm::EltwiseRelu:
-                    case Algorithm::EltwiseGelu:
-                    case Algorithm::EltwiseElu:
-                    case Algorithm::EltwiseTanh:
-                    case Algorithm::EltwiseSigmoid:
-                    case Algorithm::EltwiseAbs:
-                    case Algorithm::EltwiseSqrt:
-                    case Algorithm::EltwiseSoftRelu:
-                    case Algorithm::EltwiseExp:
-                    case Algorithm::EltwiseClamp:
-                    case Algorithm::EltwiseSwish:
-                    case Algorithm::EltwiseHswish:
-                    case Algorithm::EltwiseMish:
-                    case Algorithm::EltwiseHsigmoid:
-                    case Algorithm::EltwiseRoundHalfToEven:
-                    case Algorithm::EltwiseRoundHalfAwayFromZero:
-                        *dst_ptr_f = ref_eltwise_injector->compute_scalar(src_f[0]);
-                        break;
-                    case Algorithm::EltwiseAdd:               *dst_ptr_f = src_f[0] + src_f[1]; break;
-                    case Algorithm::EltwiseMulAdd:            *dst_ptr_f = src_f[0] * src_f[1] + src_f[2]; break;
-                    case Algorithm::EltwiseSubtract:          *dst_ptr_f = src_f[0] - src_f[1]; break;
-                    case Algorithm::EltwiseMultiply:          *dst_ptr_f = src_f[0] * src_f[1]; break;
-                    case Algorithm::EltwiseDivide:            *dst_ptr_f = src_f[0] / src_f[1]; break;
-                    case Algorithm::EltwiseFloorMod:          *dst_ptr_f = src_f[0] - floorf(src_f[0] / src_f[1]) * src_f[1]; break;
-                    case Algorithm::EltwiseMod:               *dst_ptr_f = src_f[0] - truncf(src_f[0] / src_f[1]) * src_f[1]; break;
-                    case Algorithm::EltwiseMaximum:           *dst_ptr_f = std::max(src_f[0], src_f[1]); break;
-                    case Algorithm::EltwiseMinimum:           *dst_ptr_f = std::min(src_f[0], src_f[1]); break;
-                    case Algorithm::EltwiseSquaredDifference: *dst_ptr_f = powf((src_f[0] - src_f[1]), 2.f); break;
-                    case Algorithm::EltwisePowerDynamic:      *dst_ptr_f = powf(src_f[0], src_f[1]); break;
-                    case Algorithm::EltwiseEqual:             *dst_ptr_f = src_f[0] == src_f[1]; break;
-                    case Algorithm::EltwiseNotEqual:          *dst_ptr_f = src_f[0] != src_f[1]; break;
-                    case Algorithm::EltwiseGreater:           *dst_ptr_f = src_f[0] > src_f[1]; break;
-                    case Algorithm::EltwiseGreaterEqual:      *dst_ptr_f = src_f[0] >= src_f[1]; break;
-                    case Algorithm::EltwiseLess:              *dst_ptr_f = src_f[0] < src_f[1]; break;
-                    case Algorithm::EltwiseLessEqual:         *dst_ptr_f = src_f[0] <= src_f[1]; break;
-                    case Algorithm::EltwiseLogicalAnd:        *dst_ptr_f = src_f[0] && src_f[1]; break;
-                    case Algorithm::EltwiseLogicalOr:         *dst_ptr_f = src_f[0] || src_f[1]; break;
-                    case Algorithm::EltwiseLogicalXor:        *dst_ptr_f = (src_f[0] || src_f[1]) - (src_f[0] && src_f[1]); break;
-                    case Algorithm::EltwiseLogicalNot:        *dst_ptr_f = !src_f[0]; break;
-                    case Algorithm::EltwisePowerStatic:       *dst_ptr_f = powf(_opData.beta * src_f[0] + _opData.gamma, _opData.alpha); break;
-                    case Algorithm::EltwisePrelu:             *dst_ptr_f = src_f[0] > 0 ? src_f[0] : src_f[0] * src_f[1]; break;
-                    case Algorithm::EltwiseErf:               *dst_ptr_f = std::erf(src_f[0]); break;
-                    case Algorithm::EltwiseSoftSign:          *dst_ptr_f = src_f[0] / (1 + std::fabs(src_f[0])); break;
-                    case Algorithm::EltwiseIsFinite:          *dst_ptr_f = std::isfinite(src_f[0]); break;
-                    case Algorithm::EltwiseIsInf:
-                        *dst_ptr_f = _opData.alpha && (src_f[0] == -std::numeric_limits<float>::infinity()) ||
-                                     _opData.beta  && (src_f[0] == std::numeric_limits<float>::infinity());
-                        break;
-                    case Algorithm::EltwiseIsNaN:             *dst_ptr_f = std::isnan(src_f[0]); break;
-                    default: IE_THROW() << "Unsupported operation type for Eltwise executor";
+                for (size_t w = 0; w < inner_dim; ++w) {
+                    float src_f[MAX_ELTWISE_INPUTS] = {0.f};
+                    for (int i = 0; i < _inputNum; i++) {
+                        src_f[i] = (reinterpret_cast<const float*>(args_ptrs.src_ptr[i]) + index_in[i] + w * src_steps[i])[0];
+                    }
+                    float* dst_ptr_f = reinterpret_cast<float*>(args_ptrs.dst_ptr) + index_out + w * dst_step;
+
+                    switch (_opData.algo) {
+                        case Algorithm::EltwiseRelu:
+                        case Algorithm::EltwiseGelu:
+                        case Algorithm::EltwiseElu:
+                        case Algorithm::EltwiseTanh:
+                        case Algorithm::EltwiseSigmoid:
+                        case Algorithm::EltwiseAbs:
+                        case Algorithm::EltwiseSqrt:
+                        case Algorithm::EltwiseSoftRelu:
+                        case Algorithm::EltwiseExp:
+                        case Algorithm::EltwiseClamp:
+                        case Algorithm::EltwiseSwish:
+                        case Algorithm::EltwiseHswish:
+                        case Algorithm::EltwiseMish:
+                        case Algorithm::EltwiseHsigmoid:
+                        case Algorithm::EltwiseRoundHalfToEven:
+                        case Algorithm::EltwiseRoundHalfAwayFromZero:
+                            *dst_ptr_f = ref_eltwise_injector->compute_scalar(src_f[0]);
+                            break;
+                        case Algorithm::EltwiseAdd:               *dst_ptr_f = src_f[0] + src_f[1]; break;
+                        case Algorithm::EltwiseMulAdd:            *dst_ptr_f = src_f[0] * src_f[1] + src_f[2]; break;
+                        case Algorithm::EltwiseSubtract:          *dst_ptr_f = src_f[0] - src_f[1]; break;
+                        case Algorithm::EltwiseMultiply:          *dst_ptr_f = src_f[0] * src_f[1]; break;
+                        case Algorithm::EltwiseDivide:            *dst_ptr_f = src_f[0] / src_f[1]; break;
+                        case Algorithm::EltwiseFloorMod:          *dst_ptr_f = src_f[0] - floorf(src_f[0] / src_f[1]) * src_f[1]; break;
+                        case Algorithm::EltwiseMod:               *dst_ptr_f = src_f[0] - truncf(src_f[0] / src_f[1]) * src_f[1]; break;
+                        case Algorithm::EltwiseMaximum:           *dst_ptr_f = std::max(src_f[0], src_f[1]); break;
+                        case Algorithm::EltwiseMinimum:           *dst_ptr_f = std::min(src_f[0], src_f[1]); break;
+                        case Algorithm::EltwiseSquaredDifference: *dst_ptr_f = powf((src_f[0] - src_f[1]), 2.f); break;
+                        case Algorithm::EltwisePowerDynamic:      *dst_ptr_f = powf(src_f[0], src_f[1]); break;
+                        case Algorithm::EltwiseEqual:             *dst_ptr_f = src_f[0] == src_f[1]; break;
+                        case Algorithm::EltwiseNotEqual:          *dst_ptr_f = src_f[0] != src_f[1]; break;
+                        case Algorithm::EltwiseGreater:           *dst_ptr_f = src_f[0] > src_f[1]; break;
+                        case Algorithm::EltwiseGreaterEqual:      *dst_ptr_f = src_f[0] >= src_f[1]; break;
+                        case Algorithm::EltwiseLess:              *dst_ptr_f = src_f[0] < src_f[1]; break;
+                        case Algorithm::EltwiseLessEqual:         *dst_ptr_f = src_f[0] <= src_f[1]; break;
+                        case Algorithm::EltwiseLogicalAnd:        *dst_ptr_f = src_f[0] && src_f[1]; break;
+                        case Algorithm::EltwiseLogicalOr:         *dst_ptr_f = src_f[0] || src_f[1]; break;
+                        case Algorithm::EltwiseLogicalXor:        *dst_ptr_f = (src_f[0] || src_f[1]) - (src_f[0] && src_f[1]); break;
+                        case Algorithm::EltwiseLogicalNot:        *dst_ptr_f = !src_f[0]; break;
+                        case Algorithm::EltwisePowerStatic:       *dst_ptr_f = powf(_opData.beta * src_f[0] + _opData.gamma, _opData.alpha); break;
+                        case Algorithm::EltwisePrelu:             *dst_ptr_f = src_f[0] > 0 ? src_f[0] : src_f[0] * src_f[1]; break;
+                        case Algorithm::EltwiseErf:               *dst_ptr_f = std::erf(src_f[0]); break;
+                        case Algorithm::EltwiseSoftSign:          *dst_ptr_f = src_f[0] / (1 + std::fabs(src_f[0])); break;
+                        case Algorithm::EltwiseIsFinite:          *dst_ptr_f = std::isfinite(src_f[0]); break;
+                        case Algorithm::EltwiseIsInf:
+                            *dst_ptr_f = _opData.alpha && (src_f[0] == -std::numeric_limits<float>::infinity()) ||
+                                         _opData.beta  && (src_f[0] == std::numeric_limits<float>::infinity());
+                            break;
+                        case Algorithm::EltwiseIsNaN:             *dst_ptr_f = std::isnan(src_f[0]); break;
+                        default: IE_THROW() << "Unsupported operation type for Eltwise executor";
+                    }
                 }
             }
         });
@@ -1647,6 +1915,10 @@ static Eltwise::executorPtr buildExecutor(const EltwiseKey& key) {
     return execPtr;
 }
 
+static Eltwise::executorPtr buildShapeAgnosticExecutor(const EltwiseShapeAgnosticKey& key) {
+    return std::make_shared<EltwiseShapeAgnosticExecutor>(key);
+}
+
 bool Eltwise::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (initializers.find(op->get_type_info()) == initializers.end()) {
@@ -1758,6 +2030,9 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
             Precision::I32
     };
 
+    if (mayiuse(avx512_core_fp16))
+        supportedPrecisions.push_back(Precision::FP16);
+
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
@@ -2051,6 +2326,61 @@ void Eltwise::prepareParams() {
     }
 
     auto cache = context->getParamsCache();
+
+    // Dynamic-shape fast path: when every input is classified as no-broadcast, scalar or
+    // per-channel the memory access pattern does not depend on the particular shape, so a
+    // shape-agnostic executor is cached by the classification alone and recurring shape changes
+    // neither rebuild the per-shape work descriptors nor compile new code
+    if (canUseOptimizedImpl && !isDynBatchEnabled && key.postOps.len() == 0) {
+        VectorDims outDims(input_size, 1);
+        for (size_t i = 0; i < outRank; i++)
+            outDims[input_size - 1 - i] = currentOutBlkDims[outRank - 1 - i];
+
+        const bool isPlanar = outBlockingDesc->hasLayoutType(LayoutType::ncsp);
+        const size_t chPos = input_size - outRank + 1;
+
+        auto classify = [&](const VectorDims& dims) -> std::pair<EltwiseBroadcastClass, bool> {
+            if (dims == outDims)
+                return {EltwiseBroadcastClass::None, true};
+            if (std::all_of(dims.begin(), dims.end(), [](size_t dim) { return dim == 1; }))
+                return {EltwiseBroadcastClass::Scalar, true};
+            if (isPlanar && outRank >= 2 && dims[chPos] == outDims[chPos] && outDims[chPos] != 1) {
+                bool restAreOnes = true;
+                for (size_t j = 0; j < dims.size(); j++)
+                    restAreOnes = restAreOnes && (j == chPos || dims[j] == 1);
+                if (restAreOnes)
+                    return {EltwiseBroadcastClass::PerChannel, true};
+            }
+            return {EltwiseBroadcastClass::None, false};
+        };
+
+        bool classified = std::all_of(outDims.begin(), outDims.end(), [](size_t dim) { return dim != 0; });
+        std::vector<EltwiseBroadcastClass> inpClass(inputNum, EltwiseBroadcastClass::None);
+        for (size_t i = 0; i < inputNum && classified; i++) {
+            const auto res = classify(dims_in[i]);
+            inpClass[i] = res.first;
+            classified = res.second;
+        }
+
+        if (classified) {
+            // per-channel inputs are constant within one (n, c) row of a planar tensor, the
+            // pure elementwise/scalar case collapses into a single row
+            VectorDims geometry = {1, 1, 1};
+            const bool perChannel = std::any_of(inpClass.begin(), inpClass.end(), [](EltwiseBroadcastClass cls) {
+                return cls == EltwiseBroadcastClass::PerChannel;
+            });
+            for (size_t j = 0; j < outDims.size(); j++) {
+                const size_t pos = !perChannel ? 2 : (j < chPos ? 0 : (j == chPos ? 1 : 2));
+                geometry[pos] *= outDims[j];
+            }
+
+            EltwiseShapeAgnosticKey saKey = {key.eltwise_data, key.ops_list, inpClass, inpPrc, outPrc};
+            execPtr = cache->getOrCreate(saKey, buildShapeAgnosticExecutor).first;
+            shapeAgnosticDims = geometry;
+            return;
+        }
+    }
+
     auto result = cache->getOrCreate(key, buildExecutor);
     execPtr = result.first;
 }
@@ -2072,6 +2402,9 @@ void Eltwise::execute(dnnl::stream strm) {
         jit_eltwise_call_args_ptrs args_ptrs = {};
         auto batchDimIdx = execPtr->getBatchDimIdx();
         VectorDims dims_out = execPtr->getOutDims();
+        // the shape-agnostic executor holds no dims, the geometry of the current shape is ours
+        if (dims_out.empty())
+            dims_out = shapeAgnosticDims;
         for (int i = 0; i < memPtrs.size() - 1; i++)
             args_ptrs.src_ptr[i] = reinterpret_cast<const uint8_t*>(memPtrs[i]->GetData()) + start_offset_in[i];
         args_ptrs.dst_ptr = reinterpret_cast<uint8_t*>(memPtrs.back()->GetData()) + start_offset_out;
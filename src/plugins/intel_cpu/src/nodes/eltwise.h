@@ -42,6 +42,9 @@ struct jit_eltwise_call_args_ptrs {
     void *dst_ptr;
     //ptr to array of post op inputs pointers (flat list)
     const void** post_op_data;
+    // consumed only by shape-agnostic kernels (generated with jep.work_amount == 0) which take
+    // the element count at runtime instead of baking it into the code
+    size_t work_amount;
 };
 
 struct jit_eltwise_call_args_indexes {
@@ -147,6 +150,10 @@ private:
     // blocked dims for which kernel compiled and params prepared
     std::vector<VectorDims> currentInBlkDims = {};
 
+    // {N, C, inner} geometry of the current shape for the shape-agnostic executor, which itself
+    // carries no per-shape state and is shared between all shapes of the same broadcast class
+    VectorDims shapeAgnosticDims = {};
+
     float alpha = 0;
     float beta = 0;
     float gamma = 0;
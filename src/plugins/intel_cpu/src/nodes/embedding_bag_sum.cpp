@@ -10,6 +10,7 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "common/cpu_prefetch.h"
 
 using namespace InferenceEngine;
 
@@ -79,6 +80,8 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                     IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
                 }
                 size_t srcIndex = indices[inIdx] * _embDepth;
+                if (indicesSize > 1lu)
+                    cpu_prefetch(srcData + indices[1] * _embDepth);
 
                 if (withWeights) {
                     for (size_t i = 0lu; i < _embDepth; i++) {
@@ -96,6 +99,8 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                         IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
                     }
                     size_t srcIndex = indices[inIdx] * _embDepth;
+                    if (inIdx + 1lu < indicesSize)
+                        cpu_prefetch(srcData + indices[inIdx + 1] * _embDepth);
 
                     if (withWeights) {
                         for (size_t i = 0lu; i < _embDepth; i++) {
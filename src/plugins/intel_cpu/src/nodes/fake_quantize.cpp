@@ -1433,6 +1433,20 @@ void FakeQuantize::prepareParams() {
         key.jqp.is_planar = srcDesc->hasLayoutType(LayoutType::ncsp) && one_of(srcDesc->getShape().getRank(), 3, 4, 5);
         key.jqp.op_type = getAlgorithm();
 
+        // Byte inputs go through a table lookup instead of the jit formula kernel. The tables
+        // depend on the actual quantization parameter values, so this executor is built directly
+        // and bypasses the params cache, whose key only carries shapes and precisions.
+        const bool perTensorParams = broadcastingPolicy == PerTensor;
+        const bool lutLayoutSupported = perTensorParams || key.jqp.is_planar || srcDesc->hasLayoutType(LayoutType::nspc);
+        if (!isBinarization() && levels != 2 && getAxis() == 1 &&
+            one_of(key.jqp.src_prc, Precision::U8, Precision::I8) &&
+            one_of(key.jqp.dst_prc, Precision::U8, Precision::I8, Precision::FP32) &&
+            lutLayoutSupported) {
+            execPtr = std::make_shared<FakeQuantizeLutExecutor>(*this, key.jqp.src_prc, key.jqp.dst_prc,
+                                                                axisSize, perTensorParams, key.jqp.is_planar);
+            return;
+        }
+
         auto cache = context->getParamsCache();
         auto buildExecutor = [](const FakeQuantKey& key) {
             return std::make_shared<FakeQuantizeJitExecutor>(key.jqp);
@@ -2117,6 +2131,120 @@ void FakeQuantize::FakeQuantizeJitExecutor::exec(const FakeQuantize& node) {
     }
 }
 
+FakeQuantize::FakeQuantizeLutExecutor::FakeQuantizeLutExecutor(const FakeQuantize& node,
+                                                               Precision srcPrc,
+                                                               Precision dstPrc,
+                                                               size_t axisSize,
+                                                               bool perTensor,
+                                                               bool isPlanar)
+        : elementSize(dstPrc.size()), perTensor(perTensor), isPlanar(isPlanar) {
+    // the internal blobs hold the per-axis parameters with broadcasts already resolved
+    const auto* cropLowData = reinterpret_cast<const float*>(node.internalBlobMemory[0]->GetData());
+    const auto* cropHighData = reinterpret_cast<const float*>(node.internalBlobMemory[1]->GetData());
+    const auto* inputScaleData = reinterpret_cast<const float*>(node.internalBlobMemory[2]->GetData());
+    const auto* inputShiftData = reinterpret_cast<const float*>(node.internalBlobMemory[3]->GetData());
+    const auto* outputScaleData = reinterpret_cast<const float*>(node.internalBlobMemory[4]->GetData());
+    const auto* outputShiftData = reinterpret_cast<const float*>(node.internalBlobMemory[5]->GetData());
+
+    const size_t rows = perTensor ? 1 : axisSize;
+    table.resize(rows * 256 * elementSize);
+
+    for (size_t c = 0; c < rows; c++) {
+        for (size_t v = 0; v < 256; v++) {
+            const float x = srcPrc == Precision::I8 ? static_cast<float>(static_cast<int8_t>(v))
+                                                    : static_cast<float>(v);
+            float val = nstl::min(cropHighData[c], nstl::max(cropLowData[c], x));
+            val = val * inputScaleData[c] + inputShiftData[c];
+            val = roundf(val);
+            val = val * outputScaleData[c] + outputShiftData[c];
+
+            const size_t idx = c * 256 + v;
+            if (dstPrc == Precision::FP32) {
+                reinterpret_cast<float*>(table.data())[idx] = val;
+            } else {
+                // match the jit kernel conversion: round to nearest-even and saturate
+                const long rounded = std::lrintf(val);
+                if (dstPrc == Precision::U8)
+                    table[idx] = static_cast<uint8_t>(std::max(static_cast<long>(0), std::min(static_cast<long>(255), rounded)));
+                else
+                    reinterpret_cast<int8_t*>(table.data())[idx] =
+                        static_cast<int8_t>(std::max(static_cast<long>(-128), std::min(static_cast<long>(127), rounded)));
+            }
+        }
+    }
+}
+
+void FakeQuantize::FakeQuantizeLutExecutor::exec(const FakeQuantize& node) {
+    const auto& srcMemory = node.getParentEdgeAt(0)->getMemoryPtr();
+    const auto& dstMemory = node.getChildEdgeAt(0)->getMemoryPtr();
+
+    const auto* src = reinterpret_cast<const uint8_t*>(srcMemory->GetPtr());
+    auto* dst = reinterpret_cast<uint8_t*>(dstMemory->GetPtr());
+
+    if (perTensor) {
+        // a single row serves the whole tensor, so every stored element (layout padding
+        // included) can be mapped with a flat loop regardless of the layout
+        const size_t total = srcMemory->GetSize();
+        constexpr size_t blockSize = 16384;
+        const size_t blocks = div_up(total, blockSize);
+        if (elementSize == 1) {
+            const uint8_t* row = table.data();
+            parallel_for(blocks, [&](size_t b) {
+                const size_t start = b * blockSize;
+                const size_t end = std::min(start + blockSize, total);
+                for (size_t i = start; i < end; i++)
+                    dst[i] = row[src[i]];
+            });
+        } else {
+            const float* row = reinterpret_cast<const float*>(table.data());
+            auto* fdst = reinterpret_cast<float*>(dst);
+            parallel_for(blocks, [&](size_t b) {
+                const size_t start = b * blockSize;
+                const size_t end = std::min(start + blockSize, total);
+                for (size_t i = start; i < end; i++)
+                    fdst[i] = row[src[i]];
+            });
+        }
+        return;
+    }
+
+    const auto& dims = srcMemory->getStaticDims();
+    const size_t N = dims[0];
+    const size_t C = dims.size() > 1 ? dims[1] : 1;
+    size_t spatial = 1;
+    for (size_t i = 2; i < dims.size(); i++)
+        spatial *= dims[i];
+
+    if (isPlanar) {
+        parallel_for2d(N, C, [&](size_t n, size_t c) {
+            const size_t base = (n * C + c) * spatial;
+            if (elementSize == 1) {
+                const uint8_t* row = table.data() + c * 256;
+                for (size_t i = 0; i < spatial; i++)
+                    dst[base + i] = row[src[base + i]];
+            } else {
+                const float* row = reinterpret_cast<const float*>(table.data()) + c * 256;
+                auto* fdst = reinterpret_cast<float*>(dst);
+                for (size_t i = 0; i < spatial; i++)
+                    fdst[base + i] = row[src[base + i]];
+            }
+        });
+    } else {  // nspc: the channels are contiguous at every spatial position
+        parallel_for2d(N, spatial, [&](size_t n, size_t s) {
+            const size_t base = (n * spatial + s) * C;
+            if (elementSize == 1) {
+                for (size_t c = 0; c < C; c++)
+                    dst[base + c] = table[c * 256 + src[base + c]];
+            } else {
+                const float* rows = reinterpret_cast<const float*>(table.data());
+                auto* fdst = reinterpret_cast<float*>(dst);
+                for (size_t c = 0; c < C; c++)
+                    fdst[base + c] = rows[c * 256 + src[base + c]];
+            }
+        });
+    }
+}
+
 bool FakeQuantize::created() const {
     return getType() == Type::FakeQuantize;
 }
@@ -163,6 +163,23 @@ private:
         std::unique_ptr<jit_uni_quantize_kernel> pKernel;
     };
 
+    // For byte inputs the whole piecewise formula has only 256 outcomes per channel, so it
+    // collapses into a lookup table and the per-element cost becomes a single load
+    struct FakeQuantizeLutExecutor : public FakeQuantizeExecutor {
+        FakeQuantizeLutExecutor(const FakeQuantize& node,
+                                InferenceEngine::Precision srcPrc,
+                                InferenceEngine::Precision dstPrc,
+                                size_t axisSize,
+                                bool perTensor,
+                                bool isPlanar);
+        void exec(const FakeQuantize& node) override;
+        // perTensor ? 1 : axisSize rows of 256 entries in the output precision
+        std::vector<uint8_t> table;
+        size_t elementSize;
+        bool perTensor;
+        bool isPlanar;
+    };
+
     void init() override;
     std::vector<LayoutType> getDataFormats() const;
     void initializePostOpData(const VectorDims &postOpDims, const size_t bufferAlignment, bool doRounding);
@@ -14,7 +14,10 @@
 #include <vector>
 #include <dnnl_extension_utils.h>
 #include <onednn/dnnl.h>
+#include "itt.h"
+#include "onednn/itt.h"
 #include "utils/general_utils.h"
+#include "common/cpu_memcpy.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -33,6 +36,11 @@ namespace intel_cpu {
 namespace node {
 namespace {
 
+// Bucket size (in rows) for the batch dimension of dynamically shaped inputs. One primitive
+// created for the bucket upper bound serves every batch value within the bucket, so a volatile
+// batch (e.g. NLP sequence length) doesn't trigger primitive creation on each new shape.
+constexpr size_t fcBucketGranularity = 32;
+
 struct FCKey {
     DnnlMemoryDescCPtr inp0;
     DnnlMemoryDescCPtr inp1;
@@ -41,6 +49,7 @@ struct FCKey {
     dnnl::primitive_attr attr;
     impl_desc_type implType;
     bool useConv1x1;
+    bool useInt8Matmul;
 
     size_t hash() const;
     bool operator==(const FCKey& rhs) const;
@@ -61,6 +70,7 @@ size_t FCKey::hash() const {
     seed = hash_combine(seed, get_attr_hash(*attr.get()));
     seed = hash_combine(seed, implType);
     seed = hash_combine(seed, useConv1x1);
+    seed = hash_combine(seed, useInt8Matmul);
     return seed;
 }
 
@@ -79,7 +89,8 @@ bool FCKey::operator==(const FCKey &rhs) const {
         retVal = retVal && out && rhs.out && out->getDnnlDesc() == rhs.out->getDnnlDesc();
     }
     retVal = retVal && *attr.get() == *rhs.attr.get() &&
-             implType == rhs.implType && useConv1x1 == rhs.useConv1x1;
+             implType == rhs.implType && useConv1x1 == rhs.useConv1x1 &&
+             useInt8Matmul == rhs.useInt8Matmul;
     return retVal;
 }
 
@@ -193,18 +204,18 @@ void FullyConnected::getSupportedDescriptors() {
 
     //  We have to extend gemm_x8s8s32x_inner_product_fwd_t from oneDNN to support BF16 output data type
     if ((!one_of(inputDataType , memory::data_type::u8, memory::data_type::s8) || weightsDataType != memory::data_type::s8)
-            && inputDataType != memory::data_type::bf16) {
+            && !one_of(inputDataType, memory::data_type::bf16, memory::data_type::f16)) {
         inputDataType = outputDataType = memory::data_type::f32;
     }
 
     if (one_of(inputDataType , memory::data_type::u8, memory::data_type::s8)
-        && outputDataType == memory::data_type::bf16) {
+        && one_of(outputDataType, memory::data_type::bf16, memory::data_type::f16)) {
         outputDataType = memory::data_type::f32;
     }
 
-    if (inputDataType == memory::data_type::bf16
+    if (one_of(inputDataType, memory::data_type::bf16, memory::data_type::f16)
         && one_of(outputDataType , memory::data_type::u8, memory::data_type::s8)) {
-        outputDataType = memory::data_type::bf16;
+        outputDataType = inputDataType;
     }
 
     inDims = isDynamicNode() ? makeDummyInputDims() : getInputShapeAtPort(DATA_ID).getStaticDims();
@@ -250,13 +261,65 @@ void FullyConnected::prepareParams() {
     DnnlMemoryDescCPtr outDesc = dstMemPtr->GetDescWithType<DnnlMemoryDesc>();
 
     useConv1x1 = canBeExecutedInConv1x1();
-    FCKey key = {inDesc,
+    useInt8Matmul = !useConv1x1 && canBeExecutedInInt8Matmul();
+
+    // Shape bucketing for dynamic shapes: pad the batch dimension up to a multiple of
+    // fcBucketGranularity and look the executor up by the padded descriptors, so all batch values
+    // within a bucket share one primitive. Per-shape primitive creation costs milliseconds while
+    // the pad adds at most (fcBucketGranularity - 1) extra rows of compute and two plain copies.
+    // Only plain layouts are bucketed - the valid region then is a contiguous prefix.
+    useBucketPadding = false;
+    DnnlMemoryDescCPtr keyInDesc = inDesc;
+    DnnlMemoryDescCPtr keyOutDesc = outDesc;
+    if (isDynamicNode() && !useConv1x1) {
+        const auto& srcDims = srcMemPtr->getStaticDims();
+        const auto& dstDims = dstMemPtr->getStaticDims();
+        const size_t srcRank = srcDims.size();
+        size_t M = 1;
+        for (size_t i = 0; i + 1 < srcDims.size(); i++)
+            M *= srcDims[i];
+        const size_t paddedM = (M + fcBucketGranularity - 1) / fcBucketGranularity * fcBucketGranularity;
+        const auto srcType = inDesc->getDataType();
+        const auto dstType = outDesc->getDataType();
+        const auto plainTag = srcRank == 3 ? memory::format_tag::tnc : memory::format_tag::nc;
+        // small batches are left as is: padding them would cost a significant compute fraction
+        // and there are only a few such shapes to cache anyway
+        if (one_of(srcRank, static_cast<size_t>(2), static_cast<size_t>(3)) && dstDims.size() == srcRank &&
+            M >= fcBucketGranularity &&
+            inDesc->getDnnlDesc() == dnnl::memory::desc(DnnlExtensionUtils::convertToDnnlDims(srcDims), srcType, plainTag) &&
+            outDesc->getDnnlDesc() == dnnl::memory::desc(DnnlExtensionUtils::convertToDnnlDims(dstDims), dstType, plainTag)) {
+            const auto K = static_cast<dnnl::memory::dim>(srcDims.back());
+            const auto N = static_cast<dnnl::memory::dim>(dstDims.back());
+            keyInDesc = DnnlExtensionUtils::makeDescriptor(
+                dnnl::memory::desc({static_cast<dnnl::memory::dim>(paddedM), K}, srcType, memory::format_tag::nc));
+            keyOutDesc = DnnlExtensionUtils::makeDescriptor(
+                dnnl::memory::desc({static_cast<dnnl::memory::dim>(paddedM), N}, dstType, memory::format_tag::nc));
+            if (paddedM != M) {
+                useBucketPadding = true;
+                bucketSrcValidBytes = M * K * DnnlExtensionUtils::sizeOfDataType(srcType);
+                bucketDstValidBytes = M * N * DnnlExtensionUtils::sizeOfDataType(dstType);
+                auto growBucketMem = [this](MemoryPtr& mem, const DnnlMemoryDescCPtr& desc) {
+                    if (!mem || mem->GetSize() < desc->getCurrentMemSize()) {
+                        mem = std::make_shared<Memory>(getEngine());
+                        mem->Create(*desc);
+                        // keep the pad rows deterministic so stale data can't hit slow fp corner cases
+                        memset(mem->GetData(), 0, mem->GetSize());
+                    }
+                };
+                growBucketMem(bucketSrcMem, keyInDesc);
+                growBucketMem(bucketDstMem, keyOutDesc);
+            }
+        }
+    }
+
+    FCKey key = {keyInDesc,
                  weightDesc,
                  biasDesc,
-                 outDesc,
+                 keyOutDesc,
                  *attr,
                  implementationTypeIP,
-                 useConv1x1};
+                 useConv1x1,
+                 useInt8Matmul};
 
     auto engine = getEngine();
 
@@ -283,6 +346,45 @@ void FullyConnected::prepareParams() {
                 execPtr = std::make_shared<ExecutorConv1x1>(prim_desc);
             }
         }
+        // dedicated int8 tall-skinny GEMM path: the brgemm-based matmul kernels block over M and
+        // keep the VNNI pipes busy where the int8 inner product kernels are bound by the narrow N
+        // dimension; quantization scales and the fused post-ops (including the LPT-produced
+        // FakeQuantize tail) are applied in the kernel epilogue through the same attr
+        if (!execPtr && key.useInt8Matmul) {
+            auto inDesc = key.inp0->getDnnlDesc();
+            if (inDesc.dims().size() == 3) {
+                auto inDims = inDesc.dims();
+                auto normalizedInDims = {inDims[0] * inDims[1], inDims[2]};
+                inDesc = inDesc.reshape(normalizedInDims);
+            }
+            auto outDesc = key.out->getDnnlDesc();
+            if (outDesc.dims().size() == 3) {
+                auto outDims = outDesc.dims();
+                auto normalizedOutDims = { outDims[0] * outDims[1], outDims[2] };
+                outDesc = outDesc.reshape(normalizedOutDims);
+            }
+            const auto K = inDesc.dims()[1];
+            const auto N = outDesc.dims()[1];
+            // the [N, K] constant is consumed as a transposed [K, N] matrix; format_tag::any lets
+            // the primitive choose its blocked VNNI layout and prepareWeightMemory repacks into it
+            auto wgh_candidate = dnnl::memory::desc({K, N}, key.inp1->getDnnlDesc().data_type(),
+                                                    memory::format_tag::any);
+            try {
+                std::shared_ptr<dnnl::matmul::desc> mmDsc;
+                if (key.bias) {
+                    mmDsc = std::make_shared<dnnl::matmul::desc>(inDesc, wgh_candidate,
+                                                                 key.bias->getDnnlDesc().reshape({1, N}), outDesc);
+                } else {
+                    mmDsc = std::make_shared<dnnl::matmul::desc>(inDesc, wgh_candidate, outDesc);
+                }
+                dnnl::matmul::primitive_desc prim_desc(*mmDsc, key.attr, engine, true);
+                if (prim_desc) {
+                    execPtr = std::make_shared<ExecutorMatmul>(prim_desc);
+                }
+            } catch (...) {
+                // no suitable matmul implementation - fall back to the inner product path below
+            }
+        }
         // fallback
         if (!execPtr) {
             auto inDesc = key.inp0->getDnnlDesc();
@@ -362,6 +464,11 @@ void FullyConnected::prepareParams() {
                 primArgs[DNNL_ARG_DST] = dnnl::memory(execPtr->getDstDesc(), oldMem.get_engine(), oldMem.get_data_handle());
             }
         }
+        if (useBucketPadding) {
+            // the primitive reads and writes paddedM rows - route it through the padded scratch buffers
+            primArgs[DNNL_ARG_SRC] = dnnl::memory(execPtr->getSrcDesc(), engine, bucketSrcMem->GetData());
+            primArgs[DNNL_ARG_DST] = dnnl::memory(execPtr->getDstDesc(), engine, bucketDstMem->GetData());
+        }
         if (!prevExecPtr || prevExecPtr->getWeightDesc() != execPtr->getWeightDesc()) {
             primArgs[DNNL_ARG_WEIGHTS] = prepareWeightMemory(DnnlExtensionUtils::makeDescriptor(execPtr->getWeightDesc()))->GetPrimitive();
         }
@@ -375,7 +482,14 @@ void FullyConnected::prepareParams() {
         useConv1x1 = execPtr->getImplementationType() == brgconv_avx512_1x1;
 
         if (withBiases) {
-            primArgs[DNNL_ARG_BIAS] = biasMemPtr->GetPrimitive();
+            auto oldMem = biasMemPtr->GetPrimitive();
+            // the matmul path expects a 2D {1, N} bias while the node holds it as 1D {N}
+            const auto* biasMd = dnnl_primitive_desc_query_md(execPtr->getPrimitiveDesc(), dnnl_query_weights_md, 1);
+            if (biasMd && dnnl::memory::desc(*biasMd) != oldMem.get_desc()) {
+                primArgs[DNNL_ARG_BIAS] = dnnl::memory(dnnl::memory::desc(*biasMd), engine, oldMem.get_data_handle());
+            } else {
+                primArgs[DNNL_ARG_BIAS] = std::move(oldMem);
+            }
         }
 
         appendPostOpArgs(*attr, primArgs, postOpsArgs);
@@ -429,6 +543,17 @@ void FullyConnected::execute(dnnl::stream strm) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
 
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, primExecItt(*execPtr->getExecPrim()));
+
+    if (useBucketPadding) {
+        // the batch was padded up to the bucket bound: run over the padded scratch buffers and
+        // copy only the valid rows in and out (plain layouts, so a single memcpy each way)
+        cpu_memcpy(bucketSrcMem->GetData(), getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetData(), bucketSrcValidBytes);
+        execPtr->exec(primArgs, strm);
+        cpu_memcpy(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetData(), bucketDstMem->GetData(), bucketDstValidBytes);
+        return;
+    }
+
     // in cases parameter -> FullyConnected or dynamic shapes
     // we keep old pointer to data in primArgs on second iteration with same input shapes
     auto updateMemoryPtr = [this](int argType) {
@@ -568,7 +693,7 @@ void FullyConnected::createDescriptorInternal(const dnnl::memory::desc &inputDes
 
     dnnl::memory::data_type wdt = in_candidate.data_type();
     dnnl::memory::data_type bdt = out_candidate.data_type();
-    if (in_candidate.data_type() == dnnl::memory::data_type::bf16) {
+    if (one_of(in_candidate.data_type(), dnnl::memory::data_type::bf16, dnnl::memory::data_type::f16)) {
         bdt = dnnl::memory::data_type::f32;
     } else if (in_candidate.data_type() == dnnl::memory::data_type::u8 || in_candidate.data_type() == dnnl::memory::data_type::s8) {
         wdt = memory::data_type::s8;
@@ -844,6 +969,34 @@ bool FullyConnected::canBeExecutedInConv1x1() const {
     return retVal;
 }
 
+bool FullyConnected::canBeExecutedInInt8Matmul() const {
+    // Tall-skinny quantized GEMMs (many rows, few output channels) leave the int8 inner product
+    // kernels bound by the narrow N dimension; the brgemm-based matmul kernels block over M and
+    // keep the VNNI pipes busy instead. The bounds below target recommender-style workloads:
+    // a wide feature/embedding input (K) projected to a few outputs (N) for a large batch (M).
+    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_vnni) || useSparseWeights)
+        return false;
+    const auto inRank = getInputShapeAtPort(DATA_ID).getRank();
+    const auto weightRank = getInputShapeAtPort(WEIGHTS_ID).getRank();
+    if (!one_of(inRank, 2, 3) || weightRank != 2)
+        return false;
+    const auto srcPrc = getOriginalInputPrecisionAtPort(DATA_ID);
+    const auto weiPrc = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+    if (!one_of(srcPrc, InferenceEngine::Precision::U8, InferenceEngine::Precision::I8) ||
+        weiPrc != InferenceEngine::Precision::I8)
+        return false;
+
+    const auto& srcDims = getParentEdgesAtPort(0)[0]->getMemoryPtr()->getStaticDims();
+    const auto& weightDims = getParentEdgesAtPort(1)[0]->getMemoryPtr()->getStaticDims();
+    Dim M = 1;
+    for (size_t i = 0; i + 1 < srcDims.size(); i++)
+        M *= srcDims[i];
+    const Dim K = srcDims.back();
+    const Dim N = weightDims[0];
+    // K > N also keeps the transposed weights view in prepareWeightMemory unambiguous
+    return N <= 64 && K >= 2 * N && M >= 256;
+}
+
 FullyConnected::ExecutorInnerProduct::ExecutorInnerProduct(const dnnl::inner_product_forward::primitive_desc& pd) {
     execPrim.reset(new dnnl::inner_product_forward(pd));
 }
@@ -852,6 +1005,10 @@ FullyConnected::ExecutorConv1x1::ExecutorConv1x1(const dnnl::convolution_forward
     execPrim.reset(new dnnl::convolution_forward(pd));
 }
 
+FullyConnected::ExecutorMatmul::ExecutorMatmul(const dnnl::matmul::primitive_desc& pd) {
+    execPrim.reset(new dnnl::matmul(pd));
+}
+
 MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     if (!getParentEdgeAt(1)->getParent()->isConstant())
         IE_THROW() << "Weight input is not const for node " << getName() << ".";
@@ -861,7 +1018,29 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
 
     auto constDnnlMemOutDesc = blob->GetDescWithType<DnnlMemoryDesc>();
     auto weightSrcDesc = constDnnlMemOutDesc->getDnnlDesc();
-    weightSrcDesc = weightSrcDesc.reshape(weightDesc->getDnnlDesc().dims());
+    const auto& wgtDims = weightDesc->getDnnlDesc().dims();
+    const auto& blobDims = weightSrcDesc.dims();
+    if (wgtDims.size() == 2 && blobDims.size() == 2 && wgtDims[0] != wgtDims[1] &&
+        wgtDims[0] == blobDims[1] && wgtDims[1] == blobDims[0]) {
+        // the int8 matmul path consumes the [N, K] constant as a [K, N] matrix: describe the blob
+        // as a transposed view so the reorder below materializes the blocked layout directly
+        weightSrcDesc = dnnl::memory::desc(wgtDims, weightSrcDesc.data_type(),
+                                           dnnl::memory::dims{1, blobDims[1]});
+    } else {
+        weightSrcDesc = weightSrcDesc.reshape(wgtDims);
+    }
+
+    // If the layout the primitive expects matches the layout of the constant blob, reuse the blob
+    // data in place instead of materializing a reordered copy. This keeps mmap-backed weights
+    // zero-copy and only pays for a reorder when the layouts actually differ. When weights NUMA
+    // replication is requested, take the copying path so each NUMA node gets a local replica
+    // through its weights cache.
+    if (weightSrcDesc == weightDesc->getDnnlDesc() && !context->getConfig().weightsNumaReplication) {
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+        _ptr->Create(weightDesc, blob->GetData());
+        return _ptr;
+    }
+
     auto create = [&] () {
         auto newSrcDesc = DnnlExtensionUtils::makeDescriptor(weightSrcDesc);
 
@@ -928,12 +1107,19 @@ bool FullyConnected::useSparseWeightsDecompression() {
 
     auto weightsData = reinterpret_cast<const int8_t*>(blb->GetPtr());
     auto elementsCount = blb->GetDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
-    size_t zerosCounts = 0;
-    for (int i = 0; i < elementsCount; i++) {
-        if (weightsData[i] == 0) {
-            zerosCounts++;
+    // the scan touches the whole weights blob at load time, so count zeros block-wise in parallel
+    const size_t blockSize = 4096;
+    const size_t blocksCount = (elementsCount + blockSize - 1) / blockSize;
+    size_t zerosCounts = parallel_sum(blocksCount, static_cast<size_t>(0), [&](size_t block) -> size_t {
+        size_t count = 0;
+        const size_t blockEnd = std::min(elementsCount, (block + 1) * blockSize);
+        for (size_t i = block * blockSize; i < blockEnd; i++) {
+            if (weightsData[i] == 0) {
+                count++;
+            }
         }
-    }
+        return count;
+    });
     nnzCount = elementsCount - zerosCounts;
 
     DEBUG_LOG(getName(), ", weightsData.size() = ", elementsCount, ", zerosCounts = ",
@@ -82,6 +82,7 @@ private:
     using executorPtr = std::shared_ptr<DnnlExecutor>;
     executorPtr execPtr = nullptr;
     bool useConv1x1 = false;
+    bool useInt8Matmul = false;
     impl_desc_type implementationTypeIP;
     MemoryDescPtr weightDescIP;
     // when weightCache is not enabled (such as stream=1), brgconv weights may change due to
@@ -100,14 +101,28 @@ private:
             ExecutorConv1x1(const dnnl::convolution_forward::primitive_desc& pd);
     };
 
+    class ExecutorMatmul : public DnnlExecutor {
+        public:
+            ExecutorMatmul(const dnnl::matmul::primitive_desc& pd);
+    };
+
     static DnnlDesriptor createDescriptorInternalForConv(DnnlMemoryDescCPtr inputDescPtr,
                                                          DnnlMemoryDescCPtr weightDescPtr,
                                                          DnnlMemoryDescCPtr biasDescPtr,
                                                          DnnlMemoryDescCPtr outputDescPtr);
 
     bool canBeExecutedInConv1x1() const;
+    bool canBeExecutedInInt8Matmul() const;
     MemoryPtr prepareWeightMemory(const DnnlMemoryDescPtr weightDesc);
 
+    // shape bucketing of the batch dimension for dynamic shapes (see prepareParams): when the
+    // actual batch is below the bucket bound the primitive runs over these padded scratch buffers
+    bool useBucketPadding = false;
+    MemoryPtr bucketSrcMem;
+    MemoryPtr bucketDstMem;
+    size_t bucketSrcValidBytes = 0;
+    size_t bucketDstValidBytes = 0;
+
     // sparse weights
     bool useSparseWeights = false;
     int nnzCount = -1;
@@ -9,6 +9,7 @@
 #include "gather.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "common/cpu_prefetch.h"
 #include <utils/general_utils.h>
 #include "kernels/gather_uni_kernel.hpp"
 
@@ -449,7 +450,17 @@ void Gather::execReference() {
     uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
     const size_t dstAfterBatchSize = betweenBatchAndAxisSize * specIdxAndAfterAxSizeB;
-    parallel_for2d(beforeBatchSize, specIndicesSize, [&](const size_t b, const size_t j) {
+    const size_t workAmount = beforeBatchSize * specIndicesSize;
+    // Vocab/embedding tables are much bigger than the caches and the indices are effectively
+    // random, so each row read starts with a DRAM access. The rows a few iterations ahead are
+    // known from the indices tensor, hinting them while the current row is copied overlaps the
+    // memory latency with the copy. The distance is a compromise between issuing the hint early
+    // enough and not evicting the lines before they get consumed.
+    static constexpr size_t prefetchDistance = 4lu;
+
+    auto srcRow = [&](size_t work) -> const uint8_t* {
+        const size_t b = work / specIndicesSize;
+        const size_t j = work % specIndicesSize;
         int ii = srcIndices[b * specIndicesSize + j];
         if (ii < 0) {
             if (reverseIndexing)
@@ -458,18 +469,36 @@ void Gather::execReference() {
                 ii = axisDim;
         }
         const size_t idx = ii;
-        const size_t c2 = dstAfterBatchSize * b + afterAxisSizeInBytes * j;
-        if (idx < axisDim) {
-            size_t c1 = srcAfterBatchSizeInBytes * b + afterAxisSizeInBytes * idx;
-            for (size_t i = 0; i < betweenBatchAndAxisSize; i++) {
-                size_t srcIdx = c1 + axisAndAfterAxisSizeInBytes * i;
-                size_t dstIdx = c2 + specIdxAndAfterAxSizeB * i;
-
-                cpu_memcpy(&dstData[dstIdx], &srcData[srcIdx], afterAxisSizeInBytes);
+        if (idx >= axisDim)
+            return nullptr;
+        return &srcData[srcAfterBatchSizeInBytes * b + afterAxisSizeInBytes * idx];
+    };
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(workAmount, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        for (size_t work = start; work < end; work++) {
+            if (work + prefetchDistance < end) {
+                if (const uint8_t* aheadRow = srcRow(work + prefetchDistance))
+                    cpu_prefetch(aheadRow);
             }
-        } else {
-            for (size_t i = 0; i < betweenBatchAndAxisSize; i++) {
-                memset(&dstData[c2 + specIdxAndAfterAxSizeB * i], 0, afterAxisSizeInBytes);
+
+            const size_t b = work / specIndicesSize;
+            const size_t j = work % specIndicesSize;
+            const size_t c2 = dstAfterBatchSize * b + afterAxisSizeInBytes * j;
+            if (const uint8_t* row = srcRow(work)) {
+                for (size_t i = 0; i < betweenBatchAndAxisSize; i++) {
+                    size_t dstIdx = c2 + specIdxAndAfterAxSizeB * i;
+
+                    cpu_memcpy(&dstData[dstIdx], row + axisAndAfterAxisSizeInBytes * i, afterAxisSizeInBytes);
+                }
+            } else {
+                for (size_t i = 0; i < betweenBatchAndAxisSize; i++) {
+                    memset(&dstData[c2 + specIdxAndAfterAxSizeB * i], 0, afterAxisSizeInBytes);
+                }
             }
         }
     });
@@ -12,6 +12,7 @@
 #include <precision_utils.h>
 #include <utils/general_utils.h>
 #include "common/cpu_memcpy.h"
+#include "common/cpu_prefetch.h"
 
 using namespace InferenceEngine;
 
@@ -169,6 +170,15 @@ void GatherND::GatherNDExecutor::gatherBlocks(const MemoryPtr& srcMemPtr, const
 
         for (size_t b = bStart; b < batchSize; b++) {
             for (size_t j = cStart; j < cycles; j++) {
+                // the slice a few iterations ahead is known from the indices, hint it
+                // while the current one is copied to hide the random-access latency
+                if (j + PREFETCH_DISTANCE < cycles && workCounter + PREFETCH_DISTANCE < end) {
+                    const int32_t* aheadIndices = shiftedIndices + PREFETCH_DISTANCE * sliceRank;
+                    size_t aheadIdx = 0lu;
+                    for (size_t i = 0; i < sliceRank; i++)
+                        aheadIdx += srcShifts[i] * aheadIndices[i];
+                    cpu_prefetch(&(shiftedSrcData[aheadIdx]));
+                }
                 size_t dataIdx = 0lu;
                 for (size_t i = 0; i < sliceRank; i++)
                     dataIdx += srcShifts[i] * shiftedIndices[i];
@@ -206,6 +216,13 @@ void GatherND::GatherNDExecutor::gatherElementwise(const MemoryPtr& srcMemPtr, c
 
         for (size_t b = bStart; b < batchSize; b++) {
             for (size_t j = cStart; j < cycles; j++) {
+                if (j + PREFETCH_DISTANCE < cycles && workCounter + PREFETCH_DISTANCE < end) {
+                    const int32_t* aheadIndices = shiftedIndices + PREFETCH_DISTANCE * sliceRank;
+                    size_t aheadIdx = 0lu;
+                    for (size_t i = 0lu; i < sliceRank; i++)
+                        aheadIdx += srcShifts[i] * aheadIndices[i];
+                    cpu_prefetch(&(shiftedSrcData[aheadIdx]));
+                }
                 size_t dataIdx = 0lu;
                 for (size_t i = 0lu; i < sliceRank; i++)
                     dataIdx += srcShifts[i] * shiftedIndices[i];
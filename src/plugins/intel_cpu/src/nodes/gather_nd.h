@@ -50,6 +50,9 @@ private:
         void gatherElementwise(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, MemoryPtr& dstMemPtr);
         void gatherBlocks(const MemoryPtr& srcMemPtr, const MemoryPtr& idxMemPtr, MemoryPtr& dstMemPtr);
 
+        // how many iterations ahead the source slices get prefetched in the gather loops
+        static constexpr size_t PREFETCH_DISTANCE = 4lu;
+
         size_t batchSize = 1lu;
         size_t cycles = 1lu;
         size_t dataLength = 1lu;
@@ -237,6 +237,19 @@ void If::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+void If::appendSubGraphPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const {
+    // report both branches: nodes of the branch which was never taken come out with
+    // zero time and NOT_RUN status, which makes the cascade hit rate visible in the report
+    auto appendBranch = [&](const Graph& graph, const char* branch) {
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> branchMap;
+        graph.GetPerfData(branchMap);
+        for (const auto& entry : branchMap)
+            perfMap[getName() + "/" + branch + "/" + entry.first] = entry.second;
+    };
+    appendBranch(subGraphThen, "then");
+    appendBranch(subGraphElse, "else");
+}
+
 bool If::created() const {
     return getType() == Type::If;
 }
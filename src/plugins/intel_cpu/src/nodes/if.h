@@ -26,6 +26,7 @@ public:
     bool created() const override;
     void execute(dnnl::stream strm) override;
     bool isExecutable() const override { return true; }
+    void appendSubGraphPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const override;
 
 protected:
     void executeDynamicImpl(dnnl::stream strm) override;
@@ -343,24 +343,36 @@ void Input::cloneBlobIfRequired() {
         return false;
     };
 
+    // The key is content-hash based (as for the repacked internal blobs, see Node::prepareMemory),
+    // so identical constants of networks compiled from the same model resolve to one cache record
+    // and the weights are packed only once per process
     auto blobKey = [&, this] () {
-        char ptr[32];
-        snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
+        const uint64_t data_hash = WeightsSharing::GetHashFunc().hash(
+                static_cast<const unsigned char*>(constOp->get_data_ptr()), size * prec.size());
         return getName()
                 + "_" + std::to_string(size * prec.size())
-                + "_" + ptr;
+                + "_" + std::to_string(data_hash);
     };
 
-    auto weightCache = context->getWeightsCache();
-    if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
-        memoryPtr = std::const_pointer_cast<const Memory>(ptr);
-    } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
+    // A constant which is properly aligned and does not require any fixup can be used in place:
+    // the Memory object just wraps the Constant data pointer (which may point into a memory mapped
+    // .bin file), the node holds constOp to keep the underlying buffer alive. There is no point in
+    // going through the weights cache in this case since the pages are already shared by the OS.
+    // With weights NUMA replication enabled the in-place path is skipped: graphs are created on
+    // their stream threads, so cloning through the per-NUMA-node weights cache places the replica
+    // on the node the stream is bound to.
+    if (isBlobAligned() && !hasSubnormals() && !isWA() && !context->getConfig().weightsNumaReplication) {
         auto ptr = new Memory(getEngine());
         ptr->Create(memDesc, constOp->get_data_ptr());
         memoryPtr = MemoryCPtr(ptr);
+    } else if (auto weightCache = context->getWeightsCache()) {
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        memoryPtr = std::const_pointer_cast<const Memory>(ptr);
+        // the data was copied, no need to keep the source constant alive on behalf of this node
+        constOp.reset();
     } else {
         memoryPtr = std::const_pointer_cast<const Memory>(cloneBlob());
+        constOp.reset();
     }
 }
 
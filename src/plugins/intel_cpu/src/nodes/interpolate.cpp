@@ -4,6 +4,7 @@
 
 #include "interpolate.h"
 
+#include "itt.h"
 #include "fake_quantize.h"
 #include "eltwise.h"
 #include <string>
@@ -1900,7 +1901,22 @@ void Interpolate::prepareParams() {
     InterpolateKey key = {interpAttrs, srcDims, dstDims, dataScales, dnnl::primitive_attr()};
     setPostOps(key.attr, dstDims);
 
+    auto cache = context->getParamsCache();
     auto buildExecutor = [&](const InterpolateKey& key) -> std::shared_ptr<InterpolateExecutor> {
+        // The index/weight tables only depend on the mode related attributes, the spatial dims
+        // and the scales, so they are cached under a key with normalized batch/channel and
+        // default post ops; executors built for a repeating scale ratio (e.g. the same resize
+        // applied to different batch or channel counts) then share one copy of the tables.
+        InterpolateKey tableKey = {key.nodeAttrs, key.srcDims, key.dstDims, key.dataScales, dnnl::primitive_attr()};
+        if (tableKey.srcDims.size() > 2 && tableKey.dstDims.size() > 2) {
+            tableKey.srcDims[0] = tableKey.srcDims[1] = 1;
+            tableKey.dstDims[0] = tableKey.dstDims[1] = 1;
+        }
+        auto tableResult = cache->getOrCreate(tableKey, [](const InterpolateKey&) {
+            // an empty table to be populated by the first executor built for this key
+            return std::make_shared<std::vector<int>>();
+        });
+
         std::shared_ptr<InterpolateExecutor> executor;
         if ((key.nodeAttrs.mode == InterpolateMode::nearest || key.nodeAttrs.mode == InterpolateMode::linear_onnx ||
             key.nodeAttrs.mode == InterpolateMode::cubic) &&
@@ -1910,17 +1926,18 @@ void Interpolate::prepareParams() {
                                                                key.srcDims,
                                                                key.dstDims,
                                                                key.dataScales,
-                                                               key.attr);
+                                                               key.attr,
+                                                               tableResult.first);
         } else {
             executor = std::make_shared<InterpolateRefExecutor>(key.nodeAttrs,
                                                                key.srcDims,
                                                                key.dstDims,
-                                                               key.dataScales);
+                                                               key.dataScales,
+                                                               tableResult.first);
         }
         return executor;
     };
 
-    auto cache = context->getParamsCache();
     auto result = cache->getOrCreate(key, buildExecutor);
     execPtr = result.first;
 
@@ -3088,9 +3105,12 @@ void Interpolate::InterpolateRefExecutor::linearInterpolation(const uint8_t *in_
 Interpolate::InterpolateExecutor::InterpolateExecutor(const InterpolateAttrs& interpAttrs,
                                                                 const VectorDims &srcDims,
                                                                 const VectorDims &dstDims,
-                                                                const std::vector<float> &dataScales) :
+                                                                const std::vector<float> &dataScales,
+                                                                const std::shared_ptr<std::vector<int>>& cachedIndexTable) :
         mode(interpAttrs.mode), configured_for_layout(interpAttrs.layout), coordTransMode(interpAttrs.coordTransMode),
-        inputPrec(interpAttrs.inPrc), outputPrec(interpAttrs.outPrc) {
+        inputPrec(interpAttrs.inPrc), outputPrec(interpAttrs.outPrc),
+        indexTableHolder(cachedIndexTable ? cachedIndexTable : std::make_shared<std::vector<int>>()),
+        indexTable(*indexTableHolder) {
     srcDimPad5d = to5Dim(getPaddedInputShape(srcDims, interpAttrs.padBegin, interpAttrs.padEnd));
     dstDim5d = to5Dim(dstDims);
     srcDataSize = interpAttrs.inPrc.size();
@@ -3098,6 +3118,11 @@ Interpolate::InterpolateExecutor::InterpolateExecutor(const InterpolateAttrs& in
     dataRank = srcDims.size();
     spatialDimSize = getSpatialDimsNum(dataRank);
 
+    // a cached table that has already been populated by a previously built executor
+    // with the same spatial dims and scales can be used as is
+    if (!indexTable.empty())
+        return;
+
     switch (mode) {
         case InterpolateMode::nearest: {
             buildTblNN(srcDimPad5d, dstDim5d, dataScales, interpAttrs.layout, interpAttrs.nearestMode);
@@ -3127,8 +3152,9 @@ Interpolate::InterpolateJitExecutor::InterpolateJitExecutor(const InterpolateAtt
                                                                       const VectorDims &srcDims,
                                                                       const VectorDims &dstDims,
                                                                       const std::vector<float> &dataScales,
-                                                                      const dnnl::primitive_attr &attr) :
-        InterpolateExecutor(interpAttrs, srcDims, dstDims, dataScales) {
+                                                                      const dnnl::primitive_attr &attr,
+                                                                      const std::shared_ptr<std::vector<int>>& cachedIndexTable) :
+        InterpolateExecutor(interpAttrs, srcDims, dstDims, dataScales, cachedIndexTable) {
     auto jcp = jit_interpolate_config_params();
     jcp.mode = mode;
     jcp.src_prc = interpAttrs.inPrc;
@@ -3147,14 +3173,18 @@ Interpolate::InterpolateJitExecutor::InterpolateJitExecutor(const InterpolateAtt
     jcp.layout = interpAttrs.layout;
     if (jcp.layout != InterpolateLayoutType::planar) {
         if (mayiuse(cpu::x64::avx512_core)) {
+            CPU_ISA_SCOPE(JitInterpolate_avx512_core);
             interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx512_core>(jcp, *attr.get()));
         } else if (mayiuse(cpu::x64::avx2)) {
+            CPU_ISA_SCOPE(JitInterpolate_avx2);
             interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
         } else if (mayiuse(cpu::x64::sse41)) {
+            CPU_ISA_SCOPE(JitInterpolate_sse41);
             interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
         }
     } else if (mayiuse(cpu::x64::avx2) && interpAttrs.inPrc == InferenceEngine::Precision::FP32) {
         // gather ISA(for planar JIT kernel) for avx2 and fp32
+        CPU_ISA_SCOPE(JitInterpolate_avx2);
         interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
     } else {
         IE_THROW() << "Can't create InterpolateJitExecutor";
@@ -142,7 +142,8 @@ private:
             InterpolateExecutor(const InterpolateAttrs& interpAttrs,
                                 const VectorDims &srcDims,
                                 const VectorDims &dstDims,
-                                const std::vector<float> &dataScales);
+                                const std::vector<float> &dataScales,
+                                const std::shared_ptr<std::vector<int>>& cachedIndexTable = nullptr);
 
             virtual void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) = 0;
             virtual ~InterpolateExecutor() = default;
@@ -172,7 +173,10 @@ private:
             size_t srcDataSize, dstDataSize;
             int spatialDimSize;
             size_t dataRank;
-            std::vector<int> indexTable;
+            // the index/weight table is held by a shared pointer, so executors that only differ
+            // in batch, channel count or fused post ops reuse one copy of it, see prepareParams
+            std::shared_ptr<std::vector<int>> indexTableHolder;
+            std::vector<int>& indexTable;
     };
     std::shared_ptr<InterpolateExecutor> execPtr = nullptr;
 
@@ -182,7 +186,8 @@ private:
                                    const VectorDims &srcDims,
                                    const VectorDims &dstDims,
                                    const std::vector<float> &dataScales,
-                                   const dnnl::primitive_attr &attr);
+                                   const dnnl::primitive_attr &attr,
+                                   const std::shared_ptr<std::vector<int>>& cachedIndexTable = nullptr);
 
             void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) override;
 
@@ -214,8 +219,10 @@ private:
             InterpolateRefExecutor(const InterpolateAttrs& interpAttrs,
                                    const VectorDims &srcDims,
                                    const VectorDims &dstDims,
-                                   const std::vector<float> &_dataScales) : dataScales(_dataScales), antialias(interpAttrs.antialias),
-                InterpolateExecutor(interpAttrs, srcDims, dstDims, _dataScales) {}
+                                   const std::vector<float> &_dataScales,
+                                   const std::shared_ptr<std::vector<int>>& cachedIndexTable = nullptr) :
+                dataScales(_dataScales), antialias(interpAttrs.antialias),
+                InterpolateExecutor(interpAttrs, srcDims, dstDims, _dataScales, cachedIndexTable) {}
 
             void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) override;
 
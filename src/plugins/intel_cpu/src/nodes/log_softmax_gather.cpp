@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "ngraph_transformations/op/log_softmax_gather.hpp"
+#include "ie_parallel.hpp"
+#include "log_softmax_gather.h"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool LogSoftmaxGather::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto logSoftmaxGather = std::dynamic_pointer_cast<const ov::intel_cpu::LogSoftmaxGatherNode>(op);
+        if (!logSoftmaxGather) {
+            errorMessage = "Only LogSoftmaxGather operation from the CPU plugin opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+LogSoftmaxGather::LogSoftmaxGather(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "LogSoftmaxGather layer with name '" + op->get_friendly_name() + "'";
+    const auto logSoftmaxGather = std::dynamic_pointer_cast<const ov::intel_cpu::LogSoftmaxGatherNode>(op);
+
+    if (inputShapes.size() != 2 || outputShapes.size() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    batchDims = logSoftmaxGather->get_batch_dims();
+    sharedIndices = batchDims == 0;
+}
+
+void LogSoftmaxGather::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32}, {LayoutType::ncsp, Precision::I32}},
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
+void LogSoftmaxGather::prepareParams() {
+    const auto& dims = getParentEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    const auto& indicesDims = getParentEdgesAtPort(1)[0]->getMemory().getStaticDims();
+
+    outerSize = 1;
+    for (size_t i = 0; i + 1 < dims.size(); i++)
+        outerSize *= dims[i];
+    axisSize = dims.back();
+
+    indicesPerSlice = 1;
+    for (size_t i = sharedIndices ? 0 : static_cast<size_t>(batchDims); i < indicesDims.size(); i++)
+        indicesPerSlice *= indicesDims[i];
+}
+
+void LogSoftmaxGather::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+void LogSoftmaxGather::execute(dnnl::stream strm) {
+    const float* srcData = reinterpret_cast<const float*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const int32_t* indices = reinterpret_cast<const int32_t*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+    float* dstData = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+
+    // The normalized tensor is never materialized: a single streaming pass per row accumulates
+    // the log-denominator (the running maximum rescales the partial sum, so the exact
+    // log-sum-exp comes out of one traversal), then only the gathered entries pay the
+    // normalization - one read of the axis plus k lookups instead of two full round-trips.
+    parallel_for(outerSize, [&](size_t row) {
+        const float* srcPtr = &srcData[row * axisSize];
+        float max = srcPtr[0];
+        float sum = 1.0f;
+        for (size_t j = 1; j < axisSize; ++j) {
+            const float value = srcPtr[j];
+            if (value > max) {
+                sum = sum * expf(max - value) + 1.0f;
+                max = value;
+            } else {
+                sum += expf(value - max);
+            }
+        }
+        const float logDenominator = max + logf(sum);
+
+        const int32_t* idxPtr = sharedIndices ? indices : &indices[row * indicesPerSlice];
+        float* dstPtr = &dstData[row * indicesPerSlice];
+        for (size_t i = 0; i < indicesPerSlice; ++i) {
+            int32_t index = idxPtr[i];
+            if (index < 0)
+                index += static_cast<int32_t>(axisSize);
+            dstPtr[i] = srcPtr[index] - logDenominator;
+        }
+    });
+}
+
+bool LogSoftmaxGather::created() const {
+    return getType() == Type::LogSoftmaxGather;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
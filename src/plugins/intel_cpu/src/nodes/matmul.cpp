@@ -8,6 +8,7 @@
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "cpu_types.h"
 #include "eltwise.h"
+#include "reorder.h"
 
 #include <numeric>
 #include <string>
@@ -37,6 +38,7 @@ struct MatMulKey {
     DnnlMemoryDescCPtr out;
     dnnl::primitive_attr attr;
     impl_desc_type implType;
+    bool packedB;
 
     size_t hash() const;
     bool operator==(const MatMulKey& rhs) const;
@@ -56,6 +58,7 @@ size_t MatMulKey::hash() const {
 
     seed = hash_combine(seed, get_attr_hash(*attr.get()));
     seed = hash_combine(seed, implType);
+    seed = hash_combine(seed, packedB);
     return seed;
 }
 
@@ -74,7 +77,8 @@ bool MatMulKey::operator==(const MatMulKey &rhs) const {
         retVal = retVal && out && rhs.out && out->getDnnlDesc() == rhs.out->getDnnlDesc();
     }
     retVal = retVal && *attr.get() == *rhs.attr.get() &&
-             implType == rhs.implType;
+             implType == rhs.implType &&
+             packedB == rhs.packedB;
     return retVal;
 }
 
@@ -265,8 +269,8 @@ void MatMul::getSupportedDescriptors() {
         firstInPortPrec = secondInPortPrec = getMaxPrecision(getOriginalInputPrecisions());
 
     // fallback to fp32 for any precision that cannot be handled natively
-    if ((!one_of(firstInPortPrec , Precision::U8, Precision::I8, Precision::BF16, Precision::FP32) ||
-         !one_of(secondInPortPrec , Precision::I8, Precision::BF16, Precision::FP32))) {
+    if ((!one_of(firstInPortPrec , Precision::U8, Precision::I8, Precision::BF16, Precision::FP16, Precision::FP32) ||
+         !one_of(secondInPortPrec , Precision::I8, Precision::BF16, Precision::FP16, Precision::FP32))) {
         outPortPrec = firstInPortPrec = secondInPortPrec = Precision::FP32;
     }
 
@@ -482,6 +486,54 @@ InferenceEngine::Precision MatMul::getRuntimePrecision() const {
     return getMaxPrecision(getInputPrecisions());
 }
 
+MemoryPtr MatMul::prepareWeightMemory(const DnnlMemoryDescPtr& weightDesc, const DnnlMemoryDescPtr& weightSrcDesc) {
+    auto blob = getParentEdgeAt(1)->getMemoryPtr();
+    if (!blob || !blob->isAllocated())
+        IE_THROW() << errorPrefix << " did not allocate constant weights memory";
+
+    // the primitive may prefer the layout B already has (e.g. the plain non-transposed case):
+    // reuse the constant blob data in place then instead of materializing a copy
+    if (weightSrcDesc->getDnnlDesc() == weightDesc->getDnnlDesc() && !context->getConfig().weightsNumaReplication) {
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+        _ptr->Create(weightDesc, blob->GetData());
+        return _ptr;
+    }
+
+    auto create = [&] () {
+        // weightSrcDesc describes the constant blob as the (possibly transposed) strided view the
+        // primitive consumes, so the reorder materializes the packed layout directly
+        Memory srcMemory{ getEngine() };
+        srcMemory.Create(weightSrcDesc, blob->GetData());
+
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+        _ptr->Create(weightDesc);
+        node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
+
+        return _ptr;
+    };
+
+    MemoryPtr ptr;
+    const auto& format = weightDesc->serializeFormat();
+    auto itr = privateWeightCache.find(format);
+    if (privateWeightCache.end() != itr) {
+        ptr = itr->second;
+    } else {
+        auto weightCache = context->getWeightsCache();
+        if (weightCache != nullptr) {
+            const std::string string_hash = getName() + "_" + format
+                                            + "_" + std::to_string(blob->GetSize())
+                                            + "_" + std::to_string(reinterpret_cast<uint64_t>(blob->GetData()));
+
+            ptr = *weightCache->findOrCreate(string_hash, create);
+        } else {
+            ptr = create();
+        }
+        privateWeightCache[format] = ptr;
+    }
+
+    return ptr;
+}
+
 void MatMul::prepareParams() {
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto& src0MemPtr = getParentEdgeAt(0)->getMemoryPtr();
@@ -529,22 +581,32 @@ void MatMul::prepareParams() {
         dnnlBiasMemDesc = biasMemory->GetDescWithType<DnnlMemoryDesc>();
     }
 
+    // When B is a constant weight, let the primitive pick its preferred (packed) weights layout
+    // and materialize it once through the weights cache: with a plain strided B the brgemm kernels
+    // repack it into the scratchpad on every execution, and with dynamic M every shape change
+    // repacks the very same weights again
+    const bool packedB = getParentEdgeAt(1)->getParent()->isConstant();
+
     MatMulKey key = {src0TransposedDesc, src1TransposedDesc, dnnlBiasMemDesc,
-                     dstDnnlDesc, *attr, selected_pd->getImplementationType()};
+                     dstDnnlDesc, *attr, selected_pd->getImplementationType(), packedB};
 
     auto engine = getEngine();
 
     auto builder = [&engine](const MatMulKey& key) -> std::shared_ptr<dnnl::primitive> {
         std::shared_ptr<dnnl::matmul::desc> matmul_desc;
 
+        auto weiDesc = key.inp1->getDnnlDesc();
+        if (key.packedB)
+            weiDesc = dnnl::memory::desc(weiDesc.dims(), weiDesc.data_type(), memory::format_tag::any);
+
         if (key.bias) {
             matmul_desc.reset(new dnnl::matmul::desc{key.inp0->getDnnlDesc(),
-                                                       key.inp1->getDnnlDesc(),
+                                                       weiDesc,
                                                        key.bias->getDnnlDesc(),
                                                        key.out->getDnnlDesc()});
         } else {
             matmul_desc.reset(new dnnl::matmul::desc(key.inp0->getDnnlDesc(),
-                                                       key.inp1->getDnnlDesc(),
+                                                       weiDesc,
                                                        key.out->getDnnlDesc()));
         }
 
@@ -579,7 +641,12 @@ void MatMul::prepareParams() {
 
     primArgs[DNNL_ARG_SCRATCHPAD] = scratchpadMem->GetPrimitive();
     primArgs[DNNL_ARG_SRC_0] = src0MemPtr->GetPrimitive();
-    primArgs[DNNL_ARG_WEIGHTS_0] = src1MemPtr->GetPrimitive();
+    if (packedB) {
+        const auto expectedWeightDesc = DnnlExtensionUtils::query_md(pd, dnnl::query::weights_md);
+        primArgs[DNNL_ARG_WEIGHTS_0] = prepareWeightMemory(expectedWeightDesc, src1TransposedDesc)->GetPrimitive();
+    } else {
+        primArgs[DNNL_ARG_WEIGHTS_0] = src1MemPtr->GetPrimitive();
+    }
     primArgs[DNNL_ARG_DST] = dstMemPtr->GetPrimitive();
     if (withBiases)
         primArgs[DNNL_ARG_BIAS] = getParentEdgeAt(2)->getMemoryPtr()->GetPrimitive();
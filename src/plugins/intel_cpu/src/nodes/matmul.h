@@ -7,6 +7,7 @@
 #include <node.h>
 #include <ie_common.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <array>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -50,6 +51,10 @@ protected:
 private:
     dnnl::memory::desc getBiasDescFrom(const DnnlMemoryDescCPtr outMemDesc);
     std::pair<Shape, Shape> makeDummyInputShapes(const Shape& in0, const Shape& in1) const;
+    // Packs the constant B matrix into the layout the primitive prefers, through the weights
+    // cache: the packed copy is keyed by the weight buffer identity and layout, so dynamic M
+    // never triggers a repack of the same weights
+    MemoryPtr prepareWeightMemory(const DnnlMemoryDescPtr& weightDesc, const DnnlMemoryDescPtr& weightSrcDesc);
 
     bool withBiases;
 
@@ -62,6 +67,10 @@ private:
 
     std::array<DnnlBlockedMemoryDescPtr, 2> inDataDesc;
     DnnlBlockedMemoryDescPtr outDataDesc;
+
+    // The B matrices packed for the primitives created on this node, per weights layout; entries
+    // are shared with the other streams through the GraphContext weights cache
+    std::unordered_map<std::string, MemoryPtr> privateWeightCache;
 };
 
 }   // namespace node
@@ -107,7 +107,11 @@ bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>
 }
 
 MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr ctx)
-        : Input(op, ctx), MemoryNode(op), dataStore(new Memory{ctx->getEngine()}) {
+        : Input(op, ctx), MemoryNode(op),
+          // the state storage is sized to the upper bound of the variable, but sessions rarely
+          // use all of it, so back it with demand committed pages to keep only the actually
+          // touched part resident (and let Reset() return it to the OS)
+          dataStore(new Memory{ctx->getEngine(), std::unique_ptr<IMemoryMngr>(new MemoryMngrDemandPaged())}) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
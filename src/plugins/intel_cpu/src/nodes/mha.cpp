@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -1166,9 +1167,15 @@ static void reorder2D(const srcT* pin, dstT* pout, const std::vector<size_t>& di
     }
 }
 
-void MHA::callBrgemm(brgemmCtx& ctx, std::unique_ptr<brgemm_kernel_t>& brgKernel, const void* pin0, const void* pin1, void* pout, void* wsp) {
-    if (ctx.is_with_amx)
+void MHA::callBrgemm(brgemmCtx& ctx, std::unique_ptr<brgemm_kernel_t>& brgKernel, const void* pin0, const void* pin1, void* pout, void* wsp,
+                     char* lastAmxPalette) {
+    // LDTILECFG is serializing and noticeably expensive on small blocks, so the tile config
+    // is reloaded only when it differs from the one this task loaded last (main and tail
+    // blocks of both matmuls usually share the same palette)
+    if (ctx.is_with_amx && std::memcmp(lastAmxPalette, ctx.palette, sizeof(ctx.palette)) != 0) {
         amx_tile_configure(ctx.palette);
+        std::memcpy(lastAmxPalette, ctx.palette, sizeof(ctx.palette));
+    }
     if (ctx.is_with_comp) {
         brgemm_post_ops_data_t post_ops_data;
         brgemm_kernel_execute_postops(brgKernel.get(), 1, pin0, pin1, nullptr, pout, pout, post_ops_data, wsp);
@@ -1190,6 +1197,9 @@ void MHA::mhaImpl() {
     parallel_for2d(dimsMatMul0Out[0], dimsMatMul0Out[1], [&](size_t i0, size_t i1) {
         size_t threadNum = parallel_get_thread_num();
 
+        // per-task cache of the currently loaded AMX tile config; zero never matches a valid palette
+        char lastAmxPalette[64] = {0};
+
         auto pTranspose0In0_aux = pTranspose0In0 + (i0 * strTranspose0In0[0] + i1 * strTranspose0In0[2]) * inputPrecisions[0].size(); // order 0213
         auto pTranspose1In0_aux = pTranspose1In0 + (i0 * strTranspose1In0[0] + i1 * strTranspose1In0[2]) * inputPrecisions[1].size(); // order 0231
 
@@ -1322,7 +1332,7 @@ void MHA::mhaImpl() {
                     if (brgemmCtx.K != 0 && brgemmCtx.N != 0) {
                         callBrgemm(brgemmCtx, brgKernels0[getBrgIdx(mIdx, k, n)],
                             pMatMul0In0 + (k * K0_step0) * inputPrecisions[0].size(), pMatMul0In1 + (k * K0_step1 + n * N0_step0) * inputPrecisions[0].size(),
-                            pMatMul0Out + (n * N0_step1) * accPrecision0.size(), wsp);
+                            pMatMul0Out + (n * N0_step1) * accPrecision0.size(), wsp, lastAmxPalette);
                     }
                 }
             }
@@ -1365,7 +1375,7 @@ void MHA::mhaImpl() {
                     if (brgemmCtx.K != 0 && brgemmCtx.N != 0) {
                         callBrgemm(brgemmCtx, brgKernels1[getBrgIdx(mIdx, k, n)],
                             pMatMul1In0 + (k * K1_step0) * inputPrecisions[3].size(), pMatMul1In1 + (k * K1_step1 + n * N1_step0) * inputPrecisions[3].size(),
-                            pMatMul1Out + (n * N1_step1) * accPrecision1.size(), wsp);
+                            pMatMul1Out + (n * N1_step1) * accPrecision1.size(), wsp, lastAmxPalette);
                     }
                 }
             }
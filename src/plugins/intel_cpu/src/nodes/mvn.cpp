@@ -4,6 +4,8 @@
 
 #include "mvn.h"
 
+#include "itt.h"
+
 #include <algorithm>
 #include <string>
 #include <vector>
@@ -1262,6 +1264,7 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
     int N = 0;
     std::tie(N, jcp.C, jcp.D, jcp.H, jcp.W) = mvnAttrs.shape5D;
     if (mayiuse(cpu::x64::avx512_core)) {
+        CPU_ISA_SCOPE(JitMVN_avx512_core);
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_core>(jcp, *attr.get()));
         jcp.normalize_variance = false;
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_core>(jcp));
@@ -1270,6 +1273,7 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_core>(jcp));
         }
     } else if (mayiuse(cpu::x64::avx2)) {
+        CPU_ISA_SCOPE(JitMVN_avx2);
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
         jcp.normalize_variance = false;
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
@@ -1278,6 +1282,7 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
         }
     } else if (mayiuse(cpu::x64::sse41)) {
+        CPU_ISA_SCOPE(JitMVN_sse41);
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
         jcp.normalize_variance = false;
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
@@ -1579,36 +1584,59 @@ void MVN::MVNRefExecutor::mvn_ref(const uint8_t* src_data, uint8_t* dst_data) {
     size_t C2 = C1 * D;
     size_t C3 = C2 * C;
 
+    // single pass mean and variance via the Welford recurrence, so the data is read once for the
+    // statistics instead of a dedicated sweep per moment
+    auto welford_channel = [&](size_t cc, float& mean, float& m2) {
+        mean = 0.f;
+        m2 = 0.f;
+        for (size_t sp = 0lu; sp < C2; sp++) {
+            const float val = src_data_ptr[cc + sp];
+            const float delta = val - mean;
+            mean += delta / static_cast<float>(sp + 1);
+            m2 += delta * (val - mean);
+        }
+    };
+
     parallel_for(N, [&](int b) {
         size_t cb = b * C3;
         if (mvnAttrs.execAcrossChannels_) {
-            // Parallel sum for each channel for mean
             float C3inv = 1.f / static_cast<float>(C3);
-            float mean_temp = 0.0f;
-
-            mean_temp = parallel_sum(C, mean_temp, [&](size_t c)->float {
-                float mean_internal = 0.0f;
-                size_t cc = cb + c * C2;
-                for (size_t sp = 0lu; sp < C2; sp++) {
-                    mean_internal += src_data_ptr[cc + sp];
-                }
-                return mean_internal;
-            });
-
-            float mean = mean_temp * C3inv;
 
+            float mean = 0.f;
+            float variance_temp = 0.f;
             if (mvnAttrs.normalizeVariance_) {
-                // parallel sum for each channel for variance
-                float variance_temp = 0.0f;
-                variance_temp = parallel_sum(C, variance_temp, [&](size_t c)->float {
-                    float variance_internal = 0.0f;
+                // per channel partial statistics computed in parallel and combined with the
+                // Chan et al. merge formula
+                std::vector<float> chan_mean(C, 0.f);
+                std::vector<float> chan_m2(C, 0.f);
+                parallel_for(C, [&](size_t c) {
+                    welford_channel(cb + c * C2, chan_mean[c], chan_m2[c]);
+                });
+
+                float m2 = 0.f;
+                size_t count = 0lu;
+                for (size_t c = 0; c < C; c++) {
+                    const float delta = chan_mean[c] - mean;
+                    const size_t new_count = count + C2;
+                    mean += delta * static_cast<float>(C2) / static_cast<float>(new_count);
+                    m2 += chan_m2[c] + delta * delta * static_cast<float>(C2) * static_cast<float>(count) / static_cast<float>(new_count);
+                    count = new_count;
+                }
+                variance_temp = m2;
+            } else {
+                float mean_temp = 0.0f;
+                mean_temp = parallel_sum(C, mean_temp, [&](size_t c)->float {
+                    float mean_internal = 0.0f;
                     size_t cc = cb + c * C2;
                     for (size_t sp = 0lu; sp < C2; sp++) {
-                        variance_internal += (src_data_ptr[cc + sp] - mean) * (src_data_ptr[cc + sp] - mean);
+                        mean_internal += src_data_ptr[cc + sp];
                     }
-                    return variance_internal;
+                    return mean_internal;
                 });
+                mean = mean_temp * C3inv;
+            }
 
+            if (mvnAttrs.normalizeVariance_) {
                 float variance = 1.f;
                 if (mvnAttrs.epsMode_ == INSIDE_SQRT)
                     variance = 1.f / sqrtf(variance_temp * C3inv + mvnAttrs.epsValue_);
@@ -1632,31 +1660,32 @@ void MVN::MVNRefExecutor::mvn_ref(const uint8_t* src_data, uint8_t* dst_data) {
         } else {  // per channel
             float C2inv = 1.f / static_cast<float>(C2);
             parallel_for(C, [&](size_t c) {
-                // mean for this channel
-                float mean = 0.f;
                 size_t cc = cb + c * C2;
-                for (size_t sp = 0lu; sp < C2; sp++) {
-                    mean += src_data_ptr[cc + sp];
-                }
-                mean *= C2inv;
 
                 if (mvnAttrs.normalizeVariance_) {
-                    // variance for this channel
-                    float variance = 0.f;
-                    for (size_t sp = 0lu; sp < C2; sp++) {
-                        variance += (src_data_ptr[cc + sp] - mean) * (src_data_ptr[cc + sp] - mean);
-                    }
+                    // mean and variance for this channel in one sweep
+                    float mean = 0.f;
+                    float m2 = 0.f;
+                    welford_channel(cc, mean, m2);
 
+                    float variance = 1.f;
                     if (mvnAttrs.epsMode_ == INSIDE_SQRT)
-                        variance = 1.f / sqrtf(variance * C2inv + mvnAttrs.epsValue_);
+                        variance = 1.f / sqrtf(m2 * C2inv + mvnAttrs.epsValue_);
                     else if (mvnAttrs.epsMode_ == OUTSIDE_SQRT)
-                        variance = 1.f / (sqrtf(variance * C2inv) + mvnAttrs.epsValue_);
+                        variance = 1.f / (sqrtf(m2 * C2inv) + mvnAttrs.epsValue_);
 
                     // mvn for this channel
                     for (size_t sp = 0lu; sp < C2; sp++) {
                         dst_data_ptr[cc + sp] = (src_data_ptr[cc + sp] - mean) * variance;
                     }
                 } else {
+                    // mean for this channel
+                    float mean = 0.f;
+                    for (size_t sp = 0lu; sp < C2; sp++) {
+                        mean += src_data_ptr[cc + sp];
+                    }
+                    mean *= C2inv;
+
                     // mvn for this channel
                     for (size_t sp = 0lu; sp < C2; sp++) {
                         dst_data_ptr[cc + sp] = src_data_ptr[cc + sp] - mean;
@@ -694,6 +694,7 @@ void NonMaxSuppression::prepareParams() {
     numFiltBox.resize(numBatches);
     for (auto & i : numFiltBox)
         i.resize(numClasses);
+    candidatePools.resize(numBatches * numClasses);
 }
 
 bool NonMaxSuppression::isExecutable() const {
@@ -884,29 +885,44 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
     };
 
     parallel_for2d(numBatches, numClasses, [&](int batch_idx, int class_idx) {
-        std::vector<filteredBoxes> selectedBoxes;
+        auto& pool = candidatePools[batch_idx * numClasses + class_idx];
+        auto& selectedBoxes = pool.selectedBoxes;
+        selectedBoxes.clear();
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);  // score, box_id, suppress_begin_index
+        // candidates are kept in a heap over the pooled buffer (same semantics as the
+        // priority_queue that used to live here, without its per-call allocation)
+        auto& sorted_boxes = pool.softBoxes;  // score, box_id, suppress_begin_index
+        sorted_boxes.clear();
         for (int box_idx = 0; box_idx < numBoxes; box_idx++) {
             if (scoresPtr[box_idx] > scoreThreshold)
-                sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
+                sorted_boxes.push_back(boxInfo({scoresPtr[box_idx], box_idx, 0}));
         }
+        std::make_heap(sorted_boxes.begin(), sorted_boxes.end(), less);
+        auto topCandidate = [&]() {
+            std::pop_heap(sorted_boxes.begin(), sorted_boxes.end(), less);
+            boxInfo box = sorted_boxes.back();
+            sorted_boxes.pop_back();
+            return box;
+        };
         size_t sortedBoxSize = sorted_boxes.size();
         size_t maxSeletedBoxNum = std::min(sortedBoxSize, maxOutputBoxesPerClass);
         selectedBoxes.reserve(maxSeletedBoxNum);
         if (maxSeletedBoxNum > 0) {
             // include first directly
-            boxInfo candidateBox = sorted_boxes.top();
-            sorted_boxes.pop();
+            boxInfo candidateBox = topCandidate();
             selectedBoxes.push_back({ candidateBox.score, batch_idx, class_idx, candidateBox.idx });
             if (maxSeletedBoxNum > 1) {
                 if (nms_kernel) {
-                    std::vector<float> boxCoord0(maxSeletedBoxNum, 0.0f);
-                    std::vector<float> boxCoord1(maxSeletedBoxNum, 0.0f);
-                    std::vector<float> boxCoord2(maxSeletedBoxNum, 0.0f);
-                    std::vector<float> boxCoord3(maxSeletedBoxNum, 0.0f);
+                    auto& boxCoord0 = pool.boxCoords[0];
+                    auto& boxCoord1 = pool.boxCoords[1];
+                    auto& boxCoord2 = pool.boxCoords[2];
+                    auto& boxCoord3 = pool.boxCoords[3];
+                    boxCoord0.resize(maxSeletedBoxNum);
+                    boxCoord1.resize(maxSeletedBoxNum);
+                    boxCoord2.resize(maxSeletedBoxNum);
+                    boxCoord3.resize(maxSeletedBoxNum);
 
                     boxCoord0[0] = boxesPtr[candidateBox.idx * 4];
                     boxCoord1[0] = boxesPtr[candidateBox.idx * 4 + 1];
@@ -918,9 +934,8 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
                     arg.score_threshold = static_cast<float*>(&scoreThreshold);
                     arg.scale = static_cast<float*>(&scale);
                     while (selectedBoxes.size() < maxOutputBoxesPerClass && !sorted_boxes.empty()) {
-                        boxInfo candidateBox = sorted_boxes.top();
+                        boxInfo candidateBox = topCandidate();
                         float origScore = candidateBox.score;
-                        sorted_boxes.pop();
 
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected, 2 for updated
                         arg.score = static_cast<float*>(&candidateBox.score);
@@ -945,15 +960,15 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
                                 boxCoord3[selectedSize - 1] = boxesPtr[candidateBox.idx * 4 + 3];
                             } else {
                                 candidateBox.suppress_begin_index = selectedBoxes.size();
-                                sorted_boxes.push(candidateBox);
+                                sorted_boxes.push_back(candidateBox);
+                                std::push_heap(sorted_boxes.begin(), sorted_boxes.end(), less);
                             }
                         }
                     }
                 } else {
                     while (selectedBoxes.size() < maxOutputBoxesPerClass && !sorted_boxes.empty()) {
-                        boxInfo candidateBox = sorted_boxes.top();
+                        boxInfo candidateBox = topCandidate();
                         float origScore = candidateBox.score;
-                        sorted_boxes.pop();
 
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected, 2 for updated
                         for (int selected_idx = static_cast<int>(selectedBoxes.size()) - 1; selected_idx >= candidateBox.suppress_begin_index; selected_idx--) {
@@ -975,7 +990,8 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
                                 selectedBoxes.push_back({ candidateBox.score, batch_idx, class_idx, candidateBox.idx });
                             } else {
                                 candidateBox.suppress_begin_index = selectedBoxes.size();
-                                sorted_boxes.push(candidateBox);
+                                sorted_boxes.push_back(candidateBox);
+                                std::push_heap(sorted_boxes.begin(), sorted_boxes.end(), less);
                             }
                         }
                     }
@@ -997,7 +1013,9 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::vector<std::pair<float, int>> sorted_boxes;  // score, box_idx
+        auto& pool = candidatePools[batch_idx * numClasses + class_idx];
+        auto& sorted_boxes = pool.sortedBoxes;  // score, box_idx
+        sorted_boxes.clear();
         for (int box_idx = 0; box_idx < numBoxes; box_idx++) {
             if (scoresPtr[box_idx] > scoreThreshold)
                 sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
@@ -1006,24 +1024,39 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
         int io_selection_size = 0;
         size_t sortedBoxSize = sorted_boxes.size();
         if (sortedBoxSize > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
+            // usually only a fraction of the candidates is inspected before max_out_box boxes are
+            // selected, so the candidates are popped lazily from a heap instead of fully sorting
+            // the whole pool; the comparator is a total order (the box index breaks the score
+            // ties), so the traversal order stays deterministic
+            auto worse = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                return (l.first < r.first) || ((l.first == r.first) && (l.second > r.second));
+            };
+            std::make_heap(sorted_boxes.begin(), sorted_boxes.end(), worse);
+            auto heapEnd = sorted_boxes.end();
+            auto nextCandidate = [&]() {
+                std::pop_heap(sorted_boxes.begin(), heapEnd, worse);
+                return *(--heapEnd);
+            };
+            auto candidateBox = nextCandidate();
             int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
+            filtBoxes[offset + 0] = filteredBoxes(candidateBox.first, batch_idx, class_idx, candidateBox.second);
             io_selection_size++;
             if (sortedBoxSize > 1) {
                 if (nms_kernel) {
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0f);
-
-                    boxCoord0[0] = boxesPtr[sorted_boxes[0].second * 4];
-                    boxCoord1[0] = boxesPtr[sorted_boxes[0].second * 4 + 1];
-                    boxCoord2[0] = boxesPtr[sorted_boxes[0].second * 4 + 2];
-                    boxCoord3[0] = boxesPtr[sorted_boxes[0].second * 4 + 3];
+                    auto& boxCoord0 = pool.boxCoords[0];
+                    auto& boxCoord1 = pool.boxCoords[1];
+                    auto& boxCoord2 = pool.boxCoords[2];
+                    auto& boxCoord3 = pool.boxCoords[3];
+                    // no more than max_out_box boxes get selected on this path
+                    boxCoord0.resize(maxOutputBoxesPerClass);
+                    boxCoord1.resize(maxOutputBoxesPerClass);
+                    boxCoord2.resize(maxOutputBoxesPerClass);
+                    boxCoord3.resize(maxOutputBoxesPerClass);
+
+                    boxCoord0[0] = boxesPtr[candidateBox.second * 4];
+                    boxCoord1[0] = boxesPtr[candidateBox.second * 4 + 1];
+                    boxCoord2[0] = boxesPtr[candidateBox.second * 4 + 2];
+                    boxCoord3[0] = boxesPtr[candidateBox.second * 4 + 3];
 
                     auto arg = jit_nms_args();
                     arg.iou_threshold = static_cast<float*>(&iouThreshold);
@@ -1035,27 +1068,29 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
                     arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[0]);
                     arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
 
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                    while (heapEnd != sorted_boxes.begin() && io_selection_size < max_out_box) {
+                        candidateBox = nextCandidate();
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
                         arg.selected_boxes_num = io_selection_size;
-                        arg.candidate_box = static_cast<const float*>(&boxesPtr[sorted_boxes[candidate_idx].second * 4]);
+                        arg.candidate_box = static_cast<const float*>(&boxesPtr[candidateBox.second * 4]);
                         arg.candidate_status = static_cast<int*>(&candidateStatus);
                         (*nms_kernel)(&arg);
                         if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4];
-                            boxCoord1[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 1];
-                            boxCoord2[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 2];
-                            boxCoord3[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 3];
+                            boxCoord0[io_selection_size] = boxesPtr[candidateBox.second * 4];
+                            boxCoord1[io_selection_size] = boxesPtr[candidateBox.second * 4 + 1];
+                            boxCoord2[io_selection_size] = boxesPtr[candidateBox.second * 4 + 2];
+                            boxCoord3[io_selection_size] = boxesPtr[candidateBox.second * 4 + 3];
                             filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                                filteredBoxes(candidateBox.first, batch_idx, class_idx, candidateBox.second);
                             io_selection_size++;
                         }
                     }
                 } else {
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                    while (heapEnd != sorted_boxes.begin() && io_selection_size < max_out_box) {
+                        candidateBox = nextCandidate();
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
                         for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[candidate_idx].second * 4],
+                            float iou = intersectionOverUnion(&boxesPtr[candidateBox.second * 4],
                                 &boxesPtr[filtBoxes[offset + selected_idx].box_index * 4]);
                             if (iou >= iouThreshold) {
                                 candidateStatus = NMSCandidateStatus::SUPPRESSED;
@@ -1065,7 +1100,7 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
 
                         if (candidateStatus == NMSCandidateStatus::SELECTED) {
                             filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                                filteredBoxes(candidateBox.first, batch_idx, class_idx, candidateBox.second);
                             io_selection_size++;
                         }
                     }
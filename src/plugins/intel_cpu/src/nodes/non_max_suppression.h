@@ -139,6 +139,15 @@ private:
     std::string errorPrefix;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    // per (batch, class) scratch reused across the infer calls, so the parallel sections
+    // do not pay the per-call allocations for the candidate pools
+    struct CandidatePool {
+        std::vector<std::pair<float, int>> sortedBoxes;  // score, box_idx
+        std::vector<boxInfo> softBoxes;
+        std::vector<filteredBoxes> selectedBoxes;
+        std::vector<float> boxCoords[4];
+    };
+    std::vector<CandidatePool> candidatePools;
     const std::string inType = "input", outType = "output";
 
     void checkPrecision(const Precision& prec, const std::vector<Precision>& precList, const std::string& name, const std::string& type);
@@ -4,6 +4,7 @@
 
 #include "normalize.h"
 
+#include "itt.h"
 #include <ie_parallel.hpp>
 
 #include "fake_quantize.h"
@@ -996,16 +997,19 @@ public:
         jcp.w = (dims_size > 3) ? dims[3] : 1lu;
 
         if (mayiuse(cpu::x64::avx512_core)) {
+            CPU_ISA_SCOPE(JitNormalize_avx512_core);
             blk_size = 16;
             normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::x64::avx512_core>(jcp));
             normalize_kernel.reset(
                     new jit_uni_normalize_kernel_f32<cpu::x64::avx512_core>(jcp, *kernel_attrs.get()));
         } else if (mayiuse(cpu::x64::avx2)) {
+            CPU_ISA_SCOPE(JitNormalize_avx2);
             blk_size = 8;
             normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::x64::avx2>(jcp));
             normalize_kernel.reset(
                     new jit_uni_normalize_kernel_f32<cpu::x64::avx2>(jcp, *kernel_attrs.get()));
         } else if (mayiuse(cpu::x64::sse41)) {
+            CPU_ISA_SCOPE(JitNormalize_sse41);
             blk_size = jcp.is_blk ? 8 : 4;
             normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::x64::sse41>(jcp));
             normalize_kernel.reset(
@@ -27,6 +27,14 @@ public:
 
     bool isExecutable() const override;
 
+    // true when the node pads with a constant zero and the pad vectors are known in advance,
+    // i.e. the padding is equivalent to the implicit zero padding of conv/pooling primitives
+    bool isConstantZeroPad() const {
+        return attrs.padMode == CONSTANT && attrs.padValue == 0.f && !attrs.padsBegin.empty();
+    }
+    const std::vector<unsigned int>& getPadsBegin() const { return attrs.padsBegin; }
+    const std::vector<unsigned int>& getPadsEnd() const { return attrs.padsEnd; }
+
 protected:
     void executeDynamicImpl(dnnl::stream strm) override;
 
@@ -189,6 +189,18 @@ Pooling::Pooling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr c
     }
 }
 
+void Pooling::absorbInputPadding(const std::vector<unsigned int>& padsBegin, const std::vector<unsigned int>& padsEnd) {
+    auto srcDims = getInputShapeAtPort(0).getStaticDims();
+    const size_t spatialOffset = srcDims.size() - kernel.size();
+    for (size_t i = 0; i < kernel.size(); i++) {
+        data_pad_begin[i] += padsBegin[spatialOffset + i];
+        data_pad_end[i] += padsEnd[spatialOffset + i];
+        srcDims[spatialOffset + i] -= padsBegin[spatialOffset + i] + padsEnd[spatialOffset + i];
+    }
+    // the data input edge now comes from the producer of the dropped Pad node
+    inputShapes[0] = Shape(srcDims);
+}
+
 std::vector<memory::format_tag> Pooling::getAvailableFormatsForDims(const Shape &dims) const {
     if (dims.getRank() == 0)
         return {memory::format_tag::x};
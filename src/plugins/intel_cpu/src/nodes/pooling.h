@@ -34,6 +34,16 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
+    bool isExcludePad() const { return exclude_pad; }
+    const std::vector<ptrdiff_t>& getKernel() const { return kernel; }
+    const std::vector<ptrdiff_t>& getDilation() const { return dilation; }
+    const std::vector<ptrdiff_t>& getDataPadBegin() const { return data_pad_begin; }
+    const std::vector<ptrdiff_t>& getDataPadEnd() const { return data_pad_end; }
+
+    // Folds an external constant-zero padding of the spatial dims into the native padding of the
+    // pooling; called by the graph optimizer when the producing Pad node is dropped
+    void absorbInputPadding(const std::vector<unsigned int>& padsBegin, const std::vector<unsigned int>& padsEnd);
+
 protected:
     AttrPtr initPrimitiveAttr() override;
 
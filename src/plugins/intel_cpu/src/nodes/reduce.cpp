@@ -4,6 +4,7 @@
 
 #include "reduce.h"
 
+#include "itt.h"
 #include "fake_quantize.h"
 #include "eltwise.h"
 #include <string>
@@ -1902,10 +1903,13 @@ void Reduce::prepareParams() {
         std::shared_ptr<jit_uni_reduce_post_kernel> post_kernel;
 
         if (mayiuse(cpu::x64::avx512_core)) {
+            CPU_ISA_SCOPE(JitReducePost_avx512_core);
             post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx512_core>(key.jcp, *attr.get()));
         } else if (mayiuse(cpu::x64::avx2)) {
+            CPU_ISA_SCOPE(JitReducePost_avx2);
             post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx2>(key.jcp, *attr.get()));
         } else if (mayiuse(cpu::x64::sse41)) {
+            CPU_ISA_SCOPE(JitReducePost_sse41);
             post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::sse41>(key.jcp, *attr.get()));
         }
         if (post_kernel)
@@ -1984,10 +1988,13 @@ void Reduce::createPrimitive() {
     }
 
     if (mayiuse(cpu::x64::avx512_core)) {
+        CPU_ISA_SCOPE(JitReduce_avx512_core);
         reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx512_core>(jcp));
     } else if (mayiuse(cpu::x64::avx2)) {
+        CPU_ISA_SCOPE(JitReduce_avx2);
         reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx2>(jcp));
     } else if (mayiuse(cpu::x64::sse41)) {
+        CPU_ISA_SCOPE(JitReduce_sse41);
         reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::sse41>(jcp));
     }
     if (reduce_kernel)
@@ -9,6 +9,8 @@
 #include "nodes/common/cpu_convert.h"
 #include "utils/bfloat16.hpp"
 #include "input.h"
+#include "itt.h"
+#include "onednn/itt.h"
 #include <dnnl_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
@@ -20,6 +22,8 @@
 #include <ngraph/node.hpp>
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include <cstring>
+#include <map>
 #include <string>
 #include <utility>
 
@@ -995,20 +999,6 @@ void RNN::prepareParams() {
     auto dataMemPtr = getParentEdgesAtPort(0).front()->getMemoryPtr();
     const size_t B = dataMemPtr->GetShape().getStaticDims()[0];
     const size_t SL = is_cell ? 1lu : dataMemPtr->GetShape().getStaticDims()[1];
-    const Shape shapeS_4D{L, D, B, SC};
-
-    inDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, DC}, inDataTypes[xIdx], memory::format_tag::tnc);
-    outDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, D * SC}, outDataTypes[yIdx], memory::format_tag::tnc);
-
-    inDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[hIdx], memory::format_tag::ldnc);
-    outDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[hoIdx], memory::format_tag::ldnc);
-
-    if (haveCellState(cell_type)) {
-        inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[cIdx], memory::format_tag::ldnc);
-        outDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[coIdx], memory::format_tag::ldnc);
-    } else if (haveAttention(cell_type)) {
-        inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, 1}, inDataTypes[aIdx], memory::format_tag::tnc);
-    }
 
     bool wFormatWasChanged = false;
     // WA To avoid different weights layer and iter formats in FP32 case.
@@ -1031,6 +1021,46 @@ void RNN::prepareParams() {
         wDescs[1] = dnnl::memory::desc(statesDims, targetWeightDataType, wFormat);
     }
 
+    prim = buildPrimitive(SL, B);
+
+    auto pd = (*prim).get_primitive_desc();
+    scratchpadMem = getScratchPadMem(pd);
+
+    if (!wasMemoryPrepared || wFormatWasChanged) {
+        auto pd = (*prim).get_primitive_desc();
+        auto query_weights_md = [&](int idx = 0) -> dnnl::memory::desc {
+            auto what = dnnl::convert_to_c(dnnl::query::weights_md);
+            const dnnl_memory_desc_t *cdesc = dnnl_primitive_desc_query_md(pd, what, idx);
+            if (!cdesc)
+                IE_THROW() << "query_weights_md failed for node " << getName() << " idx " << idx << ".";
+            return dnnl::memory::desc(*cdesc);
+        };
+        std::vector<DnnlMemoryDescPtr> intDescs {
+            DnnlExtensionUtils::makeDescriptor(query_weights_md(0)),
+            DnnlExtensionUtils::makeDescriptor(query_weights_md(1)),
+            DnnlExtensionUtils::makeDescriptor(query_weights_md(2))
+        };
+        prepareMemory(intDescs);
+        wasMemoryPrepared = true;
+    }
+}
+
+std::shared_ptr<dnnl::primitive> RNN::buildPrimitive(const size_t SL, const size_t B) {
+    const Shape shapeS_4D{L, D, B, SC};
+
+    inDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, DC}, inDataTypes[xIdx], memory::format_tag::tnc);
+    outDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, D * SC}, outDataTypes[yIdx], memory::format_tag::tnc);
+
+    inDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[hIdx], memory::format_tag::ldnc);
+    outDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[hoIdx], memory::format_tag::ldnc);
+
+    if (haveCellState(cell_type)) {
+        inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[cIdx], memory::format_tag::ldnc);
+        outDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[coIdx], memory::format_tag::ldnc);
+    } else if (haveAttention(cell_type)) {
+        inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, 1}, inDataTypes[aIdx], memory::format_tag::tnc);
+    }
+
     RNNKey key = { inDataDescs, outDataDescs, wDescs, cell_type, cell_act, direction };
 
     const auto attr = initPrimitiveAttr();
@@ -1068,28 +1098,7 @@ void RNN::prepareParams() {
         IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
     }
 
-    prim = result.first;
-
-    auto pd = (*prim).get_primitive_desc();
-    scratchpadMem = getScratchPadMem(pd);
-
-    if (!wasMemoryPrepared || wFormatWasChanged) {
-        auto pd = (*prim).get_primitive_desc();
-        auto query_weights_md = [&](int idx = 0) -> dnnl::memory::desc {
-            auto what = dnnl::convert_to_c(dnnl::query::weights_md);
-            const dnnl_memory_desc_t *cdesc = dnnl_primitive_desc_query_md(pd, what, idx);
-            if (!cdesc)
-                IE_THROW() << "query_weights_md failed for node " << getName() << " idx " << idx << ".";
-            return dnnl::memory::desc(*cdesc);
-        };
-        std::vector<DnnlMemoryDescPtr> intDescs {
-            DnnlExtensionUtils::makeDescriptor(query_weights_md(0)),
-            DnnlExtensionUtils::makeDescriptor(query_weights_md(1)),
-            DnnlExtensionUtils::makeDescriptor(query_weights_md(2))
-        };
-        prepareMemory(intDescs);
-        wasMemoryPrepared = true;
-    }
+    return result.first;
 }
 
 std::shared_ptr<MemoryDesc> RNN::getSrcMemDesc(dnnl::primitive_desc_iterator& primitive_desc_it, size_t idx) {
@@ -1100,10 +1109,125 @@ std::shared_ptr<MemoryDesc> RNN::getDstMemDesc(dnnl::primitive_desc_iterator& pr
     return supportedPrimitiveDescriptors[0].getConfig().outConfs[idx].getMemDesc();
 }
 
+/* Executes a batch with per-sequence lengths in packed form. oneDNN processes the whole padded
+ * batch up to the max sequence length, so the time spent on the padded tails is wasted and the
+ * states past the real length are polluted by the padding. Here the batch elements are grouped
+ * by their length and every group runs a primitive trimmed to exactly that length on a gathered
+ * copy of the data, which both skips the padded compute and yields the states at the real last
+ * step. Returns false when the batch has to be processed by the padded primitive as before. */
+bool RNN::executePackedSequences(dnnl::stream strm) {
+    // the packed path gathers f32 data in the [T, B, C] physical layout and reuses the plain
+    // (ldigo) repacked weights across the per-group primitives
+    if (is_augru || nativeOrder || inDataTypes[xIdx] != memory::data_type::f32 ||
+            wFormat != memory::format_tag::ldigo)
+        return false;
+
+    const auto& srcMem = getParentEdgeAt(xIdx)->getMemory();
+    const auto& srcDims = srcMem.getStaticDims(); // [N, T, DC] logical, t-major physically (ntc)
+    const size_t B = srcDims[0];
+    const size_t SL = srcDims[1];
+    if (SL < 2lu)
+        return false;
+
+    const auto* seqLens = reinterpret_cast<const int32_t*>(getParentEdgeAt(sIdx)->getMemoryPtr()->GetPtr());
+    bool trimmed = false;
+    for (size_t b = 0lu; b < B; b++) {
+        if (seqLens[b] < 1 || static_cast<size_t>(seqLens[b]) > SL)
+            return false;
+        trimmed = trimmed || static_cast<size_t>(seqLens[b]) < SL;
+    }
+    if (!trimmed)
+        return false;
+
+    // group the batch elements by their length, longest first
+    std::map<int32_t, std::vector<size_t>, std::greater<int32_t>> groups;
+    for (size_t b = 0lu; b < B; b++)
+        groups[seqLens[b]].push_back(b);
+
+    const auto* srcData = reinterpret_cast<const float*>(srcMem.GetPtr());
+    const auto* hInitData = reinterpret_cast<const float*>(getParentEdgeAt(hIdx)->getMemoryPtr()->GetPtr());
+    auto* dstData = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+    auto* hStateData = reinterpret_cast<float*>(getChildEdgesAtPort(1)[0]->getMemoryPtr()->GetPtr());
+    const float* cInitData = nullptr;
+    float* cStateData = nullptr;
+    if (haveCellState(cell_type)) {
+        cInitData = reinterpret_cast<const float*>(getParentEdgeAt(cIdx)->getMemoryPtr()->GetPtr());
+        cStateData = reinterpret_cast<float*>(getChildEdgesAtPort(2)[0]->getMemoryPtr()->GetPtr());
+    }
+
+    for (const auto& group : groups) {
+        const size_t Tg = static_cast<size_t>(group.first);
+        const auto& batchIdxs = group.second;
+        const size_t Ng = batchIdxs.size();
+
+        std::vector<float> srcPack(Tg * Ng * DC);
+        std::vector<float> dstPack(Tg * Ng * D * SC);
+        std::vector<float> hPack(Ng * SC), hoPack(Ng * SC);
+        std::vector<float> cPack, coPack;
+
+        for (size_t t = 0lu; t < Tg; t++) {
+            for (size_t j = 0lu; j < Ng; j++) {
+                cpu_memcpy(&srcPack[(t * Ng + j) * DC], &srcData[(t * B + batchIdxs[j]) * DC], DC * sizeof(float));
+            }
+        }
+        for (size_t j = 0lu; j < Ng; j++)
+            cpu_memcpy(&hPack[j * SC], &hInitData[batchIdxs[j] * SC], SC * sizeof(float));
+        if (cInitData) {
+            cPack.resize(Ng * SC);
+            coPack.resize(Ng * SC);
+            for (size_t j = 0lu; j < Ng; j++)
+                cpu_memcpy(&cPack[j * SC], &cInitData[batchIdxs[j] * SC], SC * sizeof(float));
+        }
+
+        auto packedPrim = buildPrimitive(Tg, Ng);
+        auto packedScratchpadMem = getScratchPadMem((*packedPrim).get_primitive_desc());
+
+        std::unordered_map<int, memory> args {
+            {DNNL_ARG_SRC_LAYER,     memory(inDataDescs[0]->getDnnlDesc(), getEngine(), srcPack.data())},
+            {DNNL_ARG_SRC_ITER,      memory(inDataDescs[1]->getDnnlDesc(), getEngine(), hPack.data())},
+            {DNNL_ARG_DST_LAYER,     memory(outDataDescs[0]->getDnnlDesc(), getEngine(), dstPack.data())},
+            {DNNL_ARG_DST_ITER,      memory(outDataDescs[1]->getDnnlDesc(), getEngine(), hoPack.data())},
+            {DNNL_ARG_WEIGHTS_LAYER, internalBlobMemory[0]->GetPrimitive()},
+            {DNNL_ARG_WEIGHTS_ITER,  internalBlobMemory[1]->GetPrimitive()},
+            {DNNL_ARG_BIAS,          internalBlobMemory[2]->GetPrimitive()},
+            {DNNL_ARG_SCRATCHPAD,    packedScratchpadMem->GetPrimitive()}
+        };
+        if (cInitData) {
+            args[DNNL_ARG_SRC_ITER_C] = memory(inDataDescs[2]->getDnnlDesc(), getEngine(), cPack.data());
+            args[DNNL_ARG_DST_ITER_C] = memory(outDataDescs[2]->getDnnlDesc(), getEngine(), coPack.data());
+        }
+
+        (*packedPrim).execute(strm, args);
+
+        for (size_t t = 0lu; t < Tg; t++) {
+            for (size_t j = 0lu; j < Ng; j++) {
+                cpu_memcpy(&dstData[(t * B + batchIdxs[j]) * D * SC], &dstPack[(t * Ng + j) * D * SC], D * SC * sizeof(float));
+            }
+        }
+        // the output past the real sequence length is defined to be zero
+        for (size_t t = Tg; t < SL; t++) {
+            for (size_t j = 0lu; j < Ng; j++) {
+                memset(&dstData[(t * B + batchIdxs[j]) * D * SC], 0, D * SC * sizeof(float));
+            }
+        }
+        for (size_t j = 0lu; j < Ng; j++)
+            cpu_memcpy(&hStateData[batchIdxs[j] * SC], &hoPack[j * SC], SC * sizeof(float));
+        if (cStateData) {
+            for (size_t j = 0lu; j < Ng; j++)
+                cpu_memcpy(&cStateData[batchIdxs[j] * SC], &coPack[j * SC], SC * sizeof(float));
+        }
+    }
+
+    return true;
+}
+
 void RNN::execute(dnnl::stream strm) {
     if (!prim)
         THROW_ERROR << "does not have initialized primitive to execute.";
 
+    if (!is_cell && executePackedSequences(strm))
+        return;
+
     const auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
     const auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
 
@@ -1143,6 +1267,7 @@ void RNN::execute(dnnl::stream strm) {
         }
     }
 
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, primExecItt(*prim));
     (*prim).execute(strm, args);
 }
 
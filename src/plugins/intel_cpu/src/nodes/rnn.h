@@ -49,6 +49,8 @@ private:
     void fillCellDesc();
     void fillSequenceDesc();
     void fillDescs();
+    std::shared_ptr<dnnl::primitive> buildPrimitive(const size_t SL, const size_t B);
+    bool executePackedSequences(dnnl::stream strm);
     bool verifyWeightsPrecision(const InferenceEngine::Precision& layerPrec,
                                 const InferenceEngine::Precision& weightsPrec);
 
@@ -123,7 +125,8 @@ private:
     const size_t hIdx = 1; // ov -> initial_hidden_state; dnnl -> src_iter_h
     const size_t cIdx = 2; // ov -> initial_cell_state;   dnnl -> src_iter_c
     size_t sIdx = 0;       // ov -> sequence_length;      dnnl -> additional input dimension 't'
-                           //                             oneDNN does not support unique t (seq_len) per batch
+                           //                             oneDNN does not support unique t (seq_len) per batch,
+                           //                             variable lengths are handled by packed execution instead
     size_t wIdx = 0;       // ov -> W;                    dnnl -> weights_layer
     size_t rIdx = 0;       // ov -> R;                    dnnl -> weights_iter
     size_t bIdx = 0;       // ov -> B;                    dnnl -> bias
@@ -908,10 +908,8 @@ void ROIAlign::executeSpecified() {
         }
     }
 
-    std::vector<int> numSamples(realRois);
-    std::vector<std::vector<float>> weightsTbl(realRois);
-    std::vector<std::vector<size_t>> srcAddressListTbl;
-    std::vector<std::vector<int>> srcIndexTbl;
+    numSamples.resize(realRois);
+    weightsTbl.resize(realRois);
     if (!isPlainFmt)
         srcAddressListTbl.resize(realRois);
     else
@@ -971,13 +969,14 @@ void ROIAlign::executeSpecified() {
 
         float sampleDistanceX = binWidth / samplingRatioX;
         float sampleDistanceY = binHeight / samplingRatioY;
-        // prepare arrays for sampling points and weights
+        // prepare arrays for sampling points and weights; every slot is written below,
+        // so resize() is enough and the capacity survives from the previous invocation
         size_t paramsSize = BLIParamsNum * numSamplesInBin * binCount;
-        weightsTbl[n] = std::vector<float>(paramsSize, 0.f);
+        weightsTbl[n].resize(paramsSize);
         if (!isPlainFmt)
-            srcAddressListTbl[n] = std::vector<size_t>(paramsSize, 0);
+            srcAddressListTbl[n].resize(paramsSize);
         else
-            srcIndexTbl[n] = std::vector<int>(paramsSize, 0);
+            srcIndexTbl[n].resize(paramsSize);
 
         size_t batchSrcOffset = roiBatchInd * batchInputStride;
         int idxIter = 0;
@@ -94,6 +94,14 @@ private:
     void createJitKernel(const InferenceEngine::Precision& dataPrec, const ROIAlignLayoutType& selectLayout);
     std::shared_ptr<jit_uni_roi_align_kernel> roi_align_kernel = nullptr;
 
+    // Per-ROI sampling tables kept across invocations: in detection models this node runs
+    // on every infer with hundreds of ROIs, so reusing the buffers avoids the per-ROI heap
+    // allocations of the weight preparation phase.
+    std::vector<int> numSamples;
+    std::vector<std::vector<float>> weightsTbl;
+    std::vector<std::vector<size_t>> srcAddressListTbl;
+    std::vector<std::vector<int>> srcIndexTbl;
+
     std::string errorPrefix;
 };
 
@@ -254,6 +254,29 @@ static std::vector<size_t> getBlockND(const VectorDims& shape) {
     return blockND;
 }
 
+// Minimal number of updates for which the bucketing pass pays off; below it the extra passes over
+// the indices cost more than the removed write conflicts
+static constexpr size_t minUpdatesForBucketing = 4096lu;
+
+void ScatterUpdate::bucketIndices(uint8_t *indices, size_t count, size_t axisDim,
+                                  std::vector<size_t>& bucketOffsets, std::vector<size_t>& order) {
+    bucketOffsets.assign(axisDim + 1, 0);
+    for (size_t i = 0; i < count; i++) {
+        const int64_t idxValue = getIndicesValue(indices, i);
+        if (idxValue >= 0 && idxValue < static_cast<int64_t>(axisDim))
+            bucketOffsets[idxValue + 1]++;
+    }
+    for (size_t b = 1; b <= axisDim; b++)
+        bucketOffsets[b] += bucketOffsets[b - 1];
+    order.resize(bucketOffsets[axisDim]);
+    std::vector<size_t> fill(bucketOffsets.begin(), bucketOffsets.end() - 1);
+    for (size_t i = 0; i < count; i++) {
+        const int64_t idxValue = getIndicesValue(indices, i);
+        if (idxValue >= 0 && idxValue < static_cast<int64_t>(axisDim))
+            order[fill[idxValue]++] = i;
+    }
+}
+
 void ScatterUpdate::execute(dnnl::stream strm) {
     auto &srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
@@ -390,6 +413,14 @@ void ScatterUpdate::scatterUpdate(uint8_t *indices, uint8_t *update, int axis, u
     size_t blockToUpdate = srcBlockND[axis + 1];
     size_t blockToUpdateSize = blockToUpdate * dataSize;
 
+    // With many (possibly duplicated) indices the straightforward parallelization may write the
+    // same destination slice from several threads at once, and the scattered accesses thrash the
+    // caches. The bucketed flavor pre-partitions the indices into conflict-free ranges instead.
+    if (idxLength >= minUpdatesForBucketing && srcDataDim[axis] > 1 && parallel_get_max_threads() > 1) {
+        scatterUpdateBucketed(indices, update, axis, dstData);
+        return;
+    }
+
     parallel_for2d(batchToUpdate, idxLength, [&](size_t b, size_t idx) {
         int64_t idxValue = getIndicesValue(indices, idx);
         uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
@@ -398,6 +429,57 @@ void ScatterUpdate::scatterUpdate(uint8_t *indices, uint8_t *update, int axis, u
     });
 }
 
+// Same as scatterUpdate, but the indices are first bucketed by their destination position along
+// the axis with a counting (radix) pass and the threads split whole buckets. Every thread thereby
+// owns a disjoint slice of the destination tensor: duplicated indices cannot be written
+// concurrently and the result is deterministic, since the updates of one slice are applied in
+// their original order (the last one wins). Sorting by destination also turns the scattered
+// writes into mostly sequential ones.
+void ScatterUpdate::scatterUpdateBucketed(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
+    const auto& srcDataDim = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
+    const auto& indicesDim = getParentEdgeAt(INDICES_ID)->getMemory().getStaticDims();
+    const auto& updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().getStaticDims();
+    size_t indicesRank = indicesDim.size();
+
+    std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
+    std::vector<size_t> updateBlockND = getBlockND(updateDim);
+
+    size_t idxLength = 1;
+    for (size_t ri = 0; ri < indicesRank; ri++) {
+        idxLength *= indicesDim[ri];
+    }
+    size_t batchToUpdate = 1;
+    for (int x = 0; x < axis; x++) {
+        batchToUpdate *= srcDataDim[x];
+    }
+    size_t blockToUpdate = srcBlockND[axis + 1];
+    size_t blockToUpdateSize = blockToUpdate * dataSize;
+    const size_t axisDim = srcDataDim[axis];
+
+    std::vector<size_t> bucketOffsets, order;
+    bucketIndices(indices, idxLength, axisDim, bucketOffsets, order);
+    const size_t totalOrdered = bucketOffsets[axisDim];
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        // every thread takes a near-equal share of the ordered updates rounded up to whole
+        // buckets; the rounding is a pure function of the offsets, so the chunk end of one
+        // thread is exactly the chunk start of the next one
+        const size_t chunkStart = *std::lower_bound(bucketOffsets.begin(), bucketOffsets.end(),
+                                                    totalOrdered * ithr / nthr);
+        const size_t chunkEnd = *std::lower_bound(bucketOffsets.begin(), bucketOffsets.end(),
+                                                  totalOrdered * (ithr + 1) / nthr);
+        for (size_t b = 0; b < batchToUpdate; b++) {
+            for (size_t pos = chunkStart; pos < chunkEnd; pos++) {
+                const size_t idx = order[pos];
+                const int64_t idxValue = getIndicesValue(indices, idx);
+                uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
+                uint8_t *updateEntry = update + (b * updateBlockND[axis] + idx * blockToUpdate) * dataSize;
+                cpu_memcpy(dstEntry, updateEntry, blockToUpdateSize);
+            }
+        }
+    });
+}
+
 // indices is a (q-1)-dimension tensor of k-tuple,
 // k is indices.shape[-1] and should not be greater than rank of input, q is rank of indicies.
 // updates is a (q-1)-dimension tensor of replacement-slice-values
@@ -439,6 +521,14 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
     std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
+    // Duplicated indices make the straightforward split of the updates racy: two threads may
+    // write the very same destination element. The bucketed flavor partitions the work by the
+    // destination instead, which is also friendlier to the caches.
+    if (updateBlockND[0] >= minUpdatesForBucketing && srcDataDim[axis] > 1 && parallel_get_max_threads() > 1) {
+        scatterElementsUpdateBucketed(indices, update, axis, dstData);
+        return;
+    }
+
     parallel_nt(0, [&](const int ithr, const int nthr) {
         int j;
         size_t i, dst_idx = 0, start = 0, end = 0;
@@ -478,6 +568,44 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
     });
 }
 
+// Same as scatterElementsUpdate, but the updates are bucketed by their destination index along
+// the axis (counting pass over the indices) and the threads split whole buckets, so every thread
+// owns a disjoint slice of the destination tensor: no write conflicts on duplicated indices and a
+// deterministic result, since the updates of one destination element keep their original order.
+void ScatterUpdate::scatterElementsUpdateBucketed(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
+    const auto& srcDataDim = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
+    const auto& updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().getStaticDims();
+    size_t updateRank = updateDim.size();
+
+    std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
+    std::vector<size_t> updateBlockND = getBlockND(updateDim);
+    const size_t axisDim = srcDataDim[axis];
+
+    std::vector<size_t> bucketOffsets, order;
+    bucketIndices(indices, updateBlockND[0], axisDim, bucketOffsets, order);
+    const size_t totalOrdered = bucketOffsets[axisDim];
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        const size_t chunkStart = *std::lower_bound(bucketOffsets.begin(), bucketOffsets.end(),
+                                                    totalOrdered * ithr / nthr);
+        const size_t chunkEnd = *std::lower_bound(bucketOffsets.begin(), bucketOffsets.end(),
+                                                  totalOrdered * (ithr + 1) / nthr);
+        for (size_t pos = chunkStart; pos < chunkEnd; pos++) {
+            const size_t iwork = order[pos];
+            const int64_t idxValue = getIndicesValue(indices, iwork);
+            size_t i = iwork, dst_idx = 0;
+            for (int j = updateRank - 1; j >= 0; j--) {
+                const size_t coord = i % updateDim[j];
+                i /= updateDim[j];
+                if (j != axis)
+                    dst_idx += coord * srcBlockND[j + 1];
+            }
+            cpu_memcpy(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
+                       update + iwork * dataSize, dataSize);
+        }
+    });
+}
+
 bool ScatterUpdate::created() const {
     return getType() == Type::ScatterUpdate
             || getType() == Type::ScatterElementsUpdate
@@ -42,6 +42,14 @@ private:
     void scatterUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
     void scatterNDUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, uint8_t *dstDataPtr);
     void scatterElementsUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
+    // Buckets the update positions by their destination index along the axis with a counting
+    // (radix) pass: bucketOffsets gets the bucket boundaries, order the positions sorted by bucket
+    void bucketIndices(uint8_t *indices, size_t count, size_t axisDim,
+                       std::vector<size_t>& bucketOffsets, std::vector<size_t>& order);
+    // Conflict-free parallel flavors: the threads split whole buckets, so each of them owns a
+    // disjoint slice of the destination tensor along the axis (see bucketIndices)
+    void scatterUpdateBucketed(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
+    void scatterElementsUpdateBucketed(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
     inline int64_t getIndicesValue(uint8_t *indices, size_t offset);
 
     ScatterUpdateMode scatterUpdateMode = ScatterUpdateMode::ScatterUpdate;
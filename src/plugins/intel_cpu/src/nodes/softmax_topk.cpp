@@ -0,0 +1,167 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "ngraph_transformations/op/softmax_topk.hpp"
+#include "ie_parallel.hpp"
+#include "softmax_topk.h"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool SoftmaxTopK::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto softmaxTopK = std::dynamic_pointer_cast<const ov::intel_cpu::SoftmaxTopKNode>(op);
+        if (!softmaxTopK) {
+            errorMessage = "Only SoftmaxTopK operation from the CPU plugin opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+SoftmaxTopK::SoftmaxTopK(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "SoftmaxTopK layer with name '" + op->get_friendly_name() + "'";
+    const auto softmaxTopK = std::dynamic_pointer_cast<const ov::intel_cpu::SoftmaxTopKNode>(op);
+
+    if (inputShapes.size() != 1 || outputShapes.size() != 2)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    axis = softmaxTopK->get_axis();
+    topK = softmaxTopK->get_k();
+    sortByIndex = softmaxTopK->get_sort_type() == ngraph::op::TopKSortType::SORT_INDICES;
+
+    const auto dimsSize = getInputShapeAtPort(0).getDims().size();
+    if (dimsSize < static_cast<size_t>((size_t)(1) + axis))
+        IE_THROW() << errorPrefix << " has incorrect input parameters dimensions and axis number!";
+}
+
+void SoftmaxTopK::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32}},
+                         {{LayoutType::ncsp, Precision::FP32}, {LayoutType::ncsp, Precision::I32}},
+                         impl_desc_type::ref_any);
+}
+
+void SoftmaxTopK::prepareParams() {
+    const auto &dims = getParentEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    reducedAxisStride = 1;
+    axisStep = 1;
+    isLastDim = false;
+
+    int j = static_cast<int>(dims.size()) - 1;
+    for (; j >= 0; j--) {
+        if (dims[j] != 1) break;
+    }
+    if (j == axis) isLastDim = true;
+
+    for (int i = 0; i < axis; i++)
+        axisStep *= dims[i];
+    reducedAxisSize = dims[axis];
+    for (size_t i = (axis + 1); i < dims.size(); i++)
+        reducedAxisStride *= dims[i];
+
+    if (reducedAxisSize < topK)
+        IE_THROW() << errorPrefix << " has k larger than the reduced axis size!";
+}
+
+void SoftmaxTopK::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+void SoftmaxTopK::execute(dnnl::stream strm) {
+    const float *srcData = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    float* dstValues = reinterpret_cast<float *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+    int32_t* dstIndices = reinterpret_cast<int32_t *>(getChildEdgesAtPort(1)[0]->getMemoryPtr()->GetPtr());
+
+    // The full softmax is never materialized: one pass finds the max, the second accumulates the
+    // exact denominator while keeping the k largest logits in a small insertion-sorted list, and
+    // only those k entries are exponentiated and normalized.
+    auto processSlice = [&](const float *srcPtr, float *valPtr, int32_t *idxPtr, size_t srcStride, size_t dstStride) {
+        float max = srcPtr[0];
+        for (size_t j = 1; j < reducedAxisSize; ++j)
+            max = std::max(max, srcPtr[j * srcStride]);
+
+        std::vector<float> candValues(topK);
+        std::vector<int32_t> candIndices(topK);
+        size_t count = 0;
+        float reduceProd = 0.0f;
+        for (size_t j = 0; j < reducedAxisSize; ++j) {
+            const float value = srcPtr[j * srcStride];
+            reduceProd += expf(value - max);
+            if (count == topK && value <= candValues[topK - 1])
+                continue;
+            // strict comparison keeps equal values ordered by ascending index, as TopK does
+            size_t pos = count < topK ? count : topK - 1;
+            while (pos > 0 && value > candValues[pos - 1]) {
+                candValues[pos] = candValues[pos - 1];
+                candIndices[pos] = candIndices[pos - 1];
+                pos--;
+            }
+            candValues[pos] = value;
+            candIndices[pos] = static_cast<int32_t>(j);
+            if (count < topK)
+                count++;
+        }
+
+        if (sortByIndex) {
+            // the candidates arrive sorted by value; reorder the k pairs by ascending index
+            for (size_t i = 1; i < topK; ++i) {
+                const float value = candValues[i];
+                const int32_t index = candIndices[i];
+                size_t pos = i;
+                while (pos > 0 && index < candIndices[pos - 1]) {
+                    candValues[pos] = candValues[pos - 1];
+                    candIndices[pos] = candIndices[pos - 1];
+                    pos--;
+                }
+                candValues[pos] = value;
+                candIndices[pos] = index;
+            }
+        }
+
+        const float scale = 1.0f / reduceProd;
+        for (size_t i = 0; i < topK; ++i) {
+            valPtr[i * dstStride] = expf(candValues[i] - max) * scale;
+            idxPtr[i * dstStride] = candIndices[i];
+        }
+    };
+
+    if (isLastDim) {
+        parallel_for(axisStep, [&](size_t i) {
+            processSlice(&srcData[i * reducedAxisSize], &dstValues[i * topK], &dstIndices[i * topK], 1, 1);
+        });
+    } else {
+        parallel_for2d(axisStep, reducedAxisStride, [&](size_t k, size_t i) {
+            processSlice(&srcData[k * reducedAxisStride * reducedAxisSize + i],
+                         &dstValues[k * reducedAxisStride * topK + i],
+                         &dstIndices[k * reducedAxisStride * topK + i],
+                         reducedAxisStride, reducedAxisStride);
+        });
+    }
+}
+
+bool SoftmaxTopK::created() const {
+    return getType() == Type::SoftmaxTopK;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class SoftmaxTopK : public Node {
+public:
+    SoftmaxTopK(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    void prepareParams() override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    int axis = 0;
+    size_t topK = 0;
+    bool sortByIndex = false;
+    size_t reducedAxisSize = 0;
+    size_t reducedAxisStride = 1;
+    size_t axisStep = 1;
+    bool isLastDim = false;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
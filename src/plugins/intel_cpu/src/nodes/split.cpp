@@ -158,8 +158,9 @@ void Split::initSupportedPrimitiveDescriptors() {
         }
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
 
-        if (itr->first == LayoutType::ncsp) {
-            // at least the plain layout can be optimized inplace.
+        if (itr->first == LayoutType::ncsp || itr->first == LayoutType::nspc) {
+            // the non blocked layouts can always be optimized inplace, since every output is just
+            // a strided view over the input memory
             pdIndexesToReuse.emplace_back(supportedPrimitiveDescriptors.size() - 1);
         } else if (itr->first == LayoutType::nCsp8c || itr->first == LayoutType::nCsp16c) {
             if (axis < 2) {
@@ -179,6 +180,16 @@ void Split::initSupportedPrimitiveDescriptors() {
             const auto& blkDims = inBlockingDesc->getBlockDims();
             auto numOfDim = blkDims.size();
 
+            // position of the split axis in the actual memory layout, e.g. for the tail channels
+            // layout the channels axis is the innermost one
+            size_t axisOrderPos = 0;
+            for (size_t i = 0; i < order.size(); ++i) {
+                if (order[i] == axis) {
+                    axisOrderPos = i;
+                    break;
+                }
+            }
+
             SizeVector offsets(numOfDim, 0lu);
             SizeVector strides(numOfDim);
             strides.back() = 1lu;
@@ -186,7 +197,7 @@ void Split::initSupportedPrimitiveDescriptors() {
             BlockedMemoryDesc::CmpMask mask = BLOCKED_DESC_SKIP_OFFSET_MASK; // accepts any offset
 
             for (size_t i = 2; i <= numOfDim; i++) {
-                if (numOfDim - i < axis) {
+                if (numOfDim - i < axisOrderPos) {
                     strides[numOfDim - i] = Shape::UNDEFINED_DIM;
                     mask.reset(numOfDim - i); // accepts any strides on axis
                 } else {
@@ -339,6 +350,14 @@ void Split::initOptimalPrimitiveDescriptor() {
             THROW_ERROR << "has invalid config";
 
         auto firstInBlockingDesc = config.inConfs[0].getMemDesc()->as<BlockedMemoryDesc>();
+        const auto& inOrder = firstInBlockingDesc->getOrder();
+        size_t axisOrderPos = 0;
+        for (size_t i = 0; i < inOrder.size(); ++i) {
+            if (inOrder[i] == axis) {
+                axisOrderPos = i;
+                break;
+            }
+        }
         size_t offset = 0;
         for (size_t i = 0; i < outputShapes.size(); i++) {
             auto oldDesc = config.outConfs[i].getMemDesc();
@@ -355,7 +374,7 @@ void Split::initOptimalPrimitiveDescriptor() {
                                                                               firstInBlockingDesc->getStrides())), BLOCKED_DESC_FULL_MASK);
 
             size_t axisSize = 1;
-            for (size_t j = axis; j < outBlockingDesc->getBlockDims().size(); j++) {
+            for (size_t j = axisOrderPos; j < outBlockingDesc->getBlockDims().size(); j++) {
                 axisSize *= outBlockingDesc->getBlockDims()[j];
             }
             offset += axisSize;
@@ -413,17 +432,7 @@ void Split::selectOptimalPrimitiveDescriptor() {
         return;
     }
 
-    // if there are more then one PD with similar data layouts - select the optimized one
-    for (auto indx : canSelectPrimitive) {
-        if (supportedPrimitiveDescriptors[indx].getImplementationType() == impl_desc_type::unknown) {
-            selectPrimitiveDescriptorByIndex(static_cast<int>(indx));
-            return;
-        }
-    }
-
-    // if there are no inPlace, but more than one suitable configurations, select the one that matches the output layout
-    for (auto indx : canSelectPrimitive) {
-        bool outputDescFullMatch = true;
+    auto outputDescsMatchChildren = [&](size_t indx) {
         for (size_t i = 0; i < getChildEdges().size(); ++i) {
             auto childEdge = getChildEdgeAt(i);
             auto childPtr = childEdge->getChild();
@@ -446,16 +455,39 @@ void Split::selectOptimalPrimitiveDescriptor() {
                     }
                 }
                 if (!hasMatchDesc) {
-                    outputDescFullMatch = false;
-                    break;
+                    return false;
                 }
             }
         }
-        if (outputDescFullMatch) {
+        return true;
+    };
+
+    // if there are more then one PD with similar data layouts - select the optimized one, but prefer a configuration
+    // which the consumers can read directly, so that an inplace view does not push an extra reorder downstream
+    // (e.g. the special nspc -> ncsp case is still preferable when all the consumers expect the planar layout)
+    for (auto indx : canSelectPrimitive) {
+        if (supportedPrimitiveDescriptors[indx].getImplementationType() == impl_desc_type::unknown && outputDescsMatchChildren(indx)) {
+            selectPrimitiveDescriptorByIndex(static_cast<int>(indx));
+            return;
+        }
+    }
+
+    // if there are no suitable inPlace configurations, select the one that matches the output layout
+    for (auto indx : canSelectPrimitive) {
+        if (outputDescsMatchChildren(indx)) {
             selectPrimitiveDescriptorByIndex(static_cast<int>(indx));
             return;
         }
     }
+
+    // no configuration matches the consumers, so an extra reorder is inevitable; at least avoid the split copy itself
+    for (auto indx : canSelectPrimitive) {
+        if (supportedPrimitiveDescriptors[indx].getImplementationType() == impl_desc_type::unknown) {
+            selectPrimitiveDescriptorByIndex(static_cast<int>(indx));
+            return;
+        }
+    }
+
     if (!canSelectPrimitive.empty()) {
         selectPrimitiveDescriptorByIndex(static_cast<int>(canSelectPrimitive.front()));
         return;
@@ -342,6 +342,15 @@ StridedSlice::StridedSliceCommonExecutor::StridedSliceCommonExecutor(const Strid
     dimsNormalization();
     dimsGluing();
     indicesCalculation();
+
+    // after the dims gluing the slice may degenerate into a fully contiguous region in both tensors
+    // (e.g. a trim of the outermost dimension only), then the whole work collapses into one bulk copy
+    // without any per-iteration offset lookup
+    canUseFlatCopy = workAmount > 0lu;
+    for (size_t iwork = 0lu; iwork < workAmount && canUseFlatCopy; ++iwork) {
+        if (dstIndices[iwork] != iwork * lastDstDim || srcIndices[iwork] != srcIndices.front() + iwork * lastDstDim)
+            canUseFlatCopy = false;
+    }
 }
 
 void StridedSlice::StridedSliceCommonExecutor::orderParametersByLayouts(const BlockedMemoryDescCPtr& blockedMemoryDesc) {
@@ -741,6 +750,19 @@ void StridedSlice::StridedSliceCommonExecutor::exec(const std::vector<MemoryCPtr
     const uint8_t* srcData = reinterpret_cast<const uint8_t*>(srcMemory[0]->GetPtr());
     uint8_t* dstData = reinterpret_cast<uint8_t*>(dstMemory[0]->GetPtr());
     const uint8_t* srcShiftedData = srcData + srcShift;
+
+    if (canUseFlatCopy) {
+        const uint8_t* srcFlatData = srcShiftedData + srcIndices.front();
+        const size_t totalSize = workAmount * lastDstDim;
+        parallel_nt(nThreads, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(totalSize, nthr, ithr, start, end);
+
+            cpu_memcpy(&dstData[start], &srcFlatData[start], end - start);
+        });
+        return;
+    }
+
     parallel_nt(nThreads, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
         splitter(workAmount, nthr, ithr, start, end);
@@ -622,6 +622,19 @@ void TensorIterator::prepareBackEdges() {
 
 void TensorIterator::prepareDynamicBackEdges() {
     const auto &eng = getEngine();
+
+    // for decoding style loops the body shapes stabilize after the first iteration, so the mappers
+    // built on the previous one are usually still valid; rebuilding them (desc redefinition plus a
+    // reorder primitive construction per edge) every iteration dominates the loop overhead
+    bool reuse = back_mappers.size() == backEdges.size();
+    for (size_t i = 0; i < backEdges.size() && reuse; i++) {
+        auto &from_mem = output_mem[backEdges[i].from];
+        auto &to_mem = input_mems[backEdges[i].to].front();
+        reuse = from_mem->getDesc().isCompatible(to_mem->getDesc()) && back_mappers[i]->holdsHandles(from_mem, to_mem);
+    }
+    if (reuse)
+        return;
+
     back_mappers.clear();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
@@ -37,6 +37,10 @@ class PortMapHelper {
 public:
     virtual ~PortMapHelper() = default;
     virtual void execute(dnnl::stream strm, int n_iter = -1) = 0;
+    bool holdsHandles(const MemoryPtr& src, const MemoryPtr& dst) const {
+        return mem_holder_src.get_data_handle() == src->GetPrimitive().get_data_handle() &&
+               mem_holder_dst.get_data_handle() == dst->GetPrimitive().get_data_handle();
+    }
 protected:
     dnnl::reorder reorder;
     dnnl::memory mem_holder_src;
@@ -1847,6 +1847,7 @@ TopK::TopK(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr con
 
         top_k = 0;
         preset_params_done = false;
+        ref_partial_sort = false;
         vec_idx_seq.clear();
         vec_idx_block.clear();
 
@@ -2042,6 +2043,17 @@ void TopK::prepareParams() {
         }
         dim = static_cast<int>(src_dims[axis]);
         before_num = count(src_dims, 0, axis);
+
+        // the insertion based selection degrades to O(dim * top_k) per row for large top_k,
+        // in which case a partial sort of a (value, index) copy of the row, O(dim * log(top_k)),
+        // is preferred; for small top_k the insertion path stays faster, since most of the
+        // candidates are rejected by the very first comparison
+        ref_partial_sort = top_k > 32 && dim > 2 * top_k;
+        const size_t nthr = parallel_get_max_threads();
+        vec_ref_values.resize(nthr * (top_k + 1));
+        vec_ref_indexes.resize(nthr * (top_k + 1));
+        if (ref_partial_sort)
+            vec_ref_row.resize(nthr * dim);
     }
 }
 
@@ -2347,15 +2359,21 @@ void TopK::topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx) {
 }
 
 void TopK::topk_ref_process(const float* src_data, float* dst_data, int32_t* dst_idx, const SizeVector &in_dims,
-                               std::function<float(float, float)> compare) const {
+                               std::function<float(float, float)> compare) {
     int after_num = count(in_dims, axis + 1, in_dims.size());
+    size_t work_amount = static_cast<size_t>(before_num) * after_num;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(work_amount, nthr, ithr, start, end);
+        if (start >= end)
+            return;
 
-    parallel_for2d(before_num, after_num, [&](int i0, int i1) {
-        std::vector<float> max_values(top_k + 1);
-        std::vector<int> max_indexes(top_k + 1);
+        float *max_values = vec_ref_values.data() + ithr * (top_k + 1);
+        int *max_indexes = vec_ref_indexes.data() + ithr * (top_k + 1);
+        std::pair<float, int> *row = ref_partial_sort ? vec_ref_row.data() + ithr * dim : nullptr;
         float tmp_value;
         int tmp_index;
-        int s_index = i0 * dim * after_num + i1;
 
         auto swap_func = [&](int index1, int index2) {
             tmp_value = max_values[index1];
@@ -2367,45 +2385,68 @@ void TopK::topk_ref_process(const float* src_data, float* dst_data, int32_t* dst
             max_indexes[index2] = tmp_index;
         };
 
-        for (int i2 = 0; i2 < top_k; i2++) {
-            max_values[i2] = src_data[s_index];
-            max_indexes[i2] = i2;
-            s_index += after_num;
-        }
-        for (int i2 = 0; i2 < top_k - 1; i2++) {
-            for (int i3 = top_k - 1; i3 > i2; i3--) {
-                if (compare(max_values[i3], max_values[i3 - 1])) {
-                    swap_func(i3, i3 - 1);
+        for (size_t iwork = start; iwork < end; iwork++) {
+            int i0 = static_cast<int>(iwork / after_num);
+            int i1 = static_cast<int>(iwork % after_num);
+            int s_index = i0 * dim * after_num + i1;
+
+            if (ref_partial_sort) {
+                // value ties are resolved by the smaller index, which keeps the output
+                // bit-identical to the insertion path below
+                for (int i2 = 0; i2 < dim; i2++) {
+                    row[i2] = std::make_pair(src_data[s_index], i2);
+                    s_index += after_num;
+                }
+                std::partial_sort(row, row + top_k, row + dim,
+                                  [&](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                                      return compare(l.first, r.first) || (l.first == r.first && l.second < r.second);
+                                  });
+                for (int i2 = 0; i2 < top_k; i2++) {
+                    max_values[i2] = row[i2].first;
+                    max_indexes[i2] = row[i2].second;
+                }
+            } else {
+                for (int i2 = 0; i2 < top_k; i2++) {
+                    max_values[i2] = src_data[s_index];
+                    max_indexes[i2] = i2;
+                    s_index += after_num;
+                }
+                for (int i2 = 0; i2 < top_k - 1; i2++) {
+                    for (int i3 = top_k - 1; i3 > i2; i3--) {
+                        if (compare(max_values[i3], max_values[i3 - 1])) {
+                            swap_func(i3, i3 - 1);
+                        }
+                    }
+                }
+                for (int i2 = top_k; i2 < dim; i2++) {
+                    max_values[top_k] = src_data[s_index];
+                    max_indexes[top_k] = i2;
+                    for (int i3 = top_k; i3 > 0; i3--) {
+                        if (compare(max_values[i3], max_values[i3 - 1]))
+                            swap_func(i3, i3 - 1);
+                        else
+                            break;
+                    }
+                    s_index += after_num;
                 }
             }
-        }
-        for (int i2 = top_k; i2 < dim; i2++) {
-            max_values[top_k] = src_data[s_index];
-            max_indexes[top_k] = i2;
-            for (int i3 = top_k; i3 > 0; i3--) {
-                if (compare(max_values[i3], max_values[i3 - 1]))
-                    swap_func(i3, i3 - 1);
-                else
-                    break;
-            }
-            s_index += after_num;
-        }
-        if (sort_index) {
-            for (int i2 = 0; i2 < top_k - 1; i2++) {
-                for (int i3 = top_k - 1; i3 > i2; i3--) {
-                    if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
-                        swap_func(i3, i3 - 1);
+            if (sort_index) {
+                for (int i2 = 0; i2 < top_k - 1; i2++) {
+                    for (int i3 = top_k - 1; i3 > i2; i3--) {
+                        if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
+                            swap_func(i3, i3 - 1);
+                        }
                     }
                 }
             }
-        }
-        if (dst_data) {
-            for (int i2 = 0; i2 < top_k; i2++)
-                dst_data[i0 * top_k * after_num + i2 * after_num + i1] = max_values[i2];
-        }
-        if (dst_idx) {
-            for (int i2 = 0; i2 < top_k; i2++)
-                dst_idx[i0 * top_k * after_num + i2 * after_num + i1] = max_indexes[i2];
+            if (dst_data) {
+                for (int i2 = 0; i2 < top_k; i2++)
+                    dst_data[i0 * top_k * after_num + i2 * after_num + i1] = max_values[i2];
+            }
+            if (dst_idx) {
+                for (int i2 = 0; i2 < top_k; i2++)
+                    dst_idx[i0 * top_k * after_num + i2 * after_num + i1] = max_indexes[i2];
+            }
         }
     });
 }
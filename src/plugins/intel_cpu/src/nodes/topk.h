@@ -107,7 +107,7 @@ private:
     void calc_bitonic_idx(size_t n, int &cnt, bool cmp_val);
     void calc_dims_size(const InferenceEngine::SizeVector &layout_dims);
     void topk_ref_process(const float* src_data, float* dst_data, int32_t* dst_idx,
-                   const InferenceEngine::SizeVector &in_dims, std::function<float(float, float)> compare) const;
+                   const InferenceEngine::SizeVector &in_dims, std::function<float(float, float)> compare);
     void preset_params();
     void prepare_original_idx();
 
@@ -127,6 +127,7 @@ private:
     int dim, before_num;
     bool bubble_inplace;
     bool preset_params_done;
+    bool ref_partial_sort;
 
     InferenceEngine::SizeVector src_dims, dst_dims;
     TopKLayoutType layout;
@@ -141,6 +142,11 @@ private:
     std::vector<uint8_t> vec_process_ptr;
     std::vector<uint8_t> vec_process_idx_ptr;
 
+    // per thread scratch of the reference implementation, reused across the infer calls
+    std::vector<float> vec_ref_values;
+    std::vector<int> vec_ref_indexes;
+    std::vector<std::pair<float, int>> vec_ref_row;
+
     std::shared_ptr<jit_uni_topk_kernel> topk_kernel;
 
     std::string errorPrefix;
@@ -90,6 +90,8 @@
 #include "nodes/priorbox_clustered.h"
 #include "nodes/eye.h"
 #include "nodes/interaction.h"
+#include "nodes/softmax_topk.h"
+#include "nodes/log_softmax_gather.h"
 #include "nodes/mha.h"
 #include "nodes/unique.hpp"
 
@@ -195,6 +197,8 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(Eye, Type::Eye);
     INTEL_CPU_NODE(Interaction, Type::Interaction);
     INTEL_CPU_NODE(MHA, Type::MHA);
+    INTEL_CPU_NODE(SoftmaxTopK, Type::SoftmaxTopK);
+    INTEL_CPU_NODE(LogSoftmaxGather, Type::LogSoftmaxGather);
     INTEL_CPU_NODE(Unique, Type::Unique);
 }
 
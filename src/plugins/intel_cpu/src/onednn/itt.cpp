@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "itt.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace ov {
+namespace intel_cpu {
+
+openvino::itt::handle_t primitive_itt_handle(const std::string& owner, const dnnl::primitive& prim) {
+    const char* implInfo = nullptr;
+    auto pd = prim.get_primitive_desc();
+    if (dnnl_primitive_desc_query(pd, dnnl_query_impl_info_str, 0, &implInfo) != dnnl_success || implInfo == nullptr)
+        implInfo = "undef";
+
+    const std::string name = owner + '@' + implInfo;
+
+    static std::mutex handlesMutex;
+    static std::unordered_map<std::string, openvino::itt::handle_t> handles;
+
+    std::lock_guard<std::mutex> lock(handlesMutex);
+    auto it = handles.find(name);
+    if (it == handles.end())
+        it = handles.emplace(name, openvino::itt::handle(name)).first;
+    return it->second;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
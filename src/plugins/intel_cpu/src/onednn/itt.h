@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/itt.hpp>
+
+#include <string>
+
+#include "dnnl.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Bridges oneDNN primitive executions into the plugin ITT timeline.
+ *
+ * The returned handle names an ITT region "<owner>@<impl>", where <impl> is the
+ * implementation string oneDNN reports for the primitive that was actually created
+ * (e.g. brgconv_avx512_amx:any). The selected primitive descriptor type alone does
+ * not tell which kernel won the internal dispatch, so until now ONEDNN_VERBOSE
+ * output had to be correlated with node names by hand; nesting this region under
+ * the per-node task makes the attribution structural in a single timeline.
+ *
+ * Handles are interned per name, since the ITT runtime keeps raw string pointers
+ * alive for the whole collection. Callers are expected to cache the result per
+ * primitive and only come back here when the primitive is rebuilt.
+ */
+openvino::itt::handle_t primitive_itt_handle(const std::string& owner, const dnnl::primitive& prim);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#if defined(__linux__)
+
+namespace {
+
+// A group of self-monitoring hardware counters opened once per thread. Grouping guarantees all
+// events are scheduled on the PMU together, so the deltas taken around a node execution are
+// consistent with each other.
+struct PmuEventGroup {
+    int fds[PerfCount::pmuEventsNum] = {-1, -1, -1, -1};
+    bool valid = false;
+
+    PmuEventGroup() {
+        static const uint64_t events[PerfCount::pmuEventsNum] = {PERF_COUNT_HW_CPU_CYCLES,
+                                                                 PERF_COUNT_HW_INSTRUCTIONS,
+                                                                 PERF_COUNT_HW_CACHE_REFERENCES,
+                                                                 PERF_COUNT_HW_CACHE_MISSES};
+        for (size_t i = 0; i < PerfCount::pmuEventsNum; i++) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = events[i];
+            attr.disabled = (i == 0) ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            const int group_fd = (i == 0) ? -1 : fds[0];
+            fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+            if (fds[i] < 0) {
+                // perf events may be unavailable (perf_event_paranoid, containers, missing PMU
+                // virtualization) - silently fall back to wall clock only profiling
+                release();
+                return;
+            }
+        }
+        ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        valid = true;
+    }
+
+    ~PmuEventGroup() {
+        release();
+    }
+
+    bool read_counters(uint64_t values[PerfCount::pmuEventsNum]) const {
+        if (!valid)
+            return false;
+        // PERF_FORMAT_GROUP layout: { u64 nr; u64 values[nr]; }
+        uint64_t buf[1 + PerfCount::pmuEventsNum];
+        if (::read(fds[0], buf, sizeof(buf)) != static_cast<ssize_t>(sizeof(buf)) ||
+            buf[0] != PerfCount::pmuEventsNum)
+            return false;
+        for (size_t i = 0; i < PerfCount::pmuEventsNum; i++)
+            values[i] = buf[1 + i];
+        return true;
+    }
+
+private:
+    void release() {
+        for (size_t i = 0; i < PerfCount::pmuEventsNum; i++) {
+            if (fds[i] >= 0)
+                close(fds[i]);
+            fds[i] = -1;
+        }
+        valid = false;
+    }
+};
+
+const PmuEventGroup& get_pmu_group() {
+    thread_local PmuEventGroup group;
+    return group;
+}
+
+}  // namespace
+
+void PerfCount::start_pmu_itr() {
+    __pmu_valid = get_pmu_group().read_counters(__pmu_start);
+}
+
+void PerfCount::finish_pmu_itr() {
+    uint64_t values[pmuEventsNum];
+    if (!__pmu_valid || !get_pmu_group().read_counters(values))
+        return;
+    for (size_t i = 0; i < pmuEventsNum; i++)
+        pmu_total[i] += values[i] - __pmu_start[i];
+    pmu_num++;
+}
+
+#else   // !defined(__linux__)
+
+void PerfCount::start_pmu_itr() {}
+void PerfCount::finish_pmu_itr() {}
+
+#endif  // defined(__linux__)
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -5,18 +5,31 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <ratio>
 
 namespace ov {
 namespace intel_cpu {
 
 class PerfCount {
+public:
+    // cycles, instructions, LLC references, LLC misses
+    static constexpr size_t pmuEventsNum = 4;
+
+private:
     uint64_t total_duration;
     uint32_t num;
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    // accumulated deltas of the hardware counters; filled only when PMU sampling is enabled
+    // and the thread local perf event group was opened successfully
+    uint64_t pmu_total[pmuEventsNum] = {0};
+    uint64_t __pmu_start[pmuEventsNum] = {0};
+    bool __pmu_valid = false;
+    uint32_t pmu_num = 0;
+
 public:
     PerfCount(): total_duration(0), num(0) {}
 
@@ -27,6 +40,12 @@ public:
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
     uint32_t count() const { return num; }
 
+    uint32_t pmu_count() const { return pmu_num; }
+    uint64_t cycles() const { return pmu_total[0]; }
+    uint64_t instructions() const { return pmu_total[1]; }
+    uint64_t llc_references() const { return pmu_total[2]; }
+    uint64_t llc_misses() const { return pmu_total[3]; }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -38,20 +57,35 @@ private:
         num++;
     }
 
+    // Defined in perf_count.cpp: reading the counters goes through a perf_event_open group which
+    // is opened lazily per thread. No-op when the group could not be opened (e.g. restricted
+    // perf_event_paranoid) or on platforms without the perf_event interface.
+    void start_pmu_itr();
+    void finish_pmu_itr();
+
     friend class PerfHelper;
 };
 
 class PerfHelper {
     PerfCount &counter;
+    const bool with_pmu;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, bool pmu = false): counter(count), with_pmu(pmu) {
+        if (with_pmu)
+            counter.start_pmu_itr();
+        counter.start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        counter.finish_itr();
+        if (with_pmu)
+            counter.finish_pmu_itr();
+    }
 };
 
 }   // namespace intel_cpu
 }   // namespace ov
 
-#define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
-#define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define GET_PERF(_node, _pmu) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter(), _pmu))
+#define PERF(_node, _need, _pmu) auto pc = _need ? GET_PERF(_node, _pmu) : nullptr;
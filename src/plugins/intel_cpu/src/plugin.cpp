@@ -15,12 +15,17 @@
 
 #include "ie_icore.hpp"
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_system_conf.h"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 
 #include <ie_ngraph_utils.hpp>
 
 #include "performance_heuristics.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/hash.hpp"
+#include "transformations/utils/utils.hpp"
+#include <ngraph/op/assign.hpp>
 
 #include "weights_cache.hpp"
 #include "utils/denormals.hpp"
@@ -46,6 +51,10 @@
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include <itt.h>
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
 using namespace InferenceEngine;
 
 #define IE_CPU_PLUGIN_THROW(...) IE_THROW(__VA_ARGS__) << "CPU plugin: "
@@ -75,6 +84,18 @@ static std::string getDeviceFullName() {
     return brand_string;
 }
 
+static std::vector<std::string> getAvailableCpuDevices() {
+    // a machine with several NUMA domains additionally exposes them as CPU.<N> sub-devices, so a
+    // model can be confined to one socket or die; see the KEY_DEVICE_ID handling in Config
+    std::vector<std::string> devices = { "" };
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    if (numaNodes.size() > 1) {
+        for (const auto node : numaNodes)
+            devices.push_back(std::to_string(node));
+    }
+    return devices;
+}
+
 #if defined(__linux__)
 
 #ifndef AT_MINSIGSTKSZ
@@ -353,6 +374,12 @@ Engine::StreamCfg Engine::GetNumStreams(InferenceEngine::IStreamsExecutor::Threa
     return stream_cfg;
 }
 
+static std::string compilationCheckpointPath(const std::string& dir, uint64_t key, Transformations::CheckpointStage stage) {
+    std::stringstream path;
+    path << dir << "/cpu_ckpt_" << std::hex << key << "_stage" << static_cast<int>(stage) << ".blob";
+    return path.str();
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Engine::LoadExeNetworkImpl");
@@ -405,7 +432,112 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "org_"));
 
+    // Cross-model sharing: ensembles and multi-tenant processes compile byte-identical models
+    // repeatedly, each instance paying the full compile time and keeping its own graphs. With
+    // the key enabled the model is hashed (the same ov::pass::Hash the compilation checkpoints
+    // are keyed by) together with the compile options, and when an alive executable network
+    // matches it is handed out instead of compiling a new one. Stateful models are excluded:
+    // their variable state lives in the executable network and must not leak between the
+    // nominally independent instances.
+    const auto& shareProp = config.find(CPUConfigParams::KEY_CPU_CROSS_MODEL_SHARING);
+    const bool enableSharing = (shareProp != config.end() && shareProp->second == PluginConfigParams::YES) ||
+                               (shareProp == config.end() && engConfig.crossModelSharing);
+    std::string sharingKey;
+    if (enableSharing &&
+        !ngraph::op::util::has_op_with_type<ngraph::op::v3::Assign>(nGraphFunc) &&
+        !ngraph::op::util::has_op_with_type<ngraph::op::v6::Assign>(nGraphFunc)) {
+        uint64_t modelHash = 0;
+        {
+            ov::pass::Manager manager;
+            manager.register_pass<ov::pass::Hash>(modelHash);
+            manager.run_passes(nGraphFunc);
+        }
+        // the plugin defaults are part of the identity too, since SetConfig may change them
+        // between otherwise identical LoadNetwork calls
+        sharingKey = std::to_string(modelHash);
+        for (const auto& option : engConfig._config) {
+            sharingKey += '#' + option.first + '=' + option.second;
+        }
+        for (const auto& option : config) {
+            sharingKey += '#' + option.first + '=' + option.second;
+        }
+        std::lock_guard<std::mutex> lock{_sharedNetworksMutex};
+        auto itr = _sharedNetworks.find(sharingKey);
+        if (itr != _sharedNetworks.end()) {
+            if (auto shared = itr->second.lock())
+                return shared;
+            _sharedNetworks.erase(itr);
+        }
+    }
+
+    // Transformation pipeline checkpointing: snapshots of the intermediate model are stored in the
+    // cache directory after the expensive pipeline stages, so a compilation interrupted by a crash
+    // resumes from the last completed stage instead of starting from zero when it is retried.
+    const auto& ckptProp = config.find(CPUConfigParams::KEY_CPU_COMPILATION_CHECKPOINTING);
+    const auto& cacheDirProp = config.find(PluginConfigParams::KEY_CACHE_DIR);
+    const std::string checkpointDir = cacheDirProp != config.end() ? cacheDirProp->second : engConfig.cache_dir;
+    const bool enableCheckpointing = !checkpointDir.empty() &&
+        ((ckptProp != config.end() && ckptProp->second == PluginConfigParams::YES) ||
+         (ckptProp == config.end() && engConfig.compilationCheckpointing));
+    uint64_t checkpointKey = 0;
+    auto completedStage = Transformations::CheckpointStage::None;
+    if (enableCheckpointing) {
+        {
+            ov::pass::Manager manager;
+            manager.register_pass<ov::pass::Hash>(checkpointKey);
+            manager.run_passes(nGraphFunc);
+        }
+        // the options below change the outcome of the pipeline, so they are part of the identity
+        checkpointKey ^= (enableLPT ? 0x1u : 0u) | (enableBF16 ? 0x2u : 0u) |
+                         (enableSnippets ? 0x4u : 0u) | (isLegacyAPI() ? 0x8u : 0u);
+        for (auto stage : {Transformations::CheckpointStage::Snippets,
+                           Transformations::CheckpointStage::PostLpt,
+                           Transformations::CheckpointStage::Lpt,
+                           Transformations::CheckpointStage::PreLpt}) {
+            std::ifstream checkpoint(compilationCheckpointPath(checkpointDir, checkpointKey, stage),
+                                     std::ios::binary);
+            if (!checkpoint)
+                continue;
+            try {
+                CNNNetworkDeserializer deserializer(checkpoint,
+                    [this](const std::string& model, const Blob::CPtr& weights) {
+                        return GetCore()->ReadNetwork(model, weights, true);
+                    });
+                CNNNetwork restoredNetwork;
+                deserializer >> restoredNetwork;
+                clonedNetwork = restoredNetwork;
+                nGraphFunc = clonedNetwork.getFunction();
+                completedStage = stage;
+                break;
+            } catch (const InferenceEngine::Exception&) {
+                // a checkpoint which cannot be restored (e.g. truncated by the very crash it is
+                // meant to recover from, or packed for a different ISA) is simply recompiled
+            }
+        }
+    }
+
     Transformations transformations(nGraphFunc, enableLPT, enableSnippets, enableBF16, isLegacyAPI(), engConfig);
+    if (enableCheckpointing) {
+        transformations.SetCheckpointing(
+            [&](Transformations::CheckpointStage stage) {
+                const auto path = compilationCheckpointPath(checkpointDir, checkpointKey, stage);
+                // written to a temporary first, so a crash in the middle of the write cannot leave
+                // a truncated checkpoint under the final name
+                const auto tmpPath = path + ".tmp";
+                try {
+                    {
+                        std::ofstream checkpoint(tmpPath, std::ios::binary);
+                        CNNNetworkSerializer serializer(checkpoint, extensionManager);
+                        serializer << clonedNetwork;
+                    }
+                    std::rename(tmpPath.c_str(), path.c_str());
+                } catch (const InferenceEngine::Exception&) {
+                    // failing to store a checkpoint (e.g. a full disk) must not fail the compilation
+                    std::remove(tmpPath.c_str());
+                }
+            },
+            completedStage);
+    }
     transformations.UpToCpuSpecificOpSet();
 
     // need to check that all outputs have static shapes
@@ -444,7 +576,25 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, _numaNodesWeights, shared_from_this());
+    if (!sharingKey.empty()) {
+        // two identical concurrent compilations may both get here; the later one wins the slot
+        // and the earlier network simply stays unshared
+        std::lock_guard<std::mutex> lock{_sharedNetworksMutex};
+        _sharedNetworks[sharingKey] = execNetwork;
+    }
+
+    // the compilation got past every checkpointed stage, so the snapshots are no longer needed
+    if (enableCheckpointing) {
+        for (auto stage : {Transformations::CheckpointStage::PreLpt,
+                           Transformations::CheckpointStage::Lpt,
+                           Transformations::CheckpointStage::PostLpt,
+                           Transformations::CheckpointStage::Snippets}) {
+            std::remove(compilationCheckpointPath(checkpointDir, checkpointKey, stage).c_str());
+        }
+    }
+
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -498,8 +648,8 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         const bool perfCount = engConfig.collectPerfCounters;
         return decltype(ov::enable_profiling)::value_type(perfCount);
     } else if (name == ov::hint::inference_precision) {
-        const auto enforceBF16 = engConfig.enforceBF16;
-        const auto inference_precision = enforceBF16 ? ov::element::bf16 : ov::element::f32;
+        const auto inference_precision = engConfig.enforceFP16 ? ov::element::f16
+            : engConfig.enforceBF16 ? ov::element::bf16 : ov::element::f32;
         return decltype(ov::hint::inference_precision)::value_type(inference_precision);
     } else if (name == ov::hint::performance_mode) {
         const auto perfHint = ov::util::from_string(engConfig.perfHintsConfig.ovPerfHint, ov::hint::performance_mode);
@@ -507,6 +657,9 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = engConfig.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::hint::scheduling_core_type) {
+        const auto coreType = engConfig.schedulingCoreType;
+        return coreType;
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -529,8 +682,7 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, deviceFullName);
     } else if (name == METRIC_KEY(AVAILABLE_DEVICES)) {
-        std::vector<std::string> availableDevices = { "" };
-        IE_SET_METRIC_RETURN(AVAILABLE_DEVICES, availableDevices);
+        IE_SET_METRIC_RETURN(AVAILABLE_DEVICES, getAvailableCpuDevices());
     } else if (name == METRIC_KEY(OPTIMIZATION_CAPABILITIES)) {
         std::vector<std::string> capabilities;
         if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_bf16))
@@ -588,6 +740,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::enable_profiling.name()),
                                                     RW_property(ov::hint::inference_precision.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
+                                                    RW_property(ov::hint::scheduling_core_type.name()),
                                                     RW_property(ov::hint::num_requests.name()),
         };
 
@@ -600,8 +753,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == ov::device::full_name) {
         return decltype(ov::device::full_name)::value_type(deviceFullName);
     } else if (name == ov::available_devices) {
-        const std::vector<std::string> availableDevices = { "" };
-        return decltype(ov::available_devices)::value_type(availableDevices);
+        return decltype(ov::available_devices)::value_type(getAvailableCpuDevices());
     } else if (name == ov::device::capabilities) {
         std::vector<std::string> capabilities;
         if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_bf16))
@@ -717,7 +869,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, _numaNodesWeights, shared_from_this());
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -9,7 +9,9 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <functional>
+#include <unordered_map>
 
 namespace ov {
 namespace intel_cpu {
@@ -61,6 +63,14 @@ private:
 
     Config engConfig;
     ExtensionManager::Ptr extensionManager = std::make_shared<ExtensionManager>();
+    /* Weights cache (one per NUMA node) shared by all executable networks of the plugin, so
+       loading the same model several times costs one set of packed weights */
+    NumaNodesWeights _numaNodesWeights;
+    /* Executable networks handed out to repeated compilations of an identical model with
+       identical options when cross-model sharing is enabled, keyed by the model hash plus the
+       options (weak records: a network lives only as long as its last user) */
+    std::mutex _sharedNetworksMutex;
+    std::unordered_map<std::string, std::weak_ptr<ExecNetwork>> _sharedNetworks;
     /* Explicily configured streams have higher priority even than performance hints.
        So track if streams is set explicitly (not auto-configured) */
     bool streamsExplicitlySetForEngine = false;
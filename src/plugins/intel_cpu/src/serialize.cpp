@@ -7,11 +7,27 @@
 
 #include <pugixml.hpp>
 
+#include "ie_system_conf.h"
+
 using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 namespace {
+    // Identifies the ISA the lowered model was produced for. The exported blob contains the model
+    // after the whole transformation pipeline, so it must not be imported on a machine with a
+    // different ISA level: precisions and op set selection depend on it.
+    std::string runtime_isa_fingerprint() {
+        if (InferenceEngine::with_cpu_x86_avx512_core_amx())
+            return "amx";
+        if (InferenceEngine::with_cpu_x86_avx512_core())
+            return "avx512_core";
+        if (InferenceEngine::with_cpu_x86_avx2())
+            return "avx2";
+        if (InferenceEngine::with_cpu_x86_sse42())
+            return "sse42";
+        return "generic";
+    }
     std::string to_string(InferenceEngine::Layout layout) {
         std::stringstream ss;
         ss << layout;
@@ -85,6 +101,8 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
         const std::string name = "cnndata";
         pugi::xml_document xml_doc;
         pugi::xml_node root = xml_doc.append_child(name.c_str());
+        pugi::xml_node runtime = root.append_child("runtime");
+        runtime.append_attribute("isa").set_value(runtime_isa_fingerprint().c_str());
         pugi::xml_node inputs = root.append_child("inputs");
         pugi::xml_node outputs = root.append_child("outputs");
 
@@ -143,6 +161,18 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
         IE_THROW(NetworkNotRead) << "The inputs and outputs information is invalid.";
     }
 
+    // The blob stores the model after the whole transformation pipeline, so on import the pipeline
+    // is skipped entirely. This is only valid when the blob was produced on a compatible machine:
+    // reject blobs packed for a different ISA so the core falls back to full compilation.
+    {
+        const auto runtime = xmlInOutDoc.child("cnndata").child("runtime");
+        const std::string blob_isa = runtime.attribute("isa").as_string();
+        if (blob_isa != runtime_isa_fingerprint()) {
+            IE_THROW(NetworkNotRead) << "The compiled blob was produced for a different CPU ISA ('" << blob_isa
+                                     << "' vs '" << runtime_isa_fingerprint() << "') and cannot be imported.";
+        }
+    }
+
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
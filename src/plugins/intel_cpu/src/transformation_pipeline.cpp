@@ -157,15 +157,31 @@ void Transformations::UpToCpuSpecificOpSet() {
         }
     }
 
-    PreLpt(defaultPrecisions, isLegacyApi);
+    // Stages already reflected in a model restored from a compilation checkpoint are skipped,
+    // each of the remaining ones stores a fresh snapshot once it completes (see SetCheckpointing)
+    if (completedStage < CheckpointStage::PreLpt) {
+        PreLpt(defaultPrecisions, isLegacyApi);
+        if (storeCheckpoint)
+            storeCheckpoint(CheckpointStage::PreLpt);
+    }
 
-    if (useLpt)
+    if (useLpt && completedStage < CheckpointStage::Lpt) {
         Lpt(hasINT16orINT32Levels, defaultPrecisions);
+        if (storeCheckpoint)
+            storeCheckpoint(CheckpointStage::Lpt);
+    }
 
-    PostLpt();
+    if (completedStage < CheckpointStage::PostLpt) {
+        PostLpt();
+        if (storeCheckpoint)
+            storeCheckpoint(CheckpointStage::PostLpt);
+    }
 
-    if (useSnippets)
+    if (useSnippets && completedStage < CheckpointStage::Snippets) {
         Snippets();
+        if (storeCheckpoint)
+            storeCheckpoint(CheckpointStage::Snippets);
+    }
 }
 
 void Transformations::CpuSpecificOpSet(void) {
@@ -10,6 +10,7 @@
 
 #include "itt.h"
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -35,11 +36,32 @@ public:
           isLegacyApi(isLegacyApi),
           config(config) {}
 
+    // Pipeline stages after which a resumable snapshot of the intermediate model may be stored,
+    // ordered the way they run inside UpToCpuSpecificOpSet. A model restored from the snapshot of
+    // a stage already reflects that stage and all preceding ones.
+    enum class CheckpointStage {
+        None = 0,
+        PreLpt,
+        Lpt,
+        PostLpt,
+        Snippets,
+    };
+
+    // Enables pipeline checkpointing: storeCheckpoint is invoked after each completed stage with
+    // the model in its current state, completedStage tells the pipeline which stages are already
+    // reflected in the model (because it was restored from a checkpoint) and must be skipped.
+    void SetCheckpointing(std::function<void(CheckpointStage)> storeCheckpoint, CheckpointStage completedStage) {
+        this->storeCheckpoint = std::move(storeCheckpoint);
+        this->completedStage = completedStage;
+    }
+
     void UpToCpuSpecificOpSet();
     void CpuSpecificOpSet(void);
 
 private:
     std::shared_ptr<ov::Model> model;
+    std::function<void(CheckpointStage)> storeCheckpoint;
+    CheckpointStage completedStage = CheckpointStage::None;
     const bool    enableLpt;
     const bool    enableSnippets;
     const bool    enableBF16;
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "execution_trace.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// Small stable per-thread ids make the trace rows readable, unlike the OS thread ids
+int threadTraceId() {
+    static std::atomic<int> nextId{0};
+    static thread_local int id = nextId++;
+    return id;
+}
+
+std::string escapeJson(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (const char c : str) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        if (static_cast<unsigned char>(c) < 0x20)
+            continue;
+        result += c;
+    }
+    return result;
+}
+
+}   // namespace
+
+ExecutionTrace& ExecutionTrace::get() {
+    static ExecutionTrace instance;
+    return instance;
+}
+
+ExecutionTrace::~ExecutionTrace() {
+    flush();
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_file.is_open())
+        _file << "]\n";
+}
+
+void ExecutionTrace::enable(const std::string& path) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_enabled.load(std::memory_order_relaxed))
+        return;
+    _path = path;
+    _origin = std::chrono::high_resolution_clock::now();
+    _enabled.store(true, std::memory_order_relaxed);
+}
+
+void ExecutionTrace::record(const std::string& name,
+                            const std::string& category,
+                            std::chrono::high_resolution_clock::time_point begin,
+                            std::chrono::high_resolution_clock::time_point end) {
+    Event event;
+    event.name = name;
+    event.category = category;
+    event.ts = std::chrono::duration_cast<std::chrono::microseconds>(begin - _origin).count();
+    event.dur = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+    event.tid = threadTraceId();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _events.push_back(std::move(event));
+}
+
+void ExecutionTrace::flush() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_events.empty())
+        return;
+    if (!_file.is_open()) {
+        _file.open(_path, std::ios::out | std::ios::trunc);
+        if (!_file.is_open()) {
+            _events.clear();
+            return;
+        }
+        _file << "[\n";
+    }
+    for (const auto& event : _events) {
+        _file << "{\"ph\":\"X\",\"pid\":0,\"tid\":" << event.tid << ",\"ts\":" << event.ts
+              << ",\"dur\":" << event.dur << ",\"cat\":\"" << escapeJson(event.category)
+              << "\",\"name\":\"" << escapeJson(event.name) << "\"},\n";
+    }
+    _events.clear();
+    _file.flush();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Process wide collector of per node execution timelines.
+ *
+ * Every node execution is recorded as a complete event in the Chrome trace event format
+ * (loadable into chrome://tracing or Perfetto), with one trace row per stream thread, so
+ * the timelines of concurrently running infer requests end up interleaved in a single file
+ * and interference between streams becomes directly visible. The events of a request are
+ * appended to the file when the request finishes; the trailing bracket of the JSON array
+ * is optional in the format, so the file stays loadable even when the process dies.
+ *
+ * The collector is a singleton because the merged timeline is only useful when all graphs
+ * of the process write into the same file. When disabled the only cost on the execution
+ * path is a relaxed atomic load.
+ */
+class ExecutionTrace {
+public:
+    static ExecutionTrace& get();
+
+    ExecutionTrace(const ExecutionTrace&) = delete;
+    ExecutionTrace& operator=(const ExecutionTrace&) = delete;
+    ~ExecutionTrace();
+
+    // The first call fixes the trace file path and the timeline origin; subsequent calls
+    // with a different path are ignored to keep the timeline consistent.
+    void enable(const std::string& path);
+
+    bool enabled() const noexcept {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void record(const std::string& name,
+                const std::string& category,
+                std::chrono::high_resolution_clock::time_point begin,
+                std::chrono::high_resolution_clock::time_point end);
+
+    // Appends everything recorded so far to the trace file; called once per infer request.
+    void flush();
+
+private:
+    ExecutionTrace() = default;
+
+    struct Event {
+        std::string name;
+        std::string category;
+        uint64_t ts;   // microseconds since the timeline origin
+        uint64_t dur;  // microseconds
+        int tid;
+    };
+
+    std::atomic<bool> _enabled{false};
+    std::mutex _mutex;
+    std::string _path;
+    std::ofstream _file;
+    std::vector<Event> _events;
+    std::chrono::high_resolution_clock::time_point _origin;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -47,6 +47,7 @@
 #include "gru_cell_shape_inference.hpp"
 #include "interpolate_shape_inference.hpp"
 #include "lstm_cell_shape_inference.hpp"
+#include "lstm_sequence_shape_inference.hpp"
 #include "matmul_shape_inference.hpp"
 #include "one_hot_shape_inference.hpp"
 #include "pad_shape_inference.hpp"
@@ -57,6 +58,8 @@
 #include "region_yolo_shape_inference.hpp"
 #include "reorg_yolo_shape_inference.hpp"
 #include "reverse_sequence_shape_inference.hpp"
+#include "rnn_cell_shape_inference.hpp"
+#include "rnn_sequence_shape_inference.hpp"
 #include "roi_align_shape_inference.hpp"
 #include "roll_shape_inference.hpp"
 #include "scatter_elements_update_shape_inference.hpp"
@@ -479,6 +482,8 @@ std::shared_ptr<IShapeInferCommon> make_shape_inference(const std::shared_ptr<ng
         return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::opset6::LSTMCell>(op)) {
         return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset5::LSTMSequence>(op)) {
+        return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::opset3::ReadValue>(op)) {
         return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::opset6::ReadValue>(op)) {
@@ -511,6 +516,10 @@ std::shared_ptr<IShapeInferCommon> make_shape_inference(const std::shared_ptr<ng
         return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::op::internal::AUGRUCell>(op)) {
         return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset5::RNNSequence>(op)) {
+        return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset1::RNNCell>(op)) {
+        return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::opset1::OneHot>(op)) {
         return make_shared_entryIOC(node);
     } else if (auto node = ov::as_type_ptr<ov::opset4::CTCLoss>(op)) {
@@ -5,13 +5,128 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+
+#    include <chrono>
+#    include <thread>
+#endif
+
 namespace ov {
 namespace intel_cpu {
 
 const SimpleDataHash WeightsSharing::simpleCRC;
 
+#if defined(__linux__)
+namespace {
+// The segment layout is a fixed header followed by the packed buffer at a cache line
+// aligned offset. ftruncate() zero-fills the file, so a reader which races with the
+// publisher observes state == 0 until the payload is completely copied.
+struct ShmWeightsHeader {
+    uint64_t magic;
+    uint64_t keyHash;
+    uint64_t byteSize;
+    uint64_t state;  // 0 - being filled, 1 - ready
+};
+constexpr uint64_t shmWeightsMagic = 0x4f56435055574d45;  // "OVCPUWME"
+constexpr size_t shmWeightsDataOffset = 64;
+}  // namespace
+
+MemoryPtr WeightsSharing::tryMapCrossProcess(const std::string& key, const MemoryPtr& packed) {
+    if (!packed || packed->GetSize() == 0 || packed->GetData() == nullptr)
+        return packed;
+
+    const uint64_t keyHash = simpleCRC.hash(reinterpret_cast<const unsigned char*>(key.data()), key.size());
+    char path[64];
+    snprintf(path, sizeof(path), "/dev/shm/ov_cpu_weights_%016llx", static_cast<unsigned long long>(keyHash));
+
+    const size_t byteSize = packed->GetSize();
+    const size_t totalSize = shmWeightsDataOffset + byteSize;
+
+    int fd = ::open(path, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+        // this process publishes the segment
+        void* mapping = MAP_FAILED;
+        if (0 == ::ftruncate(fd, totalSize))
+            mapping = ::mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            ::unlink(path);
+            return packed;
+        }
+        auto* header = reinterpret_cast<ShmWeightsHeader*>(mapping);
+        header->keyHash = keyHash;
+        header->byteSize = byteSize;
+        header->magic = shmWeightsMagic;
+        memcpy(static_cast<uint8_t*>(mapping) + shmWeightsDataOffset, packed->GetData(), byteSize);
+        reinterpret_cast<std::atomic<uint64_t>*>(&header->state)->store(1, std::memory_order_release);
+
+        auto shmMem = std::make_shared<Memory>(packed->getEngine());
+        shmMem->Create(packed->getDescPtr(), static_cast<uint8_t*>(mapping) + shmWeightsDataOffset, false);
+        shmMappings.emplace_back(mapping, [totalSize](void* p) {
+            ::munmap(p, totalSize);
+        });
+        return shmMem;
+    }
+    if (errno != EEXIST)
+        return packed;
+
+    // the segment exists, adopt it read-only; any inconsistency falls back to the private copy
+    fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+        return packed;
+
+    // The publisher only has to ftruncate() and memcpy() the payload, so the wait is bounded by
+    // the expected copy time (a fixed grace plus ~1ms per MB) rather than a generous constant:
+    // this poll runs under the weights cache lock of the calling process, so a segment abandoned
+    // by a publisher which died before releasing state would otherwise stall every reader of the
+    // whole cache. On timeout the segment is also unlinked, so the cost is paid once and the next
+    // compilation republishes the weights instead of finding the same dead segment (an alive but
+    // slow publisher keeps its mapping after the unlink and merely loses the sharing).
+    ShmWeightsHeader header;
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(100 + byteSize / (1024 * 1024));
+    for (;;) {
+        if (::pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) && header.state == 1)
+            break;
+        if (std::chrono::steady_clock::now() > deadline) {
+            ::unlink(path);
+            ::close(fd);
+            return packed;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (header.magic != shmWeightsMagic || header.keyHash != keyHash || header.byteSize != byteSize) {
+        // a stale or colliding segment left by a different model revision
+        ::close(fd);
+        return packed;
+    }
+    void* mapping = ::mmap(nullptr, totalSize, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+        return packed;
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    auto shmMem = std::make_shared<Memory>(packed->getEngine());
+    shmMem->Create(packed->getDescPtr(), static_cast<const uint8_t*>(mapping) + shmWeightsDataOffset, false);
+    shmMappings.emplace_back(mapping, [totalSize](void* p) {
+        ::munmap(p, totalSize);
+    });
+    return shmMem;
+}
+#else
+MemoryPtr WeightsSharing::tryMapCrossProcess(const std::string& key, const MemoryPtr& packed) {
+    return packed;
+}
+#endif  // defined(__linux__)
+
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MemoryInfo::Ptr & memory,
@@ -46,6 +161,10 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+            // only immutable entries may be published across processes; callers which pass
+            // valid == false fill the memory after the fact and must stay private
+            if (crossProcessSharing && valid)
+                newPtr = tryMapCrossProcess(key, newPtr);
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -76,6 +195,11 @@ NumaNodesWeights::NumaNodesWeights() {
         _cache_map[numa_id] = std::make_shared<WeightsSharing>();
 }
 
+void NumaNodesWeights::enableCrossProcessSharing() {
+    for (auto& cache : _cache_map)
+        cache.second->enableCrossProcessSharing();
+}
+
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
     auto found = _cache_map.find(numa_id);
     if (found == _cache_map.end())
@@ -13,6 +13,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -94,11 +95,24 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief Enables publishing/adopting packed constant buffers via named shared memory
+     * segments, so identical worker processes on one host map a single copy of the weights
+     * (see CPU_CONFIG_KEY(WEIGHTS_SHM_SHARING)). Takes effect for subsequently created entries.
+     */
+    void enableCrossProcessSharing() { crossProcessSharing = true; }
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    MemoryPtr tryMapCrossProcess(const std::string& key, const MemoryPtr& packed);
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    // mappings adopted from other processes or published by this one; kept for the process
+    // lifetime like the weights they back
+    std::vector<std::shared_ptr<void>> shmMappings;
+    bool crossProcessSharing = false;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -114,6 +128,9 @@ public:
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    /// Enables cross-process weights sharing on the caches of all NUMA nodes
+    void enableCrossProcessSharing();
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
@@ -0,0 +1,139 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_prefetch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+WeightsPrefetcher::WeightsPrefetcher(std::vector<std::vector<Region>> nodeRegions, size_t budget)
+    : m_nodeRegions(std::move(nodeRegions)),
+      m_budget(budget) {
+#if defined(__linux__)
+    m_thread = std::thread([this] { run(); });
+#endif
+}
+
+WeightsPrefetcher::~WeightsPrefetcher() {
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_one();
+        m_thread.join();
+    }
+}
+
+void WeightsPrefetcher::startPass() {
+    if (!m_thread.joinable())
+        return;
+    m_progress.store(0, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_generation++;
+    }
+    m_cv.notify_one();
+}
+
+void WeightsPrefetcher::run() {
+    uint64_t consumed = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_cv.wait(lock, [&] {
+            return m_stop || m_generation != consumed;
+        });
+        if (m_stop)
+            return;
+        consumed = m_generation;
+        lock.unlock();
+        pass(consumed);
+        lock.lock();
+    }
+}
+
+void WeightsPrefetcher::pass(uint64_t generation) {
+#if defined(__linux__)
+    const size_t nodeCount = m_nodeRegions.size();
+    auto nodeBytes = [&](size_t index) {
+        size_t bytes = 0;
+        for (const auto& region : m_nodeRegions[index])
+            bytes += region.size;
+        return bytes;
+    };
+
+    size_t prefetched = 0;  // next execution index to advise in
+    size_t released = 0;    // next execution index to advise out
+    size_t residentBytes = 0;
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stop || m_generation != generation)
+                return;  // a new pass started, the fresh walk takes over
+        }
+        const size_t current = m_progress.load(std::memory_order_relaxed);
+
+        // the nodes behind the executing thread are done with their weights
+        while (released < current && released < nodeCount) {
+#ifdef MADV_COLD
+            advise(m_nodeRegions[released], MADV_COLD);
+#endif
+            residentBytes -= std::min(residentBytes, nodeBytes(released));
+            released++;
+        }
+        if (current >= nodeCount)
+            return;  // the pass is over, the resident window is released above
+
+        if (prefetched < current)
+            prefetched = current;  // execution overtook the walk, catch up
+
+        bool advanced = false;
+        while (prefetched < nodeCount) {
+            const size_t bytes = nodeBytes(prefetched);
+            // the node about to execute is always advised in, however large; further nodes only
+            // while the window fits the budget
+            if (prefetched > current && residentBytes + bytes > m_budget)
+                break;
+            advise(m_nodeRegions[prefetched], MADV_WILLNEED);
+            residentBytes += bytes;
+            prefetched++;
+            advanced = true;
+        }
+        if (!advanced) {
+            // the window is full, follow the executing thread
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+#else
+    (void)generation;
+#endif  // defined(__linux__)
+}
+
+void WeightsPrefetcher::advise(const std::vector<Region>& regions, int advice) const {
+#if defined(__linux__)
+    static const uintptr_t pageMask = ~static_cast<uintptr_t>(sysconf(_SC_PAGESIZE) - 1);
+    for (const auto& region : regions) {
+        const auto begin = reinterpret_cast<uintptr_t>(region.ptr) & pageMask;
+        const auto end = (reinterpret_cast<uintptr_t>(region.ptr) + region.size + ~pageMask) & pageMask;
+        // purely advisory: an unsupported advice or a region the kernel refuses to handle only
+        // costs the overlap with the compute
+        madvise(reinterpret_cast<void*>(begin), end - begin, advice);
+    }
+#else
+    (void)regions;
+    (void)advice;
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
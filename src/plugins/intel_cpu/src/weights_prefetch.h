@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Streams the constant weights of a graph through a bounded resident working set.
+ *
+ * A model whose mmap-backed weights exceed the physical memory of the machine cannot keep them
+ * all resident, so by default every inference faults the weights in on first touch, stalling the
+ * compute inside the page fault handler. The prefetcher runs one background thread per graph
+ * copy which walks the execution order ahead of the executing stream thread: the regions of the
+ * upcoming nodes are advised in (madvise(MADV_WILLNEED)) up to the configured byte budget, and
+ * the regions of the already executed nodes are advised out (madvise(MADV_COLD)), so the kernel
+ * keeps roughly one working set of weights resident while the faults overlap with the compute of
+ * the preceding nodes. All the advice is best effort: a failed or unsupported madvise() only
+ * loses the overlap, never correctness. On platforms without madvise() the prefetcher degrades
+ * to a no-op. See CPU_CONFIG_KEY(WEIGHTS_STREAMING_BUDGET).
+ */
+class WeightsPrefetcher {
+public:
+    struct Region {
+        const void* ptr;
+        size_t size;
+    };
+
+    WeightsPrefetcher(std::vector<std::vector<Region>> nodeRegions, size_t budget);
+    ~WeightsPrefetcher();
+
+    WeightsPrefetcher(const WeightsPrefetcher&) = delete;
+    WeightsPrefetcher& operator=(const WeightsPrefetcher&) = delete;
+
+    // Called on the stream thread when an inference over the graph starts; restarts the walk
+    void startPass();
+    // Called on the stream thread right before the node with the given execution index runs
+    void advance(size_t execIndex) {
+        m_progress.store(execIndex, std::memory_order_relaxed);
+    }
+    // Called on the stream thread when the inference is over; releases the resident window
+    void endPass() {
+        m_progress.store(m_nodeRegions.size(), std::memory_order_relaxed);
+    }
+
+private:
+    void run();
+    void pass(uint64_t generation);
+    void advise(const std::vector<Region>& regions, int advice) const;
+
+    const std::vector<std::vector<Region>> m_nodeRegions;
+    const size_t m_budget;
+
+    std::atomic<size_t> m_progress{0};
+    uint64_t m_generation = 0;
+    bool m_stop = false;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::thread m_thread;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
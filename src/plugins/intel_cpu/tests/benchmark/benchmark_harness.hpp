@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Lightweight timing harness for node executor microbenchmarks.
+//
+// The benchmarks are built as a separate gtest binary (ov_cpu_benchmarks) so that a
+// single kernel can be measured outside a full model run and regression-tracked across
+// releases. Each case reports a single parseable line per measurement:
+//
+//     [ BENCH    ] <name>: median <t> us, min <t> us (<n> iterations)
+//
+// The ISA level is controlled the same way as for the plugin itself, via the
+// ONEDNN_MAX_CPU_ISA environment variable, so the same binary can be used to compare
+// e.g. AVX2 vs AVX-512 codepaths on one machine.
+
+namespace cpu_bench {
+
+struct Timings {
+    double medianUs = 0.0;
+    double minUs = 0.0;
+    size_t iterations = 0;
+};
+
+// Runs `fn` repeatedly until ~`budgetMs` of wall time is consumed (bounded by
+// `maxIterations`) after `warmupIterations` untimed runs, and returns per-iteration
+// statistics. The median is reported as the primary metric since it is robust to
+// occasional scheduling noise.
+template <typename F>
+Timings measure(F&& fn,
+                const size_t warmupIterations = 5,
+                const size_t maxIterations = 1000,
+                const double budgetMs = 200.0) {
+    using clock = std::chrono::steady_clock;
+
+    for (size_t i = 0; i < warmupIterations; ++i)
+        fn();
+
+    std::vector<double> samplesUs;
+    samplesUs.reserve(maxIterations);
+    const auto budgetStart = clock::now();
+    while (samplesUs.size() < maxIterations) {
+        const auto start = clock::now();
+        fn();
+        const auto stop = clock::now();
+        samplesUs.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+        if (std::chrono::duration<double, std::milli>(stop - budgetStart).count() >= budgetMs)
+            break;
+    }
+
+    Timings timings;
+    timings.iterations = samplesUs.size();
+    std::sort(samplesUs.begin(), samplesUs.end());
+    timings.minUs = samplesUs.front();
+    timings.medianUs = samplesUs[samplesUs.size() / 2];
+    return timings;
+}
+
+inline void report(const std::string& name, const Timings& timings) {
+    std::cout << "[ BENCH    ] " << name << ": median " << timings.medianUs << " us, min " << timings.minUs
+              << " us (" << timings.iterations << " iterations)" << std::endl;
+}
+
+}  // namespace cpu_bench
@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+#include <ie_common.h>
+#include <edge.h>
+#include <node.h>
+#include <nodes/reorder.h>
+
+#include <dnnl.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../benchmark_harness.hpp"
+#include "cache/multi_cache.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/input.h"
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+namespace ReorderCPUBench {
+
+struct ReorderBenchParamSet {
+    // logical dimensions of the tensor
+    std::vector<size_t> dims;
+    // physical orders of src and dst, e.g. {0, 2, 3, 1} for nspc
+    std::vector<size_t> srcOrder;
+    std::vector<size_t> dstOrder;
+    InferenceEngine::Precision prec;
+};
+
+// Builds a standalone Input -> Reorder -> Output graph, the same way the reorder unit
+// tests do, so that a single Reorder executor can be timed in isolation.
+class ReorderBenchTest : public ::testing::Test, public ::testing::WithParamInterface<ReorderBenchParamSet> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ReorderBenchParamSet>& obj) {
+        ReorderBenchParamSet p = obj.param;
+        std::ostringstream result;
+        result << "IS:(";
+        for (size_t i = 0; i < p.dims.size(); ++i)
+            result << (i == 0 ? "" : ".") << p.dims[i];
+        result << ")_SrcOrder:" << orderName(p.srcOrder);
+        result << "_DstOrder:" << orderName(p.dstOrder);
+        result << "_DataType:" << p.prec.name();
+        return result.str();
+    }
+
+    void Run() {
+        const auto& p = GetParam();
+        buildReorderGraph(makeDesc(p.dims, p.srcOrder, p.prec), makeDesc(p.dims, p.dstOrder, p.prec));
+        reorderNode->createPrimitive();
+
+        const auto timings = cpu_bench::measure([&] {
+            reorderNode->execute(stream);
+        });
+        cpu_bench::report("Reorder/" + getTestCaseName({GetParam(), 0}), timings);
+    }
+
+protected:
+    static std::string orderName(const std::vector<size_t>& order) {
+        if (order == std::vector<size_t>{0, 2, 3, 1})
+            return "nspc";
+        if (order == std::vector<size_t>{0, 1, 2, 3})
+            return "ncsp";
+        return "custom";
+    }
+
+    static CpuBlockedMemoryDesc makeDesc(const std::vector<size_t>& dims,
+                                         const std::vector<size_t>& order,
+                                         const InferenceEngine::Precision& prec) {
+        std::vector<size_t> blockedDims;
+        blockedDims.reserve(order.size());
+        for (auto i : order)
+            blockedDims.push_back(dims[i]);
+        std::vector<size_t> strides(blockedDims.size());
+        strides[blockedDims.size() - 1] = 1;
+        for (int i = blockedDims.size() - 2; i >= 0; --i)
+            strides[i] = strides[i + 1] * blockedDims[i + 1];
+        const std::vector<size_t> offsetPaddingToData(dims.size(), 0);
+        return CpuBlockedMemoryDesc(prec, Shape(dims), blockedDims, order, 0, offsetPaddingToData, strides);
+    }
+
+    void buildReorderGraph(const CpuBlockedMemoryDesc& inputDesc, const CpuBlockedMemoryDesc& outputDesc) {
+        Config conf;
+        conf.rtCacheCapacity = 100;
+        auto context = std::make_shared<GraphContext>(conf,
+                                                      nullptr,
+                                                      std::make_shared<WeightsSharing>(),
+                                                      std::make_shared<std::mutex>(),
+                                                      false);
+        const dnnl::engine cpuEngine = context->getEngine();
+
+        inputNode = std::make_shared<node::Input>(inputDesc.clone(), "Reorder_Input", "Parameter", context);
+        reorderNode = std::make_shared<node::Reorder>("Reorder", context);
+        outputNode = std::make_shared<node::Input>(outputDesc.clone(), "Reorder_Output", "Result", context);
+
+        parentEdge = std::make_shared<Edge>(inputNode, reorderNode, 0, 0);
+        childEdge = std::make_shared<Edge>(reorderNode, outputNode, 0, 0);
+        parentEdge->changeStatus(Edge::Status::NeedAllocation);
+        childEdge->changeStatus(Edge::Status::NeedAllocation);
+        reorderNode->addEdge(parentEdge);
+        reorderNode->addEdge(childEdge);
+
+        auto parentMemory = std::make_shared<Memory>(cpuEngine);
+        auto childMemory = std::make_shared<Memory>(cpuEngine);
+        parentMemory->Create(inputDesc, nullptr);
+        childMemory->Create(outputDesc, nullptr);
+        memset(parentMemory->GetData(), 0, parentMemory->GetSize());
+        memset(childMemory->GetData(), 0, childMemory->GetSize());
+
+        parentEdge->reuse(parentMemory);
+        childEdge->reuse(childMemory);
+
+        reorderNode->setDescs(inputDesc, outputDesc);
+        std::vector<std::shared_ptr<Node>> nodes{inputNode, reorderNode, outputNode};
+        for (auto& n : nodes) {
+            n->init();
+            n->getSupportedDescriptors();
+            n->initSupportedPrimitiveDescriptors();
+            n->selectPrimitiveDescriptorByIndex(0);
+        }
+        stream = dnnl::stream{cpuEngine};
+    }
+
+    dnnl::stream stream;
+    std::shared_ptr<node::Input> inputNode;
+    std::shared_ptr<node::Reorder> reorderNode;
+    std::shared_ptr<node::Input> outputNode;
+    std::shared_ptr<Edge> parentEdge;
+    std::shared_ptr<Edge> childEdge;
+};
+
+TEST_P(ReorderBenchTest, Bench) {
+    Run();
+}
+
+const std::vector<size_t> nspc{0, 2, 3, 1};
+const std::vector<size_t> ncsp{0, 1, 2, 3};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ReorderBench,
+                         ReorderBenchTest,
+                         ::testing::Values(ReorderBenchParamSet{{1, 32, 224, 224}, nspc, ncsp, Precision::FP32},
+                                           ReorderBenchParamSet{{1, 32, 224, 224}, ncsp, nspc, Precision::FP32},
+                                           ReorderBenchParamSet{{1, 64, 56, 56}, nspc, ncsp, Precision::FP32},
+                                           ReorderBenchParamSet{{1, 32, 224, 224}, nspc, ncsp, Precision::I8},
+                                           ReorderBenchParamSet{{1, 32, 224, 224}, ncsp, nspc, Precision::I8}),
+                         ReorderBenchTest::getTestCaseName);
+
+}  // namespace ReorderCPUBench
@@ -86,8 +86,11 @@ const auto planar_5D_ref = CPUSpecificParams{{ncdhw}, {ncdhw}, {"ref"}, "ref"};
 const auto planar_4D = CPUSpecificParams{{nchw}, {nchw}, {}, "unknown"};
 const auto planar_5D = CPUSpecificParams{{ncdhw}, {ncdhw}, {}, "unknown"};
 
-const auto perChannels_4D = CPUSpecificParams{{nhwc}, {nhwc}, {}, "ref"};
-const auto perChannels_5D = CPUSpecificParams{{ndhwc}, {ndhwc}, {}, "ref"};
+const auto perChannels_4D = CPUSpecificParams{{nhwc}, {nhwc}, {}, "unknown"};
+const auto perChannels_5D = CPUSpecificParams{{ndhwc}, {ndhwc}, {}, "unknown"};
+
+const auto perChannels_4D_ref = CPUSpecificParams{{nhwc}, {nhwc}, {}, "ref"};
+const auto perChannels_5D_ref = CPUSpecificParams{{ndhwc}, {ndhwc}, {}, "ref"};
 
 const auto perChannelsToPlanar_4D = CPUSpecificParams{{nhwc}, {nchw}, {}, "ref"};
 const auto perChannelsToPlanar_5D = CPUSpecificParams{{ndhwc}, {ncdhw}, {}, "ref"};
@@ -216,7 +219,7 @@ INSTANTIATE_TEST_SUITE_P(smoke_VariadicSplit4D_CPU_planar, VariadicSplitLayerCPU
                                 ::testing::Values(2, 3),
                                 ::testing::Values(std::vector<int>{1, 3, -1}),
                                 ::testing::ValuesIn(netPrecisions),
-                                ::testing::Values(planar_4D_ref, perChannels_4D)),
+                                ::testing::Values(planar_4D_ref, perChannels_4D_ref)),
                         VariadicSplitLayerCPUTest::getTestCaseName);
 
 const std::vector<InputShape> inputShapes4D_block = {
@@ -299,7 +302,7 @@ INSTANTIATE_TEST_SUITE_P(smoke_VariadicSplit5D_CPU_planar, VariadicSplitLayerCPU
                                 ::testing::Values(2, 3, 4),
                                 ::testing::Values(std::vector<int>{2, 1, -1}),
                                 ::testing::ValuesIn(netPrecisions),
-                                ::testing::Values(planar_5D_ref, perChannels_5D)),
+                                ::testing::Values(planar_5D_ref, perChannels_5D_ref)),
                         VariadicSplitLayerCPUTest::getTestCaseName);
 
 const std::vector<InputShape> inputShapes5D_block = {
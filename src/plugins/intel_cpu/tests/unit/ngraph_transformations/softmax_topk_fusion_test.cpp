@@ -0,0 +1,152 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph_transformations/softmax_topk_fusion.hpp>
+#include <ngraph_transformations/op/softmax_topk.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+TEST(TransformationTests, SoftmaxTopKFusionTest1) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 21000 });
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(input, 1);
+        auto k = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{}, { 5 });
+        auto topk = std::make_shared<ngraph::opset3::TopK>(softmax, k, 1, ngraph::op::TopKMode::MAX,
+                                                           ngraph::op::TopKSortType::SORT_VALUES);
+
+        f = std::make_shared<ngraph::Function>(topk->outputs(), ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<SoftmaxTopKFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 21000 });
+        auto softmaxTopK = std::make_shared<ov::intel_cpu::SoftmaxTopKNode>(input, 1, 5,
+                                                                            ngraph::op::TopKSortType::SORT_VALUES,
+                                                                            ngraph::element::i32);
+
+        f_ref = std::make_shared<ngraph::Function>(softmaxTopK->outputs(), ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, SoftmaxTopKFusionTest2) {
+    // v8 Softmax with a negative axis is normalized before the comparison with the TopK axis
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 8, 1001 });
+        auto softmax = std::make_shared<ngraph::opset8::Softmax>(input, -1);
+        auto k = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{}, { 3 });
+        auto topk = std::make_shared<ngraph::opset3::TopK>(softmax, k, 1, ngraph::op::TopKMode::MAX,
+                                                           ngraph::op::TopKSortType::SORT_INDICES);
+
+        f = std::make_shared<ngraph::Function>(topk->outputs(), ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<SoftmaxTopKFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 8, 1001 });
+        auto softmaxTopK = std::make_shared<ov::intel_cpu::SoftmaxTopKNode>(input, 1, 3,
+                                                                            ngraph::op::TopKSortType::SORT_INDICES,
+                                                                            ngraph::element::i32);
+
+        f_ref = std::make_shared<ngraph::Function>(softmaxTopK->outputs(), ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, SoftmaxTopKFusionTest3) {
+    // the min mode selects the smallest probabilities, which are not the smallest logits' exps
+    // after normalization ordering-wise only max is equivalent, so no fusion
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 21000 });
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(input, 1);
+        auto k = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{}, { 5 });
+        auto topk = std::make_shared<ngraph::opset3::TopK>(softmax, k, 1, ngraph::op::TopKMode::MIN,
+                                                           ngraph::op::TopKSortType::SORT_VALUES);
+
+        f = std::make_shared<ngraph::Function>(topk->outputs(), ngraph::ParameterVector{ input });
+        f_ref = f;
+
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<SoftmaxTopKFusion>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, SoftmaxTopKFusionTest4) {
+    // TopK selects along a different axis than the softmax normalization, so no fusion
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 8, 1001 });
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(input, 1);
+        auto k = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{}, { 5 });
+        auto topk = std::make_shared<ngraph::opset3::TopK>(softmax, k, 0, ngraph::op::TopKMode::MAX,
+                                                           ngraph::op::TopKSortType::SORT_VALUES);
+
+        f = std::make_shared<ngraph::Function>(topk->outputs(), ngraph::ParameterVector{ input });
+        f_ref = f;
+
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<SoftmaxTopKFusion>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, SoftmaxTopKFusionTest5) {
+    // the softmax output has a second consumer, so its full result is still needed
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 21000 });
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(input, 1);
+        auto k = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{}, { 5 });
+        auto topk = std::make_shared<ngraph::opset3::TopK>(softmax, k, 1, ngraph::op::TopKMode::MAX,
+                                                           ngraph::op::TopKSortType::SORT_VALUES);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(softmax);
+
+        f = std::make_shared<ngraph::Function>(ngraph::OutputVector{ topk->output(0), topk->output(1), relu->output(0) },
+                                               ngraph::ParameterVector{ input });
+        f_ref = f;
+
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<SoftmaxTopKFusion>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -317,6 +317,32 @@ TEST(MultiCacheTests, Empty) {
     }
 }
 
+TEST(MultiCacheTests, Statistics) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 3;
+    MultiCache cache(capacity);
+    auto builder = [](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    //fill the cache twice over, so the first keys get evicted
+    for (int i = 0; i < 2 * capacity; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, builder);
+        ASSERT_NE(result.first, ValueType());
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+    //the last capacity keys are still cached
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, builder);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.records, capacity);
+    ASSERT_EQ(stats.evictions, capacity);
+    ASSERT_EQ(stats.hits, capacity);
+    ASSERT_EQ(stats.misses, 2 * capacity);
+}
+
 namespace {
 class ScopedThread {
 public:
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/ops.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeInferenceTest, RNNCellTest_default_bias) {
+    constexpr size_t batch_size = 2;
+    constexpr size_t input_size = 3;
+    constexpr size_t hidden_size = 5;
+
+    const auto X = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    const auto H_t = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    const auto W = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    const auto R = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+
+    const auto rnn_cell = std::make_shared<op::v0::RNNCell>(X, H_t, W, R, hidden_size);
+
+    std::vector<StaticShape> static_input_shapes{StaticShape{batch_size, input_size},   // X
+                                                 StaticShape{batch_size, hidden_size},  // H_t
+                                                 StaticShape{hidden_size, input_size},  // W
+                                                 StaticShape{hidden_size, hidden_size},  // R
+                                                 StaticShape{hidden_size}};             // B
+
+    std::vector<StaticShape> static_output_shapes{StaticShape{}};
+
+    shape_inference(rnn_cell.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({batch_size, hidden_size}));
+}
+
+TEST(StaticShapeInferenceTest, RNNCellTest_with_bias) {
+    constexpr size_t batch_size = 2;
+    constexpr size_t input_size = 3;
+    constexpr size_t hidden_size = 5;
+
+    const auto X = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    const auto H_t = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    const auto W = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    const auto R = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    const auto B = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(1));
+
+    const auto rnn_cell = std::make_shared<op::v0::RNNCell>(X, H_t, W, R, B, hidden_size);
+
+    std::vector<StaticShape> static_input_shapes{StaticShape{batch_size, input_size},   // X
+                                                 StaticShape{batch_size, hidden_size},  // H_t
+                                                 StaticShape{hidden_size, input_size},  // W
+                                                 StaticShape{hidden_size, hidden_size},  // R
+                                                 StaticShape{hidden_size}};             // B
+
+    std::vector<StaticShape> static_output_shapes{StaticShape{}};
+
+    shape_inference(rnn_cell.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({batch_size, hidden_size}));
+}
@@ -172,6 +172,16 @@ header_latest::ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
                     readNBytes(&header, sizeof(header_latest::ModelHeader), is);
                     break;
                 default:
+                    if (header.version.minor > header_latest::ModelHeader().version.minor) {
+                        // Minor version bumps only append reserved fields to the header and do not
+                        // change the layout of the known part (that requires a major bump), so a
+                        // blob exported by a newer library is imported with the latest known layout
+                        // and the appended bytes are skipped via the headerSize check below. This
+                        // keeps cached blobs valid across minor library updates instead of forcing
+                        // a full recompilation of the fleet.
+                        readNBytes(&header, sizeof(header_latest::ModelHeader), is);
+                        break;
+                    }
                     THROW_GNA_EXCEPTION << "Imported file unsupported. minor version should have values in range 1 to 8 and is: " << header.version.minor;
             }
             break;
@@ -220,6 +230,13 @@ header_latest::RuntimeEndPoint GNAModelSerial::ReadEndPoint(std::istream &is) {
                     readNBytes(&endPoint, sizeof(header_latest::RuntimeEndPoint), is);
                     break;
                 default:
+                    if (model_header_.version.minor > header_latest::ModelHeader().version.minor) {
+                        // The end point layout is frozen within a major version (see the header
+                        // version contract in ReadHeader), so blobs of newer minor versions are
+                        // read with the latest known layout
+                        readNBytes(&endPoint, sizeof(header_latest::RuntimeEndPoint), is);
+                        break;
+                    }
                     THROW_GNA_EXCEPTION << "Imported file unsupported. minor version should have values in range 1 to 8 and is: "
                                         << model_header_.version.minor;
             }
@@ -249,8 +249,10 @@ OPENVINO_SUPPRESS_DEPRECATED_START
             } catch (std::out_of_range&) {
                 gnaFlags.num_requests =  (0 == stoul(value)) ? 1 : Config::max_num_requests;
             }
+            numRequestsSetExplicitly = true;
         } else if (key == GNA_CONFIG_KEY(LIB_N_THREADS)) {
             check_compatibility(ov::hint::num_requests.name());
+            numRequestsSetExplicitly = true;
             try {
                 gnaFlags.num_requests = get_max_num_requests();
             } catch (std::out_of_range&) {
@@ -283,6 +285,15 @@ OPENVINO_SUPPRESS_DEPRECATED_END
         inputScaleFactors.push_back(kScaleFactorDefault);
     }
 
+    // The THROUGHPUT hint turns on double buffering: with two request workers the import of the
+    // next frame (quantization and copy into the accelerator visible memory) overlaps with the
+    // scoring of the current one instead of serializing with it. An explicitly configured number
+    // of requests keeps priority, and SW_FP32 stays at one since it does not support async mode.
+    if (performance_mode == ov::hint::PerformanceMode::THROUGHPUT && !numRequestsSetExplicitly &&
+        !gnaFlags.sw_fp32 && gnaFlags.num_requests == 1) {
+        gnaFlags.num_requests = 2;
+    }
+
     AdjustKeyMapValues();
 }
 
@@ -43,6 +43,7 @@ struct Config {
         inputScaleFactorsPerInput = r.inputScaleFactorsPerInput;
         inputScaleFactors = r.inputScaleFactors;
         gnaFlags = r.gnaFlags;
+        numRequestsSetExplicitly = r.numRequestsSetExplicitly;
         std::lock_guard<std::mutex> lock(r.mtx4keyConfigMap);
         keyConfigMap = r.keyConfigMap;
     }
@@ -70,6 +71,8 @@ struct Config {
     std::map<std::string, float> inputScaleFactorsPerInput;
     std::vector<float> inputScaleFactors; // Legacy one, should be removed with old confg API
     GNAFlags gnaFlags;
+    // true when the number of request workers came from an explicit option rather than a hint
+    bool numRequestsSetExplicitly = false;
 
     mutable std::mutex mtx4keyConfigMap;
     std::map<std::string, std::string> keyConfigMap;
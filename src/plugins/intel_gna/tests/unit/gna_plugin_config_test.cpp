@@ -183,6 +183,26 @@ TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsTest) {
     ExpectThrow(GNA_CONFIG_KEY(LIB_N_THREADS), "abc");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigThroughputHintEnablesDoubleBufferingTest) {
+    config.UpdateFromMap({{CONFIG_KEY(PERFORMANCE_HINT), "THROUGHPUT"}});
+    EXPECT_EQ(config.gnaFlags.num_requests, 2);
+}
+
+TEST_F(GNAPluginConfigTest, GnaConfigThroughputHintKeepsExplicitRequestNumberTest) {
+    config.UpdateFromMap({{GNA_CONFIG_KEY(LIB_N_THREADS), "5"},
+                          {CONFIG_KEY(PERFORMANCE_HINT), "THROUGHPUT"}});
+    EXPECT_EQ(config.gnaFlags.num_requests, 5);
+
+    config.UpdateFromMap({{CONFIG_KEY(PERFORMANCE_HINT_NUM_REQUESTS), "1"},
+                          {CONFIG_KEY(PERFORMANCE_HINT), "THROUGHPUT"}});
+    EXPECT_EQ(config.gnaFlags.num_requests, 1);
+}
+
+TEST_F(GNAPluginConfigTest, GnaConfigLatencyHintKeepsSingleRequestTest) {
+    config.UpdateFromMap({{CONFIG_KEY(PERFORMANCE_HINT), "LATENCY"}});
+    EXPECT_EQ(config.gnaFlags.num_requests, 1);
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigSingleThreadTest) {
     SetAndCheckFlag(CONFIG_KEY(SINGLE_THREAD),
                     config.gnaFlags.gna_openmp_multithreading,
@@ -221,6 +221,10 @@ public:
         return *_memory_pool;
     }
 
+    /// Releases pooled allocations which no primitive references anymore once their total size
+    /// exceeds ov::intel_gpu::memory_pool_shrink_threshold; no-op when the threshold is 0.
+    void shrink_memory_pool();
+
     /// Assigns memory state locations
     void assign_variables_memories(variables_states_map &&variables_memories);
 
@@ -98,6 +98,9 @@ public:
     int serialize_compile;                  // Serialize creating primitives and compiling kernels
     std::string forced_impl_type;           // Force implementation type either ocl or onednn
     int max_kernels_per_batch;              // Maximum number of kernels in a batch during compiling kernels
+    int online_tuning;                      // Enable online kernel auto-tuning and persist winners to the model cache directory
+    int ooq_barrier_sync;                   // Use global barriers instead of per-primitive events for out-of-order queue sync
+    int validate_event_coverage;            // Fail on dependencies which are not covered by a synchronization event
     static const debug_configuration *get_instance();
     bool is_dumped_layer(const std::string& layerName, bool is_output = false) const;
 };
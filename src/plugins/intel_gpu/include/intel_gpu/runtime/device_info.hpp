@@ -62,6 +62,7 @@ struct device_info {
     bool supports_intel_required_subgroup_size; ///< Does engine support cl_intel_required_subgroup_size extension.
     bool supports_local_block_io;               ///< Does engine support cl_intel_subgroup_local_block_io extension.
     bool supports_queue_families;               ///< Does engine support cl_intel_command_queue_families extension.
+    bool supports_command_buffers;              ///< Does engine support cl_khr_command_buffer extension.
     bool supports_image;                        ///< Does engine support images (CL_DEVICE_IMAGE_SUPPORT cap).
     bool supports_intel_planar_yuv;             ///< Does engine support cl_intel_planar_yuv extension.
 
@@ -85,6 +86,7 @@ struct device_info {
     uint32_t num_eus_per_sub_slice;             ///< Number of execution units per subslice
     uint32_t num_threads_per_eu;                ///< Number of hardware threads per execution unit
     uint32_t num_ccs;                           ///< Number of compute command streamers
+    uint32_t num_tiles;                         ///< Number of NUMA-partitionable sub-devices (tiles); 1 for single-tile parts
 
     device_uuid uuid;                           ///< UUID of the gpu device
 };
@@ -26,6 +26,7 @@
 namespace cldnn {
 
 class stream;
+class staging_buffer_pool;
 
 using memory_ptr = std::shared_ptr<memory>;
 using stream_ptr = std::shared_ptr<stream>;
@@ -123,6 +124,9 @@ public:
     /// Returns true if USM is enabled in engine config and device/driver supports required features
     bool use_unified_shared_memory() const;
 
+    /// Returns engine-wide pool of host-pinned staging buffers used for user tensor copies
+    staging_buffer_pool& get_staging_pool();
+
     /// Returns the size of the larger of the GPU memory and CPU memory.
     uint64_t get_max_memory_size() const;
 
@@ -169,6 +173,8 @@ protected:
 
     std::map<allocation_type, std::atomic<uint64_t>> _memory_usage_map;
     std::map<allocation_type, std::atomic<uint64_t>> _peak_memory_usage_map;
+
+    std::shared_ptr<staging_buffer_pool> _staging_pool;
 };
 
 }  // namespace cldnn
@@ -68,9 +68,13 @@ public:
     void set_property(const ov::AnyMap& properties);
     void set_user_property(const ov::AnyMap& properties);
     Any get_property(const std::string& name) const;
+    Any get_property(const char* name) const;
     bool is_set_by_user(const std::string& name) const;
     bool is_supported(const std::string& name) const;
-    void register_property_impl(const std::pair<std::string, ov::Any>& propertiy, PropertyVisibility visibility, BaseValidator::Ptr validator);
+    void register_property_impl(const std::pair<std::string, ov::Any>& propertiy,
+                                PropertyVisibility visibility,
+                                BaseValidator::Ptr validator,
+                                const char* key_literal = nullptr);
 
     template <PropertyVisibility visibility, typename... PropertyInitializer, typename std::enable_if<(sizeof...(PropertyInitializer) == 0), bool>::type = true>
     void register_property_impl() { }
@@ -79,7 +83,7 @@ public:
     void register_property_impl(const std::tuple<ov::Property<T, mutability>, ValueT>& property, PropertyInitializer&&... properties) {
         auto p = std::get<0>(property)(std::get<1>(property));
         auto v = std::dynamic_pointer_cast<BaseValidator>(std::make_shared<PropertyTypeValidator<T>>());
-        register_property_impl(std::move(p), visibility, std::move(v));
+        register_property_impl(std::move(p), visibility, std::move(v), std::get<0>(property).name());
         register_property_impl<visibility>(properties...);
     }
 
@@ -93,7 +97,7 @@ public:
     register_property_impl(const std::tuple<ov::Property<T, mutability>, ValueT, ValidatorT>& property, PropertyInitializer&&... properties) {
         auto p = std::get<0>(property)(std::get<1>(property));
         auto v = std::dynamic_pointer_cast<BaseValidator>(std::make_shared<ValidatorT>(std::get<2>(property)));
-        register_property_impl(std::move(p), visibility, std::move(v));
+        register_property_impl(std::move(p), visibility, std::move(v), std::get<0>(property).name());
         register_property_impl<visibility>(properties...);
     }
 
@@ -107,7 +111,7 @@ public:
     register_property_impl(const std::tuple<ov::Property<T, mutability>, ValueT, ValidatorT>& property, PropertyInitializer&&... properties) {
         auto p = std::get<0>(property)(std::get<1>(property));
         auto v = std::dynamic_pointer_cast<BaseValidator>(std::make_shared<FuncValidator>(std::get<2>(property)));
-        register_property_impl(std::move(p), visibility, std::move(v));
+        register_property_impl(std::move(p), visibility, std::move(v), std::get<0>(property).name());
         register_property_impl<visibility>(properties...);
     }
 
@@ -145,13 +149,27 @@ protected:
     void apply_performance_hints(const cldnn::device_info& info);
     void apply_priority_hints(const cldnn::device_info& info);
     void apply_debug_options(const cldnn::device_info& info);
+    void apply_tuning_options(const cldnn::device_info& info);
 
 private:
+    void rebuild_property_cache();
+
     ov::AnyMap internal_properties;
     ov::AnyMap user_properties;
 
     std::map<std::string, PropertyVisibility> supported_properties;
     std::map<std::string, BaseValidator::Ptr> property_validators;
+
+    // ov::Property names are string literals, so the registered pointer itself identifies the key
+    // and reads via the typed get_property() overload can be resolved with pointer compares over a
+    // flat merged view instead of two map traversals with string compares. The cache is rebuilt by
+    // apply_user_properties(); any later mutation drops it and reads fall back to the maps.
+    struct FlatProperty {
+        const char* name;
+        ov::Any value;
+    };
+    std::map<std::string, const char*> property_key_literals;
+    std::vector<FlatProperty> property_cache;
 };
 
 }  // namespace intel_gpu
@@ -42,6 +42,11 @@ inline std::ostream& operator<<(std::ostream& os, const QueueTypes& val) {
 static constexpr Property<QueueTypes, PropertyMutability::RW> queue_type{"GPU_QUEUE_TYPE"};
 
 static constexpr Property<bool, PropertyMutability::RW> enable_memory_pool{"GPU_ENABLE_MEMORY_POOL"};
+/**
+ * @brief Once the unreferenced part of the memory pool exceeds this amount of bytes on an idle request,
+ * those allocations are released back to the driver. 0 (default) keeps the pool growing monotonically.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> memory_pool_shrink_threshold{"GPU_MEMORY_POOL_SHRINK_THRESHOLD"};
 static constexpr Property<bool, PropertyMutability::RW> optimize_data{"GPU_OPTIMIZE_DATA"};
 static constexpr Property<bool, PropertyMutability::RW> allow_static_input_reorder{"GPU_ALLOW_STATIC_INPUT_REORDER"};
 static constexpr Property<bool, PropertyMutability::RW> partial_build_program{"GPU_PARTIAL_BUILD"};
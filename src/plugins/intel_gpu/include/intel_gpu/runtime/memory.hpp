@@ -11,7 +11,10 @@
 
 #include "ngraph/runtime/host_tensor.hpp"
 
+#include <map>
+#include <mutex>
 #include <type_traits>
+#include <vector>
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
 #include <oneapi/dnnl/dnnl.hpp>
@@ -120,6 +123,34 @@ private:
     void* _pointer;
 };
 
+/// Recycling pool of host-pinned (usm_host) staging buffers backing copies between arbitrary
+/// user pointers and device memory. Transfers issued from pinned allocations run as direct DMA,
+/// while copies from plain user pointers go through driver-internal staging with extra
+/// synchronization. Buffers are bucketed into power-of-two size classes and recycled through
+/// per-class freelists.
+class staging_buffer_pool {
+public:
+    explicit staging_buffer_pool(engine& engine) : _engine(engine) {}
+
+    /// Transfers below this size are cheaper to issue directly than to route through an extra
+    /// host copy into a pinned buffer.
+    static constexpr size_t min_staging_size = 64 * 1024;
+
+    /// Returns a pinned buffer of at least @p size bytes, or nullptr when the engine cannot
+    /// allocate host-pinned memory.
+    memory::ptr acquire(size_t size);
+    /// Puts a buffer obtained from acquire() back on its freelist.
+    void release(memory::ptr buffer);
+
+private:
+    // bounds the pinned footprint kept alive by the pool
+    static constexpr size_t max_buffers_per_class = 4;
+
+    engine& _engine;
+    std::mutex _mutex;
+    std::map<size_t, std::vector<memory::ptr>> _free_lists;
+};
+
 template <class T, mem_lock_type lock_type = mem_lock_type::read_write>
 struct mem_lock {
     explicit mem_lock(memory::ptr mem, const stream& stream) : _mem(mem), _stream(stream), _ptr(reinterpret_cast<T*>(_mem->lock(_stream, lock_type))) {}
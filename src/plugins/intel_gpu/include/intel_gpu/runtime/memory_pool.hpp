@@ -125,6 +125,8 @@ public:
     void clear_pool();
     void clear_pool_for_network(uint32_t network_id);
     void release_memory(memory* memory, const primitive_id& id, uint32_t network_id);
+    uint64_t get_unused_pool_size() const;
+    void release_unused_memory();
 };
 
 }  // namespace cldnn
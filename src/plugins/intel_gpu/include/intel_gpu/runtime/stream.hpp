@@ -40,6 +40,16 @@ public:
     virtual event::ptr create_user_event(bool set) = 0;
     virtual event::ptr create_base_event() = 0;
 
+    /// Returns a stream with a queue dedicated to host<->device transfers if the backend
+    /// provides one, or this stream itself otherwise. Copies enqueued to the transfer stream
+    /// can overlap with compute of this stream, so the events they return must be passed to
+    /// enqueue_dependencies() of this stream before any dependent kernel is submitted.
+    virtual stream& get_transfer_stream() { return *this; }
+
+    /// Makes all commands enqueued to this stream after the call wait on the device for the
+    /// given events. In contrast to wait_for_events() the host thread is not blocked.
+    virtual void enqueue_dependencies(const std::vector<event::ptr>& events) { wait_for_events(events); }
+
     QueueTypes get_queue_type() const { return queue_type; }
 
     static QueueTypes detect_queue_type(engine_types engine_type, void* queue_handle);
@@ -389,20 +389,23 @@ void prepare_buffer_fusing::run(program& p) {
                         return;
                     if (input_layout.data_padding.lower_size().batch[0] != 0 || input_layout.data_padding.upper_size().batch[0] != 0 ||
                         input_layout.data_padding.lower_size().spatial[0] != 0 || input_layout.data_padding.upper_size().spatial[0] != 0 ||
-                        input_layout.data_padding.lower_size().spatial[1] != 0 || input_layout.data_padding.upper_size().spatial[1] != 0)
+                        input_layout.data_padding.lower_size().spatial[1] != 0 || input_layout.data_padding.upper_size().spatial[1] != 0 ||
+                        input_layout.data_padding.lower_size().spatial[2] != 0 || input_layout.data_padding.upper_size().spatial[2] != 0)
                         return;
                     // oneDNN doesn't support paddings
                     if (usr->get_preferred_impl_type() == impl_types::onednn)
                         return;
                 }
 
-                if (format == format::bfyx && crop_size.batch[0] == input_layout.batch() &&
+                if ((format == format::bfyx || format == format::bfzyx) && crop_size.batch[0] == input_layout.batch() &&
                     crop_size.spatial[0] == input_layout.spatial(0) &&
-                    crop_size.spatial[1] == input_layout.spatial(1) && out_padd.lower_size().feature[0] == 0 &&
+                    crop_size.spatial[1] == input_layout.spatial(1) &&
+                    crop_size.spatial[2] == input_layout.spatial(2) && out_padd.lower_size().feature[0] == 0 &&
                     out_padd.upper_size().feature[0] == 0 && out_padd.lower_size().batch[0] == 0 &&
                     out_padd.upper_size().batch[0] == 0 && out_padd.lower_size().spatial[0] == 0 &&
-                    out_padd.lower_size().spatial[1] == 0 && out_padd.upper_size().spatial[0] == 0 &&
-                    out_padd.upper_size().spatial[1] == 0) {
+                    out_padd.lower_size().spatial[1] == 0 && out_padd.lower_size().spatial[2] == 0 &&
+                    out_padd.upper_size().spatial[0] == 0 && out_padd.upper_size().spatial[1] == 0 &&
+                    out_padd.upper_size().spatial[2] == 0) {
                     //  Regular crop
                     //  crop input buffer
                     //  |___________data____________|
@@ -421,11 +424,13 @@ void prepare_buffer_fusing::run(program& p) {
                         padding({out_padd.lower_size().batch[0],
                                  opt_lower_pad,
                                  out_padd.lower_size().spatial[0],
-                                 out_padd.lower_size().spatial[1]},
+                                 out_padd.lower_size().spatial[1],
+                                 out_padd.lower_size().spatial[2]},
                                 {out_padd.upper_size().batch[0],
                                  opt_upper_pad,
                                  out_padd.upper_size().spatial[0],
-                                 out_padd.upper_size().spatial[1]}));
+                                 out_padd.upper_size().spatial[1],
+                                 out_padd.upper_size().spatial[2]}));
                     node.can_be_optimized(true);
                 }
             }
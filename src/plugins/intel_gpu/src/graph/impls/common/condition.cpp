@@ -41,10 +41,9 @@ struct condition_impl : typed_primitive_impl<condition> {
             memory_to_copy = execute_branch(instance.get_net_true(), instance.result_id(), instance.input_memory_ptr());
         else
             memory_to_copy = execute_branch(instance.get_net_false(), instance.result_id(), instance.input_memory_ptr());
-        // just copy memory
-        mem_lock<float, mem_lock_type::read> inp_ptr{memory_to_copy, instance.get_network().get_stream()};
-        mem_lock<float, mem_lock_type::write> out_ptr{instance.output_memory_ptr(), instance.get_network().get_stream()};
-        std::copy(inp_ptr.begin(), inp_ptr.end(), out_ptr.begin());
+        // copy the branch result into the output on the device; the previous implementation locked
+        // both buffers and moved the data through the host, which also pinned the primitive to f32
+        instance.output_memory_ptr()->copy_from(instance.get_network().get_stream(), *memory_to_copy, true);
         ev->set();
         return ev;
     }
@@ -56,6 +56,11 @@ struct activation_impl : typed_primitive_impl_ocl<activation> {
 
         return {params, optional_params};
     }
+
+    void update_dispatch_data(const kernel_impl_params& impl_param) override {
+        auto kernel_params = get_kernel_params(impl_param);
+        (_kernel_data.update_dispatch_data_func)(kernel_params.first, _kernel_data);
+    }
 };
 
 namespace detail {
@@ -122,6 +127,18 @@ attach_activation_impl::attach_activation_impl() {
         // fs_b_yx_fsv32
         std::make_tuple(data_types::f16, format::fs_b_yx_fsv32),
     });
+
+    auto dyn_types = {data_types::f32, data_types::f16, data_types::i8, data_types::u8, data_types::i32};
+    auto dyn_formats = {
+        format::bfyx,
+        format::bfzyx,
+    };
+
+    implementation_map<activation>::add(impl_types::ocl,
+                                        shape_types::dynamic_shape,
+                                        typed_primitive_impl_ocl<activation>::create<activation_impl>,
+                                        dyn_types,
+                                        dyn_formats);
 }
 
 }  // namespace detail
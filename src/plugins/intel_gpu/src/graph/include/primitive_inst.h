@@ -205,6 +205,22 @@ public:
     const std::unordered_map<size_t, std::tuple<int64_t, size_t>>& get_profiling_data() const { return _profiling_data; }
     const std::unordered_map<size_t, instrumentation::perf_counter_key>& get_profiling_info() const { return _profiling_info; }
 
+    // per-enqueue device-side timings taken from the event profiling counters; unlike the
+    // host-measured pipeline stages above they stay correct when the queue is deep, since no
+    // synchronization is inserted between the enqueues
+    struct device_profiling_record {
+        size_t hash;             // key of the matching _profiling_info entry
+        int64_t submission_ns;   // host submission to the device
+        int64_t starting_ns;     // waiting in the command queue
+        int64_t executing_ns;    // actual execution on the device
+    };
+    void record_device_profiling_event(const event::ptr& ev);
+    void collect_device_profiling_data();
+    const std::unordered_map<size_t, std::tuple<int64_t, size_t>>& get_device_profiling_data() const {
+        return _device_profiling_data;
+    }
+    const std::vector<device_profiling_record>& get_device_profiling_raw() const { return _device_profiling_raw; }
+
     layout get_input_layout(size_t idx = 0) const { return _impl_params->get_input_layout(idx); }
     layout get_output_layout(size_t idx = 0) const { return _impl_params->get_output_layout(idx); }
     layout get_node_output_layout() const { return _node_output_layout; }
@@ -330,6 +346,12 @@ protected:
     // and store mapping onto original perf_clounter_key for further data analysis and dumps
     std::unordered_map<size_t, std::tuple<int64_t, size_t>> _profiling_data;
     std::unordered_map<size_t, instrumentation::perf_counter_key> _profiling_info;
+
+    // device-side profiling (see record_device_profiling_event): the events of the enqueues
+    // are kept until the next collection point and resolved into timings in one pass
+    std::vector<std::pair<size_t, event::ptr>> _device_profiling_events;
+    std::unordered_map<size_t, std::tuple<int64_t, size_t>> _device_profiling_data;
+    std::vector<device_profiling_record> _device_profiling_raw;
 };
 
 /*
@@ -68,7 +68,7 @@ void dump_perf_data_raw(std::string dump_path, const std::list<std::shared_ptr<p
         return s.str();
     };
 
-    const std::string perf_raw_csv_header = "prim_id,prim_type,stage,net_in_shapes,in_shapes,out_shapes,impl,iters,time_usec\n";
+    const std::string perf_raw_csv_header = "prim_id,prim_type,stage,net_in_shapes,in_shapes,out_shapes,impl,iters,time_usec,device_time_usec\n";
     std::ofstream of(dump_path);
     if (of.is_open()) {
         of << perf_raw_csv_header;
@@ -120,7 +120,37 @@ void dump_perf_data_raw(std::string dump_path, const std::list<std::shared_ptr<p
                 << out_l_str << ","
                 << (key.stage == instrumentation::pipeline_stage::inference ? key.impl_name : "undef") << ","
                 << num_iters << ","
-                << time_avg << "\n";
+                << time_avg << ",";
+                // the host time above includes only the enqueue for GPU primitives; the device
+                // time comes from the event profiling counters of the same key
+                auto& device_data = inst->get_device_profiling_data();
+                auto device_entry = device_data.find(hash);
+                if (device_entry != device_data.end() && std::get<1>(device_entry->second) > 0) {
+                    of << std::get<0>(device_entry->second) / std::get<1>(device_entry->second) / 1000;
+                }
+                of << "\n";
+            }
+        }
+    }
+}
+
+void dump_device_perf_data_raw(std::string dump_path, const std::list<std::shared_ptr<primitive_inst>>& exec_order) {
+    const std::string perf_raw_csv_header = "prim_id,prim_type,impl,enqueue,submission_nsec,starting_nsec,executing_nsec\n";
+    std::ofstream of(dump_path);
+    if (of.is_open()) {
+        of << perf_raw_csv_header;
+        for (auto& inst : exec_order) {
+            auto& perf_info = inst->get_profiling_info();
+            size_t enqueue_num = 0;
+            for (auto& record : inst->get_device_profiling_raw()) {
+                auto& key = perf_info.at(record.hash);
+                of << inst->id() << ","
+                << inst->desc()->type_string() << ","
+                << key.impl_name << ","
+                << enqueue_num++ << ","
+                << record.submission_ns << ","
+                << record.starting_ns << ","
+                << record.executing_ns << "\n";
             }
         }
     }
@@ -263,6 +293,7 @@ void wait_for_the_turn() {
 
 #else
 void dump_perf_data_raw(std::string, const std::list<std::shared_ptr<primitive_inst>>&) {}
+void dump_device_perf_data_raw(std::string, const std::list<std::shared_ptr<primitive_inst>>&) {}
 void log_memory_to_file(memory::ptr, stream&, std::string) {}
 void wait_for_the_turn() {}
 #endif
@@ -441,7 +472,13 @@ network::~network() {
     _memory_pool->clear_pool_for_network(net_id);
     GPU_DEBUG_GET_INSTANCE(debug_config);
     GPU_DEBUG_IF(!debug_config->dump_profiling_data.empty()) {
+        // resolve the still pending events of the last iteration before dumping
+        for (auto& inst : _exec_order) {
+            inst->collect_device_profiling_data();
+        }
         dump_perf_data_raw(debug_config->dump_profiling_data + "/perf_raw" + std::to_string(net_id) + ".csv", _exec_order);
+        dump_device_perf_data_raw(debug_config->dump_profiling_data + "/perf_raw_device" + std::to_string(net_id) + ".csv",
+                                  _exec_order);
     }
 }
 
@@ -571,6 +608,20 @@ void network::reset_execution(bool wait) {
     _events.clear();
 }
 
+void network::shrink_memory_pool() {
+    auto threshold = _config.get_property(ov::intel_gpu::memory_pool_shrink_threshold);
+    if (threshold == 0)
+        return;
+
+    if (_memory_pool->get_unused_pool_size() < threshold)
+        return;
+
+    // Make sure no enqueued primitive still references the pooled buffers before freeing them,
+    // which matters for USM allocations as they are not refcounted by the command queue.
+    reset_execution(true);
+    _memory_pool->release_unused_memory();
+}
+
 void network::set_input_data(const primitive_id& id, memory::ptr data) {
     std::shared_ptr<primitive_inst> primitive_inst;
 
@@ -904,6 +955,13 @@ void network::execute_impl(const std::vector<event::ptr>& events) {
     OV_ITT_SCOPED_TASK(ov::intel_gpu::itt::domains::intel_gpu_plugin, "NetworkImpl::Execute");
     // Wait for previous execution completion
     reset_execution(false);
+    GPU_DEBUG_IF(!cldnn::debug_configuration::get_instance()->dump_profiling_data.empty()) {
+        // the previous iteration is complete here, so its device timestamps are available
+        // without stalling the queue
+        for (auto& inst : _exec_order) {
+            inst->collect_device_profiling_data();
+        }
+    }
     GPU_DEBUG_TRACE << "----------------------------------------------" << std::endl;
     GPU_DEBUG_TRACE << "Start network execution" << std::endl;
 
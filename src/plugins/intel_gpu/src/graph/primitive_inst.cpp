@@ -471,7 +471,9 @@ event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
         auto ev = _impl->execute(dependencies, *this);
 
         GPU_DEBUG_IF(!debug_config->dump_profiling_data.empty()) {
-            get_network().get_stream().wait_for_events({ev});
+            // the device timestamps are read out later at a collection point, so the queue
+            // stays deep and the measured times are not distorted by host synchronization
+            record_device_profiling_event(ev);
         }
 
         return ev;
@@ -1008,6 +1010,50 @@ void primitive_inst::add_profiling_data(instrumentation::pipeline_stage stage, b
     total_iter++;
 }
 
+void primitive_inst::record_device_profiling_event(const event::ptr& ev) {
+    if (ev == nullptr)
+        return;
+
+    instrumentation::perf_counter_key key {
+            _network.get_input_layouts(),
+            _impl_params->input_layouts,
+            _impl_params->output_layouts,
+            get_implementation_name(),
+            instrumentation::pipeline_stage::inference,
+            false
+    };
+
+    auto hash = instrumentation::perf_counter_hash()(key);
+    if (_profiling_info.find(hash) == _profiling_info.end()) {
+        _profiling_info.emplace(hash, key);
+    }
+    _device_profiling_events.emplace_back(hash, ev);
+}
+
+void primitive_inst::collect_device_profiling_data() {
+    for (auto& entry : _device_profiling_events) {
+        auto& ev = entry.second;
+        ev->wait();
+
+        device_profiling_record record { entry.first, 0, 0, 0 };
+        for (auto& interval : ev->get_profiling_info()) {
+            auto count = interval.value->value().count();
+            switch (interval.stage) {
+            case instrumentation::profiling_stage::submission: record.submission_ns += count; break;
+            case instrumentation::profiling_stage::starting:   record.starting_ns += count; break;
+            case instrumentation::profiling_stage::executing:
+            case instrumentation::profiling_stage::duration:   record.executing_ns += count; break;
+            }
+        }
+        _device_profiling_raw.push_back(record);
+
+        auto& d = _device_profiling_data[record.hash];
+        std::get<0>(d) += record.executing_ns;
+        std::get<1>(d)++;
+    }
+    _device_profiling_events.clear();
+}
+
 std::string primitive_inst::get_implementation_name() const {
     try {
         auto kernel_name = _impl ? _impl->get_kernel_name() : "";
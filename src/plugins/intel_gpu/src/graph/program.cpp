@@ -90,6 +90,7 @@
 #include <utility>
 #include <vector>
 #include <stdexcept>
+#include <thread>
 #include <unordered_set>
 
 #ifdef __unix__
@@ -557,22 +558,56 @@ void program::build_program(bool is_internal) {
     init_graph();
     { pre_optimize_graph(is_internal); }
     run_graph_compilation();
-    { post_optimize_graph(is_internal); }
 
     GPU_DEBUG_GET_INSTANCE(debug_config);
+    bool needs_compilation = !_config.get_property(ov::intel_gpu::partial_build_program);
 #ifdef GPU_DEBUG_CONFIG
-    if (debug_config->dry_run_path.empty() || is_internal) {
+    if (!debug_config->dry_run_path.empty() && !is_internal)
+        needs_compilation = false;
+#endif
+
+    // The sources of all kernels selected by compile_graph are in the kernels cache at this
+    // point, so their OpenCL compilation can run in the background while the passes below keep
+    // working on the graph. Kernels added by those passes (e.g. weights reorders) are picked up
+    // by the second compile() call.
+    std::thread background_compilation;
+    std::exception_ptr background_compilation_error;
+    if (needs_compilation) {
+        background_compilation = std::thread([this, &background_compilation_error] {
+            try {
+                compile();
+            } catch (...) {
+                background_compilation_error = std::current_exception();
+            }
+        });
+    }
+
+    try {
+        { post_optimize_graph(is_internal); }
+
+#ifdef GPU_DEBUG_CONFIG
+        if (debug_config->dry_run_path.empty() || is_internal) {
 #else
-    {
+        {
 #endif
-        prepare_memory_dependencies();
+            prepare_memory_dependencies();
 
-        if (_config.get_property(ov::intel_gpu::partial_build_program)) {
-            return;
-        }
+            if (_config.get_property(ov::intel_gpu::partial_build_program)) {
+                return;
+            }
 
-        compile();
-        init_kernels();
+            background_compilation.join();
+            if (background_compilation_error) {
+                std::rethrow_exception(background_compilation_error);
+            }
+
+            compile();
+            init_kernels();
+        }
+    } catch (...) {
+        if (background_compilation.joinable())
+            background_compilation.join();
+        throw;
     }
 
     if (!is_internal) {
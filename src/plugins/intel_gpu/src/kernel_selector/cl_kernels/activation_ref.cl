@@ -12,6 +12,7 @@
 
 // TODO: move it from layout based to memory based
 KERNEL(activation)(
+    OPTIONAL_SHAPE_INFO_ARG
     __global INPUT0_TYPE* input,
     __global OUTPUT_TYPE* output
 #if HAS_FUSED_OPS_DECLS
@@ -32,7 +33,11 @@ KERNEL(activation)(
     const unsigned x = get_global_id(0);
     const uint y = (uint)get_global_id(1) % OUTPUT_SIZE_Y;
     const uint z = (uint)get_global_id(1) / OUTPUT_SIZE_Y;
-    #if OUTPUT_BATCH_NUM == 1
+    #ifdef IS_DYNAMIC
+        // with runtime dims the single-batch case cannot be specialized at compile time
+        const unsigned feature = (uint)get_global_id(2) % OUTPUT_FEATURE_NUM;
+        const unsigned batch = (uint)get_global_id(2) / OUTPUT_FEATURE_NUM;
+    #elif OUTPUT_BATCH_NUM == 1
         const unsigned feature = (uint)get_global_id(2);
         const unsigned batch = 0;
     #else
@@ -60,7 +65,10 @@ KERNEL(activation)(
         #define z 0
             const unsigned x = (uint)get_global_id(0);
             const unsigned y = (uint)get_global_id(1);
-        #if OUTPUT_BATCH_NUM == 1
+        #ifdef IS_DYNAMIC
+            const unsigned feature = (uint)get_global_id(2) % OUTPUT_FEATURE_NUM;
+            const unsigned batch = (uint)get_global_id(2) / OUTPUT_FEATURE_NUM;
+        #elif OUTPUT_BATCH_NUM == 1
             const unsigned feature = (uint)get_global_id(2);
             const unsigned batch = 0;
         #else
@@ -71,6 +79,8 @@ KERNEL(activation)(
 #endif
 
 // GWS.feature and GWS.batch is aligned to 16. Otherwise, there are some idling WIs.
+// Blocked layouts are not supported with dynamic shapes, so the checks below can stay compile time ones.
+#ifndef IS_DYNAMIC
 #if (defined(OUTPUT_LAYOUT_B_FS_YX_FSV16) || defined(OUTPUT_LAYOUT_B_FS_YX_FSV32)) \
     && OUTPUT_FEATURE_NUM % 16 != 0
     if (feature >= OUTPUT_FEATURE_NUM)
@@ -79,6 +89,7 @@ KERNEL(activation)(
     && (OUTPUT_FEATURE_NUM % 16 != 0 || OUTPUT_BATCH_NUM % 16 != 0)
     if (batch >= OUTPUT_BATCH_NUM || feature >= OUTPUT_FEATURE_NUM)
         return;
+#endif
 #endif
 
     const unsigned src_index = GET_INDEX(INPUT,0,ORDER);
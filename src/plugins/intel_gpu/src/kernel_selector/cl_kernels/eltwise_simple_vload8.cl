@@ -5,7 +5,11 @@
 #include "include/batch_headers/fetch_data.cl"
 
 KERNEL(eltwise_gpu_vload8)(INPUTS_DECLS
-                           __global OUTPUT_TYPE* output)
+                           __global OUTPUT_TYPE* output
+#if HAS_FUSED_OPS_DECLS
+                           , FUSED_OPS_DECLS
+#endif
+)
 {
     const uint global_id = get_global_id(0);
 
@@ -15,7 +19,12 @@ KERNEL(eltwise_gpu_vload8)(INPUTS_DECLS
 
     DO_ELTWISE
 
+#if HAS_FUSED_OPS
+    FUSED_OPS;
+    res = FUSED_OPS_RESULT;
+#else
     res = ACTIVATION(res, ACTIVATION_PARAMS);
+#endif
 
     vstore8(res, global_id, output);
 
@@ -27,6 +27,7 @@ ParamsKey ActivationKernelRef::GetSupportedKey() const {
     k.EnableTensorOffset();
     k.EnableTensorPitches();
     k.EnableBatching();
+    k.EnableDynamicShapesSupport();
     return k;
 }
 
@@ -63,6 +64,11 @@ bool ActivationKernelRef::Validate(const Params& p, const optional_params& o) co
     if (params.inputs[0].GetDims().size() != params.outputs[0].GetDims().size())
         return false;
 
+    auto supported_dyn_layouts = {DataLayout::bfyx, DataLayout::bfzyx};
+    if (params.has_dynamic_tensors() &&
+        (!layout_is_one_of(params.inputs, supported_dyn_layouts) || !layout_is_one_of(params.outputs, supported_dyn_layouts)))
+        return false;
+
     return true;
 }
 }  // namespace kernel_selector
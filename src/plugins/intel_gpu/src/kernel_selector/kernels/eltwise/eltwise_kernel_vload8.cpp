@@ -23,7 +23,23 @@ ParamsKey EltwiseKernel_vload8::GetSupportedKey() const {
 }
 
 JitConstants EltwiseKernel_vload8::GetJitConstants(const eltwise_params& params) const {
-    return GetJitConstantsCommon(params, true);
+    auto jit = GetJitConstantsCommon(params, true);
+
+    if (!params.fused_ops.empty()) {
+        kernel_selector::Datatype input_dt = GetAccumulatorType(params);
+        FusedOpsConfiguration conf = {"",
+                                      {"global_id * 8"},
+                                      "res",
+                                      input_dt,
+                                      8,
+                                      LoadType::LT_UNALIGNED,
+                                      BoundaryCheck::ENABLED,
+                                      IndexType::LINEAR_OFFSET,
+                                      Tensor::DataChannelName::X};
+        jit.Merge(MakeFusedOpsJitConstants(params, {conf}));
+    }
+
+    return jit;
 }
 
 bool EltwiseKernel_vload8::Validate(const Params& params, const optional_params& o) const {
@@ -33,12 +49,27 @@ bool EltwiseKernel_vload8::Validate(const Params& params, const optional_params&
 
     const auto& ewParams = static_cast<const eltwise_params&>(params);
 
-    // Only one activation can be fused.
-    if (ewParams.fused_ops.size() > 1 ||
-        (ewParams.activations.size() !=0 && ewParams.fused_ops.size() != 0)) {
+    // Legacy activations and fused ops use different mechanisms, so only one of them can be handled at a time.
+    if (ewParams.activations.size() != 0 && ewParams.fused_ops.size() != 0) {
         return false;
     }
 
+    // Fused op inputs are loaded with the same linear offset as the kernel inputs, so only per-tensor
+    // parameters or tensors that exactly match the output are supported here. X is the vectorized axis,
+    // thus a matching tensor also needs x > 1 to be loaded as a vector. Anything else (e.g. per-channel
+    // quantize params) is left to the reference kernel.
+    for (auto& fused_op : ewParams.fused_ops) {
+        for (auto& t : fused_op.tensors) {
+            if (t.LogicalSize() == 1)
+                continue;
+            if (t.PitchesDifferFromLogicalDims() ||
+                t.GetLayout() != ewParams.outputs[0].GetLayout() ||
+                !t.SameDimsSizes(ewParams.outputs[0]) ||
+                t.X().v == 1)
+                return false;
+        }
+    }
+
         for (size_t i = 0; i < ewParams.inputs.size(); i++) {
             const auto input_layout = ewParams.inputs[i].GetLayout();
             const auto batch_size = ewParams.inputs[i].Batch().v;
@@ -116,10 +147,11 @@ KernelsData EltwiseKernel_vload8::GetKernelsData(const Params& params, const opt
     auto entry_point = GetEntryPoint(kernelName, newParams.layerID, params, options);
 
     try {
-        // move a fused activation from fused_ops to activations
+        // move a fused activation without extra inputs from fused_ops to activations
         if (newParams.activations.size() == 0 &&
             newParams.fused_ops.size() == 1 &&
-            newParams.fused_ops[0].GetType() == KernelType::ACTIVATION) {
+            newParams.fused_ops[0].GetType() == KernelType::ACTIVATION &&
+            newParams.fused_ops[0].tensors.empty()) {
             auto p = newParams.fused_ops[0].GetOpParams<activation_fuse_params>();
             base_activation_params activation_p = p->param;
             newParams.activations.push_back(activation_p);
@@ -136,7 +168,7 @@ KernelsData EltwiseKernel_vload8::GetKernelsData(const Params& params, const opt
     kernel.params.workGroups.global = {std::max(newParams.inputs[0].LogicalSize() / 8, (size_t)1), 1, 1};
     kernel.params.workGroups.local = GetOptimalLocalWorkGroupSizes(kernel.params.workGroups.global, params.engineInfo);
     kernel.code.kernelString = GetKernelString(kernelName, jit, entry_point, params.engineInfo, EXE_MODE_DEFAULT);
-    kernel.params.arguments = GetArgsDesc((uint32_t)newParams.inputs.size(), false, false);
+    kernel.params.arguments = GetArgsDesc((uint32_t)newParams.inputs.size(), false, false, GetFusedPrimitiveInputsCount(newParams));
 
     return {kd};
 }
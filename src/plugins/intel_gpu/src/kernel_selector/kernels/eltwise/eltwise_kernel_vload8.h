@@ -17,7 +17,9 @@ public:
     ParamsKey GetSupportedKey() const override;
     std::vector<FusedOpType> GetSupportedFusedOps() const override {
         return {
-            FusedOpType::ACTIVATION
+            FusedOpType::QUANTIZE,
+            FusedOpType::ACTIVATION,
+            FusedOpType::ELTWISE
         };
     }
 
@@ -141,6 +141,19 @@ bool same_host_mem(cldnn::memory::ptr memPtr, uint8_t* hostPtr) {
     }
     return bufferMem == hostPtr;
 }
+
+Precision::ePrecision conv_to_supported_prec(Precision::ePrecision prec) {
+    switch (prec) {
+        case Precision::I16:
+        case Precision::U16:
+        case Precision::FP64:
+            return Precision::FP32;
+        case Precision::U64:
+        case Precision::U32:
+            return Precision::I32;
+        default: return prec;
+    }
+}
 }  // namespace
 
 namespace ov {
@@ -247,6 +260,18 @@ void InferRequest::set_input(const std::string& name, const Blob::Ptr& data) {
                 if (_deviceInputs.at(name)->getTensorDesc() != data->getTensorDesc())
                     _deviceInputs[name] = reinterpret_device_blob(_deviceInputs[name], data->getTensorDesc());
             }
+        } else if (m_graph != nullptr && m_graph->get_engine().use_unified_shared_memory()) {
+            // Adopt the user pointer right away: if it is USM host memory (e.g. a decoder
+            // writing frames into a USM buffer), a shared device blob is created over it and
+            // the per-frame staging copy is removed without the user wrapping it into a
+            // remote blob manually. For regular host memory this just pre-allocates the
+            // staging blob, so enqueue doesn't pay for the pointer detection and allocation.
+            auto layout_itr = m_graph->GetInputLayouts().find(name);
+            if (layout_itr != m_graph->GetInputLayouts().end() && layout_itr->second.is_static()) {
+                auto prec = data->getTensorDesc().getPrecision();
+                allocate_dev_mem_if_needed(_deviceInputs, _inputs[name], name, layout_itr->second,
+                                           prec != conv_to_supported_prec(prec));
+            }
         }
     }
 }
@@ -492,6 +517,15 @@ void InferRequest::enqueue() {
         prepare_output(outputName, outputBlob);
     }
 
+    auto& stream = networkPtr->get_stream();
+    auto& transfer_stream = stream.get_transfer_stream();
+    if (&transfer_stream != &stream && !dependencies.empty()) {
+        // Input uploads went to the transfer queue: flush it so the copies start right away
+        // and make the compute queue wait for them on the device without blocking the host
+        transfer_stream.flush();
+        stream.enqueue_dependencies(dependencies);
+    }
+
     internal_outputs.clear();
     internal_outputs = networkPtr->execute(dependencies);
 
@@ -576,6 +610,10 @@ void InferRequest::wait() {
     if (m_useProfiling) {
         m_graph->UpdatePerfStatistics();
     }
+
+    // The request is idle at this point, so transient pool allocations (e.g. left behind by a
+    // large-batch request on a dynamic model) can be returned back to the driver if requested.
+    m_graph->GetNetwork()->shrink_memory_pool();
 }
 
 // ----------------------------------------------------------------------------------------- //
@@ -844,10 +882,18 @@ std::map<std::string, InferenceEngineProfileInfo> InferRequest::GetPerformanceCo
 
 void InferRequest::allocate_dev_mem_if_needed(InferenceEngine::BlobMap& device_mems, InferenceEngine::Blob::Ptr& user_blob,
                                               const cldnn::primitive_id& blob_name, const cldnn::layout& layout, bool need_lockable_mem) {
+    const auto has_device_blob = device_mems.find(blob_name) != device_mems.end();
+
+    // Fast path for the steady state: the very same user blob was already adopted or staged
+    // on a previous infer (or eagerly in SetBlob), so the per-infer USM pointer detection,
+    // which is a driver call, can be skipped entirely
+    auto matched = users_blobs_matching.find(blob_name);
+    if (has_device_blob && matched != users_blobs_matching.end() && matched->second == user_blob)
+        return;
+
     const auto input_ptr = static_cast<const void*>(user_blob->cbuffer());
     const auto alloc_type = m_graph->get_engine().detect_usm_allocation_type(input_ptr);
     const auto is_usm_host = alloc_type == cldnn::allocation_type::usm_host;
-    const auto has_device_blob = device_mems.find(blob_name) != device_mems.end();
     bool can_skip_allocation = false;
 
     if (has_device_blob) {
@@ -884,8 +930,8 @@ void InferRequest::allocate_dev_mem_if_needed(InferenceEngine::BlobMap& device_m
         } else {
             device_mems[blob_name] = create_device_blob(user_blob->getTensorDesc());
         }
-        users_blobs_matching[blob_name] = user_blob;
     }
+    users_blobs_matching[blob_name] = user_blob;
 }
 
 void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr& inputBlob,
@@ -901,19 +947,6 @@ void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr
     const bool is_dev_input = remote_ptr != nullptr;
     const bool can_use_usm = m_graph->get_engine().use_unified_shared_memory();
 
-    auto conv_to_supported_prec = [](Precision::ePrecision prec) {
-        switch (prec) {
-            case Precision::I16:
-            case Precision::U16:
-            case Precision::FP64:
-                return Precision::FP32;
-            case Precision::U64:
-            case Precision::U32:
-                return Precision::I32;
-            default: return prec;
-        }
-    };
-
     if (input_layout.is_dynamic()) {
         bool has_device_blob = _deviceInputs.find(inputName) != _deviceInputs.end();
         bool should_allocate_device_blob = !has_device_blob;
@@ -924,10 +957,40 @@ void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr
             }
         }
 
-        if (should_allocate_device_blob) {
-            _deviceInputs[inputName] = create_device_blob(inputBlob->getTensorDesc());
+        // If the user blob already lives in USM host memory, the device can access its buffer
+        // directly, so wrap it into a shared device blob instead of staging through a copy
+        // (mirrors what allocate_dev_mem_if_needed does for static shapes). Precision conversion
+        // cases are excluded as they write converted data into the device blob.
+        bool can_share_host_mem = can_use_usm && prec == conv_to_supported_prec(prec) &&
+            m_graph->get_engine().detect_usm_allocation_type(inputBlob->cbuffer().as<const void*>()) == cldnn::allocation_type::usm_host;
+
+        if (can_share_host_mem) {
+            auto matched = users_blobs_matching.find(inputName);
+            if (!has_device_blob || matched == users_blobs_matching.end() || matched->second != inputBlob ||
+                _deviceInputs.at(inputName)->getTensorDesc() != inputBlob->getTensorDesc()) {
+                const auto& desc = inputBlob->getTensorDesc();
+                cldnn::layout shared_layout(ov::PartialShape(desc.getDims()),
+                                            DataTypeFromPrecision(desc.getPrecision()),
+                                            FormatFromLayout(desc.getLayout()));
+                _deviceInputs[inputName] = create_shared_device_blob(desc, shared_layout, inputBlob->buffer().as<void*>());
+                users_blobs_matching[inputName] = inputBlob;
+            }
         } else {
-            _deviceInputs[inputName] = reinterpret_device_blob(_deviceInputs[inputName], inputBlob->getTensorDesc());
+            if (has_device_blob && !should_allocate_device_blob) {
+                // The previous user blob was adopted zero-copy; now a regular host blob came in,
+                // so a real device staging blob has to be allocated instead of reinterpreting
+                // the shared one (that would stage the copy into the old user buffer)
+                auto impl = getBlobImpl(_deviceInputs.at(inputName)->as<gpu::ClBlob>());
+                if (impl && impl->is_allocated() && impl->get_memory()->get_allocation_type() == cldnn::allocation_type::usm_host) {
+                    should_allocate_device_blob = true;
+                }
+            }
+
+            if (should_allocate_device_blob) {
+                _deviceInputs[inputName] = create_device_blob(inputBlob->getTensorDesc());
+            } else {
+                _deviceInputs[inputName] = reinterpret_device_blob(_deviceInputs[inputName], inputBlob->getTensorDesc());
+            }
         }
     } else if (input_layout.is_static() && !is_dev_input && can_use_usm) {
         allocate_dev_mem_if_needed(_deviceInputs, inputBlob, inputName, input_layout, (conv_to_supported_prec(prec) != prec));
@@ -990,7 +1053,11 @@ void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr
                     auto src_lock = inputBlob->cbuffer();
                     auto src_ptr = src_lock.as<uint8_t*>();
                     if (!same_host_mem(inputMem, src_ptr)) {
-                        auto ev = inputMem->copy_from(stream, src_ptr, false);
+                        // Upload through the dedicated transfer queue (if the backend provides one),
+                        // so that the input copy of this request overlaps compute of the previous
+                        // one; enqueue() synchronizes the compute queue with these events on the
+                        // device once all inputs are staged
+                        auto ev = inputMem->copy_from(stream.get_transfer_stream(), src_ptr, false);
                         dependencies.push_back(ev);
                     }
                 }
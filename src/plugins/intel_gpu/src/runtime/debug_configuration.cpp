@@ -126,6 +126,12 @@ static void print_help_messages() {
                               " For primitives, fc:onednn, fc:ocl, do:cpu, do:ocl, reduce:onednn, reduce:ocl, concat:onednn,"
                               " and concat:ocl are supported");
     message_list.emplace_back("OV_GPU_MaxKernelsPerBatch", "Maximum number of kernels in a batch during compiling kernels");
+    message_list.emplace_back("OV_GPU_OnlineTuning", "Benchmark candidate kernels on the first run per shape and persist the winners"
+                              " into a tuning cache in the model cache directory (ov::cache_dir)");
+    message_list.emplace_back("OV_GPU_OoqBarrierSync", "Synchronize the out-of-order queue with global barriers instead of"
+                              " per-primitive event dependencies (serializes independent branches)");
+    message_list.emplace_back("OV_GPU_ValidateEventCoverage", "Fail when a kernel dependency is not covered by a synchronization event,"
+                              " i.e. the kernel could start before its producer finishes");
 
     auto max_name_length_item = std::max_element(message_list.begin(), message_list.end(),
         [](std::pair<std::string, std::string>& a, std::pair<std::string, std::string>& b){
@@ -159,7 +165,10 @@ debug_configuration::debug_configuration()
         , base_batch_for_memory_estimation(-1)
         , serialize_compile(0)
         , forced_impl_type(std::string())
-        , max_kernels_per_batch(0) {
+        , max_kernels_per_batch(0)
+        , online_tuning(0)
+        , ooq_barrier_sync(0)
+        , validate_event_coverage(0) {
 #ifdef GPU_DEBUG_CONFIG
     get_gpu_debug_env_var("Help", help);
     get_common_debug_env_var("Verbose", verbose);
@@ -183,6 +192,9 @@ debug_configuration::debug_configuration()
     get_gpu_debug_env_var("SerialCompile", serialize_compile);
     get_gpu_debug_env_var("ForceImplType", forced_impl_type);
     get_gpu_debug_env_var("MaxKernelsPerBatch", max_kernels_per_batch);
+    get_gpu_debug_env_var("OnlineTuning", online_tuning);
+    get_gpu_debug_env_var("OoqBarrierSync", ooq_barrier_sync);
+    get_gpu_debug_env_var("ValidateEventCoverage", validate_event_coverage);
 
     if (help > 0) {
         print_help_messages();
@@ -67,6 +67,13 @@ const device::ptr engine::get_device() const {
     return _device;
 }
 
+staging_buffer_pool& engine::get_staging_pool() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_staging_pool)
+        _staging_pool = std::make_shared<staging_buffer_pool>(*this);
+    return *_staging_pool;
+}
+
 bool engine::use_unified_shared_memory() const {
     GPU_DEBUG_GET_INSTANCE(debug_config);
     GPU_DEBUG_IF(debug_config->disable_usm) {
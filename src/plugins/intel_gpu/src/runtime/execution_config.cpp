@@ -5,6 +5,7 @@
 #include "intel_gpu/runtime/execution_config.hpp"
 #include "intel_gpu/runtime/debug_configuration.hpp"
 
+#include <cstring>
 #include <thread>
 
 namespace ov {
@@ -62,6 +63,7 @@ void ExecutionConfig::set_default() {
         std::make_tuple(ov::intel_gpu::queue_type, QueueTypes::out_of_order),
         std::make_tuple(ov::intel_gpu::optimize_data, false),
         std::make_tuple(ov::intel_gpu::enable_memory_pool, true),
+        std::make_tuple(ov::intel_gpu::memory_pool_shrink_threshold, static_cast<uint64_t>(0)),
         std::make_tuple(ov::intel_gpu::allow_static_input_reorder, false),
         std::make_tuple(ov::intel_gpu::custom_outputs, std::vector<std::string>{}),
         std::make_tuple(ov::intel_gpu::tuning_config, ov::intel_gpu::TuningConfig{}),
@@ -71,10 +73,16 @@ void ExecutionConfig::set_default() {
         std::make_tuple(ov::intel_gpu::allow_new_shape_infer, false));
 }
 
-void ExecutionConfig::register_property_impl(const std::pair<std::string, ov::Any>& property, PropertyVisibility visibility, BaseValidator::Ptr validator) {
+void ExecutionConfig::register_property_impl(const std::pair<std::string, ov::Any>& property,
+                                             PropertyVisibility visibility,
+                                             BaseValidator::Ptr validator,
+                                             const char* key_literal) {
     property_validators[property.first] = validator;
     supported_properties[property.first] = visibility;
     internal_properties[property.first] = property.second;
+    if (key_literal)
+        property_key_literals[property.first] = key_literal;
+    property_cache.clear();
 }
 
 void ExecutionConfig::set_property(const AnyMap& config) {
@@ -85,6 +93,7 @@ void ExecutionConfig::set_property(const AnyMap& config) {
         OPENVINO_ASSERT(property_validators.at(name)->is_valid(val), "[GPU] Invalid value for property ", name,  ": ", val.as<std::string>());
         internal_properties[name] = val;
     }
+    property_cache.clear();
 }
 
 bool ExecutionConfig::is_supported(const std::string& name) const {
@@ -108,6 +117,22 @@ void ExecutionConfig::set_user_property(const AnyMap& config) {
 
         user_properties[kv.first] = kv.second;
     }
+    property_cache.clear();
+}
+
+void ExecutionConfig::rebuild_property_cache() {
+    property_cache.clear();
+    property_cache.reserve(property_key_literals.size());
+    for (const auto& kv : property_key_literals) {
+        auto user_it = user_properties.find(kv.first);
+        if (user_it != user_properties.end()) {
+            property_cache.push_back({kv.second, user_it->second});
+            continue;
+        }
+        auto internal_it = internal_properties.find(kv.first);
+        if (internal_it != internal_properties.end())
+            property_cache.push_back({kv.second, internal_it->second});
+    }
 }
 
 Any ExecutionConfig::get_property(const std::string& name) const {
@@ -119,6 +144,22 @@ Any ExecutionConfig::get_property(const std::string& name) const {
     return internal_properties.at(name);
 }
 
+Any ExecutionConfig::get_property(const char* name) const {
+    // Fast path for reads through the typed get_property() overload: the caller passes the
+    // ov::Property name literal, so when it is the very literal captured at registration a
+    // pointer compare finds the entry. A literal duplicated in another translation unit may
+    // have a different address, hence the byte-wise second pass before giving up on the cache.
+    for (const auto& entry : property_cache) {
+        if (entry.name == name)
+            return entry.value;
+    }
+    for (const auto& entry : property_cache) {
+        if (std::strcmp(entry.name, name) == 0)
+            return entry.value;
+    }
+    return get_property(std::string(name));
+}
+
 void ExecutionConfig::apply_performance_hints(const cldnn::device_info& info) {
     if (is_set_by_user(ov::hint::performance_mode)) {
         const auto mode = get_property(ov::hint::performance_mode);
@@ -132,7 +173,9 @@ void ExecutionConfig::apply_performance_hints(const cldnn::device_info& info) {
     }
 
     if (get_property(ov::num_streams) == ov::streams::AUTO) {
-        int32_t n_streams = std::max<int32_t>(info.num_ccs, 2);
+        // On multi-tile devices the driver distributes the queues across the tiles,
+        // so the root device needs proportionally more streams to keep every tile busy
+        int32_t n_streams = std::max<int32_t>(info.num_ccs * info.num_tiles, 2);
         set_property(ov::num_streams(n_streams));
     }
 }
@@ -155,12 +198,41 @@ void ExecutionConfig::apply_debug_options(const cldnn::device_info& info) {
     GPU_DEBUG_IF(debug_config->serialize_compile == 1) {
         set_property(ov::compilation_num_threads(1));
     }
+
+    GPU_DEBUG_IF(debug_config->online_tuning) {
+        auto tuning = get_property(ov::intel_gpu::tuning_config);
+        if (tuning.mode == TuningMode::tuning_disabled) {
+            tuning.mode = TuningMode::tuning_tune_and_cache;
+            set_property(ov::intel_gpu::tuning_config(tuning));
+        }
+    }
+}
+
+void ExecutionConfig::apply_tuning_options(const cldnn::device_info& info) {
+    // Online tuning: when tuning is requested without an explicit cache file, keep the tuned
+    // winners in the common model cache directory with a per-device file name, so the
+    // benchmarking cost of the first run per shape is paid once and subsequent loads pick
+    // the tuned kernels up from ov::cache_dir
+    auto tuning = get_property(ov::intel_gpu::tuning_config);
+    if (tuning.mode != TuningMode::tuning_disabled && tuning.cache_file_path.empty()) {
+        auto cache_dir = get_property(ov::cache_dir);
+        if (cache_dir.empty()) {
+            // No place to persist the results - tuning would be redone on every load
+            tuning.mode = TuningMode::tuning_disabled;
+        } else {
+            if (cache_dir.back() != '/' && cache_dir.back() != '\\')
+                cache_dir += "/";
+            tuning.cache_file_path = cache_dir + "tuning_cache_" + std::to_string(info.device_id) + ".json";
+        }
+        set_property(ov::intel_gpu::tuning_config(tuning));
+    }
 }
 
 void ExecutionConfig::apply_hints(const cldnn::device_info& info) {
     apply_performance_hints(info);
     apply_priority_hints(info);
     apply_debug_options(info);
+    apply_tuning_options(info);
 }
 
 void ExecutionConfig::apply_user_properties(const cldnn::device_info& info) {
@@ -177,6 +249,7 @@ void ExecutionConfig::apply_user_properties(const cldnn::device_info& info) {
         set_property(ov::intel_gpu::enable_lp_transformations(info.supports_imad || info.supports_immad));
     }
     user_properties.clear();
+    rebuild_property_cache();
 }
 
 std::string ExecutionConfig::to_string() const {
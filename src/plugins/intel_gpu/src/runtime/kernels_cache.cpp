@@ -16,13 +16,16 @@
 #include "openvino/util/file_util.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstdio>
 #include <sstream>
 #include <fstream>
 #include <set>
 #include <string>
 #include <tuple>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 #if defined(__unix__) && !defined(__ANDROID__)
@@ -30,7 +33,53 @@
 #endif
 
 namespace {
-std::mutex cacheAccessMutex;
+// Guards the map of binaries collected for the network bundle, which is filled concurrently
+// by the batch build tasks. The cache files themselves need no locking: entries are
+// content-addressed and published with an atomic rename (see save_binary_atomic), so a
+// reader - also one from another process sharing the cache directory - either does not see
+// the file yet or sees a complete binary.
+std::mutex builtBinariesMutex;
+
+// Process-wide in-memory index of the compiled batch binaries keyed by the batch content
+// hash (options + driver version + full source). Networks frequently share most of their
+// kernel batches, so a batch compiled or loaded from disk once per process is served from
+// memory afterwards, making the cache probe O(1) per batch.
+std::mutex binaryIndexMutex;
+std::unordered_map<size_t, std::shared_ptr<const std::vector<unsigned char>>> binaryIndex;
+
+std::shared_ptr<const std::vector<unsigned char>> probe_binary_index(size_t hash) {
+    std::lock_guard<std::mutex> lock(binaryIndexMutex);
+    auto it = binaryIndex.find(hash);
+    return it == binaryIndex.end() ? nullptr : it->second;
+}
+
+void store_in_binary_index(size_t hash, std::vector<unsigned char> binary) {
+    auto entry = std::make_shared<const std::vector<unsigned char>>(std::move(binary));
+    std::lock_guard<std::mutex> lock(binaryIndexMutex);
+    binaryIndex.emplace(hash, std::move(entry));
+}
+
+// Writes the data to a temporary file next to the target and moves it into place with an
+// atomic rename, so concurrent readers never observe a partially written entry. A failed
+// rename means another process has already published the same content-addressed entry.
+void save_binary_atomic(const std::string& path, const std::vector<unsigned char>& data) {
+    static std::atomic<unsigned> tmp_counter {0};
+    const std::string tmp_path = path + ".tmp" + std::to_string(tmp_counter++);
+    {
+        std::ofstream file(tmp_path, std::ios::binary);
+        if (!file.good())
+            return;
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file.good()) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+    }
+}
 
 std::string reorder_options(const std::string& org_options) {
     std::stringstream ss(org_options);
@@ -51,6 +100,57 @@ std::string reorder_options(const std::string& org_options) {
     return options;
 }
 
+// A bundle file stores the program binaries of all batches of one executable network
+// back to back, so that importing a cached network costs a single sequential file read
+// followed by one clCreateProgramWithBinary call per batch, instead of one cache file
+// lookup per batch. Layout: entries count, then per entry the batch hash, binary size
+// and binary bytes.
+std::map<size_t, std::vector<unsigned char>> read_program_bundle(const std::string& path) {
+    std::map<size_t, std::vector<unsigned char>> binaries;
+    std::ifstream file(path, std::ios::binary);
+    if (!file.good())
+        return binaries;
+
+    uint64_t count = 0;
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    for (uint64_t i = 0; file.good() && i < count; ++i) {
+        uint64_t hash = 0;
+        uint64_t size = 0;
+        file.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        if (!file.good())
+            break;
+        std::vector<unsigned char> binary(static_cast<size_t>(size));
+        file.read(reinterpret_cast<char*>(binary.data()), static_cast<std::streamsize>(size));
+        if (!file.good()) {
+            // Truncated or corrupted bundle - fall back to the regular compilation path
+            binaries.clear();
+            return binaries;
+        }
+        binaries.emplace(static_cast<size_t>(hash), std::move(binary));
+    }
+    return binaries;
+}
+
+void write_program_bundle(const std::string& path, const std::map<size_t, std::vector<unsigned char>>& binaries) {
+    std::vector<unsigned char> buffer;
+    auto append = [&buffer](const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+
+    uint64_t count = binaries.size();
+    append(&count, sizeof(count));
+    for (const auto& entry : binaries) {
+        uint64_t hash = entry.first;
+        uint64_t size = entry.second.size();
+        append(&hash, sizeof(hash));
+        append(&size, sizeof(size));
+        append(entry.second.data(), static_cast<size_t>(size));
+    }
+    save_binary_atomic(path, buffer);
+}
+
 }  // namespace
 
 namespace cldnn {
@@ -191,7 +291,9 @@ static std::vector<unsigned char> getProgramBinaries(cl::Program program) {
 }
 
 // TODO: This build_batch method should be backend specific
-void kernels_cache::build_batch(const engine& build_engine, const batch_program& batch) {
+void kernels_cache::build_batch(const engine& build_engine, const batch_program& batch,
+                                const std::map<size_t, std::vector<unsigned char>>* bundle_binaries,
+                                std::map<size_t, std::vector<unsigned char>>* built_binaries) {
     OV_ITT_SCOPED_TASK(ov::intel_gpu::itt::domains::intel_gpu_plugin, "KernelsCache::build_batch");
 
     auto& cl_build_engine = dynamic_cast<const ocl::ocl_engine&>(build_engine);
@@ -228,16 +330,30 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
     std::string cached_bin_name = get_cache_path() + std::to_string(batch.hash_value) + ".cl_cache";
     cl::Program::Binaries precompiled_kernels = {};
 
-    if (is_cache_enabled()) {
-        // Try to load file with name ${hash_value}.cl_cache which contains precompiled kernels for current bucket
-        // If read is successful, then remove kernels from compilation bucket
-        std::vector<uint8_t> bin;
-        {
-            std::lock_guard<std::mutex> lock(cacheAccessMutex);
-            bin = ov::util::load_binary(cached_bin_name);
+    if (bundle_binaries) {
+        // The whole network bundle has been read up front, so the batch binary is taken
+        // from memory without touching the per-batch cache files
+        auto bundled = bundle_binaries->find(batch.hash_value);
+        if (bundled != bundle_binaries->end()) {
+            store_in_binary_index(batch.hash_value, bundled->second);
+            precompiled_kernels.push_back(bundled->second);
+        }
+    }
+    if (precompiled_kernels.empty() && is_cache_enabled()) {
+        // The in-memory index serves batches already compiled or loaded by another network
+        // in this process without touching the disk
+        if (auto indexed = probe_binary_index(batch.hash_value)) {
+            precompiled_kernels.push_back(*indexed);
         }
+    }
+    if (precompiled_kernels.empty() && is_cache_enabled()) {
+        // Try to load file with name ${hash_value}.cl_cache which contains precompiled kernels for current bucket.
+        // No lock is needed: the entries are content-addressed and published atomically, so the
+        // directory can be shared with other processes
+        std::vector<uint8_t> bin = ov::util::load_binary(cached_bin_name);
         if (!bin.empty()) {
-            precompiled_kernels.push_back(bin);
+            store_in_binary_index(batch.hash_value, bin);
+            precompiled_kernels.push_back(std::move(bin));
         }
     }
     try {
@@ -267,8 +383,13 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
                 // Note: Bin file contains full bucket, not separate kernels, so kernels reuse across different models is quite limited
                 // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
                 // compile time.
-                std::lock_guard<std::mutex> lock(cacheAccessMutex);
-                ov::util::save_binary(cached_bin_name, getProgramBinaries(program));
+                auto binary = getProgramBinaries(program);
+                save_binary_atomic(cached_bin_name, binary);
+                store_in_binary_index(batch.hash_value, binary);
+                if (built_binaries) {
+                    std::lock_guard<std::mutex> lock(builtBinariesMutex);
+                    built_binaries->emplace(batch.hash_value, std::move(binary));
+                }
             }
         } else {
             cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
@@ -276,6 +397,13 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
                 throw std::runtime_error("Failed in building program with a precompiled kernel.");
 
             program.createKernels(&kernels);
+
+            if (built_binaries) {
+                // The batch came from a per-batch cache file - keep its binary so that the
+                // bundle written after this build covers the whole network
+                std::lock_guard<std::mutex> lock(builtBinariesMutex);
+                built_binaries->emplace(batch.hash_value, std::move(precompiled_kernels.front()));
+            }
         }
 
         {
@@ -382,18 +510,45 @@ void kernels_cache::build_all() {
     ocl::ocl_engine& _build_engine = downcast<ocl::ocl_engine>(_engine);
     std::vector<batch_program> batches;
     {
+        // Take the pending sources snapshot and reset the compilation state up front, so
+        // that kernels registered while this build is in flight (e.g. by graph passes
+        // running concurrently with a background build) are kept for the next build_all()
+        // call instead of being dropped by the cleanup below.
         std::lock_guard<std::mutex> lock(_mutex);
         get_program_source(_kernels_code, &batches);
+        _kernels_code.clear();
+        _pending_compilation = false;
+    }
+
+    // When the compiled kernels cache is enabled, all batches of one network are additionally
+    // stored in a single ${network_hash}.cl_bundle file, so that importing a cached network
+    // costs one file read and one clCreateProgramWithBinary per batch instead of a cache
+    // file lookup per batch. The per-batch ${hash_value}.cl_cache files are still written
+    // as they allow batch reuse across networks.
+    std::map<size_t, std::vector<unsigned char>> bundle_binaries;
+    std::map<size_t, std::vector<unsigned char>> built_binaries;
+    std::string bundle_path;
+    bool bundle_loaded = false;
+    if (is_cache_enabled() && !batches.empty()) {
+        std::string bundle_key;
+        for (const auto& batch : batches) {
+            bundle_key += std::to_string(batch.hash_value) + "_";
+        }
+        bundle_path = get_cache_path() + std::to_string(std::hash<std::string>()(bundle_key)) + ".cl_bundle";
+        bundle_binaries = read_program_bundle(bundle_path);
+        bundle_loaded = !bundle_binaries.empty();
     }
+    const auto* bundle_binaries_ptr = bundle_loaded ? &bundle_binaries : nullptr;
+    auto* built_binaries_ptr = (!bundle_path.empty() && !bundle_loaded) ? &built_binaries : nullptr;
 
     if (_task_executor) {
         std::exception_ptr exception;
         std::vector<InferenceEngine::Task> tasks;
         for (size_t idx = 0; idx < batches.size(); idx++) {
             auto& batch = batches[idx];
-            tasks.push_back([this, &_build_engine, &batch, &exception] {
+            tasks.push_back([this, &_build_engine, &batch, &exception, bundle_binaries_ptr, built_binaries_ptr] {
                 try {
-                    build_batch(_build_engine, batch);
+                    build_batch(_build_engine, batch, bundle_binaries_ptr, built_binaries_ptr);
                 } catch(...) {
                     exception = std::current_exception();
                 }
@@ -407,14 +562,16 @@ void kernels_cache::build_all() {
         }
     } else {
         for (size_t idx = 0; idx < batches.size(); idx++) {
-            build_batch(_build_engine, batches[idx]);
+            build_batch(_build_engine, batches[idx], bundle_binaries_ptr, built_binaries_ptr);
         }
     }
 
+    if (built_binaries_ptr && built_binaries.size() == batches.size()) {
+        write_program_bundle(bundle_path, built_binaries);
+    }
+
     {
         std::lock_guard<std::mutex> lock(_mutex);
-        _kernels_code.clear();
-        _pending_compilation = false;
 #if defined(__unix__) && !defined(__ANDROID__)
     //  NOTE: In linux, without malloc_trim, an amount of the memory used by compilation is not being returned to system thought they are freed.
     //  (It is at least 500 MB when we perform parallel compilation)
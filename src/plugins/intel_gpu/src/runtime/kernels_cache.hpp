@@ -87,7 +87,9 @@ private:
     std::vector<std::string> batch_header_str;
 
     void get_program_source(const kernels_code& kernels_source_code, std::vector<batch_program>*) const;
-    void build_batch(const engine& build_engine, const batch_program& batch);
+    void build_batch(const engine& build_engine, const batch_program& batch,
+                     const std::map<size_t, std::vector<unsigned char>>* bundle_binaries = nullptr,
+                     std::map<size_t, std::vector<unsigned char>>* built_binaries = nullptr);
 
     std::string get_cache_path() const;
     bool is_cache_enabled() const;
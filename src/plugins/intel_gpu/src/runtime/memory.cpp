@@ -38,6 +38,40 @@ memory::~memory() {
     }
 }
 
+memory::ptr staging_buffer_pool::acquire(size_t size) {
+    if (!_engine.supports_allocation(allocation_type::usm_host))
+        return nullptr;
+
+    size_t bucket = min_staging_size;
+    while (bucket < size)
+        bucket *= 2;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& free_list = _free_lists[bucket];
+        if (!free_list.empty()) {
+            auto buffer = free_list.back();
+            free_list.pop_back();
+            return buffer;
+        }
+    }
+
+    layout staging_layout(ov::PartialShape{static_cast<int64_t>(bucket)}, data_types::u8, format::bfyx);
+    try {
+        return _engine.allocate_memory(staging_layout, allocation_type::usm_host, false);
+    } catch (...) {
+        // pinned memory is exhausted - the caller falls back to the direct copy path
+        return nullptr;
+    }
+}
+
+void staging_buffer_pool::release(memory::ptr buffer) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& free_list = _free_lists[buffer->size()];
+    if (free_list.size() < max_buffers_per_class)
+        free_list.push_back(std::move(buffer));
+}
+
 std::unique_ptr<surfaces_lock> surfaces_lock::create(engine_types engine_type, std::vector<memory::ptr> mem, const stream& stream) {
     switch (engine_type) {
     case engine_types::ocl: return std::unique_ptr<ocl::ocl_surfaces_lock>(new ocl::ocl_surfaces_lock(mem, stream));
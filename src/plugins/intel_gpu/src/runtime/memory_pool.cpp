@@ -241,6 +241,78 @@ memory::ptr memory_pool::get_memory(const layout& layout,
 
 void memory_pool::clear_pool() { _non_padded_pool.clear(); }
 
+// Total size of pooled allocations which are not referenced outside of the pool anymore.
+// Such records only pin the high-water mark of earlier allocations for potential reuse:
+// their original requesters have dropped them (e.g. after a shape change), and any still
+// executing reinterpreted view keeps the underlying buffer alive on its own.
+uint64_t memory_pool::get_unused_pool_size() const {
+    uint64_t total_size = 0;
+    for (auto const& record : _non_padded_pool) {
+        if (record.second._memory.use_count() == 1)
+            total_size += record.second._memory->size();
+    }
+    for (auto const& record_list : _padded_pool) {
+        for (auto const& record : record_list.second) {
+            if (record._memory.use_count() == 1)
+                total_size += record._memory->size();
+        }
+    }
+    for (auto const& record : _no_reusable_pool) {
+        if (record.second._memory.use_count() == 1)
+            total_size += record.second._memory->size();
+    }
+    return total_size;
+}
+
+void memory_pool::release_unused_memory() {
+    {
+        auto itr = _non_padded_pool.begin();
+
+        while (itr != _non_padded_pool.end()) {
+            if (itr->second._memory.use_count() == 1) {
+                itr = _non_padded_pool.erase(itr);
+            } else {
+                itr++;
+            }
+        }
+    }
+
+    {
+        auto itr = _padded_pool.begin();
+
+        while (itr != _padded_pool.end()) {
+            auto& list = itr->second;
+            auto list_itr = list.begin();
+
+            while (list_itr != list.end()) {
+                if (list_itr->_memory.use_count() == 1) {
+                    list_itr = list.erase(list_itr);
+                } else {
+                    list_itr++;
+                }
+            }
+
+            if (list.empty()) {
+                itr = _padded_pool.erase(itr);
+            } else {
+                itr++;
+            }
+        }
+    }
+
+    {
+        auto itr = _no_reusable_pool.begin();
+
+        while (itr != _no_reusable_pool.end()) {
+            if (itr->second._memory.use_count() == 1) {
+                itr = _no_reusable_pool.erase(itr);
+            } else {
+                itr++;
+            }
+        }
+    }
+}
+
 void memory_pool::clear_pool_for_network(uint32_t network_id) {
     // free up _non_padded_pool for this network
     {
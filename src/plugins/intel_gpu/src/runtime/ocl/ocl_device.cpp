@@ -194,6 +194,8 @@ device_info init_device_info(const cl::Device& device) {
 
     info.supports_queue_families = extensions.find("cl_intel_command_queue_families ") != std::string::npos;
 
+    info.supports_command_buffers = extensions.find("cl_khr_command_buffer ") != std::string::npos;
+
     if (info.supports_intel_required_subgroup_size) {
         info.supported_simd_sizes = device.getInfo<CL_DEVICE_SUB_GROUP_SIZES_INTEL>();
     } else {
@@ -246,6 +248,19 @@ device_info init_device_info(const cl::Device& device) {
         info.num_ccs = std::max<uint32_t>(num_queues, info.num_ccs);
     }
 
+    info.num_tiles = 1;
+    cl_uint max_sub_devices = 0;
+    if (clGetDeviceInfo(device.get(), CL_DEVICE_PARTITION_MAX_SUB_DEVICES,
+                        sizeof(max_sub_devices), &max_sub_devices, nullptr) == CL_SUCCESS && max_sub_devices > 0) {
+        // Multi-tile parts expose the tiles as NUMA sub-devices, so the count is reported only
+        // when the device is partitionable by the NUMA affinity domain
+        const auto affinity_domain = device.getInfo<CL_DEVICE_PARTITION_AFFINITY_DOMAIN>();
+        constexpr cl_device_affinity_domain expected_flags =
+            CL_DEVICE_AFFINITY_DOMAIN_NUMA | CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE;
+        if ((affinity_domain & expected_flags) == expected_flags)
+            info.num_tiles = max_sub_devices;
+    }
+
     return info;
 }
 
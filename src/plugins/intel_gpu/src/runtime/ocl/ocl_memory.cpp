@@ -9,6 +9,7 @@
 #include "ocl_engine.hpp"
 #include "ocl_stream.hpp"
 #include "ocl_event.hpp"
+#include <cstring>
 #include <stdexcept>
 #include <vector>
 
@@ -106,6 +107,17 @@ event::ptr gpu_buffer::copy_from(stream& stream, const memory& other, bool block
 
 event::ptr gpu_buffer::copy_from(stream& stream, const void* host_ptr, bool blocking) {
     auto& cl_stream = downcast<ocl_stream>(stream);
+    if (blocking && size() >= staging_buffer_pool::min_staging_size) {
+        // Stage the upload through a host-pinned buffer: a write issued from pinned memory runs
+        // as direct DMA, while one from an arbitrary user pointer goes through driver-internal
+        // staging with extra synchronization
+        if (auto staging = _engine->get_staging_pool().acquire(size())) {
+            std::memcpy(staging->buffer_ptr(), host_ptr, size());
+            cl_stream.get_cl_queue().enqueueWriteBuffer(_buffer, CL_TRUE, 0, size(), staging->buffer_ptr(), nullptr, nullptr);
+            _engine->get_staging_pool().release(std::move(staging));
+            return stream.create_user_event(true);
+        }
+    }
     auto ev = blocking ? stream.create_user_event(true) : stream.create_base_event();
     cl::Event* ev_ocl = blocking ? nullptr : &downcast<ocl_event>(ev.get())->get();
     cl_stream.get_cl_queue().enqueueWriteBuffer(_buffer, blocking, 0, size(), host_ptr, nullptr, ev_ocl);
@@ -115,6 +127,14 @@ event::ptr gpu_buffer::copy_from(stream& stream, const void* host_ptr, bool bloc
 
 event::ptr gpu_buffer::copy_to(stream& stream, void* host_ptr, bool blocking) {
     auto& cl_stream = downcast<ocl_stream>(stream);
+    if (blocking && size() >= staging_buffer_pool::min_staging_size) {
+        if (auto staging = _engine->get_staging_pool().acquire(size())) {
+            cl_stream.get_cl_queue().enqueueReadBuffer(_buffer, CL_TRUE, 0, size(), staging->buffer_ptr(), nullptr, nullptr);
+            std::memcpy(host_ptr, staging->buffer_ptr(), size());
+            _engine->get_staging_pool().release(std::move(staging));
+            return stream.create_user_event(true);
+        }
+    }
     auto ev = blocking ? stream.create_user_event(true) : stream.create_base_event();
     cl::Event* ev_ocl = blocking ? nullptr : &downcast<ocl_event>(ev.get())->get();
     cl_stream.get_cl_queue().enqueueReadBuffer(_buffer, blocking, 0, size(), host_ptr, nullptr, ev_ocl);
@@ -184,8 +184,19 @@ void set_arguments_impl(ocl_kernel_type& kernel,
 sync_methods get_expected_sync_method(const ExecutionConfig& config) {
     auto profiling = config.get_property(ov::enable_profiling);
     auto queue_type = config.get_property(ov::intel_gpu::queue_type);
-    return profiling ? sync_methods::events : queue_type == QueueTypes::out_of_order ? sync_methods::barriers
-                                                                                     : sync_methods::none;
+    if (profiling)
+        return sync_methods::events;
+    if (queue_type == QueueTypes::out_of_order) {
+        // Per-primitive event dependencies let independent branches of the model overlap on the
+        // device, while a barrier orders the whole queue at every dependency point and thus
+        // serializes the execution. Barriers are kept as a debug fallback for triage.
+        GPU_DEBUG_GET_INSTANCE(debug_config);
+        GPU_DEBUG_IF(debug_config->ooq_barrier_sync) {
+            return sync_methods::barriers;
+        }
+        return sync_methods::events;
+    }
+    return sync_methods::none;
 }
 
 }  // namespace
@@ -193,7 +204,9 @@ sync_methods get_expected_sync_method(const ExecutionConfig& config) {
 ocl_stream::ocl_stream(const ocl_engine &engine, const ExecutionConfig& config)
     : stream(config.get_property(ov::intel_gpu::queue_type))
     , _engine(engine)
-    , sync_method(get_expected_sync_method(config)) {
+    , sync_method(get_expected_sync_method(config))
+    , _config(config)
+    , _supports_transfer_queue(config.get_property(ov::intel_gpu::queue_type) == QueueTypes::in_order) {
     auto context = engine.get_cl_context();
     auto device = engine.get_cl_device();
     ocl::command_queues_builder queue_builder;
@@ -276,10 +289,19 @@ event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
     std::vector<cl::Event> dep_events;
     std::vector<cl::Event>* dep_events_ptr = nullptr;
     if (sync_method == sync_methods::events) {
+        GPU_DEBUG_GET_INSTANCE(debug_config);
         for (auto& dep : deps) {
-            if (auto ocl_base_ev = std::dynamic_pointer_cast<ocl_base_event>(dep)) {
-                if (ocl_base_ev->get().get() != nullptr)
-                    dep_events.push_back(ocl_base_ev->get());
+            auto ocl_base_ev = std::dynamic_pointer_cast<ocl_base_event>(dep);
+            if (ocl_base_ev && ocl_base_ev->get().get() != nullptr) {
+                dep_events.push_back(ocl_base_ev->get());
+            } else {
+                // A dependency with no underlying cl event is dropped from the wait list, which
+                // is only correct when it is already completed (e.g. a set user event)
+                GPU_DEBUG_IF(debug_config->validate_event_coverage) {
+                    if (!dep->is_set())
+                        throw std::runtime_error("[CLDNN] Event coverage violation: " + args_desc.layerID +
+                                                 " depends on an incomplete event with no queue entry");
+                }
             }
         }
         dep_events_ptr = &dep_events;
@@ -348,6 +370,42 @@ event::ptr ocl_stream::create_base_event() {
     return std::make_shared<ocl_event>(ret_ev, ++_queue_counter);
 }
 
+stream& ocl_stream::get_transfer_stream() {
+    // An out-of-order queue can already overlap transfers with compute, and a user-supplied
+    // queue must receive every command, so a dedicated transfer queue is created only for
+    // plugin-owned in-order queues
+    if (!_supports_transfer_queue)
+        return *this;
+
+    if (!_transfer_stream) {
+        _transfer_stream = std::make_shared<ocl_stream>(_engine, _config);
+    }
+
+    return *_transfer_stream;
+}
+
+void ocl_stream::enqueue_dependencies(const std::vector<event::ptr>& events) {
+    if (events.empty())
+        return;
+
+    std::vector<cl::Event> clevents;
+    for (auto& ev : events) {
+        if (auto ocl_base_ev = dynamic_cast<ocl_base_event*>(ev.get())) {
+            if (ocl_base_ev->get().get() != nullptr)
+                clevents.push_back(ocl_base_ev->get());
+        }
+    }
+
+    if (clevents.empty())
+        return;
+
+    try {
+        _command_queue.enqueueBarrierWithWaitList(&clevents, nullptr);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+}
+
 void ocl_stream::flush() const { get_cl_queue().flush(); }
 void ocl_stream::finish() const { get_cl_queue().finish(); }
 
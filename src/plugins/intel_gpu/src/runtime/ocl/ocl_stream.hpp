@@ -58,7 +58,10 @@ public:
         , _queue_counter(other._queue_counter.load())
         , _last_barrier(other._last_barrier.load())
         , _last_barrier_ev(other._last_barrier_ev)
-        , sync_method(other.sync_method) {}
+        , sync_method(other.sync_method)
+        , _config(other._config)
+        , _supports_transfer_queue(other._supports_transfer_queue)
+        , _transfer_stream(other._transfer_stream) {}
 
     ~ocl_stream() = default;
 
@@ -77,6 +80,8 @@ public:
     void enqueue_barrier() override;
     event::ptr create_user_event(bool set) override;
     event::ptr create_base_event() override;
+    stream& get_transfer_stream() override;
+    void enqueue_dependencies(const std::vector<event::ptr>& events) override;
 
     const cl::UsmHelper& get_usm_helper() const { return _engine.get_usm_helper(); }
 
@@ -97,6 +102,12 @@ private:
 
     sync_methods sync_method;
 
+    // Second in-order queue used for host<->device transfers; created lazily and only for
+    // plugin-owned in-order queues, so a user-supplied queue keeps all commands for itself
+    ExecutionConfig _config;
+    bool _supports_transfer_queue = false;
+    std::shared_ptr<ocl_stream> _transfer_stream = nullptr;
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
     std::shared_ptr<dnnl::stream> _onednn_stream = nullptr;
 #endif
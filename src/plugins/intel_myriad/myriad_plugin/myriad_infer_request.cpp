@@ -241,6 +241,28 @@ void MyriadInferRequest::InferAsync() {
         return foundBlob;
     };
 
+    // For networks with only one input
+    if (_inputInfo.offset.size() == 1 && !_inputs.empty()) {
+        const auto& it = _inputs.begin();
+        const auto& name = (*it).first;
+        const auto& blob = (*it).second;
+
+        const auto vpuLayout = getNetInputInfo(name)->second->getTensorDesc().getLayout();
+        const bool isDynamic = inputInfo.offset.find(name + "_real_shape") != inputInfo.offset.end();
+
+        if (_preProcData.find(name) == _preProcData.end() && !isDynamic &&
+            getOffset(name) == 0 && blob->byteSize() == _inputInfo.totalSize &&
+            blob->getTensorDesc().getLayout() == vpuLayout &&
+            !needsTypeConvert(blob->getTensorDesc().getPrecision())) {
+            // The frame is already laid out the way the device expects it, so hand the user
+            // buffer to the FIFO directly: the USB transfer starts right away instead of
+            // waiting for a staging copy of the whole frame.
+            _executor->queueInference(_graphDesc, blob->buffer().as<uint8_t*>(),
+                                    _inputInfo.totalSize, nullptr, 0);
+            return;
+        }
+    }
+
     for (const auto& input : _inputs) {
         const auto& name = input.first;
         const auto& blob = input.second;
@@ -93,6 +93,12 @@ vector<runtime::PerformanceCounter> runtime::Executable::get_performance_data()
     return vector<PerformanceCounter>();
 }
 
+void runtime::Executable::set_output_hashing(bool /* enable */) {}
+
+map<shared_ptr<const Node>, uint64_t> runtime::Executable::get_output_hashes() const {
+    return map<shared_ptr<const Node>, uint64_t>();
+}
+
 void runtime::Executable::save(std::ostream& /* output_stream */) {
     throw runtime_error("save operation unimplemented.");
 }
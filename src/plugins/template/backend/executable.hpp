@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <memory>
 
 #include "ngraph/function.hpp"
@@ -40,6 +42,13 @@ public:
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
 
+    /// \brief Enable or disable recording of a hash of every op output computed during call()
+    virtual void set_output_hashing(bool enable);
+
+    /// \brief Collect the op output hashes recorded during the last call().
+    /// \returns Map of node to the hash of the raw bytes of its output tensors.
+    virtual std::map<std::shared_ptr<const Node>, uint64_t> get_output_hashes() const;
+
     /// \brief Validates a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
@@ -169,6 +169,9 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         if (m_nan_check_enabled) {
             perform_nan_check(op_outputs, op.get());
         }
+        if (m_output_hashing_enabled) {
+            m_output_hash_map[op] = hash_output_data(op_outputs);
+        }
     }
 
     return true;
@@ -182,6 +185,28 @@ vector<runtime::PerformanceCounter> runtime::interpreter::INTExecutable::get_per
     return rc;
 }
 
+void runtime::interpreter::INTExecutable::set_output_hashing(bool enable) {
+    m_output_hashing_enabled = enable;
+}
+
+map<shared_ptr<const Node>, uint64_t> runtime::interpreter::INTExecutable::get_output_hashes() const {
+    return m_output_hash_map;
+}
+
+uint64_t runtime::interpreter::INTExecutable::hash_output_data(const vector<shared_ptr<HostTensor>>& tensors) {
+    // FNV-1a over the raw bytes of all output tensors; cheap enough to run per op
+    // and stable across runs, which is what the divergence triage workflow needs
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const shared_ptr<HostTensor>& tensor : tensors) {
+        const uint8_t* data = static_cast<const uint8_t*>(tensor->get_data_ptr());
+        for (size_t i = 0; i < tensor->get_size_in_bytes(); i++) {
+            hash ^= data[i];
+            hash *= 0x100000001b3ULL;
+        }
+    }
+    return hash;
+}
+
 void runtime::interpreter::INTExecutable::perform_nan_check(const vector<shared_ptr<HostTensor>>& tensors,
                                                             const Node* op) {
     size_t arg_number = 1;
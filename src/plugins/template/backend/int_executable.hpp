@@ -43,6 +43,10 @@ public:
 
     std::vector<PerformanceCounter> get_performance_data() const override;
 
+    void set_output_hashing(bool enable) override;
+
+    std::map<std::shared_ptr<const Node>, uint64_t> get_output_hashes() const override;
+
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
     std::shared_ptr<runtime::Tensor> create_output_tensor(size_t output_index) override;
@@ -62,6 +66,8 @@ protected:
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
     bool m_performance_counters_enabled = false;
+    bool m_output_hashing_enabled = false;
+    std::map<std::shared_ptr<const Node>, uint64_t> m_output_hash_map;
     std::shared_ptr<Function> m_function;
     NGRAPH_SUPPRESS_DEPRECATED_START
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
@@ -69,6 +75,7 @@ protected:
     std::vector<std::shared_ptr<Node>> m_nodes;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&, const Node* op = nullptr);
+    static uint64_t hash_output_data(const std::vector<std::shared_ptr<HostTensor>>& tensors);
     struct InfoForNMS5 {
         int64_t max_output_boxes_per_class;
         float iou_threshold;
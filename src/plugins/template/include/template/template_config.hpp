@@ -51,6 +51,13 @@ namespace TemplateConfigParams {
  */
 DECLARE_TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS);
 
+/**
+ * @brief Enables recording a hash of every operation output computed during inference.
+ * The accepted values are YES/NO. The hashes are reported via GetPerformanceCounts()
+ * and can be compared against other devices to locate the first diverging operation.
+ */
+DECLARE_TEMPLATE_CONFIG_KEY(HASH_OUTPUTS);
+
 
 }  // namespace TemplateConfigParams
 }  // namespace InferenceEngine
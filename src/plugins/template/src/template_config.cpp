@@ -33,6 +33,8 @@ Configuration::Configuration(const ConfigMap& config, const Configuration& defau
             }
         } else if (CONFIG_KEY(PERF_COUNT) == key) {
             perfCount = (CONFIG_VALUE(YES) == value);
+        } else if (TEMPLATE_CONFIG_KEY(HASH_OUTPUTS) == key) {
+            hashOutputs = (CONFIG_VALUE(YES) == value);
         } else if (ov::hint::performance_mode == key) {
             std::stringstream strm{value};
             strm >> performance_mode;
@@ -51,6 +53,8 @@ InferenceEngine::Parameter Configuration::Get(const std::string& name) const {
         return {std::to_string(deviceId)};
     } else if (name == CONFIG_KEY(PERF_COUNT)) {
         return {perfCount};
+    } else if (name == TEMPLATE_CONFIG_KEY(HASH_OUTPUTS)) {
+        return {hashOutputs};
     } else if (name == TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS) || name == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
         return {std::to_string(_streamsExecutorConfig._streams)};
     } else if (name == CONFIG_KEY(CPU_BIND_THREAD)) {
@@ -32,6 +32,7 @@ struct Configuration {
 
     int deviceId = 0;
     bool perfCount = true;
+    bool hashOutputs = false;
     InferenceEngine::IStreamsExecutor::Config _streamsExecutorConfig;
     ov::hint::PerformanceMode performance_mode = ov::hint::PerformanceMode::UNDEFINED;
 };
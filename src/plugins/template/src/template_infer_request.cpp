@@ -64,7 +64,9 @@ void TemplateInferRequest::createInferRequest() {
                               "_WaitPipline"),
     };
 
-    _executable = _executableNetwork->_plugin->_backend->compile(_executableNetwork->_function);
+    _executable = _executableNetwork->_plugin->_backend->compile(_executableNetwork->_function,
+                                                                 _executableNetwork->_cfg.perfCount);
+    _executable->set_output_hashing(_executableNetwork->_cfg.hashOutputs);
 
     allocateDeviceBuffers();
     allocateBlobs();
@@ -578,6 +580,28 @@ std::map<std::string, InferenceEngineProfileInfo> TemplateInferRequest::GetPerfo
     perfMap["4. output transfer from a device"] = info;
     info.cpu_uSec = info.realTime_uSec = static_cast<long long>(_durations[Postprocess].count());
     perfMap["5. output postprocessing"] = info;
+
+    // Per-operation counters collected by the interpreter backend. The output hash, when
+    // recording is enabled, is reported via exec_type so it is visible in the standard
+    // profiling output without extending the API
+    const auto outputHashes = _executable->get_output_hashes();
+    unsigned execIndex = 0;
+    for (const auto& counter : _executable->get_performance_data()) {
+        const auto& node = counter.get_node();
+        InferenceEngineProfileInfo opInfo = {};
+        opInfo.status = InferenceEngineProfileInfo::EXECUTED;
+        opInfo.execution_index = execIndex++;
+        opInfo.cpu_uSec = opInfo.realTime_uSec = static_cast<long long>(counter.total_microseconds());
+        snprintf(opInfo.layer_type, sizeof(opInfo.layer_type), "%s", node->get_type_name());
+        auto hashIt = outputHashes.find(node);
+        if (hashIt != outputHashes.end()) {
+            snprintf(opInfo.exec_type,
+                     sizeof(opInfo.exec_type),
+                     "hash:%016llx",
+                     static_cast<unsigned long long>(hashIt->second));
+        }
+        perfMap[node->get_friendly_name()] = opInfo;
+    }
     return perfMap;
 }
 // ! [infer_request:get_performance_counts]
@@ -39,6 +39,14 @@ def parse_and_check_command_line():
     if args.report_type == "average_counters" and MULTI_DEVICE_NAME in args.target_device:
         raise Exception("only detailed_counters report type is supported for MULTI device")
 
+    if args.multi_model:
+        if args.path_to_model:
+            raise Exception("-m and -mm options cannot be used together")
+        return args, False
+    if not args.path_to_model:
+        parser.print_help()
+        raise Exception("The -m option is required, unless -mm is used")
+
     _, ext = os.path.splitext(args.path_to_model)
     is_network_compiled = True if ext == BLOB_EXTENSION else False
     is_precisiton_set = not (args.input_precision == "" and args.output_precision == "" and args.input_output_precision == "")
@@ -58,6 +66,10 @@ def main():
         logger.info("Parsing input parameters")
         args, is_network_compiled = parse_and_check_command_line()
 
+        if args.multi_model:
+            from openvino.tools.benchmark.multi_model import run_multi_model
+            return run_multi_model(args)
+
         command_line_arguments = get_command_line_arguments(sys.argv)
         if args.report_type:
           statistics = StatisticsReport(StatisticsReport.Config(args.report_type, args.report_folder))
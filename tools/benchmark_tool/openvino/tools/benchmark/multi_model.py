@@ -0,0 +1,141 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import threading
+from datetime import datetime
+
+from openvino.runtime import Core, AsyncInferQueue, Tensor, set_batch
+
+from .benchmark import percentile
+from .utils.logging import logger
+from .utils.utils import get_duration_seconds
+
+
+class ModelRun:
+    """Per-model state and results of a co-scheduling run."""
+    def __init__(self, path: str, nstreams, batch):
+        self.path = path
+        self.nstreams = nstreams
+        self.batch = batch
+        self.compiled_model = None
+        self.infer_queue = None
+        self.times = []
+        self.iterations = 0
+        self.duration_sec = 0.0
+
+
+def parse_per_model_values(value: str, num_models: int, name: str) -> list:
+    """Split a comma-separated per-model option, one (possibly empty) value per model."""
+    if not value:
+        return [None] * num_models
+    items = value.split(',')
+    if len(items) != num_models:
+        raise Exception(f"{name} must provide one value per model: "
+                        f"got {len(items)} values for {num_models} models")
+    return [int(item) if item else None for item in items]
+
+
+def fill_random_inputs(infer_queue, compiled_model):
+    # The co-scheduling mode measures interference, not accuracy, so every request
+    # gets its own plain tensors and the loops run in inference-only fashion.
+    for request in infer_queue:
+        for port in compiled_model.inputs:
+            request.set_tensor(port, Tensor(port.element_type, port.shape))
+
+
+def model_worker(run: ModelRun, niter, duration_seconds, start_barrier):
+    # Mirrors Benchmark.async_inference_only, but runs on its own thread per model, so
+    # the requests of all models compete for the device exactly as they would in production.
+    infer_queue = run.infer_queue
+    nireq = len(infer_queue)
+    in_fly = set()
+    start_barrier.wait()
+    exec_time = 0
+    iteration = 0
+    start_time = datetime.utcnow()
+    while (niter and iteration < niter) or \
+          (duration_seconds and exec_time < duration_seconds) or \
+          (iteration % nireq):
+        idle_id = infer_queue.get_idle_request_id()
+        if idle_id in in_fly:
+            run.times.append(infer_queue[idle_id].latency)
+        else:
+            in_fly.add(idle_id)
+        infer_queue.start_async()
+        iteration += 1
+
+        exec_time = (datetime.utcnow() - start_time).total_seconds()
+    infer_queue.wait_all()
+    run.duration_sec = (datetime.utcnow() - start_time).total_seconds()
+    for infer_request_id in in_fly:
+        run.times.append(infer_queue[infer_request_id].latency)
+    run.times.sort()
+    run.iterations = iteration
+
+
+def print_latency_block(prefix: str, times: list, latency_percentile: int):
+    logger.info(f'{prefix}    Median:     {percentile(times, latency_percentile):.2f} ms')
+    logger.info(f'{prefix}    Average:    {sum(times) / len(times):.2f} ms')
+    logger.info(f'{prefix}    Min:        {times[0]:.2f} ms')
+    logger.info(f'{prefix}    Max:        {times[-1]:.2f} ms')
+
+
+def run_multi_model(args):
+    if args.api_type == 'sync':
+        raise Exception("The co-scheduling mode (-mm) supports only the async API")
+
+    num_models = len(args.multi_model)
+    nstreams = parse_per_model_values(args.multi_model_nstreams, num_models, "-mm_nstreams")
+    batches = parse_per_model_values(args.multi_model_batch, num_models, "-mm_batch")
+    duration_seconds = get_duration_seconds(args.time, args.number_iterations, args.target_device)
+
+    core = Core()
+    runs = []
+    for path, model_nstreams, model_batch in zip(args.multi_model, nstreams, batches):
+        run = ModelRun(path, model_nstreams, model_batch)
+        model = core.read_model(path)
+        if model_batch:
+            set_batch(model, model_batch)
+        device_config = {}
+        if model_nstreams:
+            device_config['NUM_STREAMS'] = str(model_nstreams)
+        logger.info(f"Compiling model {path} "
+                    f"(streams: {model_nstreams if model_nstreams else 'default'}, "
+                    f"batch: {model_batch if model_batch else 'default'})")
+        run.compiled_model = core.compile_model(model, args.target_device, device_config)
+        run.infer_queue = AsyncInferQueue(run.compiled_model, args.number_infer_requests)
+        fill_random_inputs(run.infer_queue, run.compiled_model)
+        runs.append(run)
+
+    # first inference apart from the measurement, so no model pays the warm-up of another
+    for run in runs:
+        run.infer_queue.start_async()
+        run.infer_queue.wait_all()
+
+    logger.info(f"Running the {num_models} models concurrently for "
+                f"{duration_seconds if duration_seconds else 'niter-bound'} seconds")
+    start_barrier = threading.Barrier(num_models)
+    workers = [threading.Thread(target=model_worker,
+                                args=(run, args.number_iterations, duration_seconds, start_barrier))
+               for run in runs]
+    for worker in workers:
+        worker.start()
+    for worker in workers:
+        worker.join()
+
+    combined_times = sorted(time for run in runs for time in run.times)
+    combined_fps = 0.0
+    for index, run in enumerate(runs):
+        batch_size = run.batch if run.batch else 1
+        fps = batch_size * run.iterations / run.duration_sec
+        combined_fps += fps
+        logger.info(f'[model {index}] {run.path}')
+        logger.info(f'[model {index}] Count:      {run.iterations} iterations')
+        logger.info(f'[model {index}] Duration:   {run.duration_sec * 1000:.2f} ms')
+        logger.info(f'[model {index}] Latency:')
+        print_latency_block(f'[model {index}]', run.times, args.latency_percentile)
+        logger.info(f'[model {index}] Throughput: {fps:.2f} FPS')
+    logger.info('[combined] Latency:')
+    print_latency_block('[combined]', combined_times, args.latency_percentile)
+    logger.info(f'[combined] Throughput: {combined_fps:.2f} FPS')
+    return 0
@@ -43,9 +43,20 @@ def parse_args():
                            'Path to a folder with images and/or binaries or to specific image or binary file.'
                            'It is also allowed to map files to model inputs: '
                            'input_1:file_1/dir1,file_2/dir2,input_4:file_4/dir4 input_2:file_3/dir3')
-    args.add_argument('-m', '--path_to_model', type=str, required=True,
-                      help='Required. Path to an .xml/.onnx file with a trained model or '
+    args.add_argument('-m', '--path_to_model', type=str, required=False, default='',
+                      help='Required, unless -mm is used. Path to an .xml/.onnx file with a trained model or '
                            'to a .blob file with a trained compiled model.')
+    args.add_argument('-mm', '--multi_model', type=str, required=False, default=None, nargs='+',
+                      help='Optional. Co-scheduling mode: paths to several .xml/.onnx model files that are '
+                           'benchmarked concurrently on the target device, to measure the interference between '
+                           'models sharing it. Reports combined and per-model latency percentiles. '
+                           'Only the async API is supported in this mode.')
+    args.add_argument('-mm_nstreams', '--multi_model_nstreams', type=str, required=False, default=None,
+                      help='Optional. Comma-separated per-model numbers of streams for the co-scheduling mode, '
+                           'one value per model passed to -mm. An empty value keeps the device default.')
+    args.add_argument('-mm_batch', '--multi_model_batch', type=str, required=False, default=None,
+                      help='Optional. Comma-separated per-model batch sizes for the co-scheduling mode, '
+                           'one value per model passed to -mm. An empty value keeps the model batch size.')
     args.add_argument('-d', '--target_device', type=str, required=False, default='CPU',
                       help='Optional. Specify a target device to infer on (the list of available devices is shown below). '
                            'Default value is CPU. Use \'-d HETERO:<comma separated devices list>\' format to specify HETERO plugin. '
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <algorithm>
 #include <chrono>
+#include <sstream>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -14,6 +15,7 @@
 
 #include <gflags/gflags.h>
 
+#include "fat_blob.hpp"
 #include "inference_engine.hpp"
 #include "openvino/openvino.hpp"
 #include <vpu/private_plugin_config.hpp>
@@ -76,6 +78,15 @@ static constexpr char ioml_message[] =
 "                                             Notice that quotes are required.\n"
 "                                             Overwrites layout from il and ol options for specified layers.";
 
+static constexpr char targets_message[] =
+                                             "Optional. Compiles the model for several target configurations into one fat blob.\n"
+"                                             Semicolon-separated list of \"<device>[(<architecture>)][@<config_file>]\" entries,\n"
+"                                             e.g. -targets \"CPU;GPU(GPU.0.0)@gpu.conf;GPU(GPU.12.0)@gpu.conf\".\n"
+"                                             The architecture selector is matched against the DEVICE_ARCHITECTURE metric\n"
+"                                             at import time; an entry without it matches any architecture of its device.\n"
+"                                             ov::Core::import_model picks the section compiled for the detected hardware.\n"
+"                                             Cannot be combined with -d or -ov_api_1_0.";
+
 static constexpr char api1_message[] =
                                              "Optional. Compile model to legacy format for usage in Inference Engine API,\n"
 "                                             by default compiles to OV 2.0 API";
@@ -111,6 +122,7 @@ DEFINE_string(iol, "", iol_message);
 DEFINE_string(iml, "", inputs_model_layout_message);
 DEFINE_string(oml, "", outputs_model_layout_message);
 DEFINE_string(ioml, "", ioml_message);
+DEFINE_string(targets, "", targets_message);
 DEFINE_bool(ov_api_1_0, false, api1_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
@@ -589,6 +601,7 @@ static void showUsage() {
     std::cout << "    -oml                         <value>     "   << outputs_model_layout_message << std::endl;
     std::cout << "    -ioml                       \"<value>\"    "   << ioml_message               << std::endl;
     std::cout << "    -ov_api_1_0                              "   << api1_message                 << std::endl;
+    std::cout << "    -targets                    \"<value>\"    "   << targets_message            << std::endl;
     std::cout                                                                                      << std::endl;
     std::cout << " MYRIAD-specific options:                    "                                   << std::endl;
     std::cout << "      -VPU_NUMBER_OF_SHAVES      <value>     "   << number_of_shaves_message     << std::endl;
@@ -609,10 +622,18 @@ static bool parseCommandLine(int* argc, char*** argv) {
         throw std::invalid_argument("Path to model xml file is required");
     }
 
-    if (FLAGS_d.empty()) {
+    if (FLAGS_d.empty() && FLAGS_targets.empty()) {
         throw std::invalid_argument("Target device name is required");
     }
 
+    if (!FLAGS_targets.empty() && !FLAGS_d.empty()) {
+        throw std::invalid_argument("-d and -targets options cannot be used together");
+    }
+
+    if (!FLAGS_targets.empty() && FLAGS_ov_api_1_0) {
+        throw std::invalid_argument("Fat blobs are supported for the OV 2.0 API only");
+    }
+
     if (1 < *argc) {
         std::stringstream message;
         message << "Unknown arguments: ";
@@ -628,10 +649,10 @@ static bool parseCommandLine(int* argc, char*** argv) {
     return true;
 }
 
-static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
+static std::map<std::string, std::string> parseConfigFile(const std::string& path, char comment = '#') {
     std::map<std::string, std::string> config;
 
-    std::ifstream file(FLAGS_c);
+    std::ifstream file(path);
     if (file.is_open()) {
         std::string option;
         while (std::getline(file, option)) {
@@ -652,7 +673,7 @@ static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
 
 static std::map<std::string, std::string> configure() {
     const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
-    auto config = parseConfigFile();
+    auto config = parseConfigFile(FLAGS_c);
 
     if (isMYRIAD) {
         if (!FLAGS_VPU_NUMBER_OF_SHAVES.empty()) {
@@ -671,6 +692,44 @@ static std::map<std::string, std::string> configure() {
     return config;
 }
 
+struct FatTarget {
+    std::string device;
+    std::string architecture;
+    std::string configFile;
+};
+
+static std::vector<FatTarget> parseFatTargets(const std::string& targets) {
+    std::vector<FatTarget> parsed;
+    for (auto&& spec : splitStringList(targets, ';')) {
+        FatTarget target;
+        auto rest = spec;
+        const auto configPos = rest.find('@');
+        if (configPos != std::string::npos) {
+            target.configFile = rest.substr(configPos + 1);
+            rest = rest.substr(0, configPos);
+        }
+        const auto archPos = rest.find('(');
+        if (archPos != std::string::npos) {
+            if (rest.empty() || rest.back() != ')') {
+                throw std::invalid_argument("Invalid target " + spec +
+                                            ". Expected <device>[(<architecture>)][@<config_file>]");
+            }
+            target.architecture = rest.substr(archPos + 1, rest.size() - archPos - 2);
+            rest = rest.substr(0, archPos);
+        }
+        target.device = rest;
+        if (target.device.empty()) {
+            throw std::invalid_argument("Invalid target " + spec +
+                                        ". Expected <device>[(<architecture>)][@<config_file>]");
+        }
+        parsed.push_back(std::move(target));
+    }
+    if (parsed.empty()) {
+        throw std::invalid_argument("-targets list is empty");
+    }
+    return parsed;
+}
+
 bool isFP16(InferenceEngine::Precision precision) {
     return precision == InferenceEngine::Precision::FP16;
 }
@@ -777,6 +836,54 @@ int main(int argc, char* argv[]) {
             } else {
                 executableNetwork.Export(outputFile);
             }
+        } else if (!FLAGS_targets.empty()) {
+            ov::Core core;
+
+            std::vector<std::string> deviceNames;
+            std::vector<std::string> architectures;
+            std::vector<std::string> blobs;
+            for (auto&& target : parseFatTargets(FLAGS_targets)) {
+                std::cout << "Compiling for target " << target.device;
+                if (!target.architecture.empty()) {
+                    std::cout << " (" << target.architecture << ")";
+                }
+                std::cout << std::endl;
+
+                if (!FLAGS_log_level.empty()) {
+                    ov::log::Level level;
+                    std::stringstream{FLAGS_log_level} >> level;
+                    core.set_property(target.device, ov::log::level(level));
+                }
+
+                // every target gets a freshly read model, so the pre/post processing
+                // built for one target does not leak into the next one
+                auto model = core.read_model(FLAGS_m);
+                configurePrePostProcessing(model, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol, FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
+
+                auto configs = parseConfigFile(target.configFile.empty() ? FLAGS_c : target.configFile);
+                auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+                auto compiledModel = core.compile_model(model, target.device, {configs.begin(), configs.end()});
+                loadNetworkTimeElapsed += std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+
+                std::stringstream blobStream;
+                compiledModel.export_model(blobStream);
+                deviceNames.push_back(target.device);
+                architectures.push_back(target.architecture);
+                blobs.push_back(blobStream.str());
+            }
+
+            std::string outputName = FLAGS_o;
+            if (outputName.empty()) {
+                outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
+            }
+
+            std::ofstream outputFile{outputName, std::ios::out | std::ios::binary};
+            if (!outputFile.is_open()) {
+                std::cout << "Output file " << outputName << " can't be opened for writing" << std::endl;
+                return EXIT_FAILURE;
+            } else {
+                ov::writeFatBlob(outputFile, deviceNames, architectures, blobs);
+            }
         } else {
             ov::Core core;
             if (!FLAGS_log_level.empty()) {
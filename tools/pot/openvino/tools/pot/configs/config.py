@@ -365,6 +365,8 @@ class Config(Dict):
                 'dump_intermediate_model', False)
             algo['params']['inplace_statistics'] = self['compression'].get(
                 'inplace_statistics', True)
+            algo['params']['statistics_cache_dir'] = self['compression'].get(
+                'statistics_cache_dir', None)
 
     def _configure_logger_params(self):
         """ Creates a log directory name based on model and algo configurations
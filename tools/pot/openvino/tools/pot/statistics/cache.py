@@ -0,0 +1,83 @@
+# Copyright (C) 2020-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import hashlib
+import os
+import pickle
+
+from ..graph.model_utils import get_node_by_name
+from ..graph.node_utils import get_weights_for_node
+from ..utils.logger import get_logger
+
+logger = get_logger(__name__)
+
+
+class StatisticsCache:
+    """ File-backed cache of per-layer statistics for incremental re-calibration.
+
+    Statistics of a layer are keyed by a fingerprint of the layer itself (type, name,
+    weight values) and of the requested statistics, so a model refresh only pays the
+    collection cost for the layers whose weights actually changed. Activation statistics
+    also depend on the layers upstream and on the calibration dataset; the cache assumes
+    both are stable between refreshes, which is why the mode is opt-in
+    (the `statistics_cache_dir` compression option).
+    """
+
+    def __init__(self, cache_dir):
+        self._cache_dir = cache_dir
+        os.makedirs(cache_dir, exist_ok=True)
+        self.hits = 0
+        self.misses = 0
+
+    def layer_key(self, model, layer_name, layer_stats_layout, num_samples):
+        """ Computes the cache key of one layer of the registered statistics layout
+        :param model: CompressedModel instance the statistics are collected for
+        :param layer_name: layout key, a node name or a (node name, port) tuple
+        :param layer_stats_layout: dict of stats collection functions of this layer
+        :param num_samples: number of calibration samples the statistics are drawn from
+        :return hex digest identifying the layer contents and the requested statistics
+        """
+        node_name = layer_name[0] if isinstance(layer_name, tuple) else layer_name
+        fingerprint = hashlib.sha256()
+        fingerprint.update(repr(layer_name).encode())
+        fingerprint.update(repr(sorted(str(stat_name) for stat_name in layer_stats_layout)).encode())
+        fingerprint.update(str(num_samples).encode())
+        node = get_node_by_name(model, node_name)
+        if node is not None:
+            fingerprint.update(node.type.encode())
+            weights = None
+            try:
+                weights = get_weights_for_node(node)
+            except Exception:  # pylint: disable=broad-except
+                pass
+            if weights is not None and weights.has_valid('value'):
+                fingerprint.update(weights.value.tobytes())
+        return fingerprint.hexdigest()
+
+    def load(self, key):
+        """ Returns the cached statistics of a layer or None when the key is not cached """
+        path = self._stats_path(key)
+        if not os.path.isfile(path):
+            self.misses += 1
+            return None
+        try:
+            with open(path, 'rb') as file:
+                stats = pickle.load(file)
+        except (OSError, pickle.UnpicklingError):
+            logger.debug('Removing a corrupted statistics cache entry %s', path)
+            os.remove(path)
+            self.misses += 1
+            return None
+        self.hits += 1
+        return stats
+
+    def store(self, key, stats):
+        """ Stores the collected statistics of a layer """
+        path = self._stats_path(key)
+        tmp_path = path + '.tmp'
+        with open(tmp_path, 'wb') as file:
+            pickle.dump(stats, file)
+        os.replace(tmp_path, path)
+
+    def _stats_path(self, key):
+        return os.path.join(self._cache_dir, key + '.stats')
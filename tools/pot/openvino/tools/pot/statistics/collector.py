@@ -3,6 +3,7 @@
 
 from copy import copy
 
+from .cache import StatisticsCache
 from .utils import merge_algos_by_samplers, merge_stats_by_algo_names
 from ..samplers.sampler import Sampler
 from ..utils.logger import get_logger
@@ -16,8 +17,10 @@ class StatisticsCollector:
     def accumulated_stats_by_algo(self):
         return getattr(self, '_accumulated_stats_by_algo')
 
-    def __init__(self, engine):
+    def __init__(self, engine, cache=None):
         self._engine = engine
+        self._cache = cache
+        self._cache_keys = {}
         self._layout_by_algo = {}
         self._accumulated_stats_by_algo = {}
         self._names_map_by_algo = {}
@@ -59,6 +62,9 @@ class StatisticsCollector:
 
         self._engine.set_model(model)
 
+        if self._cache is not None:
+            self._preload_cached_statistics(model)
+
         predict_iterations = merge_algos_by_samplers(self._samplers)
 
         def return_stat_names(algo_name, stats, stat_aliases):
@@ -72,11 +78,19 @@ class StatisticsCollector:
         for algo_names, sampler in predict_iterations:
             combined_stats, stat_aliases_ = merge_stats_by_algo_names(
                 algo_names, self._layout_by_algo)
+            if not combined_stats:
+                # all layers of these algorithms were taken from the statistics cache
+                for name in algo_names:
+                    self._add_stats_to_accumulated(name, {})
+                logger.update_progress(len(sampler))
+                continue
             _, stats_ = self._engine.predict(combined_stats, sampler, stat_aliases_)
 
             for name in algo_names:
-                self._add_stats_to_accumulated(
-                    name, return_stat_names(name, stats_, stat_aliases_))
+                algo_stats = return_stat_names(name, stats_, stat_aliases_)
+                self._add_stats_to_accumulated(name, algo_stats)
+                if self._cache is not None:
+                    self._store_collected_statistics(name, algo_stats)
 
             logger.update_progress(len(sampler))
 
@@ -96,6 +110,30 @@ class StatisticsCollector:
 
         return self._accumulated_stats_by_algo[algo_name]
 
+    def _preload_cached_statistics(self, model):
+        """
+        Loads cached statistics and prunes their layers from the registered layouts,
+        so inference only collects statistics for the layers whose cache entry is
+        missing or stale (e.g. the layer weights changed since the last calibration).
+        """
+        self._cache_keys = {}
+        for algo_name, stats_layout in self._layout_by_algo.items():
+            num_samples = len(self._samplers[algo_name])
+            for layer_name in list(stats_layout):
+                key = self._cache.layer_key(model, layer_name, stats_layout[layer_name], num_samples)
+                cached_stats = self._cache.load(key)
+                if cached_stats is not None:
+                    self._add_stats_to_accumulated(algo_name, {layer_name: cached_stats})
+                    del stats_layout[layer_name]
+                else:
+                    self._cache_keys[(algo_name, layer_name)] = key
+
+    def _store_collected_statistics(self, algo_name, algo_stats):
+        for layer_name, layer_stats in algo_stats.items():
+            key = self._cache_keys.get((algo_name, layer_name))
+            if key is not None:
+                self._cache.store(key, layer_stats)
+
     def _add_stats_to_accumulated(self, algo_name, stats):
         """
         Adding new_computed statistics to algorithm with already stored accumulated_stats.
@@ -134,10 +172,16 @@ def collect_statistics(engine, model, algo_seq):
 
     logger.info('Start computing statistics for algorithms : {}'.
                 format(','.join([algo.name for algo in algo_seq])))
-    stats_collector = StatisticsCollector(engine)
+    cache_dir = next((algo.config.get('statistics_cache_dir') for algo in algo_seq
+                      if algo.config.get('statistics_cache_dir')), None)
+    cache = StatisticsCache(cache_dir) if cache_dir else None
+    stats_collector = StatisticsCollector(engine, cache)
 
     for algo in algo_seq:
         algo.register_statistics(model, stats_collector)
 
     stats_collector.compute_statistics(model)
+    if cache is not None:
+        logger.info('Statistics cache: {} layers reused, {} layers collected'.
+                    format(cache.hits, cache.misses))
     logger.info('Computing statistics finished')
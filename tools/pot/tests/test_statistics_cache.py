@@ -0,0 +1,39 @@
+# Copyright (C) 2020-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+
+from openvino.tools.pot.statistics.cache import StatisticsCache
+
+
+def test_store_load_round_trip(tmp_path):
+    cache = StatisticsCache(str(tmp_path))
+    stats = {'min_per_tensor': [np.float32(-1.5)], 'max_per_tensor': [np.float32(3.25)]}
+
+    cache.store('some_key', stats)
+    loaded = cache.load('some_key')
+
+    assert loaded.keys() == stats.keys()
+    assert loaded['min_per_tensor'] == stats['min_per_tensor']
+    assert loaded['max_per_tensor'] == stats['max_per_tensor']
+    assert cache.hits == 1
+    assert cache.misses == 0
+
+
+def test_missing_key_is_a_miss(tmp_path):
+    cache = StatisticsCache(str(tmp_path))
+
+    assert cache.load('unknown_key') is None
+    assert cache.hits == 0
+    assert cache.misses == 1
+
+
+def test_corrupted_entry_is_dropped(tmp_path):
+    cache = StatisticsCache(str(tmp_path))
+    cache.store('some_key', {'min_per_tensor': [0.0]})
+    entry = next(tmp_path.iterdir())
+    entry.write_bytes(b'not a pickle')
+
+    assert cache.load('some_key') is None
+    assert not entry.exists()
+    assert cache.misses == 1